@@ -1830,6 +1830,14 @@ ETEXI
         .cmd = hmp_panda_list_plugins,
     },
 
+    {
+        .name       = "panda_profile",
+        .args_type  = "action:s?",
+        .params     = "[on|off|reset]",
+        .help       = "show, enable, disable or reset panda callback profiling",
+        .cmd = hmp_panda_profile,
+    },
+
     {
         .name       = "end_replay",
         .args_type  = "",
@@ -292,11 +292,22 @@ struct TranslationBlock {
     struct TranslationBlock* llvm_tb_next[2];
 #endif
 
+    /* PANDA: address space and instrumentation tags this block was
+     * translated with, used to invalidate it selectively. */
+    target_ulong panda_asid;
+    uint64_t panda_tags;
+    /* PANDA: call/ret classification of the instruction ending this block
+     * (PANDA_TB_CALL, PANDA_TB_RET), set by the translator, 0 if unknown. */
+    uint8_t panda_call_type;
+#define PANDA_TB_CALL 1
+#define PANDA_TB_RET  2
 };
 
 void tb_free(TranslationBlock *tb);
 void tb_flush(CPUState *cpu);
 void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr);
+int tb_invalidate_filtered(bool (*filter)(TranslationBlock *tb, void *opaque),
+                           void *opaque);
 
 #if defined(USE_DIRECT_JUMP)
 
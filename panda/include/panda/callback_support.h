@@ -29,6 +29,8 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc, target_ulon
 void panda_callbacks_cpuid(CPUState *env);
 // translate-all.c
 void panda_callbacks_cpu_restore_state(CPUState *env, TranslationBlock *tb);
+void panda_tb_translate_begin(CPUState *cpu, TranslationBlock *tb);
+void panda_tb_translate_end(CPUState *cpu, TranslationBlock *tb);
 // target-i386/helper.c
 void panda_callbacks_asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid);
 // vl.c
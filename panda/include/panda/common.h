@@ -26,6 +26,18 @@ int panda_physical_memory_rw(hwaddr addr, uint8_t *buf, int len, int is_write);
 
 hwaddr panda_virt_to_phys(CPUState *env, target_ulong addr);
 
+// Borrowed host pointers into guest RAM. On entry *plen holds the number of
+// bytes wanted; on return it holds the number of bytes accessible through
+// the returned pointer (0 and NULL if addr is not backed by RAM). The valid
+// range never spans more than one RAMBlock, or more than one page for
+// virtual addresses. Pointers stay valid only while
+// panda_ram_map_generation() returns the value it had when they were taken.
+uint8_t *panda_physical_memory_ptr(hwaddr addr, hwaddr *plen, int is_write);
+uint8_t *panda_virtual_memory_ptr(CPUState *env, target_ulong addr,
+                                  hwaddr *plen, int is_write);
+uint64_t panda_ram_map_generation(void);
+void panda_ram_map_invalidate(void);
+
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
                             uint8_t *buf, int len, int is_write);
 int panda_virtual_memory_read(CPUState *env, target_ulong addr,
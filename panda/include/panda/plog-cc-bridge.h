@@ -14,9 +14,19 @@ void pandalog_init(const char *fname);
 // Closes global C++ pandalog in common.c
 void pandalog_cc_close(void);
 
+// Sets compression of the global C++ pandalog from a "codec=zstd,level=3,threads=4"
+// option string, before anything is written. Returns false on bad options.
+bool pandalog_cc_set_opts(const char *opts);
+
 //Interface for plog.c to pass a packed protobuf entry to C++ pandalog
 void pandalog_write_packed(size_t entry_size, unsigned char* buf);
 
+// Interface for plog.c to pack entries straight into the current chunk:
+// the pc and instr to record for an entry written now, and the place to
+// pack an entry of entry_size bytes (NULL in reader builds)
+void pandalog_cc_prog_point(uint64_t *pc, uint64_t *instr);
+unsigned char *pandalog_cc_reserve(size_t entry_size, uint64_t instr);
+
 // Interface for plog.c to read an entry
 unsigned char* pandalog_read_packed(void);
 
@@ -24,23 +24,86 @@ extern "C" {
 #include <iostream>
 #include <memory>
 #include <stdint.h>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "plog.pb.h"
 
-#define PL_CURRENT_VERSION 2
+// version 3 adds the codec and level to the header
+#define PL_CURRENT_VERSION 3
 // compression level
 #define PL_Z_LEVEL 9
 // 16 MB chunk
 #define PL_CHUNKSIZE (1024 * 1024 * 16)
 // header at most this many bytes
 #define PL_HEADER_SIZE 128
+// chunks are compressed by this many threads while writing.
+// 0 compresses synchronously, on the thread that fills the chunk.
+#define PL_COMPRESS_THREADS 2
 
+// chunk compression codec. Logs older than version 3 are always zlib.
+typedef enum {
+    PL_CODEC_ZLIB = 0,
+    PL_CODEC_ZSTD = 1,
+    PL_CODEC_LZ4 = 2,
+} PlCodec;
+
+#define PL_DEFAULT_CODEC PL_CODEC_ZLIB
 
 typedef struct pandalog_header_struct {
     uint32_t version;     // version number
     uint64_t dir_pos;     // position in file of directory
     uint32_t chunk_size;  // chunk size
+    uint32_t codec;       // PlCodec of the chunks
+    int32_t level;        // compression level the chunks were written with
+    uint64_t index_pos;   // position in file of chunk index, 0 if there is none
 } PlHeader;
 
+// Summary of the contents of a chunk, used to skip chunks that can't match
+// a query (see plog-index.hpp). Written after the directory:
+// num_chunks (uint32_t) followed by num_chunks PlChunkIndex records.
+#define PL_INDEX_MAX_ASIDS 14
+#define PL_INDEX_ANY_ASID UINT32_MAX
+
+typedef struct pandalog_chunk_index_struct {
+    uint64_t fields[2];     // bit n set if an entry has top level field n.
+                            // fields 127 and up share bit 127.
+    uint64_t min_pc;
+    uint64_t max_pc;
+    uint64_t min_instr;
+    uint64_t max_instr;
+    uint32_t num_asids;     // distinct asids, or PL_INDEX_ANY_ASID if too many
+    uint32_t num_entries;
+    uint64_t asids[PL_INDEX_MAX_ASIDS];
+} PlChunkIndex;
+
+// What pandalog_scan_entry finds out about a packed entry without decoding it
+typedef struct pandalog_entry_info_struct {
+    uint64_t pc;
+    uint64_t instr;
+    uint64_t asid;          // top level asid field, if any
+    bool has_asid;
+    uint64_t fields[2];     // top level fields present, as in PlChunkIndex
+} PlEntryInfo;
+
+// field number of the optional top level asid of LogEntry
+#define PL_ASID_FIELD 3
+
+// Reads the top level fields of a packed LogEntry. Returns false if the
+// entry is malformed.
+bool pandalog_scan_entry(const unsigned char *p, size_t n, PlEntryInfo *info);
+
+// Builds the index of an uncompressed chunk
+void pandalog_index_chunk(const unsigned char *buf, size_t size, PlChunkIndex *idx);
+
+// Decompresses zsize bytes of zbuf into *buf, a malloc'ed buffer of
+// *buf_size bytes, growing it as needed. Returns the uncompressed size.
+unsigned long pandalog_decompress(PlCodec codec, const unsigned char *zbuf,
+                                  unsigned long zsize, unsigned char **buf,
+                                  uint32_t *buf_size);
+
 // directory mapping instructions to chunks in the outfile
 // say el[0].instr = 1234
 // that means chunk 0 contains all pandalog info for instructions 0..1234
@@ -66,6 +129,7 @@ struct PandalogCcChunk {
     unsigned char *buf;         // uncompressed chunk data
     unsigned char *buf_p;       // pointer into uncompressed chunk (used while writing)
     unsigned char *zbuf;        // corresponding compressed chunk
+    uint32_t buf_size;          // capacity of buf, may grow past size while writing
     // these are used while writing to remember things needed for dir entry
     uint32_t start_instr;       // first instruction in current chunk 
     uint64_t start_pos;         // pos in file of start of current chunk
@@ -76,6 +140,18 @@ struct PandalogCcChunk {
     uint32_t ind_entry;         // index into array of entries
 };
 
+// a full chunk handed off to the compression threads
+struct PandalogCcJob {
+    uint32_t chunk_num;         // index of the chunk in the directory
+    unsigned char *buf;         // uncompressed chunk data
+    uint32_t buf_size;          // capacity of buf
+    uint32_t size;              // bytes used in buf
+    uint32_t num_entries;       // pandalog entries in the chunk
+    std::vector<unsigned char> zbuf;    // compressed chunk
+    PlChunkIndex index;         // summary of the chunk contents
+    bool done;                  // zbuf is ready to be written
+};
+
 class PandaLog {
     PlMode mode;
     const char *filename;
@@ -83,14 +159,42 @@ class PandaLog {
     PandalogCcDir dir;
     PandalogCcChunk chunk;
     uint32_t chunk_num;
+    std::vector<PlChunkIndex> index;    // per chunk, filled in by write_job
+
+    // compression settings, fixed once the first chunk is written
+    PlCodec codec;
+    int level;
+    uint32_t num_threads;
+
+    // write pipeline: the emulation thread fills a chunk and queues it,
+    // compression threads pick chunks off work_queue, and the writer thread
+    // writes them to the file in order. Guarded by pipe_lock.
+    bool pipe_started;
+    bool pipe_stopping;
+    std::mutex pipe_lock;
+    std::condition_variable work_cv;    // work_queue not empty, or stopping
+    std::condition_variable done_cv;    // a job has been compressed
+    std::condition_variable free_cv;    // a chunk buffer was returned
+    std::deque<PandalogCcJob *> work_queue;     // waiting for compression
+    std::deque<PandalogCcJob *> write_queue;    // all queued jobs, in chunk order
+    std::vector<std::pair<unsigned char *, uint32_t>> free_bufs;
+    uint32_t num_bufs;                  // chunk buffers allocated
+    std::vector<std::thread> compressors;
+    std::thread writer;
 
 public:    
     //default constructor
-    PandaLog(): mode(PL_MODE_UNKNOWN){
+    PandaLog(): mode(PL_MODE_UNKNOWN), codec(PL_DEFAULT_CODEC), level(PL_Z_LEVEL),
+                num_threads(PL_COMPRESS_THREADS), pipe_started(false),
+                pipe_stopping(false), num_bufs(0) {
         mode = PL_MODE_UNKNOWN;
         chunk_num = 0;
     };
 
+    // set compression used for writing. Must be called before the first
+    // chunk is written. Returns false if the codec wasn't compiled in.
+    bool set_compression(PlCodec codec, int level, uint32_t num_threads);
+
     // open pandalog for write with this uncompressed chunk size
     void open_write(const char *path, uint32_t chunk_size);
 
@@ -109,6 +213,11 @@ public:
 
     void write_entry(std::unique_ptr<panda::LogEntry> entry);
 
+    // Makes room for an n byte packed entry of instruction instr in the
+    // current chunk and returns where to pack it. The entry must be packed
+    // there before anything else is written to the log.
+    unsigned char *reserve_entry(size_t n, uint64_t instr);
+
     std::unique_ptr<panda::LogEntry> read_entry(void);
 
     // seek to the element in pandalog corresponding to this instr
@@ -130,7 +239,7 @@ private:
     //Read directory entries
     void read_dir();
 
-    //Write directory entries
+    //Write directory entries, chunk index and header
     void write_dir();
 
     // decompresses chunk and reads all entries into vector
@@ -139,9 +248,27 @@ private:
     // Adds directory entry to list of directory entries. Does not write to log
     void add_dir_entry();
 
-    //Zlib compresses and writes current chunk to log
+    // Hands the current chunk to the compression threads and switches to a
+    // free buffer. Compresses and writes it synchronously without threads.
     void write_current_chunk();
 
+    void start_pipeline();
+
+    void stop_pipeline();
+
+    void compressor_loop();
+
+    void writer_loop();
+
+    // compresses job->buf into job->zbuf with the configured codec
+    void compress_job(PandalogCcJob *job);
+
+    // writes a compressed job at the current position and records it in the dir
+    void write_job(PandalogCcJob *job);
+
+    // decompresses compressed_size bytes of chunk.zbuf into chunk.buf
+    void decompress_chunk(PlCodec codec, unsigned long compressed_size);
+
     // Finds index of entry with this instr number
     uint32_t find_ind(uint64_t instr, uint32_t lo, uint32_t high);
 
@@ -0,0 +1,83 @@
+/**
+ *
+ * Indexed, query driven reader for pandalogs.
+ *
+ * Each chunk of a pandalog has a PlChunkIndex summarizing the entry types,
+ * asids, pcs and instruction counts in it. Version 3 logs carry the index
+ * after the directory; for older logs it is built by decompressing every
+ * chunk once, and can be saved to a sidecar file (<log>.idx).
+ *
+ * A query is checked against the index first, so chunks that can't match
+ * are never read. In the remaining chunks, entries are filtered on their
+ * packed top level fields and only the matching ones are decoded, reusing
+ * one LogEntry. Chunks are read and decompressed by a pool of threads,
+ * while matches are delivered in log order.
+ *
+ */
+
+#ifndef __PANDALOG_INDEX_H_
+#define __PANDALOG_INDEX_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "panda/plog-cc.hpp"
+
+struct PlQuery {
+    // entry has at least one of these top level fields (any entry if empty)
+    std::vector<uint32_t> fields;
+    bool has_asid = false;
+    uint64_t asid = 0;
+    uint64_t min_pc = 0;
+    uint64_t max_pc = UINT64_MAX;
+    uint64_t min_instr = 0;
+    uint64_t max_instr = UINT64_MAX;
+
+    // adds the LogEntry field with this name, returns false if there's none
+    bool add_field(const std::string &name);
+
+    bool chunk_may_match(const PlChunkIndex &idx) const;
+    bool entry_matches(const PlEntryInfo &info) const;
+};
+
+class PandaLogIndexedReader {
+    std::string filename;
+    PlHeader header;
+    std::vector<uint64_t> pos;          // chunk file positions, plus dir_pos
+    std::vector<PlChunkIndex> index;
+    bool index_embedded;
+
+    // reads, decompresses and filters one chunk, for the worker threads
+    struct ChunkResult;
+    void load_chunk(std::ifstream &f, uint32_t chunk, const PlQuery *q,
+                    ChunkResult *res);
+
+public:
+    PandaLogIndexedReader(): index_embedded(false) {}
+
+    // reads header, directory and index. Returns false if the file isn't a
+    // pandalog.
+    bool open(const char *path);
+
+    uint32_t num_chunks() const { return pos.size() - 1; }
+    const PlChunkIndex &chunk_index(uint32_t chunk) const { return index[chunk]; }
+    bool has_index() const { return !index.empty(); }
+    bool has_embedded_index() const { return index_embedded; }
+
+    // builds the index by scanning all chunks with this many threads
+    void build_index(unsigned num_threads);
+
+    // sidecar index, for logs written before the index was embedded
+    bool load_index(const char *path);
+    bool save_index(const char *path) const;
+
+    // Calls fn on every entry matching q, in log order, until fn returns
+    // false. Entries are only valid during the call. Returns the number of
+    // matching entries. If chunks_read isn't NULL, it is set to the number
+    // of chunks that had to be decompressed.
+    uint64_t scan(const PlQuery &q,
+                  const std::function<bool(const panda::LogEntry &)> &fn,
+                  unsigned num_threads, uint32_t *chunks_read = NULL);
+};
+
+#endif
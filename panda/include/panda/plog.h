@@ -36,8 +36,30 @@ void pandalog_open(const char *path, const char *mode);
 // close pandalog (all modes)
 void pandalog_close(void);
 
+// Packs entry straight into the current chunk of the log, then recycles
+// the entry builder arena (see below).
 void pandalog_write_entry(Panda__LogEntry *entry);
 
+// Entry builder arena. Messages nested in an entry, repeated fields and
+// strings can be allocated here instead of with malloc. Allocations are
+// zeroed and stay valid until the next pandalog_write_entry on the same
+// thread; they are never freed individually.
+void *pandalog_alloc(size_t size);
+char *pandalog_strdup(const char *s);
+void pandalog_arena_reset(void);
+
+// Allocates a message in the arena and initializes it, e.g.
+//   Panda__TaintQuery *tq = pandalog_new(Panda__TaintQuery, PANDA__TAINT_QUERY__INIT);
+#define pandalog_new(type, init) ({                             \
+    type *_pl_msg = (type *) pandalog_alloc(sizeof(type));      \
+    type _pl_init = init;                                       \
+    *_pl_msg = _pl_init;                                        \
+    _pl_msg;                                                    \
+})
+
+#define pandalog_new_array(type, n) \
+    ((type *) pandalog_alloc(sizeof(type) * (n)))
+
 Panda__LogEntry *pandalog_read_entry(void);
 
 void pandalog_seek(uint64_t instr);
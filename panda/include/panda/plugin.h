@@ -566,15 +566,22 @@ typedef union panda_cb {
     void (* cbaddr)(void);
 } panda_cb;
 
-// Doubly linked list that stores a callback, along with its owner
+// Doubly linked list that stores a callback, along with its owner.
+// The list is RCU-protected: walk it with panda_cb_list_first/next while
+// holding rcu_read_lock(). Only the next links are safe for readers.
 typedef struct _panda_cb_list panda_cb_list;
 struct _panda_cb_list {
+    struct rcu_head rcu;    // must stay first, see g_free_rcu()
     panda_cb entry;
     void *owner;
     panda_cb_list *next;
     panda_cb_list *prev;
     bool enabled;
+    uint64_t prof_count;    // invocations while profiling, see panda/profile.h
+    uint64_t prof_cycles;   // host cycles spent in the callback
+    uint64_t tb_tag;        // TB tag of the owner, see panda_alloc_tb_tag()
 };
+panda_cb_list* panda_cb_list_first(panda_cb_type type);
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist);
 void panda_enable_plugin(void *plugin);
 void panda_disable_plugin(void *plugin);
@@ -583,6 +590,7 @@ void panda_disable_plugin(void *plugin);
 typedef struct panda_plugin {
     char name[256];     // Currently basename(filename)
     void *plugin;       // Handle to the plugin (for use with dlsym())
+    uint64_t tb_tag;    // Tag of the TBs instrumented by the plugin
 } panda_plugin;
 
 void   panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb);
@@ -601,6 +609,21 @@ void   panda_unload_plugins(void);
 bool panda_flush_tb(void);
 
 void panda_do_flush_tb(void);
+
+// Selective TB invalidation: like panda_do_flush_tb, these only take effect
+// before the next TB lookup, but keep the rest of the code cache.
+void panda_invalidate_tbs_pc_range(target_ulong start, target_ulong end);
+void panda_invalidate_tbs_asid(target_ulong asid);
+void panda_invalidate_tbs_tags(uint64_t tags);
+void panda_do_invalidate_tbs(bool apply);
+
+// TB tags: TBs translated while a tag is active carry it. Every plugin is
+// also given a tag, added to the TBs in which it requested insn_exec or
+// after_insn_exec instrumentation, and invalidated when it is unloaded.
+uint64_t panda_alloc_tb_tag(void);
+void panda_free_tb_tag(uint64_t tag);
+void panda_activate_tb_tags(uint64_t tags);
+void panda_deactivate_tb_tags(uint64_t tags);
 void panda_enable_precise_pc(void);
 void panda_disable_precise_pc(void);
 void panda_enable_memcb(void);
@@ -619,6 +642,7 @@ extern panda_cb_list *panda_cbs[PANDA_CB_LAST];
 extern bool panda_plugins_to_unload[MAX_PANDA_PLUGINS];
 extern bool panda_plugin_to_unload;
 extern bool panda_tb_chaining;
+extern uint64_t panda_active_tb_tags;
 
 extern const gchar *panda_argv[MAX_PANDA_PLUGIN_ARGS];
 extern int panda_argc;
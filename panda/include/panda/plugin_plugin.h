@@ -81,6 +81,29 @@ void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
   ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
 }									
 
+/*
+  Same, but also calls notify() after a callback is registered, for plugins
+  that keep state derived from which callbacks are registered (e.g. only
+  doing the work for callbacks that have subscribers).
+*/
+#define PPP_CB_BOILERPLATE_NOTIFY(cb_name, notify)	\
+cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB];	\
+int ppp_##cb_name##_num_cb = 0;				\
+							\
+void ppp_add_cb_##cb_name(cb_name##_t fptr) {			\
+  assert (ppp_##cb_name##_num_cb < PPP_MAX_CB);				\
+  ppp_##cb_name##_cb[ppp_##cb_name##_num_cb] = fptr;			\
+  ppp_##cb_name##_num_cb += 1;						\
+  notify();								\
+}									\
+									\
+void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
+  assert (slot_num < PPP_MAX_CB);					\
+  ppp_##cb_name##_cb[slot_num] = fptr;					\
+  ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
+  notify();								\
+}
+
 #define PPP_CB_EXTERN(cb_name) \
 extern cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB]; \
 extern int ppp_##cb_name##_num_cb;
@@ -101,6 +124,22 @@ extern int ppp_##cb_name##_num_cb;
 
 #define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_num_cb > 0)
 
+/*
+  Shared data.  Some state of plugin A is read so often by other plugins
+  (e.g. on every memory access) that even a call through a dlsym-resolved
+  API pointer shows up in profiles.  Plugin A can publish such state in a
+  global struct, and plugins B read it directly through a const pointer
+  obtained once at init time, usually from inline accessors in A's header.
+  It is up to A to document when the published state is kept up to date.
+*/
+#ifdef __cplusplus
+#define PPP_SHARED_DATA(type, name) \
+extern "C" { type ppp_shared_##name; }
+#else
+#define PPP_SHARED_DATA(type, name) \
+type ppp_shared_##name;
+#endif
+
 /****************************************************************
 This stuff gets used in "plugin B", i.e., the plugin that wants
 to add a callback to be run inside of plugin A.
@@ -122,6 +161,22 @@ to add a callback to be run inside of plugin A.
     add_cb (cb_func);							\
   }
 
+// Use this in plugin B's init_plugin fn to get a pointer to data published
+// with PPP_SHARED_DATA by other_plugin.
+#define PPP_IMPORT_SHARED(other_plugin, type, name) \
+  ((const type *) ppp_import_shared(other_plugin, "ppp_shared_" #name))
+
+static inline void *ppp_import_shared(const char *other_plugin, const char *sym) {
+  void *op = panda_get_plugin_by_name(other_plugin);
+  if (!op) {
+    printf("In trying to import shared data, couldn't load %s plugin\n", other_plugin);
+    assert (op);
+  }
+  void *data = dlsym(op, sym);
+  assert (data != NULL);
+  return data;
+}
+
 
 
 
@@ -0,0 +1,99 @@
+#ifndef __PANDA_PROFILE_H__
+#define __PANDA_PROFILE_H__
+
+/*
+ * Opt-in cost profiler for the PANDA core.
+ *
+ * When enabled (-panda general:profile=y, or the panda_profile monitor
+ * command), every callback dispatch records an invocation count and the
+ * host cycles spent in the callback. Counts are kept in the panda_cb_list
+ * node of the callback, so they are attributed to the owning plugin and
+ * callback type. Non-callback work that is a known source of replay
+ * slowdown is charged to a profiling section instead.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum panda_prof_section {
+    PANDA_PROF_LLVM_TRANSLATE,  // TCG -> LLVM translation of TBs
+    PANDA_PROF_TAINT,           // taint2 propagation ops
+    PANDA_PROF_RR_LOG,          // nondet log reads/writes
+
+    PANDA_PROF_LAST
+} panda_prof_section;
+
+typedef struct panda_prof_counter {
+    uint64_t count;
+    uint64_t cycles;
+    int64_t start;
+    uint32_t depth;
+} panda_prof_counter;
+
+extern bool panda_profiling;
+extern panda_prof_counter panda_prof_sections[PANDA_PROF_LAST];
+
+void panda_profile_init(void);
+void panda_enable_profiling(void);
+void panda_disable_profiling(void);
+void panda_profile_reset(void);
+void panda_profile_dump(FILE *out, void *plugin);
+
+// Section accounting. Nested enter/exit pairs of the same section are only
+// charged once, at the outermost level.
+void panda_prof_enter(panda_prof_section section);
+void panda_prof_exit(panda_prof_section section);
+
+#define PANDA_PROF_BEGIN(section) do {      \
+    if (unlikely(panda_profiling)) {        \
+        panda_prof_enter(section);          \
+    }                                       \
+} while (0)
+
+#define PANDA_PROF_END(section) do {        \
+    if (unlikely(panda_profiling)) {        \
+        panda_prof_exit(section);           \
+    }                                       \
+} while (0)
+
+/*
+ * Invoke a callback through its panda_cb_list node, charging the cost to
+ * the node while profiling is enabled. Requires "qemu/timer.h".
+ */
+#define PANDA_CB_INVOKE(plist, call) do {                               \
+    if (unlikely(panda_profiling)) {                                    \
+        int64_t panda_prof_t0 = cpu_get_host_ticks();                   \
+        call;                                                           \
+        (plist)->prof_cycles += cpu_get_host_ticks() - panda_prof_t0;   \
+        (plist)->prof_count++;                                          \
+    } else {                                                            \
+        call;                                                           \
+    }                                                                   \
+} while (0)
+
+#ifdef __cplusplus
+}
+
+namespace panda {
+
+// Charges the enclosing scope to a profiling section.
+class ProfileScope {
+public:
+    explicit ProfileScope(panda_prof_section section)
+        : section_(section), active_(unlikely(panda_profiling)) {
+        if (active_) panda_prof_enter(section_);
+    }
+    ~ProfileScope() {
+        if (active_) panda_prof_exit(section_);
+    }
+
+private:
+    panda_prof_section section_;
+    bool active_;
+};
+
+} // namespace panda
+#endif
+
+#endif
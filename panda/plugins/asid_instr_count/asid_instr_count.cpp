@@ -1,24 +1,34 @@
 /*
   This plugin provides a per-asid instruction count.
   
-  For each asid, keep track of the total number of instructions previously
-  executed by all other asids.  This allows us to 'correct' the instruction
+  For each asid, keep track of the intervals of the replay in which it
+  was running.  This allows us to 'correct' the instruction
   count for an asid by subtraction.  Which means we can now take two instructions
   counts obtained via calls to asid_instr_count(asid) and subtract them to know
   how many instructions were executed between the two.  Without this accounting,
   we'd be including execution by other asids.
 
-  This plugin just exposes an api of one function which returns the corrected
-  instruction count for the asid. 
+  The instruction intervals of each asid are kept in an append-only array
+  with a running total, so the count for an asid at any point of the
+  replay is a binary search.  The index can be saved when the replay ends
+  (save=file) and loaded by later replays of the same recording (load=file),
+  which then don't need to watch asid changes to answer queries.
 
-  Instr instr_count_asid(target_ulong asid);  
+  This plugin exposes an api of three functions
+
+  Instr get_instr_count_current_asid(void);
+  Instr get_instr_count_by_asid(target_ulong asid);
+  Instr get_instr_count_by_asid_at(target_ulong asid, Instr instr);
 */
 
 #define __STDC_FORMAT_MACROS
 
-#include <iostream>
-#include <set>
-#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "panda/plugin.h"
 #include "panda/plugin_plugin.h"
@@ -46,34 +56,39 @@ Instr ac_instr_start=0;
 
 target_ulong current_asid=0;
 
-// asid_instr_intervals[asid] is a *set* of instr intervals for
+// [first, second) instructions executed in an asid
 typedef std::pair<Instr,Instr> InstrRange;
-typedef std::set<InstrRange> InstrRangeSet;
-// map from asid to instruction intervalus
-std::map<target_ulong,InstrRangeSet> asid_instr_intervals;
-
-// asid_rr_sub_factor[asid] is how much to subtract from rr instr count for asid
-// to get instr-count just for that asid
-std::map<target_ulong, Instr> asid_rr_sub_factor;
-
-// just saw last instr in interval for old_asid.
-// update the number we use to correct rr instr count by asid (a subtraction factor)
-void update_asid_rr_sub_factor(target_ulong old_asid, InstrRange rri) {
-    // ok, yes, we aren't actually using this information for anything
-    // but wouldn't it be cool? 
-    asid_instr_intervals[old_asid].insert(rri);
-    Instr rri_len = rri.second - rri.first;
-    // update subtract factor for all other asids
-    for (auto kvp : asid_rr_sub_factor) {
-        auto asid = kvp.first;
-        if (asid != old_asid) asid_rr_sub_factor[asid] += rri_len;
+
+// The instr intervals of one asid, in order, and prefix[i], the number of
+// instructions in all intervals before runs[i].
+struct AsidRuns {
+    std::vector<InstrRange> runs;
+    std::vector<Instr> prefix;
+
+    void append(InstrRange rri) {
+        prefix.push_back(total());
+        runs.push_back(rri);
     }
-    if (asid_rr_sub_factor.count(old_asid) == 0) {
-        // first time seeing this asid.  
-        // its subtraction factor is just current instr count
-        asid_rr_sub_factor[old_asid] = rr_get_guest_instr_count();
+
+    Instr total() const {
+        if (runs.empty()) return 0;
+        return prefix.back() + runs.back().second - runs.back().first;
     }
-}
+
+    // instructions executed in these intervals before instr
+    Instr count_at(Instr instr) const {
+        auto it = std::upper_bound(runs.begin(), runs.end(), InstrRange(instr, ~(Instr)0));
+        if (it == runs.begin()) return 0;
+        size_t i = it - runs.begin() - 1;
+        return prefix[i] + std::min(instr, runs[i].second) - runs[i].first;
+    }
+};
+
+std::unordered_map<target_ulong, AsidRuns> asid_instr_intervals;
+
+// true if the index was loaded from a file and is complete
+bool index_loaded = false;
+std::string save_file;
 
 /*
   called whenever asid changes
@@ -82,34 +97,131 @@ void update_asid_rr_sub_factor(target_ulong old_asid, InstrRange rri) {
 */
 int asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid) {
     // XXX I wonder why this is in here?
-    if (new_asid < 10) return 0;
+    if (new_asid < 10 || old_asid == new_asid) return 0;
     Instr instr = rr_get_guest_instr_count();
-    if (old_asid != new_asid) {
-        auto rri = std::make_pair(ac_instr_start, instr-1);
-        update_asid_rr_sub_factor(old_asid, rri);
+    if (!index_loaded && instr > ac_instr_start) {
+        asid_instr_intervals[old_asid].append(std::make_pair(ac_instr_start, instr));
     }
-    ac_instr_start = rr_get_guest_instr_count();        
+    ac_instr_start = instr;
     current_asid = new_asid;
     return 0;
 }
 
 /*
-  returns instruction count for current asid (subtracting out instructions for other asids)
-  NOTE: this means this isnt the actual instr count within the replay, but it is now
+  returns the number of instructions executed in asid before instr.
+  NOTE: this isnt the actual instr count within the replay, but it is
   safe, e.g., to subtract two instruction counts
 */
+Instr get_instr_count_by_asid_at(target_ulong asid, Instr instr) {
+    Instr count = 0;
+    auto it = asid_instr_intervals.find(asid);
+    if (it != asid_instr_intervals.end()) count = it->second.count_at(instr);
+    // the current interval isn't in the index yet
+    if (!index_loaded && asid == current_asid && instr > ac_instr_start) {
+        count += instr - ac_instr_start;
+    }
+    return count;
+}
+
+/*
+  returns instruction count for current asid (subtracting out instructions for other asids)
+*/
 Instr get_instr_count_current_asid() {
-    return (rr_get_guest_instr_count() - asid_rr_sub_factor[current_asid]);
+    return get_instr_count_by_asid_at(current_asid, rr_get_guest_instr_count());
 }
 
 Instr get_instr_count_by_asid(target_ulong asid) {
-    return (rr_get_guest_instr_count() - asid_rr_sub_factor[asid]);
+    return get_instr_count_by_asid_at(asid, rr_get_guest_instr_count());
+}
+
+/*
+  Index file:
+
+  header (index_header)
+  per asid: u64 asid, u64 number of intervals, then u64 first, u64 second
+  for each interval
+*/
+#pragma pack(push, 1)
+struct index_header {
+    char magic[4];          // "PAIC"
+    uint32_t version;
+    uint64_t num_asids;
+};
+#pragma pack(pop)
+
+static bool load_index(const char *name) {
+    FILE *fp = fopen(name, "rb");
+    if (!fp) {
+        perror("asid_instr_count: load");
+        return false;
+    }
+    index_header h;
+    bool ok = fread(&h, sizeof(h), 1, fp) == 1 &&
+        memcmp(h.magic, "PAIC", 4) == 0 && h.version == 1;
+    for (uint64_t i = 0; ok && i < h.num_asids; i++) {
+        uint64_t asid, num_runs;
+        ok = fread(&asid, sizeof(asid), 1, fp) == 1 &&
+            fread(&num_runs, sizeof(num_runs), 1, fp) == 1;
+        AsidRuns &ar = asid_instr_intervals[asid];
+        for (uint64_t j = 0; ok && j < num_runs; j++) {
+            uint64_t r[2];
+            ok = fread(r, sizeof(r), 1, fp) == 1 && r[0] <= r[1] &&
+                (ar.runs.empty() || ar.runs.back().second <= r[0]);
+            if (ok) ar.append(std::make_pair(r[0], r[1]));
+        }
+    }
+    fclose(fp);
+    if (!ok) {
+        fprintf(stderr, "asid_instr_count: %s is not a valid index\n", name);
+        asid_instr_intervals.clear();
+    }
+    return ok;
+}
+
+static void save_index(const char *name) {
+    FILE *fp = fopen(name, "wb");
+    if (!fp) {
+        perror("asid_instr_count: save");
+        return;
+    }
+    index_header h = { {'P', 'A', 'I', 'C'}, 1, asid_instr_intervals.size() };
+    fwrite(&h, sizeof(h), 1, fp);
+    for (auto &kvp : asid_instr_intervals) {
+        uint64_t asid = kvp.first, num_runs = kvp.second.runs.size();
+        fwrite(&asid, sizeof(asid), 1, fp);
+        fwrite(&num_runs, sizeof(num_runs), 1, fp);
+        for (auto &rri : kvp.second.runs) {
+            uint64_t r[2] = { rri.first, rri.second };
+            fwrite(r, sizeof(r), 1, fp);
+        }
+    }
+    fclose(fp);
 }
 
 bool init_plugin(void *self) {
+    panda_arg_list *args = panda_get_args("asid_instr_count");
+    const char *load = panda_parse_string_opt(args, "load", NULL,
+            "index saved by an earlier replay of the same recording");
+    save_file = panda_parse_string_opt(args, "save", "",
+            "file to save the index to when the replay ends");
+    if (load) index_loaded = load_index(load);
+    panda_free_args(args);
+    if (load && !index_loaded) return false;
+
     panda_cb pcb;
     pcb.asid_changed = asid_changed;
     panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
     return true;
 }
 
+void uninit_plugin(void *self) {
+    if (save_file.empty()) return;
+    // close the interval of the asid running at the end
+    Instr instr = rr_get_guest_instr_count();
+    if (!index_loaded && instr > ac_instr_start) {
+        asid_instr_intervals[current_asid].append(std::make_pair(ac_instr_start, instr));
+        ac_instr_start = instr;
+    }
+    save_index(save_file.c_str());
+}
+
@@ -6,4 +6,7 @@ Instr get_instr_count_current_asid(void);
 
 Instr get_instr_count_by_asid(target_ulong asid);
 
+// instructions executed in asid before the replay reached instr
+Instr get_instr_count_by_asid_at(target_ulong asid, Instr instr);
+
 #endif
@@ -25,6 +25,10 @@
   of the graph is a set of indicators you can use to choose a good
   rr instruction count for various purposes.
 
+  While the replay runs, the intervals in which each process was seen
+  are appended to "asidstory.bin", which scripts/asidstory.py turns
+  into the same table and graph at any point.
+
  */
 
 
@@ -35,6 +39,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <cstdint>
 #include <cstring>
 #include <sstream>
@@ -115,8 +120,9 @@ Mode process_mode = Process_unknown;
 // if that is changing we won't believe it
 int process_counter=PROCESS_GOOD_NUM;
 
-// used to control spit_asidstory printout frequency
-bool *status_c=NULL;
+// asidstory.bin is flushed whenever the replay enters a new cell
+uint32_t flushed_cell = 0;
+FILE *story_bin = NULL;
 
 // divide replay up into this many temporal cells
 uint32_t num_cells = 80;
@@ -160,7 +166,11 @@ target_ulong asid_at_asid_changed;
 
 uint64_t kernel_count = 0;
 uint64_t user_count = 0;
-std::map<target_ulong, uint64_t> asid_count;
+
+// instructions run in each asid, counted at asid changes
+std::unordered_map<target_ulong, uint64_t> asid_count;
+target_ulong current_asid;
+uint64_t current_asid_instr = 0;
     
 struct NamePid {
     Name name;
@@ -176,14 +186,18 @@ struct NamePid {
     }
 };
 
+// instructions [first, second] during which a process ran
+typedef std::pair<Instr, Instr> Run;
+
 struct ProcessData {
     std::string shortname;   
-    std::map<Cell, Count> cells;  
+    uint32_t idx;               // index of the process in asidstory.bin
+    std::vector<Run> runs;      // in order, merged when less than a cell apart
     Count count;           
     Instr first;
     Instr last;
 
-    ProcessData() : count(0), first(0), last(0) {}
+    ProcessData() : idx(0), count(0), first(0), last(0) {}
 };
 
 std::map<NamePid, ProcessData> process_datas;
@@ -241,16 +255,13 @@ void spit_asidstory() {
         const ProcessData &pd = pd_kv.second;
 
         //        if (pd.count >= sample_cutoff) {
-            fprintf(fp, "%" NAMELENS "s : [", pd.shortname.c_str());
-            for (unsigned i = 0; i < num_cells; i++) {
-                auto it = pd.cells.find(i);
-                if (it == pd.cells.end() || it->second < 2) {
-                    fprintf(fp, " ");
-                } else {
-                    fprintf(fp, "#");
-                }
+            std::string cells(num_cells, ' ');
+            for (auto &run : pd.runs) {
+                Cell c1 = std::min((Cell) (run.first * scale), num_cells - 1);
+                Cell c2 = std::min((Cell) (run.second * scale), num_cells - 1);
+                std::fill(cells.begin() + c1, cells.begin() + c2 + 1, '#');
             }
-            fprintf(fp, "]\n");
+            fprintf(fp, "%" NAMELENS "s : [%s]\n", pd.shortname.c_str(), cells.c_str());
             //        }
     }
 
@@ -282,18 +293,50 @@ static inline bool check_proc(OsiProc *proc) {
 }
 
 
+/*
+  asidstory.bin, written as the replay goes:
+
+  header (story_header)
+  records, each starting with a type byte:
+    'P' (story_process) and the process name, the first time a process is seen
+    'R' (story_run), for each interval in which a process was seen
+*/
+#pragma pack(push, 1)
+struct story_header {
+    char magic[4];          // "PASD"
+    uint32_t version;
+    uint32_t ulong_size;
+    uint64_t max_instr;
+};
+
+struct story_process {
+    uint8_t type;
+    uint32_t idx;
+    uint32_t pid;
+    uint64_t asid;
+    uint32_t name_len;
+};
+
+struct story_run {
+    uint8_t type;
+    uint32_t idx;
+    uint64_t first;
+    uint64_t last;
+};
+#pragma pack(pop)
+
+
 /* 
    proc assumed to be ok.
-   register that we saw this proc at this instr count
-   updating first / last instr and cell counts
+   returns the data for this proc, creating it with a reasonable
+   shortname on first encounter
 */
-void saw_proc(CPUState *env, OsiProc *proc, uint64_t instr_count) {
+ProcessData &get_process_data(OsiProc *proc) {
 
     const NamePid namepid(proc->name ? proc->name : "", proc->pid, proc->asid);        
     ProcessData &pd = process_datas[namepid];
-    if (pd.first == 0) {
+    if (pd.count == 0) {
         // first encounter of this name/pid -- create reasonable shortname
-        pd.first = instr_count;
         unsigned count = ++name_count[namepid.name];
         std::string count_str(std::to_string(count));
         std::string shortname(namepid.name);
@@ -317,11 +360,16 @@ void saw_proc(CPUState *env, OsiProc *proc, uint64_t instr_count) {
                 pd.shortname += '_';
         }
         pd.shortname = shortname;
+        pd.idx = process_datas.size() - 1;
+
+        if (story_bin) {
+            story_process sp = { 'P', pd.idx, namepid.pid, namepid.asid,
+                                 (uint32_t) namepid.name.size() };
+            fwrite(&sp, sizeof(sp), 1, story_bin);
+            fwrite(namepid.name.data(), 1, namepid.name.size(), story_bin);
+        }
     }
-    pd.count++;
-    uint32_t cell = instr_count * scale;
-    pd.cells[cell]++;
-    pd.last = std::max(pd.last, instr_count);
+    return pd;
 }
 
 
@@ -332,13 +380,23 @@ void saw_proc_range(CPUState *env, OsiProc *proc, uint64_t i1, uint64_t i2) {
         printf ("saw_proc_range [%s,%d] (%" PRId64 " ..%" PRId64 ")\n", 
                 proc->name, (int) proc->pid, i1, i2);
 
-     uint64_t step = floor(1.0 / scale) / 2;
-    // assume that last process was running from last asid change to basically now
-    saw_proc(env, proc, i1);
-    saw_proc(env, proc, i2);
-//    printf ("step = %d\n", (int) step/3);
-    for (uint64_t i=i1; i<=i2; i+=step/3) {
-        saw_proc(env, proc, i);
+    i2 = std::max(i1, i2);
+    ProcessData &pd = get_process_data(proc);
+    if (pd.count == 0) pd.first = i1;
+    pd.count++;
+    pd.last = std::max(pd.last, i2);
+
+    // runs closer together than a cell look the same in the graph
+    Instr cell_instr = max_instr / num_cells;
+    if (!pd.runs.empty() && i1 <= pd.runs.back().second + cell_instr) {
+        pd.runs.back().second = std::max(pd.runs.back().second, i2);
+    } else {
+        pd.runs.push_back(Run(i1, i2));
+    }
+
+    if (story_bin) {
+        story_run sr = { 'R', pd.idx, i1, i2 };
+        fwrite(&sr, sizeof(sr), 1, story_bin);
     }
 }
 
@@ -350,11 +408,15 @@ void saw_proc_range(CPUState *env, OsiProc *proc, uint64_t i1, uint64_t i2) {
 // also, if proc has changed, we record the fact that a process was seen to be running
 // from now back to last asid change
 int asidstory_asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid) {
+    uint64_t curr_instr = rr_get_guest_instr_count();
+
+    asid_count[current_asid] += curr_instr - current_asid_instr;
+    current_asid = new_asid;
+    current_asid_instr = curr_instr;
+
     // some fool trying to use asidstory for boot? 
     if (new_asid == 0) return 0;
     
-    uint64_t curr_instr = rr_get_guest_instr_count();
-    
 	if (debug) printf ("\nasid changed @ %lu\n", curr_instr);
     
     if (process_mode == Process_known) {
@@ -365,16 +427,13 @@ int asidstory_asid_changed(CPUState *env, target_ulong old_asid, target_ulong ne
         // so we'll record that info for later display
         saw_proc_range(env, first_good_proc, instr_first_good_proc, curr_instr - 100);
         
-        if (!pandalog) {        
-            // just trying to arrange it so that we only spit out asidstory plot
-            // for a cell once.
-            int cell = curr_instr * scale; 
-            bool anychange = false;
-            for (int i=0; i<cell; i++) {
-                if (!status_c[i]) anychange=true;
-                status_c[i] = true;
+        if (story_bin) {
+            // make what we have so far readable once per cell
+            uint32_t cell = curr_instr * scale; 
+            if (cell > flushed_cell) {
+                fflush(story_bin);
+                flushed_cell = cell;
             }
-            if (anychange) spit_asidstory();
         }
     }    
     else {
@@ -434,13 +493,18 @@ int asidstory_before_block_exec(CPUState *env, TranslationBlock *tb) {
         kernel_count ++;
     else
         user_count ++;
-    asid_count[panda_current_asid(env)] ++;   
 
     // NB: we only know max instr *after* replay has started which is why this is here
     if (max_instr == 0) {
         max_instr = replay_get_total_num_instructions();
         scale = ((double) num_cells) / ((double) max_instr); 
         if (debug) printf("max_instr = %" PRId64 "\n", max_instr);
+        current_asid = panda_current_asid(env);
+        current_asid_instr = rr_get_guest_instr_count();
+        if (story_bin) {
+            story_header h = { {'P', 'A', 'S', 'D'}, 1, sizeof(target_ulong), max_instr };
+            fwrite(&h, sizeof(h), 1, story_bin);
+        }
     }
 
     // all this is about figuring out if and when we know the current process
@@ -507,8 +571,8 @@ bool init_plugin(void *self) {
     //    sample_rate = panda_parse_uint32(args, "sample_rate", sample_rate);
     //    sample_cutoff = panda_parse_uint32(args, "sample_cutoff", sample_cutoff);
     if (!pandalog) {
-        status_c = (bool *) malloc(sizeof(bool) * num_cells);
-        for (int i=0; i<num_cells; i++) status_c[i]=false;
+        story_bin = fopen("asidstory.bin", "wb");
+        if (!story_bin) perror("asidstory: asidstory.bin");
     }
     
     min_instr = 0;   
@@ -516,14 +580,16 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-//  spit_asidstory();
+    spit_asidstory();
+    if (story_bin) fclose(story_bin);
 
+    asid_count[current_asid] += rr_get_guest_instr_count() - current_asid_instr;
+    std::vector<std::pair<target_ulong, uint64_t>> asid_counts(asid_count.begin(), asid_count.end());
+    std::sort(asid_counts.begin(), asid_counts.end());
 
     printf ("user %" PRId64 "\n", user_count);
     printf ("kernel %" PRId64 "\n", kernel_count);
-    for (auto &kvp : asid_count) {
-//        target_ulong asid : kvp.first;
-  //      uint64_t count : kvp.second;
+    for (auto &kvp : asid_counts) {
         printf ("  %lx %" PRId64 "\n", (uint64_t) kvp.first, kvp.second);
     }
 
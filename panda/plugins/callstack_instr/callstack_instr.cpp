@@ -19,23 +19,24 @@ PANDAENDCOMMENT */
 #include <cstdio>
 #include <cstdlib>
 
+#include <deque>
+#include <iterator>
 #include <map>
 #include <set>
 #include <vector>
 #include <algorithm>
 
+#include "panda/plugin.h"
+#include "panda/plugin_plugin.h"
+
+// The i386 and ARM translators mark blocks ending in a call or return
+// (tb->panda_call_type). On PPC each new block is disassembled instead.
+#if defined(TARGET_PPC)
+#define DISAS_BLOCKS
 #include <capstone/capstone.h>
-#if defined(TARGET_I386)
-#include <capstone/x86.h>
-#elif defined(TARGET_ARM)
-#include <capstone/arm.h>
-#elif defined(TARGET_PPC)
 #include <capstone/ppc.h>
 #endif
 
-#include "panda/plugin.h"
-#include "panda/plugin_plugin.h"
-
 #include "callstack_instr.h"
 
 extern "C" {
@@ -46,7 +47,10 @@ bool translate_callback(CPUState* cpu, target_ulong pc);
 int exec_callback(CPUState* cpu, target_ulong pc);
 int before_block_exec(CPUState* cpu, TranslationBlock *tb);
 int after_block_exec(CPUState* cpu, TranslationBlock *tb);
+#ifdef DISAS_BLOCKS
 int after_block_translate(CPUState* cpu, TranslationBlock *tb);
+#endif
+int asid_changed(CPUState *cpu, target_ulong old_asid, target_ulong new_asid);
 
 bool init_plugin(void *);
 void uninit_plugin(void *);
@@ -58,10 +62,12 @@ PPP_PROT_REG_CB(on_ret);
 PPP_CB_BOILERPLATE(on_call);
 PPP_CB_BOILERPLATE(on_ret);
 
+PPP_SHARED_DATA(callstack_instr_state, callstack_instr_state);
+
 enum instr_type {
   INSTR_UNKNOWN = 0,
-  INSTR_CALL,
-  INSTR_RET,
+  INSTR_CALL = PANDA_TB_CALL,
+  INSTR_RET = PANDA_TB_RET,
   INSTR_SYSCALL,
   INSTR_SYSRET,
   INSTR_SYSENTER,
@@ -72,35 +78,103 @@ enum instr_type {
 
 struct stack_entry {
     target_ulong pc;
+    target_ulong sp;    // stack pointer right after the call
     instr_type kind;
 };
 
+// Shadow stack of one thread: return addresses and the functions called
+struct shadow_stack {
+    std::vector<stack_entry> calls;
+    std::vector<target_ulong> functions;
+};
+
 #define MAX_STACK_DIFF 5000
+// Frames are only considered unwound when the stack pointer moved above
+// them by less than this, so a thread switch isn't taken for an unwind
+#define MAX_UNWIND_DIFF 0x40000
 
+#ifdef DISAS_BLOCKS
 csh cs_handle_32;
-csh cs_handle_64;
+#endif
 
 // Track the different stacks we have seen to handle multiple threads
 // within a single process.
 std::map<target_ulong,std::set<target_ulong>> stacks_seen;
 
-// Use a typedef here so we can switch between the stack heuristic and
-// the original code easily
+// A stack is identified by its address space and, with the stack heuristic,
+// the stack pointer it was first seen at (0 otherwise)
+struct stackid {
+    target_ulong asid;
+    target_ulong base;
+    bool operator==(const stackid &o) const {
+        return asid == o.asid && base == o.base;
+    }
+};
+
 #ifdef USE_STACK_HEURISTIC
-typedef std::pair<target_ulong,target_ulong> stackid;
 target_ulong cached_sp = 0;
 target_ulong cached_asid = 0;
-#else
-typedef target_ulong stackid;
 #endif
 
-// stackid -> shadow stack
-std::map<stackid, std::vector<stack_entry>> callstacks;
-// stackid -> function entry points
-std::map<stackid, std::vector<target_ulong>> function_stacks;
-// EIP -> instr_type
-std::map<target_ulong, instr_type> call_cache;
-int last_ret_size = 0;
+/*
+  Shadow stacks, in an open addressing table keyed by stackid. Stacks are
+  never freed, so pointers to them stay valid, and the stack of the last
+  lookup is cached: consecutive blocks almost always run on the same stack,
+  so most lookups are a comparison.
+*/
+class stack_table {
+public:
+    stack_table() : count(0), mask(0), cur(NULL) {}
+
+    shadow_stack &operator[](const stackid &id) {
+        if (cur && cur_id == id) return *cur;
+        if ((count + 1) * 2 > slots.size()) grow();
+        slot *s = lookup(id);
+        if (!s->stack) {
+            stacks.emplace_back();
+            s->id = id;
+            s->stack = &stacks.back();
+            count++;
+        }
+        cur_id = id;
+        cur = s->stack;
+        return *cur;
+    }
+
+private:
+    struct slot {
+        stackid id;
+        shadow_stack *stack;    // NULL for an empty slot
+    };
+    std::vector<slot> slots;
+    std::deque<shadow_stack> stacks;
+    size_t count;
+    size_t mask;
+    stackid cur_id;
+    shadow_stack *cur;
+
+    slot *lookup(const stackid &id) {
+        uint64_t h = ((uint64_t) id.asid * 0x9e3779b97f4a7c15ULL) ^ id.base;
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 32;
+        size_t i = h & mask;
+        while (slots[i].stack && !(slots[i].id == id)) i = (i + 1) & mask;
+        return &slots[i];
+    }
+
+    void grow() {
+        std::vector<slot> old;
+        old.swap(slots);
+        slots.assign(old.empty() ? 64 : old.size() * 2, slot());
+        mask = slots.size() - 1;
+        for (auto &s : old) {
+            if (s.stack) *lookup(s.id) = s;
+        }
+    }
+};
+
+stack_table stacks;
 
 static inline bool in_kernelspace(CPUArchState* env) {
 #if defined(TARGET_I386)
@@ -115,6 +189,8 @@ static inline bool in_kernelspace(CPUArchState* env) {
 static inline target_ulong get_stack_pointer(CPUArchState* env) {
 #if defined(TARGET_I386)
     return env->regs[R_ESP];
+#elif defined(TARGET_AARCH64)
+    return is_a64(env) ? env->xregs[31] : env->regs[13];
 #elif defined(TARGET_ARM)
     return env->regs[13];
 #else
@@ -142,69 +218,55 @@ static stackid get_stackid(CPUArchState* env) {
 
     // We can short-circuit the search in most cases
     if (std::abs(sp - cached_sp) < MAX_STACK_DIFF) {
-        return std::make_pair(asid, cached_sp);
+        return stackid{asid, cached_sp};
     }
 
     auto &stackset = stacks_seen[asid];
     if (stackset.empty()) {
         stackset.insert(sp);
         cached_sp = sp;
-        return std::make_pair(asid,sp);
+        return stackid{asid, sp};
     }
     else {
         // Find the closest stack pointer we've seen
-        auto lb = std::lower_bound(stackset.begin(), stackset.end(), sp);
-        target_ulong stack1 = *lb;
-        lb--;
-        target_ulong stack2 = *lb;
-        target_ulong stack = (std::abs(stack1 - sp) < std::abs(stack2 - sp)) ? stack1 : stack2;
+        auto lb = stackset.lower_bound(sp);
+        target_ulong stack;
+        if (lb == stackset.end()) {
+            stack = *std::prev(lb);
+        } else if (lb == stackset.begin()) {
+            stack = *lb;
+        } else {
+            target_ulong stack1 = *lb;
+            target_ulong stack2 = *std::prev(lb);
+            stack = (std::abs(stack1 - sp) < std::abs(stack2 - sp)) ? stack1 : stack2;
+        }
         int diff = std::abs(stack-sp);
         if (diff < MAX_STACK_DIFF) {
-            return std::make_pair(asid,stack);
+            return stackid{asid, stack};
         }
         else {
             stackset.insert(sp);
             cached_sp = sp;
-            return std::make_pair(asid,sp);
+            return stackid{asid, sp};
         }
     }
 #else
-    return panda_current_asid(ENV_GET_CPU(env));
+    return stackid{panda_current_asid(ENV_GET_CPU(env)), 0};
 #endif
 }
 
+static inline shadow_stack &current_stack(CPUArchState* env) {
+    return stacks[get_stackid(env)];
+}
+
+#ifdef DISAS_BLOCKS
 instr_type disas_block(CPUArchState* env, target_ulong pc, int size) {
     unsigned char *buf = (unsigned char *) malloc(size);
     int err = panda_virtual_memory_rw(ENV_GET_CPU(env), pc, buf, size, 0);
     if (err == -1) printf("Couldn't read TB memory!\n");
     instr_type res = INSTR_UNKNOWN;
-
-#if defined(TARGET_I386)
-    csh handle = (env->hflags & HF_CS64_MASK) ? cs_handle_64 : cs_handle_32;
-#if !defined(TARGET_X86_64)
-    // not every block in i386 is necessary executing in the same processor mode
-    // need to make capstone match current mode or may miss call statements
-    if ((env->hflags & HF_CS32_MASK) == 0) {
-        cs_option(handle, CS_OPT_MODE, CS_MODE_16);
-    }
-    else {
-        cs_option(handle, CS_OPT_MODE, CS_MODE_32);
-    }
-#endif
-#elif defined(TARGET_ARM)
     csh handle = cs_handle_32;
 
-    if (env->thumb){
-        cs_option(handle, CS_OPT_MODE, CS_MODE_THUMB);
-    }
-    else {
-        cs_option(handle, CS_OPT_MODE, CS_MODE_ARM);
-    }
-
-#elif defined(TARGET_PPC)
-    csh handle = cs_handle_32;
-#endif
-
     cs_insn *insn;
     cs_insn *end;
     size_t count = cs_disasm(handle, buf, size, pc, 0, &insn);
@@ -231,58 +293,110 @@ done2:
     free(buf);
     return res;
 }
+#endif
+
+// Refresh the state published to inline readers from the current stack.
+static inline void update_shared_state(CPUArchState* env,
+                                       std::vector<stack_entry> &v) {
+    ppp_shared_callstack_instr_state.depth = v.size();
+    if (v.empty()) return;
+    // get_callers(..., 1, ...) reports the bottom of the stack
+    ppp_shared_callstack_instr_state.caller = v.front().pc;
+    ppp_shared_callstack_instr_state.asid = in_kernelspace(env) ? 0 :
+        panda_current_asid(ENV_GET_CPU(env));
+}
 
+int asid_changed(CPUState *cpu, target_ulong old_asid, target_ulong new_asid) {
+    // Force readers onto the slow path until the next block starts.
+    ppp_shared_callstack_instr_state.depth = 0;
+    return 0;
+}
+
+#ifdef DISAS_BLOCKS
 int after_block_translate(CPUState *cpu, TranslationBlock *tb) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
 
-    call_cache[tb->pc] = disas_block(env, tb->pc, tb->size);
+    // Classified once per translation and kept with the block
+    tb->panda_call_type = disas_block(env, tb->pc, tb->size);
 
     return 1;
 }
+#endif
 
-int before_block_exec(CPUState *cpu, TranslationBlock *tb) {
-    CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    std::vector<stack_entry> &v = callstacks[get_stackid(env)];
-    std::vector<target_ulong> &w = function_stacks[get_stackid(env)];
-    if (v.empty()) return 1;
-
-    // Search up to 10 down
-    for (int i = v.size()-1; i > ((int)(v.size()-10)) && i >= 0; i--) {
-        if (tb->pc == v[i].pc) {
-            //printf("Matched at depth %d\n", v.size()-i);
-            //v.erase(v.begin()+i, v.end());
-
-            PPP_RUN_CB(on_ret, cpu, w[i]);
-            v.erase(v.begin()+i, v.end());
-            w.erase(w.begin()+i, w.end());
+// Pops the frames left by a return to pc, with the stack pointer at sp.
+static void do_return(CPUState *cpu, shadow_stack &s, target_ulong pc,
+                      target_ulong sp) {
+    std::vector<stack_entry> &v = s.calls;
+    size_t keep = v.size();
 
+    // Search up to 10 down for the return address
+    for (size_t i = v.size(); i > 0 && i + 10 > v.size(); i--) {
+        if (v[i-1].pc == pc) {
+            keep = i - 1;
             break;
         }
     }
 
+    // Frames below the stack pointer are gone, even if they never
+    // returned (longjmp, exception unwinding). On ARM a leaf function
+    // returns with the stack pointer it was called with, so this doesn't
+    // replace the search above.
+    while (keep > 0 && v[keep-1].sp < sp && sp - v[keep-1].sp < MAX_UNWIND_DIFF) {
+        keep--;
+    }
+
+    if (keep < v.size()) {
+        PPP_RUN_CB(on_ret, cpu, s.functions[keep]);
+        v.resize(keep);
+        s.functions.resize(keep);
+    }
+}
+
+int before_block_exec(CPUState *cpu, TranslationBlock *tb) {
+    CPUArchState* env = (CPUArchState*)cpu->env_ptr;
+    shadow_stack &s = current_stack(env);
+
+    // Calls and returns are handled after the blocks ending in them. Some
+    // returns aren't marked by the translator (ARM mov pc, lr, APCS
+    // ldm fp, {..., sp, pc}, AArch64 br x30), so also pop when a block
+    // starts at the return address on top of the stack. The stack pointer
+    // check keeps a recursive call returning to the same address from
+    // popping twice.
+    if (!s.calls.empty() && s.calls.back().pc == tb->pc) {
+        target_ulong sp = get_stack_pointer(env);
+        if (sp >= s.calls.back().sp) do_return(cpu, s, tb->pc, sp);
+    }
+    update_shared_state(env, s.calls);
     return 0;
 }
 
 int after_block_exec(CPUState* cpu, TranslationBlock *tb) {
+    if (likely(tb->panda_call_type == 0)) return 1;
+
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    instr_type tb_type = call_cache[tb->pc];
+    shadow_stack &s = current_stack(env);
+    target_ulong ret_addr = tb->pc + tb->size;
 
-    if (tb_type == INSTR_CALL) {
-        stack_entry se = {tb->pc+tb->size,tb_type};
-        callstacks[get_stackid(env)].push_back(se);
+    // Where the block went, in an architecture-neutral way
+    target_ulong pc, cs_base;
+    uint32_t flags;
+    cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
 
+    if (tb->panda_call_type == INSTR_CALL) {
+        // conditional call (ARM) not taken
+        if (pc == ret_addr) return 1;
+
+        stack_entry se = {ret_addr, get_stack_pointer(env), INSTR_CALL};
+        s.calls.push_back(se);
         // Also track the function that gets called
-        target_ulong pc, cs_base;
-        uint32_t flags;
-        // This retrieves the pc in an architecture-neutral way
-        cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
-        function_stacks[get_stackid(env)].push_back(pc);
+        s.functions.push_back(pc);
+        update_shared_state(env, s.calls);
 
         PPP_RUN_CB(on_call, cpu, pc);
     }
-    else if (tb_type == INSTR_RET) {
-        //printf("Just executed a RET in TB " TARGET_FMT_lx "\n", tb->pc);
-        //if (next) printf("Next TB: " TARGET_FMT_lx "\n", next->pc);
+    else if (tb->panda_call_type == INSTR_RET) {
+        do_return(cpu, s, pc, get_stack_pointer(env));
+        update_shared_state(env, s.calls);
     }
 
     return 1;
@@ -294,7 +408,7 @@ int after_block_exec(CPUState* cpu, TranslationBlock *tb) {
  */
 uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    std::vector<stack_entry> &v = callstacks[get_stackid(env)];
+    std::vector<stack_entry> &v = current_stack(env).calls;
 
     n = std::min((uint32_t)v.size(), n);
     for (uint32_t i=0; i<n; i++) { callers[i] = v[n-1-i].pc; }
@@ -309,12 +423,11 @@ uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
 Panda__CallStack *pandalog_callstack_create() {
     assert(pandalog);
     CPUArchState* env = (CPUArchState*)first_cpu->env_ptr;
-    std::vector<stack_entry> &v = callstacks[get_stackid(env)];
+    std::vector<stack_entry> &v = current_stack(env).calls;
 
-    Panda__CallStack *cs = (Panda__CallStack *)malloc(sizeof(Panda__CallStack));
-    *cs = PANDA__CALL_STACK__INIT;
+    Panda__CallStack *cs = pandalog_new(Panda__CallStack, PANDA__CALL_STACK__INIT);
     cs->n_addr = std::min((uint32_t)v.size(), (uint32_t)CALLSTACK_MAX_SIZE);
-    cs->addr = (uint64_t *)malloc(cs->n_addr * sizeof(uint64_t));
+    cs->addr = pandalog_new_array(uint64_t, cs->n_addr);
 
     for (uint32_t i=0; i<cs->n_addr; i++) { cs->addr[i] = v[cs->n_addr-1-i].pc; }
 
@@ -324,10 +437,10 @@ Panda__CallStack *pandalog_callstack_create() {
 
 /**
  * @brief Frees a pandalog entry containing callstack information.
+ * The callstack lives in the pandalog entry arena and is released by
+ * pandalog_write_entry, so there is nothing left to do here.
  */
 void pandalog_callstack_free(Panda__CallStack *cs) {
-    free(cs->addr);
-    free(cs);
 }
 
 
@@ -336,7 +449,7 @@ void pandalog_callstack_free(Panda__CallStack *cs) {
  */
 uint32_t get_functions(target_ulong functions[], uint32_t n, CPUState* cpu) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    std::vector<target_ulong> &v = function_stacks[get_stackid(env)];
+    std::vector<target_ulong> &v = current_stack(env).functions;
 
     n = std::min((uint32_t)v.size(), n);
     for (uint32_t i=0; i<n; i++) { functions[i] = v[n-1-i]; }
@@ -376,25 +489,12 @@ void get_prog_point(CPUState* cpu, prog_point *p) {
 
 
 bool init_plugin(void *self) {
-#if defined(TARGET_I386)
-    if (cs_open(CS_ARCH_X86, CS_MODE_32, &cs_handle_32) != CS_ERR_OK)
-        return false;
-#if defined(TARGET_X86_64)
-    if (cs_open(CS_ARCH_X86, CS_MODE_64, &cs_handle_64) != CS_ERR_OK)
-        return false;
-#endif
-#elif defined(TARGET_ARM)
-    if (cs_open(CS_ARCH_ARM, CS_MODE_ARM, &cs_handle_32) != CS_ERR_OK)
-        return false;
-#elif defined(TARGET_PPC)
+#ifdef DISAS_BLOCKS
     if (cs_open(CS_ARCH_PPC, CS_MODE_32, &cs_handle_32) != CS_ERR_OK)
         return false;
-#endif
 
     // Need details in capstone to have instruction groupings
     cs_option(cs_handle_32, CS_OPT_DETAIL, CS_OPT_ON);
-#if defined(TARGET_X86_64)
-    cs_option(cs_handle_64, CS_OPT_DETAIL, CS_OPT_ON);
 #endif
 
     panda_cb pcb;
@@ -402,12 +502,16 @@ bool init_plugin(void *self) {
     panda_enable_memcb();
     panda_enable_precise_pc();
 
+#ifdef DISAS_BLOCKS
     pcb.after_block_translate = after_block_translate;
     panda_register_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, pcb);
+#endif
     pcb.after_block_exec = after_block_exec;
     panda_register_callback(self, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
     pcb.before_block_exec = before_block_exec;
     panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+    pcb.asid_changed = asid_changed;
+    panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
 
     return true;
 }
@@ -6,4 +6,29 @@
 typedef void (* on_call_t)(CPUState *env, target_ulong func);
 typedef void (* on_ret_t)(CPUState *env, target_ulong func);
 
+// State published for inline readers (see PPP_SHARED_DATA). It is updated
+// at every block boundary and cleared on ASID changes, so it describes the
+// shadow stack of the block being executed.
+typedef struct callstack_instr_state {
+    uint32_t depth;             // depth of the current shadow stack
+    target_ulong caller;        // caller reported by get_prog_point(), if depth > 0
+    target_ulong asid;          // asid reported by get_prog_point(), 0 in kernel mode
+} callstack_instr_state;
+
+// Inline fast path of get_prog_point(). Returns false when the caller must
+// fall back to get_prog_point(), i.e. when the shadow stack is empty.
+static inline bool get_prog_point_fast(const callstack_instr_state *cs,
+                                       CPUState *cpu, prog_point *p) {
+    if (cs->depth == 0) return false;
+    if (cs->asid) p->cr3 = cs->asid;
+    p->caller = cs->caller;
+    p->pc = cpu->panda_guest_pc;
+    return true;
+}
+
+// Depth of the shadow stack of the block being executed.
+static inline uint32_t get_callstack_depth(const callstack_instr_state *cs) {
+    return cs->depth;
+}
+
 #endif
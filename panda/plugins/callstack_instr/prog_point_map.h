@@ -0,0 +1,108 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __PROG_POINT_MAP_H
+#define __PROG_POINT_MAP_H
+
+// Open addressing hash table from prog_point to per tap point state, for
+// plugins that look up their tap point on every memory access.
+//
+// Values are kept in a dense array in insertion order, and the hash table
+// only holds (key, index) slots, so a lookup touches one or two cache lines
+// and inserting doesn't allocate until the table grows. References to values
+// are invalidated by inserting.
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+#include "prog_point.h"
+
+static inline uint64_t prog_point_hash(const prog_point &p) {
+    uint64_t h = (uint64_t) p.pc * 0x9e3779b97f4a7c15ULL;
+    h ^= (uint64_t) p.caller + 0x7f4a7c159e3779b9ULL + (h << 6) + (h >> 2);
+    h ^= (uint64_t) p.cr3 + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    // finalizer from murmur3, so the low bits depend on all of the key
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+template <typename V>
+class prog_point_map {
+public:
+    typedef std::pair<prog_point, V> entry;
+    typedef typename std::vector<entry>::iterator iterator;
+    typedef typename std::vector<entry>::const_iterator const_iterator;
+
+    prog_point_map() : mask(0), last(0) {}
+
+    // Returns the value for p, inserting a value-initialized one if needed.
+    V &operator[](const prog_point &p) {
+        // consecutive accesses usually come from the same tap point
+        if (last < entries.size() && entries[last].first == p) {
+            return entries[last].second;
+        }
+        if ((entries.size() + 1) * 2 > table.size()) grow();
+        uint32_t *slot = lookup(p);
+        if (*slot == 0) {
+            entries.push_back(entry(p, V()));
+            *slot = entries.size();
+        }
+        last = *slot - 1;
+        return entries[last].second;
+    }
+
+    // Returns the value for p, or NULL if there is none.
+    V *find(const prog_point &p) {
+        if (table.empty()) return NULL;
+        uint32_t idx = *lookup(p);
+        return idx ? &entries[idx - 1].second : NULL;
+    }
+
+    size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    void clear() {
+        entries.clear();
+        table.clear();
+        mask = 0;
+        last = 0;
+    }
+
+    // Iterates over (prog_point, value) pairs in insertion order.
+    iterator begin() { return entries.begin(); }
+    iterator end() { return entries.end(); }
+    const_iterator begin() const { return entries.begin(); }
+    const_iterator end() const { return entries.end(); }
+
+private:
+    // index + 1 into entries, 0 for an empty slot
+    std::vector<uint32_t> table;
+    std::vector<entry> entries;
+    size_t mask;
+    size_t last;
+
+    // Returns the slot holding p, or the empty slot where it belongs.
+    uint32_t *lookup(const prog_point &p) {
+        size_t i = prog_point_hash(p) & mask;
+        while (table[i] != 0 && !(entries[table[i] - 1].first == p)) {
+            i = (i + 1) & mask;
+        }
+        return &table[i];
+    }
+
+    void grow() {
+        size_t n = table.empty() ? 64 : table.size() * 2;
+        table.assign(n, 0);
+        mask = n - 1;
+        for (uint32_t j = 0; j < entries.size(); j++) {
+            *lookup(entries[j].first) = j + 1;
+        }
+    }
+};
+
+#endif
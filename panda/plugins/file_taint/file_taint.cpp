@@ -256,7 +256,7 @@ std::map<ThreadInfo, ReadInfo> seen_reads;
 
 uint64_t last_pos = (uint64_t) -1;
 
-void read_enter(CPUState *cpu, target_ulong pc, std::string filename, uint64_t pos, uint32_t buf, uint32_t count) {
+void read_enter(CPUState *cpu, target_ulong pc, std::string filename, uint64_t pos, target_ulong buf, uint32_t count) {
     // these things are only known at enter of read call
     last_pos = pos;
     if (debug) printf ("read_enter filename=[%s]\n", filename.c_str());
@@ -293,7 +293,7 @@ void read_enter(CPUState *cpu, target_ulong pc, std::string filename, uint64_t p
 
 // 3 long sys_read(unsigned int fd, char __user *buf, size_t count);
 // typedef void (*on_sys_read_return_t)(CPUState *cpu,target_ulong pc,uint32_t fd,target_ulong buf,uint32_t count);
-void read_return(CPUState *cpu, target_ulong pc, uint32_t buf, uint32_t actual_count, uint32_t bytes_left_on_stack) {
+void read_return(CPUState *cpu, target_ulong pc, target_ulong buf, uint32_t actual_count, uint32_t bytes_left_on_stack) {
     ThreadInfo thread{ panda_current_asid(cpu), panda_current_sp(cpu) - bytes_left_on_stack };
     auto it = seen_reads.find(thread);
     if (it != seen_reads.end()) {
@@ -392,8 +392,8 @@ void windows_create_return(CPUState *cpu, target_ulong pc, uint32_t FileHandle,
 
 char stdin_filename[] = "stdin";
 
-void linux_pread_enter(CPUState *cpu, target_ulong pc,
-        uint32_t fd, uint32_t buf, uint32_t count, uint64_t pos) {
+static void linux_fd_read_enter(CPUState *cpu, target_ulong pc,
+        uint32_t fd, target_ulong buf, uint32_t count, uint64_t pos) {
     target_ulong asid = panda_current_asid(cpu);
     if(!cache_process_details_on_basic_block) cache_process_details(cpu, NULL);
     if (running_procs.count(asid) == 0) {
@@ -422,6 +422,11 @@ void linux_pread_enter(CPUState *cpu, target_ulong pc,
     read_enter(cpu, pc, filename, pos, buf, count);
 }
 
+void linux_pread_enter(CPUState *cpu, target_ulong pc,
+        uint32_t fd, uint32_t buf, uint32_t count, uint64_t pos) {
+    linux_fd_read_enter(cpu, pc, fd, buf, count, pos);
+}
+
 void linux_pread_return(CPUState *cpu, target_ulong pc,
         uint32_t fd, uint32_t buf, uint32_t count, uint64_t pos) {
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
@@ -436,8 +441,34 @@ void linux_read_return(CPUState *cpu, target_ulong pc,
 
 void linux_read_enter(CPUState *cpu, target_ulong pc,
         uint32_t fd, uint32_t buf, uint32_t count) {
-    linux_pread_enter(cpu, pc, fd, buf, count, -1);
+    linux_fd_read_enter(cpu, pc, fd, buf, count, -1);
+}
+
+#ifdef TARGET_X86_64
+// The x64 profile passes pointers and sizes as 64-bit values and
+// reports its system calls under on_x64_ names.
+void linux_x64_pread_enter(CPUState *cpu, target_ulong pc,
+        uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos) {
+    linux_fd_read_enter(cpu, pc, fd, buf, count, pos);
+}
+
+void linux_x64_pread_return(CPUState *cpu, target_ulong pc,
+        uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos) {
+    CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    read_return(cpu, pc, buf, env->regs[R_EAX], 0);
+}
+
+void linux_x64_read_enter(CPUState *cpu, target_ulong pc,
+        uint32_t fd, uint64_t buf, uint64_t count) {
+    linux_fd_read_enter(cpu, pc, fd, buf, count, -1);
+}
+
+void linux_x64_read_return(CPUState *cpu, target_ulong pc,
+        uint32_t fd, uint64_t buf, uint64_t count) {
+    CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    read_return(cpu, pc, buf, env->regs[R_EAX], 0);
 }
+#endif
 
 #endif
 
@@ -467,6 +498,22 @@ void linux_openat_enter(CPUState *cpu, target_ulong pc, int32_t dirfd, uint32_t
     if (debug) printf ("linux openat asid=0x%x filename=[%s]\n", (unsigned int) panda_current_asid(cpu), the_filename);
     open_enter(cpu, pc, the_filename, flags, mode);
 }
+
+#ifdef TARGET_X86_64
+void linux_x64_open_enter(CPUState *cpu, target_ulong pc, uint64_t filename, int32_t flags, int32_t mode) {
+    char the_filename[MAX_FILENAME];
+    guest_strncpy(cpu, the_filename, MAX_FILENAME, filename);
+    if (debug) printf ("linux open asid=0x%x filename=[%s]\n", (unsigned int) panda_current_asid(cpu), the_filename);
+    open_enter(cpu, pc, the_filename, flags, mode);
+}
+
+void linux_x64_openat_enter(CPUState *cpu, target_ulong pc, int32_t dirfd, uint64_t filename, int32_t flags, int32_t mode) {
+    char the_filename[MAX_FILENAME];
+    guest_strncpy(cpu, the_filename, MAX_FILENAME, filename);
+    if (debug) printf ("linux openat asid=0x%x filename=[%s]\n", (unsigned int) panda_current_asid(cpu), the_filename);
+    open_enter(cpu, pc, the_filename, flags, mode);
+}
+#endif
 #endif /* TARGET_I386 */
 
 
@@ -566,6 +613,12 @@ bool init_plugin(void *self) {
     // you must use '-os os_name' cmdline arg!
     assert (!(panda_os_familyno == OS_UNKNOWN));
 
+    // the Windows handlers read 32-bit OBJECT_ATTRIBUTES and IO_STATUS_BLOCK
+    if (panda_os_familyno == OS_WINDOWS && panda_os_bits != 32) {
+        printf ("file_taint: only 32-bit Windows guests are supported\n");
+        return false;
+    }
+
     panda_require("osi");
     assert(init_osi_api());
     panda_require("syscalls2");
@@ -579,12 +632,30 @@ bool init_plugin(void *self) {
         panda_require("osi_linux");
         assert(init_osi_linux_api());
 
+#ifdef TARGET_X86_64
+        if (panda_os_bits == 64) {
+            PPP_REG_CB("syscalls2", on_x64_sys_open_enter, linux_x64_open_enter);
+            PPP_REG_CB("syscalls2", on_x64_sys_read_enter, linux_x64_read_enter);
+            PPP_REG_CB("syscalls2", on_x64_sys_openat_enter, linux_x64_openat_enter);
+            PPP_REG_CB("syscalls2", on_x64_sys_read_return, linux_x64_read_return);
+            PPP_REG_CB("syscalls2", on_x64_sys_pread64_enter, linux_x64_pread_enter);
+            PPP_REG_CB("syscalls2", on_x64_sys_pread64_return, linux_x64_pread_return);
+        } else {
+            PPP_REG_CB("syscalls2", on_sys_open_enter, linux_open_enter);
+            PPP_REG_CB("syscalls2", on_sys_read_enter, linux_read_enter);
+            PPP_REG_CB("syscalls2", on_sys_openat_enter, linux_openat_enter);
+            PPP_REG_CB("syscalls2", on_sys_read_return, linux_read_return);
+            PPP_REG_CB("syscalls2", on_sys_pread64_enter, linux_pread_enter);
+            PPP_REG_CB("syscalls2", on_sys_pread64_return, linux_pread_return);
+        }
+#else
         PPP_REG_CB("syscalls2", on_sys_open_enter, linux_open_enter);
         PPP_REG_CB("syscalls2", on_sys_read_enter, linux_read_enter);
         PPP_REG_CB("syscalls2", on_sys_openat_enter, linux_openat_enter);
         PPP_REG_CB("syscalls2", on_sys_read_return, linux_read_return);
         PPP_REG_CB("syscalls2", on_sys_pread64_enter, linux_pread_enter);
         PPP_REG_CB("syscalls2", on_sys_pread64_return, linux_pread_return);
+#endif
     }
 
     if (panda_os_familyno == OS_WINDOWS) {
@@ -623,7 +694,7 @@ bool init_plugin(void *self) {
     }
 
 #else
-    printf ("file_taint: only works for x86 target (really just 32-bit)\n");
+    printf ("file_taint: only works for x86 targets\n");
     return false;
 
 #endif
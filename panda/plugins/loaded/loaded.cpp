@@ -94,7 +94,7 @@ void linux_old_mmap_return(CPUState *cpu, target_ulong pc, uint32_t arg_ptr) {
     }
 }
 
-void linux_mmap_pgoff_return(CPUState *cpu,target_ulong pc,uint32_t addr,uint32_t len,uint32_t prot,uint32_t flags,uint32_t fd,uint32_t pgoff) {
+static void mmap_return(CPUState *cpu, target_ulong pc, uint32_t len, uint32_t prot, uint32_t flags, uint32_t fd, target_ulong pgoff) {
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     target_ulong asid = panda_current_asid(cpu);
     if (running_procs.count(asid) == 0) {
@@ -116,7 +116,7 @@ void linux_mmap_pgoff_return(CPUState *cpu,target_ulong pc,uint32_t addr,uint32_
             printf ("[loaded] linux_mmap_pgoff(fd=%d filename=[%s] "
                     "len=%d prot=%x flags=%x "
                     "pgoff=%d)=" TARGET_FMT_lx "\n", (int) fd,
-                    filename, len, prot, flags, pgoff, env->regs[R_EAX]);
+                    filename, len, prot, flags, (int) pgoff, env->regs[R_EAX]);
         }
         PPP_RUN_CB(on_library_load, cpu, pc, filename, env->regs[R_EAX], len)
     } else if ((prot & 0x04) == 0x04) {
@@ -124,9 +124,19 @@ void linux_mmap_pgoff_return(CPUState *cpu,target_ulong pc,uint32_t addr,uint32_
         printf ("[loaded] linux_mmap_pgoff(fd=%d "
                 "len=%d prot=%x flags=%x "
                 "pgoff=%d)=" TARGET_FMT_lx "\n", (int) fd,
-                len, prot, flags, pgoff, env->regs[R_EAX]);
+                len, prot, flags, (int) pgoff, env->regs[R_EAX]);
     }
 }
+
+#if defined(TARGET_X86_64)
+// 9 long sys_mmap ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long off']
+void linux_x64_mmap_return(CPUState *cpu,target_ulong pc,uint64_t addr,uint64_t len,uint64_t prot,uint64_t flags,uint64_t fd,uint64_t off) {
+    mmap_return(cpu, pc, len, prot, flags, fd, off >> 12);
+}
+#endif
+void linux_mmap_pgoff_return(CPUState *cpu,target_ulong pc,uint32_t addr,uint32_t len,uint32_t prot,uint32_t flags,uint32_t fd,uint32_t pgoff) {
+    mmap_return(cpu, pc, len, prot, flags, fd, pgoff);
+}
 #endif
 
 // get current process before each bb execs
@@ -181,7 +191,15 @@ bool init_plugin(void *self) {
         panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
     }
 
+#if defined(TARGET_X86_64)
+    if (panda_os_bits == 64) {
+        PPP_REG_CB("syscalls2", on_x64_sys_mmap_return, linux_x64_mmap_return);
+    } else {
+        PPP_REG_CB("syscalls2", on_sys_mmap_pgoff_return, linux_mmap_pgoff_return);
+    }
+#else
     PPP_REG_CB("syscalls2", on_sys_mmap_pgoff_return, linux_mmap_pgoff_return);
+#endif
     // don't use these at them moment
     //PPP_REG_CB("syscalls2", on_sys_old_mmap_return, linux_old_mmap_return);
     //PPP_REG_CB("syscalls2", on_sys_mprotect_return, linux_mprotect_return);
@@ -30,12 +30,15 @@ PANDAENDCOMMENT */
 #include "os_intro.h"
 #ifdef OSI_PROC_EVENTS
 #include "osi_proc_events.h"
+#include "syscalls2/gen_syscalls_ext_typedefs.h"
 #endif
 
 bool init_plugin(void *);
 void uninit_plugin(void *);
 #ifdef OSI_PROC_EVENTS
 int asid_changed(CPUState *, target_ulong, target_ulong);
+int procstate_before_block_exec(CPUState *, TranslationBlock *);
+void linux_exit_group_enter(CPUState *, target_ulong, int32_t);
 #endif
 
 PPP_PROT_REG_CB(on_get_processes)
@@ -104,17 +107,42 @@ void free_osimodules(OsiModules *ms) {
 
 
 #ifdef OSI_PROC_EVENTS
+/*
+ * The process table is kept between context switches (see ProcState), so
+ * switching to a known process costs a hash lookup. The guest process list
+ * is only read when an unknown asid shows up, which is when a process has
+ * been forked or has exec'd. Linux processes leaving through exit_group()
+ * are reported right away; others (e.g. killed by a signal) are noticed at
+ * the next update.
+ */
+static void *osi_self;
+static panda_cb procstate_pcb = { .before_block_exec = procstate_before_block_exec };
+static target_ulong pending_asid;
+
 int asid_changed(CPUState *cpu, target_ulong oldval, target_ulong newval) {
+    if (procstate_known(newval)) return 0;
+
+    /* The new page directory isn't loaded yet and introspection providers
+     * may cache per asid, so read the process list once it is in place. */
+    pending_asid = newval;
+    panda_enable_callback(osi_self, PANDA_CB_BEFORE_BLOCK_EXEC, procstate_pcb);
+    return 0;
+}
+
+int procstate_before_block_exec(CPUState *cpu, TranslationBlock *tb) {
     uint32_t i;
     OsiProcs *ps, *in, *out;
     ps = in = out = NULL;
 
+    panda_disable_callback(osi_self, PANDA_CB_BEFORE_BLOCK_EXEC, procstate_pcb);
+
     /* some callback has to be registered for retrieving processes */
     assert(PPP_CHECK_CB(on_get_processes) != 0);
 
     /* update process state */
     ps = get_processes(cpu);
-    procstate_update(ps, &in, &out);
+    if (ps == NULL) return 0;
+    procstate_update(ps, pending_asid, &in, &out);
 
     /* invoke callbacks for finished processes */
     if (out != NULL) {
@@ -134,6 +162,13 @@ int asid_changed(CPUState *cpu, target_ulong oldval, target_ulong newval) {
 
     return 0;
 }
+
+void linux_exit_group_enter(CPUState *cpu, target_ulong pc, int32_t error_code) {
+    OsiProc *p = procstate_remove(panda_current_asid(cpu));
+    if (p == NULL) return;
+    PPP_RUN_CB(on_process_end, cpu, p);
+    free_osiproc(p);
+}
 #endif
 
 extern const char *qemu_file;
@@ -142,6 +177,9 @@ bool init_plugin(void *self) {
 #ifdef OSI_PROC_EVENTS
     panda_cb pcb = { .asid_changed = asid_changed };
     panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+    osi_self = self;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, procstate_pcb);
+    panda_disable_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, procstate_pcb);
 #endif
     // No os supplied on command line? E.g. -os linux-32-ubuntu:4.4.0-130-generic
     assert (!(panda_os_familyno == OS_UNKNOWN));
@@ -204,6 +242,18 @@ bool init_plugin(void *self) {
         g_free(kconfgroup);
 
         panda_require("osi_linux");
+#ifdef OSI_PROC_EVENTS
+        panda_require("syscalls2");
+#if defined(TARGET_X86_64)
+        if (panda_os_bits == 64) {
+            PPP_REG_CB("syscalls2", on_x64_sys_exit_group_enter, linux_exit_group_enter);
+        } else {
+            PPP_REG_CB("syscalls2", on_sys_exit_group_enter, linux_exit_group_enter);
+        }
+#else
+        PPP_REG_CB("syscalls2", on_sys_exit_group_enter, linux_exit_group_enter);
+#endif
+#endif
     }
     if (panda_os_familyno == OS_WINDOWS) {
         g_printf("OSI grabbing Windows introspection backend.\n");
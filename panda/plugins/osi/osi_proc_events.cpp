@@ -6,24 +6,18 @@ extern "C" {
 
 #include <glib.h>
 #include <string.h>
-#include <algorithm>
-#include <iterator>
-#include <set>
-#include <map>
 
 /*! @brief The global process state. */
 ProcState pstate;
 
 /*! @brief Constructor. */
 ProcState::ProcState(void) {
-	this->pid_set = new PidSet();
 	this->proc_map = new ProcMap();
 	return;
 }
 
 /*! @brief Destructor. */
 ProcState::~ProcState(void) {
-	if (this->pid_set != NULL) delete this->pid_set;
 	if (this->proc_map != NULL) delete this->proc_map;
 
 	// This destructor is called at the end of the replay.
@@ -32,8 +26,14 @@ ProcState::~ProcState(void) {
 	free_osiprocs_g(this->ps);
 }
 
+/*! @brief Checks if `asid` belongs to a known process, or wasn't found
+ * in the guest process list the last time it was looked for. */
+bool ProcState::known(target_ulong asid) {
+	return this->proc_map->count(asid) != 0 || this->unmatched.count(asid) != 0;
+}
+
 /*! @brief Gets a subset of the processes in `ProcMap`. */
-OsiProcs *ProcState::OsiProcsSubset(ProcMap *m, PidSet *s) {
+OsiProcs *ProcState::OsiProcsSubset(ProcMap *m, AsidSet *s) {
 	int notfound = 0;
 	OsiProcs *ps = (OsiProcs *)g_malloc0(sizeof(OsiProcs));
 
@@ -60,6 +60,9 @@ error:
 }
 
 /*! @brief Updates the ProcState with the new process set.
+ * `asid` is the address space that prompted the update. If it isn't
+ * found in `ps`, it is treated as known until the process table changes,
+ * so it doesn't prompt another update every time it is scheduled.
  * If `in` and `out` are not NULL, the new and finished processes
  * will be returned through them.
  *
@@ -67,9 +70,10 @@ error:
  * the passed `ps` becomes part of the ProcState.
  * Therefore, it must not be freed by the caller.
  */
-void ProcState::update(OsiProcs *ps, OsiProcs **in, OsiProcs **out){
-	PidSet *pid_set_new = new PidSet();
+void ProcState::update(OsiProcs *ps, target_ulong asid, OsiProcs **in, OsiProcs **out){
 	ProcMap *proc_map_new = new ProcMap();
+	AsidPidSet exiting_new;
+	bool changed;
 
 	// copy data to c++ containers
 #ifdef PROC_EVENTS_DBG
@@ -77,67 +81,107 @@ void ProcState::update(OsiProcs *ps, OsiProcs **in, OsiProcs **out){
 #endif
 	for (unsigned int i=0; i<ps->num; i++) {
 		OsiProc *p = &ps->proc[i];
-		target_ulong asid = p->asid;
+		target_ulong p_asid = p->asid;
 
 		// Address Space identifier for all kernel tasks is 0.
 		// This is because they have no mm struct associated with them.
 		// Skip them.
-		if (asid == 0) continue;
+		if (p_asid == 0) continue;
+
+		// Processes already reported by remove() stay out of the table
+		// until the guest has torn them down. The pid is checked too, as
+		// the guest may reuse the address space for the next process.
+		auto key = std::make_pair(p_asid, p->pid);
+		if (this->exiting.count(key)) {
+			exiting_new.insert(key);
+			continue;
+		}
 
 #ifdef PROC_EVENTS_DBG
 		printf("*\t%-10s\t" TARGET_FMT_lu "\t" TARGET_FMT_lu "\t" TARGET_FMT_lx "\n", p->name, p->pid, p->ppid, p->asid);
 #endif
 
-		pid_set_new->insert(asid);
-		auto ret = proc_map_new->insert(std::make_pair(asid, p));
+		auto ret = proc_map_new->insert(std::make_pair(p_asid, p));
 
 		// ret type is pair<iterator, bool>
-		if (!ret.second && (asid != 0)) {
-			LOG_INFO("DUP " TARGET_FMT_lu " %s/%s", asid, ((*(ret.first)).second->name), p->name);
+		if (!ret.second) {
+			LOG_INFO("DUP " TARGET_FMT_lu " %s/%s", p_asid, ((*(ret.first)).second->name), p->name);
 		}
 	}
 #ifdef PROC_EVENTS_DBG
 	printf("*+**********\n");
 #endif
 
+	// find the asids of incoming/outgoing processes
+	AsidSet asid_in, asid_out;
+	for (auto &e : *proc_map_new) {
+		if (this->proc_map->count(e.first) == 0) asid_in.insert(e.first);
+	}
+	for (auto &e : *this->proc_map) {
+		if (proc_map_new->count(e.first) == 0) asid_out.insert(e.first);
+	}
+	changed = !asid_in.empty() || !asid_out.empty();
+
 	// extract OsiProcs
 	if (likely(in != NULL && out != NULL)) {
 		// free old data
 		if (*in != NULL) free_osiprocs(*in);
 		if (*out != NULL) free_osiprocs(*out);
 
-		// find the pids of incoming/outgoing process
-		PidSet pid_in, pid_out;
-		std::set_difference(
-			pid_set_new->begin(), pid_set_new->end(),
-			this->pid_set->begin(), this->pid_set->end(),
-			std::inserter(pid_in, pid_in.begin())
-		);
-		std::set_difference(
-			this->pid_set->begin(), this->pid_set->end(),
-			pid_set_new->begin(), pid_set_new->end(),
-			std::inserter(pid_out, pid_out.begin())
-		);
-
-		*in = ProcState::OsiProcsSubset(proc_map_new, &pid_in);
-		*out = ProcState::OsiProcsSubset(this->proc_map, &pid_out);
+		*in = asid_in.empty() ? NULL : ProcState::OsiProcsSubset(proc_map_new, &asid_in);
+		*out = asid_out.empty() ? NULL : ProcState::OsiProcsSubset(this->proc_map, &asid_out);
 	}
 
 	// update ProcState
-	delete this->pid_set;
 	delete this->proc_map;
 	free_osiprocs(this->ps);
-	this->pid_set = pid_set_new;
 	this->proc_map = proc_map_new;
 	this->ps = ps;
+	this->exiting.swap(exiting_new);
+	if (changed) this->unmatched.clear();
+	if (asid != 0 && this->proc_map->count(asid) == 0) {
+		// An address space still held by an exiting process can be given
+		// to a new one at any time, so keep checking it.
+		auto e = this->exiting.lower_bound(std::make_pair(asid, (target_ulong) 0));
+		if (e == this->exiting.end() || e->first != asid) this->unmatched.insert(asid);
+	}
 
 	return;
 }
 
+/*! @brief Removes the process with `asid` from the ProcState, e.g. when
+ * it is seen exiting. The process is not reported as new again while the
+ * guest still lists it.
+ *
+ * @return A copy of the removed process, or NULL if it wasn't known.
+ */
+OsiProc *ProcState::remove(target_ulong asid) {
+	auto it = this->proc_map->find(asid);
+	if (it == this->proc_map->end()) return NULL;
+
+	OsiProc *p = copy_osiproc_g(it->second, NULL);
+	this->proc_map->erase(it);
+	this->exiting.insert(std::make_pair(asid, p->pid));
+	return p;
+}
+
 /*!
  * @brief C wrapper for updating the global process state.
  */
-void procstate_update(OsiProcs *ps, OsiProcs **in, OsiProcs **out) {
-	pstate.update(ps, in, out);
+void procstate_update(OsiProcs *ps, target_ulong asid, OsiProcs **in, OsiProcs **out) {
+	pstate.update(ps, asid, in, out);
 }
 
+/*!
+ * @brief C wrapper for checking the global process state for an asid.
+ */
+bool procstate_known(target_ulong asid) {
+	return pstate.known(asid);
+}
+
+/*!
+ * @brief C wrapper for removing a process from the global process state.
+ */
+OsiProc *procstate_remove(target_ulong asid) {
+	return pstate.remove(asid);
+}
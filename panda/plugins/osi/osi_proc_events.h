@@ -29,23 +29,35 @@
 } while(0)
 
 #ifdef __cplusplus
-#include <set>
 #include <unordered_map>
-typedef std::set<target_ulong> PidSet;
+#include <unordered_set>
+#include <set>
+#include <utility>
+typedef std::unordered_set<target_ulong> AsidSet;
+typedef std::set<std::pair<target_ulong, target_ulong>> AsidPidSet;
 typedef std::unordered_map<target_ulong, OsiProc *> ProcMap;
 
+/*!
+ * @brief Table of the running processes, keyed by asid.
+ *
+ * The table is kept between updates, so checking whether an asid belongs
+ * to a known process is a hash lookup. A full update against the guest
+ * process list is only needed when an unknown asid shows up.
+ */
 class ProcState {
 	public:
 		ProcState();
 		~ProcState();
-		void update(OsiProcs *ps, OsiProcs **in, OsiProcs **out);
+		bool known(target_ulong asid);
+		void update(OsiProcs *ps, target_ulong asid, OsiProcs **in, OsiProcs **out);
+		OsiProc *remove(target_ulong asid);
 
 	private:
-		PidSet *pid_set = NULL;		/**< pids from previous run */
-		ProcMap *proc_map = NULL;	/**< pid to OsiProc* map */
+		ProcMap *proc_map = NULL;	/**< asid to OsiProc* map */
 		OsiProcs *ps = NULL;		/**< the actual OsiProc structs pointed to by proc_map are contained here */
-		static OsiProcs *OsiProcsSubset(ProcMap *, PidSet *);
-		static OsiProc *OsiProcCopy(OsiProc *from, OsiProc *to);
+		AsidPidSet exiting;		/**< (asid, pid) of removed processes that may still be listed by the guest */
+		AsidSet unmatched;		/**< asids not found in the last update */
+		static OsiProcs *OsiProcsSubset(ProcMap *, AsidSet *);
 };
 #else
 typedef struct ProcState ProcState;
@@ -62,7 +74,19 @@ extern ProcState pstate;
 /*!
  * @brief C wrapper for updating the global process state.
  */
-void procstate_update(OsiProcs *ps, OsiProcs **in, OsiProcs **out);
+void procstate_update(OsiProcs *ps, target_ulong asid, OsiProcs **in, OsiProcs **out);
+
+/*!
+ * @brief C wrapper for checking if an asid belongs to a known process,
+ * or was already looked for without success since the last change.
+ */
+bool procstate_known(target_ulong asid);
+
+/*!
+ * @brief C wrapper for removing an exiting process from the global
+ * process state. Returns a copy of the removed process or NULL.
+ */
+OsiProc *procstate_remove(target_ulong asid);
 
 #ifdef __cplusplus
 }
@@ -9,7 +9,11 @@
 
 #define __STDC_FORMAT_MACROS
 
+#include <algorithm>
+#include <climits>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "panda/plugin.h"
 #include "panda/plugin_plugin.h"
@@ -42,10 +46,84 @@ void on_free_osiproc(OsiProc *p);
 void on_free_osiprocs(OsiProcs *ps);
 void on_get_libraries(CPUState *env, OsiProc *p, OsiModules **out_ms);
 void on_free_osimodules(OsiModules *ms);
+int cache_asid_changed(CPUState *env, target_ulong oldval, target_ulong newval);
 
 struct kernelinfo ki;
 int panda_memory_errors;
 
+/* ******************************************************************
+ Structure reads
+****************************************************************** */
+
+/*
+ * Each guest read walks the guest page tables, and the helpers below use
+ * several fields of every task_struct, vm_area_struct, mm_struct and file
+ * they visit, including the link to the next list entry. So the span of
+ * the struct holding all of those fields is read at once and the fields
+ * are decoded from the copy. The spans are worked out from the kernel
+ * profile when the plugin loads. If a copy can't be read, e.g. because it
+ * crosses into a page that isn't mapped, the helpers fall back to reading
+ * field by field.
+ */
+struct struct_span {
+	int lo = INT_MAX;
+	int hi = 0;
+
+	void add(int offset, size_t size) {
+		lo = std::min(lo, offset);
+		hi = std::max(hi, offset + (int)size);
+	}
+};
+
+static struct_span task_span, vma_span, mm_span, file_span;
+
+static void init_struct_spans(void) {
+	task_span.add(ki.task.tasks_offset, sizeof(PTR));
+	task_span.add(ki.task.pid_offset, sizeof(int));
+	task_span.add(ki.task.real_parent_offset, sizeof(PTR));
+	task_span.add(ki.task.mm_offset, sizeof(PTR));
+	task_span.add(ki.task.comm_offset, ki.task.comm_size);
+
+	vma_span.add(ki.vma.vm_mm_offset, sizeof(PTR));
+	vma_span.add(ki.vma.vm_start_offset, sizeof(target_ulong));
+	vma_span.add(ki.vma.vm_end_offset, sizeof(target_ulong));
+	vma_span.add(ki.vma.vm_next_offset, sizeof(PTR));
+	vma_span.add(ki.vma.vm_file_offset, sizeof(PTR));
+
+	mm_span.add(ki.mm.start_brk_offset, sizeof(PTR));
+	mm_span.add(ki.mm.brk_offset, sizeof(PTR));
+	mm_span.add(ki.mm.start_stack_offset, sizeof(PTR));
+
+	file_span.add(ki.fs.f_path_dentry_offset, sizeof(PTR));
+	file_span.add(ki.fs.f_path_mnt_offset, sizeof(PTR));
+}
+
+/**
+ * @brief Host copy of the span of a guest struct.
+ */
+class struct_copy {
+public:
+	struct_copy(const struct_span &span) : span(span), buf(span.hi - span.lo) {}
+
+	bool read(CPUState *env, PTR addr) {
+		return -1 != panda_virtual_memory_rw(env, addr + span.lo, buf.data(), buf.size(), 0);
+	}
+
+	const uint8_t *at(int offset) const { return &buf[offset - span.lo]; }
+
+	template <typename T> T get(int offset) const {
+		T v;
+		memcpy(&v, at(offset), sizeof(T));
+		return v;
+	}
+
+private:
+	const struct_span &span;
+	std::vector<uint8_t> buf;
+};
+
+
+
 /* ******************************************************************
  Helpers
 ****************************************************************** */
@@ -56,10 +134,17 @@ int panda_memory_errors;
 static char *get_file_name(CPUState *env, PTR file_struct) {
 	char *name = NULL;
 	PTR file_dentry, file_mnt;
+	struct_copy file(file_span);
 
 	// Read addresses for dentry, vfsmnt structs.
-	file_dentry = get_file_dentry(env, file_struct);
-	file_mnt = get_file_mnt(env, file_struct);
+	if (file.read(env, file_struct)) {
+		file_dentry = file.get<PTR>(ki.fs.f_path_dentry_offset);
+		file_mnt = file.get<PTR>(ki.fs.f_path_mnt_offset);
+	}
+	else {
+		file_dentry = get_file_dentry(env, file_struct);
+		file_mnt = get_file_mnt(env, file_struct);
+	}
 
 	if (unlikely(file_dentry == (PTR)NULL || file_mnt == (PTR)NULL)) {
 		LOG_INFO("failure resolving file struct " TARGET_FMT_PTR "/" TARGET_FMT_PTR, file_dentry, file_mnt);
@@ -119,36 +204,85 @@ static uint64_t get_fd_pos(CPUState *env, PTR task_struct, int fd) {
 
 /**
  * @brief Fills an OsiProc struct. Any existing contents are overwritten.
+ * Returns the next task_struct in the process list.
  */
-static void fill_osiproc(CPUState *env, OsiProc *p, PTR task_addr) {
+static PTR fill_osiproc(CPUState *env, OsiProc *p, PTR task_addr) {
+	struct_copy ts(task_span);
+	PTR mm, tasks;
+
 	memset(p, 0, sizeof(OsiProc));
+	panda_memory_errors = 0;
 
 	p->offset = task_addr;	// XXX: Not sure what this is. Storing task_addr here seems logical.
-	p->name = get_name(env, task_addr, p->name);
-	p->pid = get_pid(env, task_addr);
-	p->ppid = get_real_parent_pid(env, task_addr);
 	p->pages = NULL;		// OsiPage - TODO
+	if (ts.read(env, task_addr)) {
+		int ppid;
+		p->name = (char *)g_malloc(ki.task.comm_size * sizeof(char));
+		memcpy(p->name, ts.at(ki.task.comm_offset), ki.task.comm_size * sizeof(char));
+		p->pid = ts.get<int>(ki.task.pid_offset);
+		if (-1 == panda_virtual_memory_rw(env, ts.get<PTR>(ki.task.real_parent_offset) + ki.task.pid_offset, (uint8_t *)&ppid, sizeof(int), 0)) {
+			panda_memory_errors++;
+			ppid = -1;
+		}
+		p->ppid = ppid;
+		mm = ts.get<PTR>(ki.task.mm_offset);
+		tasks = ts.get<PTR>(ki.task.tasks_offset);
+	}
+	else {
+		p->name = get_name(env, task_addr, p->name);
+		p->pid = get_pid(env, task_addr);
+		p->ppid = get_real_parent_pid(env, task_addr);
+		mm = get_mm(env, task_addr);
+		tasks = get_tasks(env, task_addr);
+	}
 
-	panda_memory_errors = 0;
-	p->asid = get_pgd(env, task_addr);
+	// kernel threads have no mm
+	p->asid = mm ? get_mm_pgd(env, mm) : 0;
 
 #if defined(OSI_LINUX_TEST)
 	LOG_INFO(TARGET_FMT_PTR ":" TARGET_FMT_PID ":" TARGET_FMT_PID ":" TARGET_FMT_PTR ":%s", task_addr, (int)p->ppid, (int)p->pid, p->asid, p->name);
 #endif
+	return tasks ? tasks - ki.task.tasks_offset : (PTR)NULL;
 }
 
 /**
- * @brief Fills an OsiModule struct.
+ * @brief State kept across the fill_osimodule calls of one walk of a vma
+ * list. The vmas share an mm_struct and most files are mapped several
+ * times, so the mm fields and each file name are only read once.
+ */
+struct vma_walk {
+	bool mm_read = false;
+	PTR mm, start_brk, brk, start_stack;
+	std::unordered_map<PTR, char *> names;	// by dentry
+
+	~vma_walk() {
+		for (auto &e : names) g_free(e.second);
+	}
+};
+
+/**
+ * @brief Fills an OsiModule struct. Returns the next vma in the list.
  */
-static void fill_osimodule(CPUState *env, OsiModule *m, PTR vma_addr) {
+static PTR fill_osimodule(CPUState *env, OsiModule *m, PTR vma_addr, vma_walk &w) {
+	struct_copy vma(vma_span);
 	target_ulong vma_start, vma_end;
-	PTR vma_vm_file;
+	PTR vma_vm_file, vma_vm_mm, vma_next;
 	PTR vma_dentry;
-	PTR mm_addr, start_brk, brk, start_stack;
 
-	vma_start = get_vma_start(env, vma_addr);
-	vma_end = get_vma_end(env, vma_addr);
-	vma_vm_file = get_vma_vm_file(env, vma_addr);
+	if (vma.read(env, vma_addr)) {
+		vma_start = vma.get<target_ulong>(ki.vma.vm_start_offset);
+		vma_end = vma.get<target_ulong>(ki.vma.vm_end_offset);
+		vma_vm_file = vma.get<PTR>(ki.vma.vm_file_offset);
+		vma_vm_mm = vma.get<PTR>(ki.vma.vm_mm_offset);
+		vma_next = vma.get<PTR>(ki.vma.vm_next_offset);
+	}
+	else {
+		vma_start = get_vma_start(env, vma_addr);
+		vma_end = get_vma_end(env, vma_addr);
+		vma_vm_file = get_vma_vm_file(env, vma_addr);
+		vma_vm_mm = get_vma_vm_mm(env, vma_addr);
+		vma_next = get_vma_next(env, vma_addr);
+	}
 
 	// Fill everything but m->name and m->file.
 	m->offset = vma_addr;	// XXX: Not sure what this is. Storing vma_addr here seems logical.
@@ -156,22 +290,37 @@ static void fill_osimodule(CPUState *env, OsiModule *m, PTR vma_addr) {
 	m->size = vma_end - vma_start;
 
 	if (vma_vm_file != (PTR)NULL) {	 // Memory area is mapped from a file.
-		vma_dentry = get_vma_dentry(env, vma_addr);
-		m->file = read_dentry_name(env, vma_dentry);
+		vma_dentry = get_file_dentry(env, vma_vm_file);
+		auto it = w.names.find(vma_dentry);
+		if (it == w.names.end()) {
+			it = w.names.insert(std::make_pair(vma_dentry, read_dentry_name(env, vma_dentry))).first;
+		}
+		m->file = g_strdup(it->second);
 		m->name = g_strrstr (m->file, "/");
 		if (m->name != NULL) m->name = g_strdup(m->name + 1);
 	}
 	else {					// Other memory areas.
-		mm_addr = get_vma_vm_mm(env, vma_addr);
-		start_brk = get_mm_start_brk(env, mm_addr);
-		brk = get_mm_brk(env, mm_addr);
-		start_stack = get_mm_start_stack(env, mm_addr);
+		if (!w.mm_read || w.mm != vma_vm_mm) {
+			struct_copy mm(mm_span);
+			if (mm.read(env, vma_vm_mm)) {
+				w.start_brk = mm.get<PTR>(ki.mm.start_brk_offset);
+				w.brk = mm.get<PTR>(ki.mm.brk_offset);
+				w.start_stack = mm.get<PTR>(ki.mm.start_stack_offset);
+			}
+			else {
+				w.start_brk = get_mm_start_brk(env, vma_vm_mm);
+				w.brk = get_mm_brk(env, vma_vm_mm);
+				w.start_stack = get_mm_start_stack(env, vma_vm_mm);
+			}
+			w.mm = vma_vm_mm;
+			w.mm_read = true;
+		}
 
 		m->file = NULL;
-		if (vma_start <= start_brk && vma_end >= brk) {
+		if (vma_start <= w.start_brk && vma_end >= w.brk) {
 			m->name = g_strdup("[heap]");
 		}
-		else if (vma_start <= start_stack && vma_end >= start_stack) {
+		else if (vma_start <= w.start_stack && vma_end >= w.start_stack) {
 			m->name = g_strdup("[stack]");
 		}
 		else {
@@ -182,6 +331,75 @@ static void fill_osimodule(CPUState *env, OsiModule *m, PTR vma_addr) {
 #if defined(OSI_LINUX_TEST)
 	LOG_INFO(TARGET_FMT_PTR ":" TARGET_FMT_PTR ":" TARGET_FMT_PID "p:%s:%s", m->offset, m->base, NPAGES(m->size), m->name, m->file);
 #endif
+	return vma_next;
+}
+
+
+
+/* ******************************************************************
+ Process cache
+****************************************************************** */
+
+/*
+ * Some plugins ask for the current process in every basic block, and each
+ * answer takes several guest memory reads, or one walk of the task list for
+ * the process list. Answers are kept until the next asid change, i.e. until
+ * the kernel switches to another mm or execs a new image. In between:
+ *  - a cached task is only used while its pid is unchanged, so a task_struct
+ *    freed and reused for a new thread is not mistaken for the old one.
+ *  - the cached process list is only used while the tail of the task list
+ *    is unchanged. fork() appends new processes at the tail.
+ * A process renamed with prctl() or reaped from the middle of the list is
+ * noticed at the next asid change. Module lists change with every mmap()
+ * and are not cached.
+ */
+static bool use_cache = true;
+static uint64_t cache_generation = 1;
+
+struct cached_proc {
+	uint64_t generation;
+	OsiProc p;
+};
+
+static std::unordered_map<PTR, cached_proc> proc_cache;	// by task_struct
+static OsiProcs *procs_cache = NULL;
+static uint64_t procs_generation = 0;
+static PTR procs_tail;
+
+/**
+ * @brief Invalidates the process cache whenever the asid changes.
+ */
+int cache_asid_changed(CPUState *env, target_ulong oldval, target_ulong newval) {
+	cache_generation++;
+	return 0;
+}
+
+/**
+ * @brief Copies an OsiProcs struct. The copy is freed with on_free_osiprocs.
+ */
+static OsiProcs *copy_osiprocs(OsiProcs *from) {
+	OsiProcs *to = (OsiProcs *)g_malloc0(sizeof(OsiProcs));
+	to->num = to->capacity = from->num;
+	to->proc = g_new(OsiProc, from->num);
+	for (uint32_t i = 0; i < from->num; i++) {
+		copy_osiproc_g(&from->proc[i], &to->proc[i]);
+	}
+	return to;
+}
+
+/**
+ * @brief Fills p from the cache entry for task ts, refreshing the entry
+ * if it is stale.
+ */
+static void fill_osiproc_cached(CPUState *env, OsiProc *p, PTR ts) {
+	cached_proc &c = proc_cache[ts];
+	if (c.generation != cache_generation || c.p.pid != (target_ulong)get_pid(env, ts)) {
+		g_free(c.p.name);
+		fill_osiproc(env, &c.p, ts);
+		// don't keep answers from pages that weren't mapped in
+		c.generation = panda_memory_errors ? 0 : cache_generation;
+	}
+	copy_osiproc_g(&c.p, p);
 }
 
 
@@ -213,7 +431,12 @@ void on_get_current_process(CPUState *env, OsiProc **out_p) {
 		// got a reasonable looking process.
 		// return it and save in cache
 		p = (OsiProc *)g_malloc(sizeof(OsiProc));
-		fill_osiproc(env, p, ts);
+		if (use_cache) {
+			fill_osiproc_cached(env, p, ts);
+		}
+		else {
+			fill_osiproc(env, p, ts);
+		}
 	}
 	*out_p = p;
 }
@@ -231,10 +454,21 @@ void on_get_processes(CPUState *env, OsiProcs **out_ps) {
 	OsiProcs *ps;
 	OsiProc *p;
 	uint32_t ps_capacity;
+	PTR ts_next;
+	PTR tail = (PTR)NULL;
 #if defined(OSI_LINUX_LIST_THREADS)
 	PTR tg_first, tg_next;
 #endif
 
+	if (use_cache) {
+		tail = get_tasks_prev(env, ki.task.init_addr);
+		if (procs_cache != NULL && procs_generation == cache_generation &&
+				procs_tail == tail && tail != (PTR)NULL) {
+			*out_ps = copy_osiprocs(procs_cache);
+			return;
+		}
+	}
+
 #if !defined(OSI_LINUX_LIST_FROM_CURRENT)
 	// Start process enumeration from the init task. This is the default.
 	ts_first = ts_current = ki.task.init_addr;
@@ -280,7 +514,7 @@ void on_get_processes(CPUState *env, OsiProcs **out_ps) {
 		}
 		p = &ps->proc[ps->num++];
 
-		fill_osiproc(env, p, ts_current);
+		ts_next = fill_osiproc(env, p, ts_current);
 #if defined(OSI_LINUX_PSDEBUG)
 		LOG_INFO("\t %d " TARGET_FMT_PTR " " TARGET_FMT_PTR " %s %d %d %c:%c", ps->num, ts_current, p->asid, p->name, (int)p->pid, (int)get_tgid(env, ts_current), TS_THREAD_CHR(env, ts_current),  TS_LEADER_CHR(env, ts_current));
 #endif
@@ -319,12 +553,19 @@ void on_get_processes(CPUState *env, OsiProcs **out_ps) {
 		/*********************************************************/
 #endif
 
-		ts_current = get_task_struct_next(env, ts_current);
+		ts_current = ts_next;
 	} while(ts_current != (PTR)NULL && ts_current != ts_first);
 
 	// memory read error
 	if (ts_current == (PTR)NULL) goto error1;
 
+	if (use_cache) {
+		on_free_osiprocs(procs_cache);
+		procs_cache = ps;
+		procs_generation = cache_generation;
+		procs_tail = tail;
+		ps = copy_osiprocs(procs_cache);
+	}
 	*out_ps = ps;
 	return;
 
@@ -356,6 +597,7 @@ void on_get_libraries(CPUState *env, OsiProc *p, OsiModules **out_ms) {
 	OsiModule *m;
 	uint32_t ms_capacity = 16;
 	PTR vma_first, vma_current;
+	vma_walk walk;
 #if defined(OSI_LINUX_LIST_THREADS)
 	PTR tg_first, tg_next;
 #endif
@@ -419,9 +661,7 @@ pid_found:
 
 		m = &ms->module[ms->num++];
 		memset(m, 0, sizeof(OsiModule));
-		fill_osimodule(env, m, vma_current);
-
-		vma_current = get_vma_next(env, vma_current);
+		vma_current = fill_osimodule(env, m, vma_current, walk);
 	} while(vma_current != (PTR)NULL && vma_current != vma_first);
 
 	*out_ms = ms;
@@ -583,6 +823,11 @@ bool init_plugin(void *self) {
 	panda_arg_list *plugin_args = panda_get_args(PLUGIN_NAME);
 	char *kconf_file = g_strdup(panda_parse_string_req(plugin_args, "kconf_file", "file containing kernel configuration information"));
 	char *kconf_group = g_strdup(panda_parse_string_req(plugin_args, "kconf_group", "kernel profile to use"));
+	use_cache = !panda_parse_bool_opt(plugin_args, "no_cache", "re-read process information from the guest on every query");
+#if !defined(TARGET_I386)
+	// asid changes are only reported on x86
+	use_cache = false;
+#endif
 	panda_free_args(plugin_args);
 
 	// Load kernel offsets.
@@ -591,9 +836,16 @@ bool init_plugin(void *self) {
 		goto error;
 	}
 	LOG_INFO("Read kernel info from group \"%s\" of file \"%s\".", kconf_group, kconf_file);
+	init_struct_spans();
 	g_free(kconf_file);
 	g_free(kconf_group);
 
+	if (use_cache) {
+		panda_cb cache_pcb;
+		cache_pcb.asid_changed = cache_asid_changed;
+		panda_register_callback(self, PANDA_CB_ASID_CHANGED, cache_pcb);
+	}
+
 	PPP_REG_CB("osi", on_get_current_process, on_get_current_process);
 	PPP_REG_CB("osi", on_get_processes, on_get_processes);
 	PPP_REG_CB("osi", on_free_osiproc, on_free_osiproc);
@@ -615,7 +867,12 @@ error:
  */
 void uninit_plugin(void *self) {
 #if defined(TARGET_I386) || defined(TARGET_ARM)
-	// Nothing to do...
+	for (auto &e : proc_cache) {
+		g_free(e.second.p.name);
+	}
+	proc_cache.clear();
+	on_free_osiprocs(procs_cache);
+	procs_cache = NULL;
 #endif
 	return;
 }
@@ -188,6 +188,12 @@ IMPLEMENT_OFFSET_GET(get_group_leader, task_struct, PTR, ki.task.group_leader_of
  */
 IMPLEMENT_OFFSET_GET(get_tasks, task_struct, PTR, ki.task.tasks_offset, 0)
 
+/**
+ * @brief Retrieves the previous tasks address from a task_struct.
+ * For the init task, this is the tail of the process list.
+ */
+IMPLEMENT_OFFSET_GET(get_tasks_prev, task_struct, PTR, ki.task.tasks_offset + sizeof(PTR), 0)
+
 /**
  * @brief Retrieves the pid from a task_struct.
  */
@@ -224,6 +230,11 @@ IMPLEMENT_OFFSET_GET2L(get_pgd, task_struct, PTR, ki.task.mm_offset, PTR, ki.mm.
  */
 IMPLEMENT_OFFSET_GET(get_mm, task_struct, PTR, ki.task.mm_offset, 0)
 
+/**
+ * @brief Retrieves the address of the page directory from an mm_struct.
+ */
+IMPLEMENT_OFFSET_GET(get_mm_pgd, mm_struct, PTR, ki.mm.pgd_offset, 0)
+
 /**
  * @brief Retrieves the address of the mm_struct from a task_struct.
  */
@@ -20,6 +20,7 @@ PANDAENDCOMMENT */
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <memory>
 #include <string>
 #include <algorithm>
@@ -233,6 +234,65 @@ struct CompareRangeAndPC
             return ln_info.lowpc < pc;
     }
 };
+
+/*
+ * PC -> LineRange lookups run for every basic block, call and return in the
+ * monitored process. line_range_list is mirrored in Eytzinger (breadth
+ * first) order so the first levels of the search share a few cache lines,
+ * and the last answer is kept because several callbacks usually look up
+ * the same pc in a row. Rebuilt whenever line_range_list is re-sorted.
+ */
+struct LineIndex {
+    std::vector<Dwarf_Addr> lowpc, highpc;  // 1-based, Eytzinger order
+    std::vector<uint32_t> pos;              // position in line_range_list
+    Dwarf_Addr last_pc;
+    LineRange *last_lr;
+    bool last_valid;
+
+    uint32_t fill(uint32_t i, size_t k) {
+        if (k < lowpc.size()) {
+            i = fill(i, 2 * k);
+            lowpc[k] = line_range_list[i].lowpc;
+            highpc[k] = line_range_list[i].highpc;
+            pos[k] = i++;
+            i = fill(i, 2 * k + 1);
+        }
+        return i;
+    }
+
+    void build() {
+        size_t n = line_range_list.size() + 1;
+        lowpc.assign(n, 0);
+        highpc.assign(n, 0);
+        pos.assign(n, 0);
+        fill(0, 1);
+        last_valid = false;
+    }
+
+    // the range holding pc, as lower_bound with CompareRangeAndPC finds it
+    // on the sorted list, or NULL
+    LineRange *find(Dwarf_Addr pc) {
+        if (last_valid && last_pc == pc) return last_lr;
+        size_t k = 1;
+        while (k < lowpc.size()) {
+            bool before = !(lowpc[k] <= pc && highpc[k] > pc) && lowpc[k] < pc;
+            k = 2 * k + before;
+        }
+        k >>= __builtin_ffsll(~k);
+        last_pc = pc;
+        last_lr = (k != 0 && pc >= lowpc[k]) ? &line_range_list[pos[k]] : NULL;
+        last_valid = true;
+        return last_lr;
+    }
+} line_index;
+
+void reset_live_locs(void);
+
+// call after changing line_range_list or the variable lists
+void rebuild_indexes(void) {
+    line_index.build();
+    reset_live_locs();
+}
 /*
     required string file_callee = 1;
     required string function_name_callee = 2;
@@ -527,6 +587,7 @@ uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong
     }
     // sort the line_range_list because we changed it
     std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
+    rebuild_indexes();
 
     return load_addr;
 }
@@ -1683,6 +1744,7 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
     // sort the line number ranges
     std::sort(fn_start_line_range_list.begin(), fn_start_line_range_list.end(), sortRange);
     std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
+    rebuild_indexes();
     printf("Successfully loaded debug symbols for %s\n", basename);
     printf("Number of address range to line mappings: %lu num globals: %lu\n", line_range_list.size(), global_var_list.size());
     return true;
@@ -1887,8 +1949,7 @@ target_ulong get_cur_fp(CPUState *cpu, target_ulong pc){
 
 bool dwarf_in_target_code(CPUState *cpu, target_ulong pc){
     if (!correct_asid(cpu)) return false;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    return (it != line_range_list.end() && pc >= it->lowpc);
+    return line_index.find(pc) != NULL;
 }
 
 void dwarf_log_callsite(CPUState *cpu, const char *file_callee, const char *fn_callee, uint64_t lno_callee, bool isCall){
@@ -1900,8 +1961,8 @@ void dwarf_log_callsite(CPUState *cpu, const char *file_callee, const char *fn_c
     }
 
     ra -= 5; // subtract 5 to get address of call instead of return address
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), ra, CompareRangeAndPC());
-    if (it == line_range_list.end() || ra < it->lowpc){
+    LineRange *it = line_index.find(ra);
+    if (it == NULL){
         //printf("No DWARF information for callsite 0x%x for current function.\n", ra);
         //printf("Callsite must be in an external library we do not have DWARF information for.\n");
         return;
@@ -1926,8 +1987,8 @@ void dwarf_log_callsite(CPUState *cpu, const char *file_callee, const char *fn_c
 
 void on_call(CPUState *cpu, target_ulong pc) {
     if (!correct_asid(cpu)) return;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it == line_range_list.end() || pc < it->lowpc ){
+    LineRange *it = line_index.find(pc);
+    if (it == NULL){
         auto it_dyn = addr_to_dynl_function.find(pc);
         if (it_dyn != addr_to_dynl_function.end()){
             if (debug) printf ("CALL: Found line info for 0x%x\n", pc);
@@ -1981,8 +2042,8 @@ void on_call(CPUState *cpu, target_ulong pc) {
 void on_ret(CPUState *cpu, target_ulong pc_func) {
     if (!correct_asid(cpu)) return;
     //printf(" on_ret address: %x\n", func);
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc_func, CompareRangeAndPC());
-    if (it == line_range_list.end() || pc_func < it->lowpc) {
+    LineRange *it = line_index.find(pc_func);
+    if (it == NULL) {
         auto it_dyn = addr_to_dynl_function.find(pc_func);
         if (it_dyn != addr_to_dynl_function.end()){
             if (debug) printf("RET: Found line info for 0x%x\n", pc_func);
@@ -2004,45 +2065,115 @@ void on_ret(CPUState *cpu, target_ulong pc_func) {
     pri_runcb_on_fn_return(cpu, pc_func, file_name.c_str(), funct_name.c_str());
 }
 
+/*
+ * Which variables of a list are live, and where, only depends on the pc.
+ * So that is worked out once per (list, pc) and kept. The location
+ * expressions of the live variables are decoded at the same time, and the
+ * ones that are a single address, register or frame offset are evaluated
+ * without going through execute_stack_op. The cache is dropped whenever
+ * debug info is loaded, as the lists change then.
+ */
+struct LiveLoc {
+    enum Kind { Addr, Reg, FrameOffset, Generic };
+
+    const VarInfo *var;
+    Dwarf_Locdesc *locdesc;
+    Kind kind;
+    target_ulong value;     // address, register or frame offset
+
+    LiveLoc(const VarInfo *var, Dwarf_Locdesc *locdesc) :
+        var(var), locdesc(locdesc), kind(Generic), value(0) {
+        if (locdesc->ld_cents != 1) return;
+        Dwarf_Loc *loc = &locdesc->ld_s[0];
+        if (loc->lr_atom == DW_OP_addr) {
+            kind = Addr;
+            value = loc->lr_number;
+        } else if (loc->lr_atom >= DW_OP_reg0 && loc->lr_atom <= DW_OP_reg31) {
+            kind = Reg;
+            value = loc->lr_atom - DW_OP_reg0;
+        } else if (loc->lr_atom == DW_OP_regx) {
+            kind = Reg;
+            value = loc->lr_number;
+#if defined(TARGET_I386) && !defined(TARGET_X86_64)
+        } else if (loc->lr_atom == DW_OP_fbreg) {
+            kind = FrameOffset;
+            value = (Dwarf_Signed) loc->lr_number;
+#endif
+        }
+    }
+
+    LocType eval(CPUState *cpu, target_ulong pc, target_ulong fp, target_ulong *var_loc) const {
+        switch (kind) {
+            case Addr:
+                *var_loc = value;
+                return LocMem;
+            case Reg:
+                *var_loc = value;
+                return LocReg;
+            case FrameOffset:
+                *var_loc = fp + value;
+                return LocMem;
+            default:
+                return execute_stack_op(cpu, pc, locdesc->ld_s, locdesc->ld_cents, fp, var_loc);
+        }
+    }
+};
+
+std::unordered_map<const std::vector<VarInfo> *,
+    std::unordered_map<target_ulong, std::vector<LiveLoc>>> live_locs_cache;
+
+void reset_live_locs(void) {
+    live_locs_cache.clear();
+}
+
+// the live locations of vars at pc, in the order of vars
+const std::vector<LiveLoc> &live_locs(const std::vector<VarInfo> &vars, target_ulong pc) {
+    auto &by_pc = live_locs_cache[&vars];
+    auto it = by_pc.find(pc);
+    if (it != by_pc.end()) return it->second;
+
+    std::vector<LiveLoc> &locs = by_pc[pc];
+    for (auto &var : vars) {
+        Dwarf_Locdesc **locdesc = var.locations;
+        for (int i=0; i < var.num_locations; i++){
+            //printf("var active in range 0x%llx - 0x%llx\n", locdesc[i]->ld_lopc, locdesc[i]->ld_hipc);
+            if (pc >= locdesc[i]->ld_lopc && pc <= locdesc[i]->ld_hipc){
+                locs.push_back(LiveLoc(&var, locdesc[i]));
+            }
+        }
+    }
+    return locs;
+}
+
 void __livevar_iter(CPUState *cpu,
         target_ulong pc,
-        std::vector<VarInfo> vars,
+        const std::vector<VarInfo> &vars,
         liveVarCB f,
         void *args,
         target_ulong fp){
     //printf("size of vars: %ld\n", vars.size());
-    for (auto it : vars){
-        void *var_type    = it.var_type;
-        std::string var_name    = it.var_name;
-        Dwarf_Locdesc **locdesc = it.locations;
-        Dwarf_Signed loc_cnt    = it.num_locations;
-        for (int i=0; i < loc_cnt; i++){
-            //printf("var active in range 0x%llx - 0x%llx\n", locdesc[i]->ld_lopc, locdesc[i]->ld_hipc);
-            if (pc >= locdesc[i]->ld_lopc && pc <= locdesc[i]->ld_hipc){
-                //enum LocType { LocReg, LocMem, LocConst, LocErr };
-                target_ulong var_loc;
-                //process_dwarf_locs(locdesc[i]->ld_s, locdesc[i]->ld_cents);
-                //printf("\n");
-                LocType loc = execute_stack_op(cpu,pc, locdesc[i]->ld_s, locdesc[i]->ld_cents, fp, &var_loc);
-                if (debug) {
-                    switch (loc){
-                        case LocReg:
-                            printf(" [livevar_iter] VAR %s in REG %d\n", var_name.c_str(), var_loc);
-                            break;
-                        case LocMem:
-                            printf(" [livevar_iter] VAR %s in MEM 0x%x\n", var_name.c_str(), var_loc);
-                            break;
-                        case LocConst:
-                            printf(" [livevar_iter] VAR %s CONST VAL %d\n", var_name.c_str(), var_loc);
-                            break;
-                        case LocErr:
-                            printf(" [livevar_iter] VAR %s - Can\'t handle location information\n", var_name.c_str());
-                            break;
-                    }
-                }
-                f((void *)var_type, var_name.c_str(),loc, var_loc, args);
+    for (auto &live : live_locs(vars, pc)){
+        const std::string &var_name = live.var->var_name;
+        //enum LocType { LocReg, LocMem, LocConst, LocErr };
+        target_ulong var_loc;
+        LocType loc = live.eval(cpu, pc, fp, &var_loc);
+        if (debug) {
+            switch (loc){
+                case LocReg:
+                    printf(" [livevar_iter] VAR %s in REG %d\n", var_name.c_str(), var_loc);
+                    break;
+                case LocMem:
+                    printf(" [livevar_iter] VAR %s in MEM 0x%x\n", var_name.c_str(), var_loc);
+                    break;
+                case LocConst:
+                    printf(" [livevar_iter] VAR %s CONST VAL %d\n", var_name.c_str(), var_loc);
+                    break;
+                case LocErr:
+                    printf(" [livevar_iter] VAR %s - Can\'t handle location information\n", var_name.c_str());
+                    break;
             }
         }
+        f(live.var->var_type, var_name.c_str(), loc, var_loc, args);
     }
     return;
 }
@@ -2051,7 +2182,7 @@ void __livevar_iter(CPUState *cpu,
 // will assign found variable to ret_var
 int livevar_find(CPUState *cpu,
         target_ulong pc,
-        std::vector<VarInfo> vars,
+        const std::vector<VarInfo> &vars,
         liveVarPred pred,
         void *args,
         VarInfo &ret_var){
@@ -2061,23 +2192,16 @@ int livevar_find(CPUState *cpu,
         printf("Error: was not able to get the Frame Pointer for the function %s at @ 0x" TARGET_FMT_lx "\n", funcaddrs[cur_function].c_str(), pc);
         return 0;
     }
-    for (auto it : vars){
-        Dwarf_Locdesc **locdesc = it.locations;
-        for (int i=0; i < it.num_locations; i++){
-            //printf("var active in range 0x%llx - 0x%llx\n", locdesc[i]->ld_lopc, locdesc[i]->ld_hipc);
-            if (pc >= locdesc[i]->ld_lopc && pc <= locdesc[i]->ld_hipc){
-                target_ulong var_loc;
-                //process_dwarf_locs(locdesc[i]->ld_s, locdesc[i]->ld_cents);
-                //printf("\n");
-                LocType loc = execute_stack_op(cpu,pc, locdesc[i]->ld_s, locdesc[i]->ld_cents, fp, &var_loc);
-                if (pred(it.var_type, it.var_name.c_str(),loc, var_loc, args)){
-                    ret_var.var_type = it.var_type;
-                    ret_var.var_name = it.var_name;
-                    ret_var.locations = it.locations;
-                    ret_var.num_locations = it.num_locations;
-                    return 1;
-                }
-            }
+    for (auto &live : live_locs(vars, pc)){
+        const VarInfo &var = *live.var;
+        target_ulong var_loc;
+        LocType loc = live.eval(cpu, pc, fp, &var_loc);
+        if (pred(var.var_type, var.var_name.c_str(),loc, var_loc, args)){
+            ret_var.var_type = var.var_type;
+            ret_var.var_name = var.var_name;
+            ret_var.locations = var.locations;
+            ret_var.num_locations = var.num_locations;
+            return 1;
         }
     }
     return 0;
@@ -2106,8 +2230,8 @@ void dwarf_get_vma_symbol (CPUState *cpu, target_ulong pc, target_ulong vma, cha
     }
     target_ulong fn_address;
 
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it == line_range_list.end() || pc < it->lowpc ) {
+    LineRange *it = line_index.find(pc);
+    if (it == NULL) {
         *symbol_name = NULL;
         return;
     }
@@ -2137,8 +2261,8 @@ void dwarf_get_pc_source_info(CPUState *cpu, target_ulong pc, SrcInfo *info, int
         *rc = -1;
         return;
     }
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it == line_range_list.end() || pc < it->lowpc ){
+    LineRange *it = line_index.find(pc);
+    if (it == NULL){
         auto it_dyn = addr_to_dynl_function.find(pc);
         if (it_dyn != addr_to_dynl_function.end()){
             //printf("In a a plt function\n");
@@ -2211,12 +2335,8 @@ void dwarf_global_livevar_iter(CPUState *cpu,
 bool translate_callback_dwarf(CPUState *cpu, target_ulong pc) {
     if (!correct_asid(cpu)) return false;
 
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    // after the call to lower_bound the `pc` should be between it2->lowpc and it2->highpc
-    // if it2 == line_range_list.end() we know we definitely didn't find out pc in our line_range_list
-    if (it2 == line_range_list.end() || pc < it2->lowpc)
-        return false;
-    return true;
+    // NULL means we definitely didn't find our pc in line_range_list
+    return line_index.find(pc) != NULL;
     /*
     // This is just the linear search to confirm binary search (lower_bound) is
     // working correctly
@@ -2232,16 +2352,16 @@ bool translate_callback_dwarf(CPUState *cpu, target_ulong pc) {
 int exec_callback_dwarf(CPUState *cpu, target_ulong pc) {
     inExecutableSource = false;
     if (!correct_asid(cpu)) return 0;
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it2 == line_range_list.end() || pc < it2->lowpc)
+    LineRange *it2 = line_index.find(pc);
+    if (it2 == NULL)
         return 0;
     inExecutableSource = true;
     if (it2->lowpc == it2->highpc) {
         inExecutableSource = false;
     }
     cur_function = it2->function_addr;
-    std::string file_name = it2->filename;
-    std::string funct_name = funcaddrs[cur_function];
+    const std::string &file_name = it2->filename;
+    const std::string &funct_name = funcaddrs[cur_function];
     cur_line = it2->line_number;
 
     //printf("[%s] [0x%llx]-%s(), ln: %4lld, pc @ 0x%x\n",file_name.c_str(),cur_function, funct_name.c_str(),cur_line,pc);
@@ -0,0 +1,410 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+/*
+  Sidecar index of a replay.
+
+  Several plugins find out the same facts about a recording, e.g. which
+  process ran when, on every replay of it. With build=true this plugin
+  finds them out once and, when the replay ends, writes them next to the
+  nondet log as <name>-rr-index.bin:
+  - every asid change, and the process that ran after it,
+  - the processes seen (pid, ppid, asid, name, first and last instr),
+  - every system call entry and return (from syscalls2), and
+  - every library load, if the loaded plugin was loaded first.
+  All of them are keyed by guest instruction count.
+
+  Without build, the plugin registers no callbacks. It reads the index of
+  the replay the first time its api is used, and answers from it without
+  any introspection.
+*/
+
+// This needs to be defined before anything is included in order to get
+// the PRIx64 macro
+#define __STDC_FORMAT_MACROS
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "panda/plugin.h"
+#include "panda/plugin_plugin.h"
+
+extern "C" {
+#include "panda/rr/rr_log.h"
+
+#include "osi/osi_types.h"
+#include "osi/osi_ext.h"
+
+#include "syscalls2/gen_syscalls_ext_typedefs.h"
+#include "loaded/loaded.h"
+
+bool init_plugin(void *);
+void uninit_plugin(void *);
+
+#include "replay_index_int_fns.h"
+}
+
+#define NO_PROC UINT32_MAX
+
+// blocks in a row osi has to report the same process in before we believe
+// it, as in asidstory
+#define PROCESS_GOOD_NUM 10
+
+/*
+  Index file:
+
+  header (index_header)
+  per process: index_proc_rec, then the name
+  switches: index_switch[num_switches]
+  system calls: index_syscall[num_syscalls]
+  per library load: index_module, then the file name
+
+  Processes are referred to by their position in the file.
+*/
+#pragma pack(push, 1)
+struct index_header {
+    char magic[4];          // "PRIX"
+    uint32_t version;
+    uint64_t num_procs;
+    uint64_t num_switches;
+    uint64_t num_syscalls;
+    uint64_t num_modules;
+};
+
+struct index_proc_rec {
+    uint32_t pid;
+    uint32_t ppid;
+    uint64_t asid;
+    uint64_t first;
+    uint64_t last;
+    uint32_t name_len;
+};
+
+struct index_switch {
+    uint64_t instr;
+    uint64_t asid;
+    uint32_t proc;          // NO_PROC if osi couldn't tell
+};
+
+struct index_syscall {
+    uint64_t instr;
+    uint32_t proc;
+    uint32_t callno;
+    uint8_t is_return;
+};
+
+struct index_module {
+    uint64_t instr;
+    uint32_t proc;
+    uint64_t base;
+    uint64_t size;
+    uint32_t name_len;
+};
+#pragma pack(pop)
+
+struct index_proc {
+    index_proc_rec rec;
+    std::string name;
+};
+
+std::vector<index_proc> procs;
+std::vector<index_switch> switches;
+std::vector<index_syscall> syscalls;
+std::vector<std::pair<index_module, std::string>> modules;
+
+// entry instrs by (pid << 32 | callno)
+std::unordered_map<uint64_t, std::vector<uint64_t>> syscalls_by_pid;
+
+bool build = false;
+std::string index_file;
+
+// build only
+void *plugin_self;
+panda_cb identify_pcb;
+std::map<std::tuple<uint32_t, uint64_t, std::string>, uint32_t> proc_ids;  // by pid, asid, name
+
+// process seen since the last asid change, and in how many blocks in a row
+uint32_t cand_pid;
+std::string cand_name;
+int cand_count;
+
+// <name>-rr-index.bin for <name>-rr-nondet.log
+static std::string default_index_file(void) {
+    if (!rr_nondet_log) return "";
+    std::string name(rr_nondet_log->name);
+    const std::string suffix("-rr-nondet.log");
+    if (name.size() >= suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        name.erase(name.size() - suffix.size());
+    }
+    return name + "-rr-index.bin";
+}
+
+static void add_syscall(uint64_t instr, uint32_t proc, uint32_t callno, bool is_return) {
+    index_syscall sc = { instr, proc, callno, is_return };
+    syscalls.push_back(sc);
+    if (proc != NO_PROC && !is_return) {
+        uint64_t key = ((uint64_t) procs[proc].rec.pid << 32) | callno;
+        syscalls_by_pid[key].push_back(instr);
+    }
+}
+
+static uint32_t current_proc(void) {
+    return switches.empty() ? NO_PROC : switches.back().proc;
+}
+
+int index_asid_changed(CPUState *cpu, target_ulong old_asid, target_ulong new_asid) {
+    uint64_t instr = rr_get_guest_instr_count();
+    if (index_file.empty()) index_file = default_index_file();
+
+    uint32_t proc = current_proc();
+    if (proc != NO_PROC) procs[proc].rec.last = instr;
+    index_switch s = { instr, new_asid, NO_PROC };
+    switches.push_back(s);
+
+    // The kernel switches page directories before it switches the current
+    // task, so ask osi which process this is in the blocks that follow,
+    // until it has been the same one for a while.
+    cand_count = 0;
+    panda_enable_callback(plugin_self, PANDA_CB_BEFORE_BLOCK_EXEC, identify_pcb);
+    return 0;
+}
+
+int index_before_block_exec(CPUState *cpu, TranslationBlock *tb) {
+    index_switch &s = switches.back();
+    OsiProc *p = get_current_process(cpu);
+    if (p == NULL || p->name == NULL || (int32_t) p->pid <= 0 || p->asid != s.asid) {
+        cand_count = 0;
+        if (p) free_osiproc(p);
+        return 0;
+    }
+    if (cand_count > 0 && cand_pid == p->pid && cand_name == p->name) {
+        cand_count++;
+    } else {
+        cand_pid = p->pid;
+        cand_name = p->name;
+        cand_count = 1;
+    }
+    if (cand_count < PROCESS_GOOD_NUM) {
+        free_osiproc(p);
+        return 0;
+    }
+
+    panda_disable_callback(plugin_self, PANDA_CB_BEFORE_BLOCK_EXEC, identify_pcb);
+    auto key = std::make_tuple((uint32_t) p->pid, (uint64_t) s.asid, std::string(p->name));
+    auto it = proc_ids.find(key);
+    if (it == proc_ids.end()) {
+        index_proc ip = { { (uint32_t) p->pid, (uint32_t) p->ppid, s.asid,
+                            s.instr, s.instr, (uint32_t) strlen(p->name) }, p->name };
+        it = proc_ids.insert(std::make_pair(key, (uint32_t) procs.size())).first;
+        procs.push_back(ip);
+    }
+    s.proc = it->second;
+    free_osiproc(p);
+
+    // system calls and library loads while we were making sure
+    for (auto sc = syscalls.rbegin(); sc != syscalls.rend() && sc->instr >= s.instr; ++sc) {
+        sc->proc = s.proc;
+        if (!sc->is_return) {
+            uint64_t key = ((uint64_t) procs[s.proc].rec.pid << 32) | sc->callno;
+            auto &v = syscalls_by_pid[key];
+            v.insert(std::upper_bound(v.begin(), v.end(), sc->instr), sc->instr);
+        }
+    }
+    for (auto m = modules.rbegin(); m != modules.rend() && m->first.instr >= s.instr; ++m) {
+        m->first.proc = s.proc;
+    }
+    return 0;
+}
+
+void index_sys_enter(CPUState *cpu, target_ulong pc, target_ulong callno) {
+    add_syscall(rr_get_guest_instr_count(), current_proc(), callno, false);
+}
+
+void index_sys_return(CPUState *cpu, target_ulong pc, target_ulong callno) {
+    add_syscall(rr_get_guest_instr_count(), current_proc(), callno, true);
+}
+
+void index_library_load(CPUState *cpu, target_ulong pc, char *filename,
+                        target_ulong base_addr, target_ulong size) {
+    index_module m = { rr_get_guest_instr_count(), current_proc(), base_addr, size,
+                       (uint32_t) strlen(filename) };
+    modules.push_back(std::make_pair(m, std::string(filename)));
+}
+
+static void save_index(const char *name) {
+    FILE *fp = fopen(name, "wb");
+    if (!fp) {
+        perror("replay_index: save");
+        return;
+    }
+    index_header h = { {'P', 'R', 'I', 'X'}, 1, procs.size(), switches.size(),
+                       syscalls.size(), modules.size() };
+    fwrite(&h, sizeof(h), 1, fp);
+    for (auto &ip : procs) {
+        fwrite(&ip.rec, sizeof(ip.rec), 1, fp);
+        fwrite(ip.name.data(), 1, ip.name.size(), fp);
+    }
+    fwrite(switches.data(), sizeof(index_switch), switches.size(), fp);
+    fwrite(syscalls.data(), sizeof(index_syscall), syscalls.size(), fp);
+    for (auto &m : modules) {
+        fwrite(&m.first, sizeof(m.first), 1, fp);
+        fwrite(m.second.data(), 1, m.second.size(), fp);
+    }
+    fclose(fp);
+    printf("replay_index: %zu processes, %zu asid changes, %zu system calls, "
+           "%zu library loads saved to %s\n", procs.size(), switches.size(),
+           syscalls.size(), modules.size(), name);
+}
+
+static bool read_string(FILE *fp, uint32_t len, std::string &s) {
+    s.resize(len);
+    return len == 0 || fread(&s[0], 1, len, fp) == len;
+}
+
+static bool load_index(const char *name) {
+    FILE *fp = fopen(name, "rb");
+    if (!fp) {
+        perror("replay_index: load");
+        return false;
+    }
+    index_header h;
+    bool ok = fread(&h, sizeof(h), 1, fp) == 1 &&
+        memcmp(h.magic, "PRIX", 4) == 0 && h.version == 1;
+    for (uint64_t i = 0; ok && i < h.num_procs; i++) {
+        index_proc ip;
+        ok = fread(&ip.rec, sizeof(ip.rec), 1, fp) == 1 &&
+            read_string(fp, ip.rec.name_len, ip.name);
+        if (ok) procs.push_back(ip);
+    }
+    if (ok) {
+        switches.resize(h.num_switches);
+        ok = fread(switches.data(), sizeof(index_switch), switches.size(), fp) == switches.size();
+    }
+    for (uint64_t i = 0; ok && i < h.num_syscalls; i++) {
+        index_syscall sc;
+        ok = fread(&sc, sizeof(sc), 1, fp) == 1 &&
+            (sc.proc == NO_PROC || sc.proc < procs.size());
+        if (ok) add_syscall(sc.instr, sc.proc, sc.callno, sc.is_return);
+    }
+    for (uint64_t i = 0; ok && i < h.num_modules; i++) {
+        std::pair<index_module, std::string> m;
+        ok = fread(&m.first, sizeof(m.first), 1, fp) == 1 &&
+            read_string(fp, m.first.name_len, m.second);
+        if (ok) modules.push_back(m);
+    }
+    for (auto &s : switches) {
+        ok = ok && (s.proc == NO_PROC || s.proc < procs.size());
+    }
+    fclose(fp);
+    if (!ok) {
+        fprintf(stderr, "replay_index: %s is not a valid index\n", name);
+        procs.clear();
+        switches.clear();
+        syscalls.clear();
+        modules.clear();
+        syscalls_by_pid.clear();
+    }
+    return ok;
+}
+
+// Reads the index the first time it is needed, as the name of the replay
+// isn't known when the plugin is loaded.
+static bool index_ready(void) {
+    static bool tried = false, ready = false;
+    if (build) return true;
+    if (!tried) {
+        tried = true;
+        if (index_file.empty()) index_file = default_index_file();
+        ready = !index_file.empty() && load_index(index_file.c_str());
+    }
+    return ready;
+}
+
+static const index_switch *switch_at(uint64_t instr) {
+    if (!index_ready()) return NULL;
+    auto it = std::upper_bound(switches.begin(), switches.end(), instr,
+            [](uint64_t i, const index_switch &s) { return i < s.instr; });
+    if (it == switches.begin()) return NULL;
+    return &*(it - 1);
+}
+
+static const index_proc *proc_at(uint64_t instr) {
+    const index_switch *s = switch_at(instr);
+    if (s == NULL || s->proc == NO_PROC) return NULL;
+    return &procs[s->proc];
+}
+
+int32_t replay_index_pid_at(uint64_t instr) {
+    const index_proc *p = proc_at(instr);
+    return p ? (int32_t) p->rec.pid : -1;
+}
+
+target_ulong replay_index_asid_at(uint64_t instr) {
+    const index_switch *s = switch_at(instr);
+    return s ? s->asid : 0;
+}
+
+char *replay_index_name_at(uint64_t instr) {
+    const index_proc *p = proc_at(instr);
+    return p ? strdup(p->name.c_str()) : NULL;
+}
+
+uint32_t replay_index_syscalls(int32_t pid, uint32_t callno, uint64_t *instrs, uint32_t max) {
+    if (!index_ready()) return 0;
+    auto it = syscalls_by_pid.find(((uint64_t) (uint32_t) pid << 32) | callno);
+    if (it == syscalls_by_pid.end()) return 0;
+    uint32_t n = std::min((size_t) max, it->second.size());
+    std::copy(it->second.begin(), it->second.begin() + n, instrs);
+    return it->second.size();
+}
+
+bool init_plugin(void *self) {
+    panda_arg_list *args = panda_get_args("replay_index");
+    build = panda_parse_bool_opt(args, "build", "index this replay instead of reading its index");
+    index_file = panda_parse_string_opt(args, "file", "",
+            "index file (default: <replay>-rr-index.bin next to the nondet log)");
+    panda_free_args(args);
+
+    if (!build) return true;
+
+    panda_require("osi");
+    assert(init_osi_api());
+    panda_require("syscalls2");
+
+    plugin_self = self;
+    panda_cb pcb;
+    pcb.asid_changed = index_asid_changed;
+    panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+    identify_pcb.before_block_exec = index_before_block_exec;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, identify_pcb);
+    panda_disable_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, identify_pcb);
+
+    PPP_REG_CB("syscalls2", on_all_sys_enter, index_sys_enter);
+    PPP_REG_CB("syscalls2", on_all_sys_return, index_sys_return);
+    if (panda_get_plugin_by_name("loaded")) {
+        PPP_REG_CB("loaded", on_library_load, index_library_load);
+    }
+    return true;
+}
+
+void uninit_plugin(void *self) {
+    if (!build) return;
+    uint32_t proc = current_proc();
+    if (proc != NO_PROC) procs[proc].rec.last = rr_get_guest_instr_count();
+    if (index_file.empty()) index_file = default_index_file();
+    if (index_file.empty()) {
+        fprintf(stderr, "replay_index: not replaying, no index written\n");
+        return;
+    }
+    save_index(index_file.c_str());
+}
@@ -0,0 +1,3 @@
+typedef void target_ulong;
+
+#include "replay_index_int_fns.h"
@@ -0,0 +1,17 @@
+#ifndef __REPLAY_INDEX_INT_FNS_H__
+#define __REPLAY_INDEX_INT_FNS_H__
+
+// pid of the process running at instr, or -1 if it isn't known
+int32_t replay_index_pid_at(uint64_t instr);
+
+// asid in use at instr, or 0 if it isn't known
+target_ulong replay_index_asid_at(uint64_t instr);
+
+// name of the process running at instr, or NULL. free() it when done
+char *replay_index_name_at(uint64_t instr);
+
+// stores the instruction counts at which pid entered system call callno
+// in instrs, up to max of them, and returns how many there are
+uint32_t replay_index_syscalls(int32_t pid, uint32_t callno, uint64_t *instrs, uint32_t max);
+
+#endif
@@ -23,6 +23,7 @@ PANDAENDCOMMENT */
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include "panda/plugin.h"
@@ -33,6 +34,7 @@ extern "C" {
 
 #include "callstack_instr/callstack_instr.h"
 #include "callstack_instr/callstack_instr_ext.h"
+#include "callstack_instr/prog_point_map.h"
 
 using namespace std;
 
@@ -50,15 +52,6 @@ PPP_PROT_REG_CB(on_ssm);
 
 }
 
-// Silly: since we use these as map values, they have to be
-// copy constructible. Plain arrays aren't, but structs containing
-// arrays are. So we make these goofy wrappers.
-struct match_strings {
-    int val[MAX_STRINGS];
-};
-struct string_pos {
-    uint32_t val[MAX_STRINGS];
-};
 struct fullstack {
     int n;
     target_ulong callers[MAX_CALLERS];
@@ -66,69 +59,182 @@ struct fullstack {
     target_ulong asid;
 };
 
+/*
+  Aho-Corasick automaton over all the search strings.
+
+  Each tap point keeps a single automaton state, which every byte read or
+  written there advances by one transition. The work per byte doesn't depend
+  on the number of strings, and overlapping matches are all found.
+
+  Trie edges are stored sorted per state in flat arrays. Transitions out of
+  the root are a dense table, since most bytes of most accesses end up there.
+*/
+#define NO_STRING UINT32_MAX
+
+struct ac_node {
+    uint32_t fail;      // state of the longest proper suffix in the trie
+    uint32_t dict;      // nearest state on the fail chain ending a string, 0 if none
+    uint32_t out;       // first string ending in this state, or NO_STRING
+    uint32_t edges;     // children are ac_edge_byte/ac_edge_to[edges, edges + n_edges)
+    uint32_t n_edges;
+};
+
+std::vector<ac_node> ac;
+std::vector<uint8_t> ac_edge_byte;
+std::vector<uint32_t> ac_edge_to;
+uint32_t ac_root[256];
+
+std::vector<std::vector<uint8_t>> tofind;
+// next string with the same contents, or NO_STRING
+std::vector<uint32_t> same_string;
+uint32_t num_strings = 0;
+
 std::map<prog_point,fullstack> matchstacks;
-std::map<prog_point,match_strings> matches;
-std::map<prog_point,string_pos> read_text_tracker;
-std::map<prog_point,string_pos> write_text_tracker;
-uint8_t tofind[MAX_STRINGS][MAX_STRLEN];
-uint32_t strlens[MAX_STRINGS];
-int num_strings = 0;
+// match counts per tap point, by string
+std::map<prog_point,std::map<uint32_t,int>> matches;
+prog_point_map<uint32_t> read_text_tracker;
+prog_point_map<uint32_t> write_text_tracker;
 int n_callers = 16;
+const callstack_instr_state *cs_state = NULL;
 
 // this creates BOTH the global for this callback fn (on_ssm_func)
 // and the function used by other plugins to register a fn (add_on_ssm)
 PPP_CB_BOILERPLATE(on_ssm)
 
-// this creates the 
+static inline uint32_t ac_step(uint32_t s, uint8_t c) {
+    while (s != 0) {
+        const ac_node &n = ac[s];
+        const uint8_t *e = (const uint8_t *)
+            memchr(ac_edge_byte.data() + n.edges, c, n.n_edges);
+        if (e) return ac_edge_to[e - ac_edge_byte.data()];
+        s = n.fail;
+    }
+    return ac_root[c];
+}
+
+static void add_string(const uint8_t *str, size_t len) {
+    if (len == 0) return;
+    tofind.push_back(std::vector<uint8_t>(str, str + len));
+    num_strings++;
+}
+
+static void build_automaton(void) {
+    // build the trie
+    std::vector<std::map<uint8_t,uint32_t>> children(1);
+    std::vector<uint32_t> out(1, NO_STRING);
+    same_string.assign(num_strings, NO_STRING);
+    for (uint32_t str_idx = 0; str_idx < num_strings; str_idx++) {
+        uint32_t s = 0;
+        for (uint8_t c : tofind[str_idx]) {
+            auto it = children[s].find(c);
+            if (it != children[s].end()) {
+                s = it->second;
+                continue;
+            }
+            uint32_t child = children.size();
+            children.push_back(std::map<uint8_t,uint32_t>());
+            out.push_back(NO_STRING);
+            children[s][c] = child;
+            s = child;
+        }
+        if (out[s] == NO_STRING) {
+            out[s] = str_idx;
+        } else {
+            uint32_t i = out[s];
+            while (same_string[i] != NO_STRING) i = same_string[i];
+            same_string[i] = str_idx;
+        }
+    }
+
+    // flatten it
+    ac.assign(children.size(), ac_node());
+    for (uint32_t s = 0; s < children.size(); s++) {
+        ac[s].out = out[s];
+        ac[s].edges = ac_edge_byte.size();
+        ac[s].n_edges = children[s].size();
+        for (auto &e : children[s]) {
+            ac_edge_byte.push_back(e.first);
+            ac_edge_to.push_back(e.second);
+        }
+    }
+    memset(ac_root, 0, sizeof(ac_root));
+    for (auto &e : children[0]) ac_root[e.first] = e.second;
+
+    // fail and dictionary links, breadth first so that the fail state of
+    // every state is done before its children
+    std::vector<uint32_t> queue;
+    for (auto &e : children[0]) queue.push_back(e.second);
+    for (size_t q = 0; q < queue.size(); q++) {
+        uint32_t s = queue[q];
+        for (auto &e : children[s]) {
+            uint32_t child = e.second;
+            uint32_t f = ac_step(ac[s].fail, e.first);
+            ac[child].fail = f;
+            ac[child].dict = ac[f].out != NO_STRING ? f : ac[f].dict;
+            queue.push_back(child);
+        }
+    }
+    printf("stringsearch: %u strings, %zu automaton states\n", num_strings, ac.size());
+}
+
+static void report_match(CPUState *env, target_ulong pc, target_ulong addr,
+                         const prog_point &p, uint32_t str_idx, bool is_write) {
+    const std::vector<uint8_t> &str = tofind[str_idx];
+    uint32_t len = str.size();
+
+    // Victory!
+    printf("%s Match of str %u at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
+           (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
+    matches[p][str_idx]++;
+
+    // Also get the full stack here
+    fullstack f = {0};
+    f.n = get_callers(f.callers, n_callers, env);
+    f.pc = p.pc;
+    f.asid = p.cr3;
+    matchstacks[p] = f;
+
+    // Check if the full string is in memory. Compare in place
+    // when the match doesn't straddle a page boundary.
+    target_ulong match_addr = addr - (len - 1);
+    bool in_memory;
+    hwaddr hlen = len;
+    uint8_t *host = panda_virtual_memory_ptr(env, match_addr, &hlen, 0);
+    if (host && hlen == len) {
+        in_memory = memcmp(host, str.data(), len) == 0;
+    } else {
+        std::vector<uint8_t> tmp(len);
+        panda_virtual_memory_read(env, match_addr, tmp.data(), len);
+        in_memory = tmp == str;
+    }
+
+    // call the i-found-a-match registered callbacks here
+    PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
+               tofind[str_idx].data(), len, is_write, in_memory);
+}
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf, bool is_write,
-                       std::map<prog_point,string_pos> &text_tracker) {
+                       prog_point_map<uint32_t> &text_tracker) {
     prog_point p = {};
-    get_prog_point(env, &p);
+    if (!get_prog_point_fast(cs_state, env, &p)) get_prog_point(env, &p);
 
-    string_pos &sp = text_tracker[p];
+    uint32_t s = text_tracker[p];
 
     for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        for(int str_idx = 0; str_idx < num_strings; str_idx++) {
-            if (tofind[str_idx][sp.val[str_idx]] == val)
-                sp.val[str_idx]++;
-            else
-                sp.val[str_idx] = 0;
-
-            if (sp.val[str_idx] == strlens[str_idx]) {
-                // Victory!
-                printf("%s Match of str %d at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
-                       (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
-                matches[p].val[str_idx]++;
-                sp.val[str_idx] = 0;
-
-                // Also get the full stack here
-                fullstack f = {0};
-                f.n = get_callers(f.callers, n_callers, env);
-                f.pc = p.pc;
-                f.asid = p.cr3;
-                matchstacks[p] = f;
-
-                // Check if the full string is in memory.
-                uint8_t *tmp =
-                    (uint8_t *)calloc(strlens[str_idx] + 1, sizeof(*tmp));
-                target_ulong match_addr = (addr + i) - (strlens[str_idx] - 1);
-                panda_virtual_memory_read(env, match_addr, tmp,
-                                          strlens[str_idx]);
-                bool in_memory =
-                    memcmp(tmp, tofind[str_idx], strlens[str_idx]) == 0;
-                free(tmp);
-
-                // call the i-found-a-match registered callbacks here
-                PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
-                           tofind[str_idx], strlens[str_idx], is_write,
-                           in_memory);
+        s = ac_step(s, ((uint8_t *)buf)[i]);
+        if (likely(ac[s].out == NO_STRING && ac[s].dict == 0)) continue;
+
+        // every string ending here: this state's, then down the dictionary links
+        for (uint32_t m = ac[s].out != NO_STRING ? s : ac[s].dict; m != 0; m = ac[m].dict) {
+            for (uint32_t str_idx = ac[m].out; str_idx != NO_STRING; str_idx = same_string[str_idx]) {
+                report_match(env, pc, addr + i, p, str_idx, is_write);
             }
         }
     }
- 
+
+    // hits the last entry cache of the map
+    text_tracker[p] = s;
     return 1;
 }
 
@@ -153,12 +259,7 @@ bool init_plugin(void *self) {
     panda_arg_list *args = panda_get_args("stringsearch");
 
     const char *arg_str = panda_parse_string_opt(args, "str", "", "a single string to search for");
-    size_t arg_len = strlen(arg_str);
-    if (arg_len > 0) {
-        memcpy(tofind[num_strings], arg_str, arg_len);
-        strlens[num_strings] = arg_len;
-        num_strings++;
-    }
+    add_string((const uint8_t *) arg_str, strlen(arg_str));
 
     n_callers = panda_parse_uint64_opt(args, "callers", 16, "depth of callstack for matches");
     if (n_callers > MAX_CALLERS) n_callers = MAX_CALLERS;
@@ -181,33 +282,23 @@ bool init_plugin(void *self) {
         // or "string" (no newlines)
         std::string line;
         while(std::getline(search_strings, line)) {
+            if (line.empty()) continue;
             std::istringstream iss(line);
 
             if (line[0] == '"') {
-                size_t len = line.size() - 2;
-                memcpy(tofind[num_strings], line.substr(1, len).c_str(), len);
-                strlens[num_strings] = len;
+                size_t len = line.size() >= 2 ? line.size() - 2 : 0;
+                add_string((const uint8_t *) line.substr(1, len).c_str(), len);
             } else {
                 std::string x;
-                int i = 0;
+                std::vector<uint8_t> str;
                 while (std::getline(iss, x, ':')) {
-                    tofind[num_strings][i++] = (uint8_t)strtoul(x.c_str(), NULL, 16);
-                    if (i >= MAX_STRLEN) {
-                        printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
-                        break;
-                    }
+                    str.push_back((uint8_t)strtoul(x.c_str(), NULL, 16));
                 }
-                strlens[num_strings] = i;
-            }
-
-            printf("stringsearch: added string of length %d to search set\n", strlens[num_strings]);
-
-            if(++num_strings >= MAX_STRINGS) {
-                printf("WARN: maximum number of strings (%d) reached, will not load any more.\n", MAX_STRINGS);
-                break;
+                add_string(str.data(), str.size());
             }
         }
     }
+    build_automaton();
 
     char matchfile[128] = {};
     sprintf(matchfile, "%s_string_matches.txt", prefix);
@@ -219,6 +310,7 @@ bool init_plugin(void *self) {
     }
 
     if(!init_callstack_instr_api()) return false;
+    cs_state = PPP_IMPORT_SHARED("callstack_instr", callstack_instr_state, callstack_instr_state);
 
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
@@ -235,8 +327,7 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    std::map<prog_point,match_strings>::iterator it;
-    for(it = matches.begin(); it != matches.end(); it++) {
+    for(auto it = matches.begin(); it != matches.end(); it++) {
         // Print prog point
 
         // Most recent callers are returned first, so print them
@@ -249,9 +340,12 @@ void uninit_plugin(void *self) {
         fprintf(mem_report, TARGET_FMT_lx " ", f.asid);
 
         // Print strings that matched and how many times
-        for(int i = 0; i < num_strings; i++)
-            fprintf(mem_report, " %d", it->second.val[i]);
+        for(uint32_t i = 0; i < num_strings; i++) {
+            auto count = it->second.find(i);
+            fprintf(mem_report, " %d", count == it->second.end() ? 0 : count->second);
+        }
         fprintf(mem_report, "\n");
     }
     fclose(mem_report);
 }
+
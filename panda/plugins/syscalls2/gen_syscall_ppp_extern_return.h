@@ -1,4 +1,4 @@
-#ifdef TARGET_ARM
+#if defined(TARGET_ARM)
 PPP_CB_EXTERN(on_ARM_breakpoint_return)
 PPP_CB_EXTERN(on_ARM_cacheflush_return)
 PPP_CB_EXTERN(on_ARM_cmpxchg_return)
@@ -318,7 +318,730 @@ PPP_CB_EXTERN(on_sys_write_return)
 PPP_CB_EXTERN(on_sys_writev_return)
 PPP_CB_EXTERN(on_vfork_return)
 #endif
-#ifdef TARGET_I386
+#if defined(TARGET_X86_64)
+PPP_CB_EXTERN(on_x64_get_thread_area_return)
+PPP_CB_EXTERN(on_x64_NtAcceptConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheck_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckAndAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckByType_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckByTypeAndAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckByTypeResultList_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckByTypeResultListAndAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)
+PPP_CB_EXTERN(on_x64_NtAddAtom_return)
+PPP_CB_EXTERN(on_x64_NtAddBootEntry_return)
+PPP_CB_EXTERN(on_x64_NtAddDriverEntry_return)
+PPP_CB_EXTERN(on_x64_NtAdjustGroupsToken_return)
+PPP_CB_EXTERN(on_x64_NtAdjustPrivilegesToken_return)
+PPP_CB_EXTERN(on_x64_NtAlertResumeThread_return)
+PPP_CB_EXTERN(on_x64_NtAlertThread_return)
+PPP_CB_EXTERN(on_x64_NtAllocateLocallyUniqueId_return)
+PPP_CB_EXTERN(on_x64_NtAllocateReserveObject_return)
+PPP_CB_EXTERN(on_x64_NtAllocateUserPhysicalPages_return)
+PPP_CB_EXTERN(on_x64_NtAllocateUuids_return)
+PPP_CB_EXTERN(on_x64_NtAllocateVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtAlpcAcceptConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCancelMessage_return)
+PPP_CB_EXTERN(on_x64_NtAlpcConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCreatePort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCreatePortSection_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCreateResourceReserve_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCreateSectionView_return)
+PPP_CB_EXTERN(on_x64_NtAlpcCreateSecurityContext_return)
+PPP_CB_EXTERN(on_x64_NtAlpcDeletePortSection_return)
+PPP_CB_EXTERN(on_x64_NtAlpcDeleteResourceReserve_return)
+PPP_CB_EXTERN(on_x64_NtAlpcDeleteSectionView_return)
+PPP_CB_EXTERN(on_x64_NtAlpcDeleteSecurityContext_return)
+PPP_CB_EXTERN(on_x64_NtAlpcDisconnectPort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcImpersonateClientOfPort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcOpenSenderProcess_return)
+PPP_CB_EXTERN(on_x64_NtAlpcOpenSenderThread_return)
+PPP_CB_EXTERN(on_x64_NtAlpcQueryInformation_return)
+PPP_CB_EXTERN(on_x64_NtAlpcQueryInformationMessage_return)
+PPP_CB_EXTERN(on_x64_NtAlpcRevokeSecurityContext_return)
+PPP_CB_EXTERN(on_x64_NtAlpcSendWaitReceivePort_return)
+PPP_CB_EXTERN(on_x64_NtAlpcSetInformation_return)
+PPP_CB_EXTERN(on_x64_NtApphelpCacheControl_return)
+PPP_CB_EXTERN(on_x64_NtAreMappedFilesTheSame_return)
+PPP_CB_EXTERN(on_x64_NtAssignProcessToJobObject_return)
+PPP_CB_EXTERN(on_x64_NtCallbackReturn_return)
+PPP_CB_EXTERN(on_x64_NtCancelIoFile_return)
+PPP_CB_EXTERN(on_x64_NtCancelIoFileEx_return)
+PPP_CB_EXTERN(on_x64_NtCancelSynchronousIoFile_return)
+PPP_CB_EXTERN(on_x64_NtCancelTimer_return)
+PPP_CB_EXTERN(on_x64_NtClearEvent_return)
+PPP_CB_EXTERN(on_x64_NtClose_return)
+PPP_CB_EXTERN(on_x64_NtCloseObjectAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtCommitComplete_return)
+PPP_CB_EXTERN(on_x64_NtCommitEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtCommitTransaction_return)
+PPP_CB_EXTERN(on_x64_NtCompactKeys_return)
+PPP_CB_EXTERN(on_x64_NtCompareTokens_return)
+PPP_CB_EXTERN(on_x64_NtCompleteConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtCompressKey_return)
+PPP_CB_EXTERN(on_x64_NtConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtContinue_return)
+PPP_CB_EXTERN(on_x64_NtCreateDebugObject_return)
+PPP_CB_EXTERN(on_x64_NtCreateDirectoryObject_return)
+PPP_CB_EXTERN(on_x64_NtCreateEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtCreateEvent_return)
+PPP_CB_EXTERN(on_x64_NtCreateEventPair_return)
+PPP_CB_EXTERN(on_x64_NtCreateFile_return)
+PPP_CB_EXTERN(on_x64_NtCreateIoCompletion_return)
+PPP_CB_EXTERN(on_x64_NtCreateJobObject_return)
+PPP_CB_EXTERN(on_x64_NtCreateJobSet_return)
+PPP_CB_EXTERN(on_x64_NtCreateKey_return)
+PPP_CB_EXTERN(on_x64_NtCreateKeyedEvent_return)
+PPP_CB_EXTERN(on_x64_NtCreateKeyTransacted_return)
+PPP_CB_EXTERN(on_x64_NtCreateMailslotFile_return)
+PPP_CB_EXTERN(on_x64_NtCreateMutant_return)
+PPP_CB_EXTERN(on_x64_NtCreateNamedPipeFile_return)
+PPP_CB_EXTERN(on_x64_NtCreatePagingFile_return)
+PPP_CB_EXTERN(on_x64_NtCreatePort_return)
+PPP_CB_EXTERN(on_x64_NtCreatePrivateNamespace_return)
+PPP_CB_EXTERN(on_x64_NtCreateProcess_return)
+PPP_CB_EXTERN(on_x64_NtCreateProcessEx_return)
+PPP_CB_EXTERN(on_x64_NtCreateProfile_return)
+PPP_CB_EXTERN(on_x64_NtCreateProfileEx_return)
+PPP_CB_EXTERN(on_x64_NtCreateResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtCreateSection_return)
+PPP_CB_EXTERN(on_x64_NtCreateSemaphore_return)
+PPP_CB_EXTERN(on_x64_NtCreateSymbolicLinkObject_return)
+PPP_CB_EXTERN(on_x64_NtCreateThread_return)
+PPP_CB_EXTERN(on_x64_NtCreateThreadEx_return)
+PPP_CB_EXTERN(on_x64_NtCreateTimer_return)
+PPP_CB_EXTERN(on_x64_NtCreateToken_return)
+PPP_CB_EXTERN(on_x64_NtCreateTransaction_return)
+PPP_CB_EXTERN(on_x64_NtCreateTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtCreateUserProcess_return)
+PPP_CB_EXTERN(on_x64_NtCreateWaitablePort_return)
+PPP_CB_EXTERN(on_x64_NtCreateWorkerFactory_return)
+PPP_CB_EXTERN(on_x64_NtDebugActiveProcess_return)
+PPP_CB_EXTERN(on_x64_NtDebugContinue_return)
+PPP_CB_EXTERN(on_x64_NtDelayExecution_return)
+PPP_CB_EXTERN(on_x64_NtDeleteAtom_return)
+PPP_CB_EXTERN(on_x64_NtDeleteBootEntry_return)
+PPP_CB_EXTERN(on_x64_NtDeleteDriverEntry_return)
+PPP_CB_EXTERN(on_x64_NtDeleteFile_return)
+PPP_CB_EXTERN(on_x64_NtDeleteKey_return)
+PPP_CB_EXTERN(on_x64_NtDeleteObjectAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtDeletePrivateNamespace_return)
+PPP_CB_EXTERN(on_x64_NtDeleteValueKey_return)
+PPP_CB_EXTERN(on_x64_NtDeviceIoControlFile_return)
+PPP_CB_EXTERN(on_x64_NtDisableLastKnownGood_return)
+PPP_CB_EXTERN(on_x64_NtDisplayString_return)
+PPP_CB_EXTERN(on_x64_NtDrawText_return)
+PPP_CB_EXTERN(on_x64_NtDuplicateObject_return)
+PPP_CB_EXTERN(on_x64_NtDuplicateToken_return)
+PPP_CB_EXTERN(on_x64_NtEnableLastKnownGood_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateBootEntries_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateDriverEntries_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateKey_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateSystemEnvironmentValuesEx_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateTransactionObject_return)
+PPP_CB_EXTERN(on_x64_NtEnumerateValueKey_return)
+PPP_CB_EXTERN(on_x64_NtExtendSection_return)
+PPP_CB_EXTERN(on_x64_NtFilterToken_return)
+PPP_CB_EXTERN(on_x64_NtFindAtom_return)
+PPP_CB_EXTERN(on_x64_NtFlushBuffersFile_return)
+PPP_CB_EXTERN(on_x64_NtFlushInstallUILanguage_return)
+PPP_CB_EXTERN(on_x64_NtFlushInstructionCache_return)
+PPP_CB_EXTERN(on_x64_NtFlushKey_return)
+PPP_CB_EXTERN(on_x64_NtFlushProcessWriteBuffers_return)
+PPP_CB_EXTERN(on_x64_NtFlushVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtFlushWriteBuffer_return)
+PPP_CB_EXTERN(on_x64_NtFreeUserPhysicalPages_return)
+PPP_CB_EXTERN(on_x64_NtFreeVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtFreezeRegistry_return)
+PPP_CB_EXTERN(on_x64_NtFreezeTransactions_return)
+PPP_CB_EXTERN(on_x64_NtFsControlFile_return)
+PPP_CB_EXTERN(on_x64_NtGetContextThread_return)
+PPP_CB_EXTERN(on_x64_NtGetCurrentProcessorNumber_return)
+PPP_CB_EXTERN(on_x64_NtGetDevicePowerState_return)
+PPP_CB_EXTERN(on_x64_NtGetMUIRegistryInfo_return)
+PPP_CB_EXTERN(on_x64_NtGetNextProcess_return)
+PPP_CB_EXTERN(on_x64_NtGetNextThread_return)
+PPP_CB_EXTERN(on_x64_NtGetNlsSectionPtr_return)
+PPP_CB_EXTERN(on_x64_NtGetNotificationResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtGetPlugPlayEvent_return)
+PPP_CB_EXTERN(on_x64_NtGetWriteWatch_return)
+PPP_CB_EXTERN(on_x64_NtImpersonateAnonymousToken_return)
+PPP_CB_EXTERN(on_x64_NtImpersonateClientOfPort_return)
+PPP_CB_EXTERN(on_x64_NtImpersonateThread_return)
+PPP_CB_EXTERN(on_x64_NtInitializeNlsFiles_return)
+PPP_CB_EXTERN(on_x64_NtInitializeRegistry_return)
+PPP_CB_EXTERN(on_x64_NtInitiatePowerAction_return)
+PPP_CB_EXTERN(on_x64_NtIsProcessInJob_return)
+PPP_CB_EXTERN(on_x64_NtIsSystemResumeAutomatic_return)
+PPP_CB_EXTERN(on_x64_NtIsUILanguageComitted_return)
+PPP_CB_EXTERN(on_x64_NtListenPort_return)
+PPP_CB_EXTERN(on_x64_NtLoadDriver_return)
+PPP_CB_EXTERN(on_x64_NtLoadKey_return)
+PPP_CB_EXTERN(on_x64_NtLoadKey2_return)
+PPP_CB_EXTERN(on_x64_NtLoadKeyEx_return)
+PPP_CB_EXTERN(on_x64_NtLockFile_return)
+PPP_CB_EXTERN(on_x64_NtLockProductActivationKeys_return)
+PPP_CB_EXTERN(on_x64_NtLockRegistryKey_return)
+PPP_CB_EXTERN(on_x64_NtLockVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtMakePermanentObject_return)
+PPP_CB_EXTERN(on_x64_NtMakeTemporaryObject_return)
+PPP_CB_EXTERN(on_x64_NtMapCMFModule_return)
+PPP_CB_EXTERN(on_x64_NtMapUserPhysicalPages_return)
+PPP_CB_EXTERN(on_x64_NtMapUserPhysicalPagesScatter_return)
+PPP_CB_EXTERN(on_x64_NtMapViewOfSection_return)
+PPP_CB_EXTERN(on_x64_NtModifyBootEntry_return)
+PPP_CB_EXTERN(on_x64_NtModifyDriverEntry_return)
+PPP_CB_EXTERN(on_x64_NtNotifyChangeDirectoryFile_return)
+PPP_CB_EXTERN(on_x64_NtNotifyChangeKey_return)
+PPP_CB_EXTERN(on_x64_NtNotifyChangeMultipleKeys_return)
+PPP_CB_EXTERN(on_x64_NtNotifyChangeSession_return)
+PPP_CB_EXTERN(on_x64_NtOpenDirectoryObject_return)
+PPP_CB_EXTERN(on_x64_NtOpenEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtOpenEvent_return)
+PPP_CB_EXTERN(on_x64_NtOpenEventPair_return)
+PPP_CB_EXTERN(on_x64_NtOpenFile_return)
+PPP_CB_EXTERN(on_x64_NtOpenIoCompletion_return)
+PPP_CB_EXTERN(on_x64_NtOpenJobObject_return)
+PPP_CB_EXTERN(on_x64_NtOpenKey_return)
+PPP_CB_EXTERN(on_x64_NtOpenKeyedEvent_return)
+PPP_CB_EXTERN(on_x64_NtOpenKeyEx_return)
+PPP_CB_EXTERN(on_x64_NtOpenKeyTransacted_return)
+PPP_CB_EXTERN(on_x64_NtOpenKeyTransactedEx_return)
+PPP_CB_EXTERN(on_x64_NtOpenMutant_return)
+PPP_CB_EXTERN(on_x64_NtOpenObjectAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtOpenPrivateNamespace_return)
+PPP_CB_EXTERN(on_x64_NtOpenProcess_return)
+PPP_CB_EXTERN(on_x64_NtOpenProcessToken_return)
+PPP_CB_EXTERN(on_x64_NtOpenProcessTokenEx_return)
+PPP_CB_EXTERN(on_x64_NtOpenResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtOpenSection_return)
+PPP_CB_EXTERN(on_x64_NtOpenSemaphore_return)
+PPP_CB_EXTERN(on_x64_NtOpenSession_return)
+PPP_CB_EXTERN(on_x64_NtOpenSymbolicLinkObject_return)
+PPP_CB_EXTERN(on_x64_NtOpenThread_return)
+PPP_CB_EXTERN(on_x64_NtOpenThreadToken_return)
+PPP_CB_EXTERN(on_x64_NtOpenThreadTokenEx_return)
+PPP_CB_EXTERN(on_x64_NtOpenTimer_return)
+PPP_CB_EXTERN(on_x64_NtOpenTransaction_return)
+PPP_CB_EXTERN(on_x64_NtOpenTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtPlugPlayControl_return)
+PPP_CB_EXTERN(on_x64_NtPowerInformation_return)
+PPP_CB_EXTERN(on_x64_NtPrepareComplete_return)
+PPP_CB_EXTERN(on_x64_NtPrepareEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtPrePrepareComplete_return)
+PPP_CB_EXTERN(on_x64_NtPrePrepareEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtPrivilegeCheck_return)
+PPP_CB_EXTERN(on_x64_NtPrivilegedServiceAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtPrivilegeObjectAuditAlarm_return)
+PPP_CB_EXTERN(on_x64_NtPropagationComplete_return)
+PPP_CB_EXTERN(on_x64_NtPropagationFailed_return)
+PPP_CB_EXTERN(on_x64_NtProtectVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtPulseEvent_return)
+PPP_CB_EXTERN(on_x64_NtQueryAttributesFile_return)
+PPP_CB_EXTERN(on_x64_NtQueryBootEntryOrder_return)
+PPP_CB_EXTERN(on_x64_NtQueryBootOptions_return)
+PPP_CB_EXTERN(on_x64_NtQueryDebugFilterState_return)
+PPP_CB_EXTERN(on_x64_NtQueryDefaultLocale_return)
+PPP_CB_EXTERN(on_x64_NtQueryDefaultUILanguage_return)
+PPP_CB_EXTERN(on_x64_NtQueryDirectoryFile_return)
+PPP_CB_EXTERN(on_x64_NtQueryDirectoryObject_return)
+PPP_CB_EXTERN(on_x64_NtQueryDriverEntryOrder_return)
+PPP_CB_EXTERN(on_x64_NtQueryEaFile_return)
+PPP_CB_EXTERN(on_x64_NtQueryEvent_return)
+PPP_CB_EXTERN(on_x64_NtQueryFullAttributesFile_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationAtom_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationJobObject_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationPort_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationProcess_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationThread_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationToken_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationTransaction_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtQueryInformationWorkerFactory_return)
+PPP_CB_EXTERN(on_x64_NtQueryInstallUILanguage_return)
+PPP_CB_EXTERN(on_x64_NtQueryIntervalProfile_return)
+PPP_CB_EXTERN(on_x64_NtQueryIoCompletion_return)
+PPP_CB_EXTERN(on_x64_NtQueryKey_return)
+PPP_CB_EXTERN(on_x64_NtQueryLicenseValue_return)
+PPP_CB_EXTERN(on_x64_NtQueryMultipleValueKey_return)
+PPP_CB_EXTERN(on_x64_NtQueryMutant_return)
+PPP_CB_EXTERN(on_x64_NtQueryObject_return)
+PPP_CB_EXTERN(on_x64_NtQueryOpenSubKeys_return)
+PPP_CB_EXTERN(on_x64_NtQueryOpenSubKeysEx_return)
+PPP_CB_EXTERN(on_x64_NtQueryPerformanceCounter_return)
+PPP_CB_EXTERN(on_x64_NtQueryPortInformationProcess_return)
+PPP_CB_EXTERN(on_x64_NtQueryQuotaInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtQuerySection_return)
+PPP_CB_EXTERN(on_x64_NtQuerySecurityAttributesToken_return)
+PPP_CB_EXTERN(on_x64_NtQuerySecurityObject_return)
+PPP_CB_EXTERN(on_x64_NtQuerySemaphore_return)
+PPP_CB_EXTERN(on_x64_NtQuerySymbolicLinkObject_return)
+PPP_CB_EXTERN(on_x64_NtQuerySystemEnvironmentValue_return)
+PPP_CB_EXTERN(on_x64_NtQuerySystemEnvironmentValueEx_return)
+PPP_CB_EXTERN(on_x64_NtQuerySystemInformation_return)
+PPP_CB_EXTERN(on_x64_NtQuerySystemInformationEx_return)
+PPP_CB_EXTERN(on_x64_NtQuerySystemTime_return)
+PPP_CB_EXTERN(on_x64_NtQueryTimer_return)
+PPP_CB_EXTERN(on_x64_NtQueryTimerResolution_return)
+PPP_CB_EXTERN(on_x64_NtQueryValueKey_return)
+PPP_CB_EXTERN(on_x64_NtQueryVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtQueryVolumeInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtQueueApcThread_return)
+PPP_CB_EXTERN(on_x64_NtQueueApcThreadEx_return)
+PPP_CB_EXTERN(on_x64_NtRaiseException_return)
+PPP_CB_EXTERN(on_x64_NtRaiseHardError_return)
+PPP_CB_EXTERN(on_x64_NtReadFile_return)
+PPP_CB_EXTERN(on_x64_NtReadFileScatter_return)
+PPP_CB_EXTERN(on_x64_NtReadOnlyEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtReadRequestData_return)
+PPP_CB_EXTERN(on_x64_NtReadVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtRecoverEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtRecoverResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtRecoverTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtRegisterProtocolAddressInformation_return)
+PPP_CB_EXTERN(on_x64_NtRegisterThreadTerminatePort_return)
+PPP_CB_EXTERN(on_x64_NtReleaseKeyedEvent_return)
+PPP_CB_EXTERN(on_x64_NtReleaseMutant_return)
+PPP_CB_EXTERN(on_x64_NtReleaseSemaphore_return)
+PPP_CB_EXTERN(on_x64_NtReleaseWorkerFactoryWorker_return)
+PPP_CB_EXTERN(on_x64_NtRemoveIoCompletion_return)
+PPP_CB_EXTERN(on_x64_NtRemoveIoCompletionEx_return)
+PPP_CB_EXTERN(on_x64_NtRemoveProcessDebug_return)
+PPP_CB_EXTERN(on_x64_NtRenameKey_return)
+PPP_CB_EXTERN(on_x64_NtRenameTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtReplaceKey_return)
+PPP_CB_EXTERN(on_x64_NtReplacePartitionUnit_return)
+PPP_CB_EXTERN(on_x64_NtReplyPort_return)
+PPP_CB_EXTERN(on_x64_NtReplyWaitReceivePort_return)
+PPP_CB_EXTERN(on_x64_NtReplyWaitReceivePortEx_return)
+PPP_CB_EXTERN(on_x64_NtReplyWaitReplyPort_return)
+PPP_CB_EXTERN(on_x64_NtRequestPort_return)
+PPP_CB_EXTERN(on_x64_NtRequestWaitReplyPort_return)
+PPP_CB_EXTERN(on_x64_NtResetEvent_return)
+PPP_CB_EXTERN(on_x64_NtResetWriteWatch_return)
+PPP_CB_EXTERN(on_x64_NtRestoreKey_return)
+PPP_CB_EXTERN(on_x64_NtResumeProcess_return)
+PPP_CB_EXTERN(on_x64_NtResumeThread_return)
+PPP_CB_EXTERN(on_x64_NtRollbackComplete_return)
+PPP_CB_EXTERN(on_x64_NtRollbackEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtRollbackTransaction_return)
+PPP_CB_EXTERN(on_x64_NtRollforwardTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtSaveKey_return)
+PPP_CB_EXTERN(on_x64_NtSaveKeyEx_return)
+PPP_CB_EXTERN(on_x64_NtSaveMergedKeys_return)
+PPP_CB_EXTERN(on_x64_NtSecureConnectPort_return)
+PPP_CB_EXTERN(on_x64_NtSerializeBoot_return)
+PPP_CB_EXTERN(on_x64_NtSetBootEntryOrder_return)
+PPP_CB_EXTERN(on_x64_NtSetBootOptions_return)
+PPP_CB_EXTERN(on_x64_NtSetContextThread_return)
+PPP_CB_EXTERN(on_x64_NtSetDebugFilterState_return)
+PPP_CB_EXTERN(on_x64_NtSetDefaultHardErrorPort_return)
+PPP_CB_EXTERN(on_x64_NtSetDefaultLocale_return)
+PPP_CB_EXTERN(on_x64_NtSetDefaultUILanguage_return)
+PPP_CB_EXTERN(on_x64_NtSetDriverEntryOrder_return)
+PPP_CB_EXTERN(on_x64_NtSetEaFile_return)
+PPP_CB_EXTERN(on_x64_NtSetEvent_return)
+PPP_CB_EXTERN(on_x64_NtSetEventBoostPriority_return)
+PPP_CB_EXTERN(on_x64_NtSetHighEventPair_return)
+PPP_CB_EXTERN(on_x64_NtSetHighWaitLowEventPair_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationDebugObject_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationEnlistment_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationJobObject_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationKey_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationObject_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationProcess_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationResourceManager_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationThread_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationToken_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationTransaction_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationTransactionManager_return)
+PPP_CB_EXTERN(on_x64_NtSetInformationWorkerFactory_return)
+PPP_CB_EXTERN(on_x64_NtSetIntervalProfile_return)
+PPP_CB_EXTERN(on_x64_NtSetIoCompletion_return)
+PPP_CB_EXTERN(on_x64_NtSetIoCompletionEx_return)
+PPP_CB_EXTERN(on_x64_NtSetLdtEntries_return)
+PPP_CB_EXTERN(on_x64_NtSetLowEventPair_return)
+PPP_CB_EXTERN(on_x64_NtSetLowWaitHighEventPair_return)
+PPP_CB_EXTERN(on_x64_NtSetQuotaInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtSetSecurityObject_return)
+PPP_CB_EXTERN(on_x64_NtSetSystemEnvironmentValue_return)
+PPP_CB_EXTERN(on_x64_NtSetSystemEnvironmentValueEx_return)
+PPP_CB_EXTERN(on_x64_NtSetSystemInformation_return)
+PPP_CB_EXTERN(on_x64_NtSetSystemPowerState_return)
+PPP_CB_EXTERN(on_x64_NtSetSystemTime_return)
+PPP_CB_EXTERN(on_x64_NtSetThreadExecutionState_return)
+PPP_CB_EXTERN(on_x64_NtSetTimer_return)
+PPP_CB_EXTERN(on_x64_NtSetTimerEx_return)
+PPP_CB_EXTERN(on_x64_NtSetTimerResolution_return)
+PPP_CB_EXTERN(on_x64_NtSetUuidSeed_return)
+PPP_CB_EXTERN(on_x64_NtSetValueKey_return)
+PPP_CB_EXTERN(on_x64_NtSetVolumeInformationFile_return)
+PPP_CB_EXTERN(on_x64_NtShutdownSystem_return)
+PPP_CB_EXTERN(on_x64_NtShutdownWorkerFactory_return)
+PPP_CB_EXTERN(on_x64_NtSignalAndWaitForSingleObject_return)
+PPP_CB_EXTERN(on_x64_NtSinglePhaseReject_return)
+PPP_CB_EXTERN(on_x64_NtStartProfile_return)
+PPP_CB_EXTERN(on_x64_NtStopProfile_return)
+PPP_CB_EXTERN(on_x64_NtSuspendProcess_return)
+PPP_CB_EXTERN(on_x64_NtSuspendThread_return)
+PPP_CB_EXTERN(on_x64_NtSystemDebugControl_return)
+PPP_CB_EXTERN(on_x64_NtTerminateJobObject_return)
+PPP_CB_EXTERN(on_x64_NtTerminateProcess_return)
+PPP_CB_EXTERN(on_x64_NtTerminateThread_return)
+PPP_CB_EXTERN(on_x64_NtTestAlert_return)
+PPP_CB_EXTERN(on_x64_NtThawRegistry_return)
+PPP_CB_EXTERN(on_x64_NtThawTransactions_return)
+PPP_CB_EXTERN(on_x64_NtTraceControl_return)
+PPP_CB_EXTERN(on_x64_NtTraceEvent_return)
+PPP_CB_EXTERN(on_x64_NtTranslateFilePath_return)
+PPP_CB_EXTERN(on_x64_NtUmsThreadYield_return)
+PPP_CB_EXTERN(on_x64_NtUnloadDriver_return)
+PPP_CB_EXTERN(on_x64_NtUnloadKey_return)
+PPP_CB_EXTERN(on_x64_NtUnloadKey2_return)
+PPP_CB_EXTERN(on_x64_NtUnloadKeyEx_return)
+PPP_CB_EXTERN(on_x64_NtUnlockFile_return)
+PPP_CB_EXTERN(on_x64_NtUnlockVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtUnmapViewOfSection_return)
+PPP_CB_EXTERN(on_x64_NtVdmControl_return)
+PPP_CB_EXTERN(on_x64_NtWaitForDebugEvent_return)
+PPP_CB_EXTERN(on_x64_NtWaitForKeyedEvent_return)
+PPP_CB_EXTERN(on_x64_NtWaitForMultipleObjects_return)
+PPP_CB_EXTERN(on_x64_NtWaitForMultipleObjects32_return)
+PPP_CB_EXTERN(on_x64_NtWaitForSingleObject_return)
+PPP_CB_EXTERN(on_x64_NtWaitForWorkViaWorkerFactory_return)
+PPP_CB_EXTERN(on_x64_NtWaitHighEventPair_return)
+PPP_CB_EXTERN(on_x64_NtWaitLowEventPair_return)
+PPP_CB_EXTERN(on_x64_NtWorkerFactoryWorkerReady_return)
+PPP_CB_EXTERN(on_x64_NtWriteFile_return)
+PPP_CB_EXTERN(on_x64_NtWriteFileGather_return)
+PPP_CB_EXTERN(on_x64_NtWriteRequestData_return)
+PPP_CB_EXTERN(on_x64_NtWriteVirtualMemory_return)
+PPP_CB_EXTERN(on_x64_NtYieldExecution_return)
+PPP_CB_EXTERN(on_x64_rt_sigaction_return)
+PPP_CB_EXTERN(on_x64_set_thread_area_return)
+PPP_CB_EXTERN(on_x64_sys_accept_return)
+PPP_CB_EXTERN(on_x64_sys_accept4_return)
+PPP_CB_EXTERN(on_x64_sys_access_return)
+PPP_CB_EXTERN(on_x64_sys_acct_return)
+PPP_CB_EXTERN(on_x64_sys_add_key_return)
+PPP_CB_EXTERN(on_x64_sys_adjtimex_return)
+PPP_CB_EXTERN(on_x64_sys_alarm_return)
+PPP_CB_EXTERN(on_x64_sys_arch_prctl_return)
+PPP_CB_EXTERN(on_x64_sys_bind_return)
+PPP_CB_EXTERN(on_x64_sys_bpf_return)
+PPP_CB_EXTERN(on_x64_sys_brk_return)
+PPP_CB_EXTERN(on_x64_sys_capget_return)
+PPP_CB_EXTERN(on_x64_sys_capset_return)
+PPP_CB_EXTERN(on_x64_sys_chdir_return)
+PPP_CB_EXTERN(on_x64_sys_chmod_return)
+PPP_CB_EXTERN(on_x64_sys_chown_return)
+PPP_CB_EXTERN(on_x64_sys_chroot_return)
+PPP_CB_EXTERN(on_x64_sys_clock_adjtime_return)
+PPP_CB_EXTERN(on_x64_sys_clock_getres_return)
+PPP_CB_EXTERN(on_x64_sys_clock_gettime_return)
+PPP_CB_EXTERN(on_x64_sys_clock_nanosleep_return)
+PPP_CB_EXTERN(on_x64_sys_clock_settime_return)
+PPP_CB_EXTERN(on_x64_sys_clone_return)
+PPP_CB_EXTERN(on_x64_sys_close_return)
+PPP_CB_EXTERN(on_x64_sys_connect_return)
+PPP_CB_EXTERN(on_x64_sys_copy_file_range_return)
+PPP_CB_EXTERN(on_x64_sys_creat_return)
+PPP_CB_EXTERN(on_x64_sys_delete_module_return)
+PPP_CB_EXTERN(on_x64_sys_dup_return)
+PPP_CB_EXTERN(on_x64_sys_dup2_return)
+PPP_CB_EXTERN(on_x64_sys_dup3_return)
+PPP_CB_EXTERN(on_x64_sys_epoll_create_return)
+PPP_CB_EXTERN(on_x64_sys_epoll_create1_return)
+PPP_CB_EXTERN(on_x64_sys_epoll_ctl_return)
+PPP_CB_EXTERN(on_x64_sys_epoll_pwait_return)
+PPP_CB_EXTERN(on_x64_sys_epoll_wait_return)
+PPP_CB_EXTERN(on_x64_sys_eventfd_return)
+PPP_CB_EXTERN(on_x64_sys_eventfd2_return)
+PPP_CB_EXTERN(on_x64_sys_execve_return)
+PPP_CB_EXTERN(on_x64_sys_execveat_return)
+PPP_CB_EXTERN(on_x64_sys_exit_return)
+PPP_CB_EXTERN(on_x64_sys_exit_group_return)
+PPP_CB_EXTERN(on_x64_sys_faccessat_return)
+PPP_CB_EXTERN(on_x64_sys_fadvise64_return)
+PPP_CB_EXTERN(on_x64_sys_fallocate_return)
+PPP_CB_EXTERN(on_x64_sys_fanotify_init_return)
+PPP_CB_EXTERN(on_x64_sys_fanotify_mark_return)
+PPP_CB_EXTERN(on_x64_sys_fchdir_return)
+PPP_CB_EXTERN(on_x64_sys_fchmod_return)
+PPP_CB_EXTERN(on_x64_sys_fchmodat_return)
+PPP_CB_EXTERN(on_x64_sys_fchown_return)
+PPP_CB_EXTERN(on_x64_sys_fchownat_return)
+PPP_CB_EXTERN(on_x64_sys_fcntl_return)
+PPP_CB_EXTERN(on_x64_sys_fdatasync_return)
+PPP_CB_EXTERN(on_x64_sys_fgetxattr_return)
+PPP_CB_EXTERN(on_x64_sys_finit_module_return)
+PPP_CB_EXTERN(on_x64_sys_flistxattr_return)
+PPP_CB_EXTERN(on_x64_sys_flock_return)
+PPP_CB_EXTERN(on_x64_sys_fork_return)
+PPP_CB_EXTERN(on_x64_sys_fremovexattr_return)
+PPP_CB_EXTERN(on_x64_sys_fsetxattr_return)
+PPP_CB_EXTERN(on_x64_sys_fstatfs_return)
+PPP_CB_EXTERN(on_x64_sys_fsync_return)
+PPP_CB_EXTERN(on_x64_sys_ftruncate_return)
+PPP_CB_EXTERN(on_x64_sys_futex_return)
+PPP_CB_EXTERN(on_x64_sys_futimesat_return)
+PPP_CB_EXTERN(on_x64_sys_get_mempolicy_return)
+PPP_CB_EXTERN(on_x64_sys_get_robust_list_return)
+PPP_CB_EXTERN(on_x64_sys_getcpu_return)
+PPP_CB_EXTERN(on_x64_sys_getcwd_return)
+PPP_CB_EXTERN(on_x64_sys_getdents_return)
+PPP_CB_EXTERN(on_x64_sys_getdents64_return)
+PPP_CB_EXTERN(on_x64_sys_getegid_return)
+PPP_CB_EXTERN(on_x64_sys_geteuid_return)
+PPP_CB_EXTERN(on_x64_sys_getgid_return)
+PPP_CB_EXTERN(on_x64_sys_getgroups_return)
+PPP_CB_EXTERN(on_x64_sys_getitimer_return)
+PPP_CB_EXTERN(on_x64_sys_getpeername_return)
+PPP_CB_EXTERN(on_x64_sys_getpgid_return)
+PPP_CB_EXTERN(on_x64_sys_getpgrp_return)
+PPP_CB_EXTERN(on_x64_sys_getpid_return)
+PPP_CB_EXTERN(on_x64_sys_getppid_return)
+PPP_CB_EXTERN(on_x64_sys_getpriority_return)
+PPP_CB_EXTERN(on_x64_sys_getrandom_return)
+PPP_CB_EXTERN(on_x64_sys_getresgid_return)
+PPP_CB_EXTERN(on_x64_sys_getresuid_return)
+PPP_CB_EXTERN(on_x64_sys_getrlimit_return)
+PPP_CB_EXTERN(on_x64_sys_getrusage_return)
+PPP_CB_EXTERN(on_x64_sys_getsid_return)
+PPP_CB_EXTERN(on_x64_sys_getsockname_return)
+PPP_CB_EXTERN(on_x64_sys_getsockopt_return)
+PPP_CB_EXTERN(on_x64_sys_gettid_return)
+PPP_CB_EXTERN(on_x64_sys_gettimeofday_return)
+PPP_CB_EXTERN(on_x64_sys_getuid_return)
+PPP_CB_EXTERN(on_x64_sys_getxattr_return)
+PPP_CB_EXTERN(on_x64_sys_init_module_return)
+PPP_CB_EXTERN(on_x64_sys_inotify_add_watch_return)
+PPP_CB_EXTERN(on_x64_sys_inotify_init_return)
+PPP_CB_EXTERN(on_x64_sys_inotify_init1_return)
+PPP_CB_EXTERN(on_x64_sys_inotify_rm_watch_return)
+PPP_CB_EXTERN(on_x64_sys_io_cancel_return)
+PPP_CB_EXTERN(on_x64_sys_io_destroy_return)
+PPP_CB_EXTERN(on_x64_sys_io_getevents_return)
+PPP_CB_EXTERN(on_x64_sys_io_setup_return)
+PPP_CB_EXTERN(on_x64_sys_io_submit_return)
+PPP_CB_EXTERN(on_x64_sys_ioctl_return)
+PPP_CB_EXTERN(on_x64_sys_ioperm_return)
+PPP_CB_EXTERN(on_x64_sys_iopl_return)
+PPP_CB_EXTERN(on_x64_sys_ioprio_get_return)
+PPP_CB_EXTERN(on_x64_sys_ioprio_set_return)
+PPP_CB_EXTERN(on_x64_sys_kcmp_return)
+PPP_CB_EXTERN(on_x64_sys_kexec_file_load_return)
+PPP_CB_EXTERN(on_x64_sys_kexec_load_return)
+PPP_CB_EXTERN(on_x64_sys_keyctl_return)
+PPP_CB_EXTERN(on_x64_sys_kill_return)
+PPP_CB_EXTERN(on_x64_sys_lchown_return)
+PPP_CB_EXTERN(on_x64_sys_lgetxattr_return)
+PPP_CB_EXTERN(on_x64_sys_link_return)
+PPP_CB_EXTERN(on_x64_sys_linkat_return)
+PPP_CB_EXTERN(on_x64_sys_listen_return)
+PPP_CB_EXTERN(on_x64_sys_listxattr_return)
+PPP_CB_EXTERN(on_x64_sys_llistxattr_return)
+PPP_CB_EXTERN(on_x64_sys_lookup_dcookie_return)
+PPP_CB_EXTERN(on_x64_sys_lremovexattr_return)
+PPP_CB_EXTERN(on_x64_sys_lseek_return)
+PPP_CB_EXTERN(on_x64_sys_lsetxattr_return)
+PPP_CB_EXTERN(on_x64_sys_madvise_return)
+PPP_CB_EXTERN(on_x64_sys_mbind_return)
+PPP_CB_EXTERN(on_x64_sys_membarrier_return)
+PPP_CB_EXTERN(on_x64_sys_memfd_create_return)
+PPP_CB_EXTERN(on_x64_sys_migrate_pages_return)
+PPP_CB_EXTERN(on_x64_sys_mincore_return)
+PPP_CB_EXTERN(on_x64_sys_mkdir_return)
+PPP_CB_EXTERN(on_x64_sys_mkdirat_return)
+PPP_CB_EXTERN(on_x64_sys_mknod_return)
+PPP_CB_EXTERN(on_x64_sys_mknodat_return)
+PPP_CB_EXTERN(on_x64_sys_mlock_return)
+PPP_CB_EXTERN(on_x64_sys_mlock2_return)
+PPP_CB_EXTERN(on_x64_sys_mlockall_return)
+PPP_CB_EXTERN(on_x64_sys_mmap_return)
+PPP_CB_EXTERN(on_x64_sys_modify_ldt_return)
+PPP_CB_EXTERN(on_x64_sys_mount_return)
+PPP_CB_EXTERN(on_x64_sys_move_pages_return)
+PPP_CB_EXTERN(on_x64_sys_mprotect_return)
+PPP_CB_EXTERN(on_x64_sys_mq_getsetattr_return)
+PPP_CB_EXTERN(on_x64_sys_mq_notify_return)
+PPP_CB_EXTERN(on_x64_sys_mq_open_return)
+PPP_CB_EXTERN(on_x64_sys_mq_timedreceive_return)
+PPP_CB_EXTERN(on_x64_sys_mq_timedsend_return)
+PPP_CB_EXTERN(on_x64_sys_mq_unlink_return)
+PPP_CB_EXTERN(on_x64_sys_mremap_return)
+PPP_CB_EXTERN(on_x64_sys_msgctl_return)
+PPP_CB_EXTERN(on_x64_sys_msgget_return)
+PPP_CB_EXTERN(on_x64_sys_msgrcv_return)
+PPP_CB_EXTERN(on_x64_sys_msgsnd_return)
+PPP_CB_EXTERN(on_x64_sys_msync_return)
+PPP_CB_EXTERN(on_x64_sys_munlock_return)
+PPP_CB_EXTERN(on_x64_sys_munlockall_return)
+PPP_CB_EXTERN(on_x64_sys_munmap_return)
+PPP_CB_EXTERN(on_x64_sys_name_to_handle_at_return)
+PPP_CB_EXTERN(on_x64_sys_nanosleep_return)
+PPP_CB_EXTERN(on_x64_sys_newfstat_return)
+PPP_CB_EXTERN(on_x64_sys_newfstatat_return)
+PPP_CB_EXTERN(on_x64_sys_newlstat_return)
+PPP_CB_EXTERN(on_x64_sys_newstat_return)
+PPP_CB_EXTERN(on_x64_sys_newuname_return)
+PPP_CB_EXTERN(on_x64_sys_open_return)
+PPP_CB_EXTERN(on_x64_sys_open_by_handle_at_return)
+PPP_CB_EXTERN(on_x64_sys_openat_return)
+PPP_CB_EXTERN(on_x64_sys_pause_return)
+PPP_CB_EXTERN(on_x64_sys_perf_event_open_return)
+PPP_CB_EXTERN(on_x64_sys_personality_return)
+PPP_CB_EXTERN(on_x64_sys_pipe_return)
+PPP_CB_EXTERN(on_x64_sys_pipe2_return)
+PPP_CB_EXTERN(on_x64_sys_pivot_root_return)
+PPP_CB_EXTERN(on_x64_sys_pkey_alloc_return)
+PPP_CB_EXTERN(on_x64_sys_pkey_free_return)
+PPP_CB_EXTERN(on_x64_sys_pkey_mprotect_return)
+PPP_CB_EXTERN(on_x64_sys_poll_return)
+PPP_CB_EXTERN(on_x64_sys_ppoll_return)
+PPP_CB_EXTERN(on_x64_sys_prctl_return)
+PPP_CB_EXTERN(on_x64_sys_pread64_return)
+PPP_CB_EXTERN(on_x64_sys_preadv_return)
+PPP_CB_EXTERN(on_x64_sys_preadv2_return)
+PPP_CB_EXTERN(on_x64_sys_prlimit64_return)
+PPP_CB_EXTERN(on_x64_sys_process_vm_readv_return)
+PPP_CB_EXTERN(on_x64_sys_process_vm_writev_return)
+PPP_CB_EXTERN(on_x64_sys_pselect6_return)
+PPP_CB_EXTERN(on_x64_sys_ptrace_return)
+PPP_CB_EXTERN(on_x64_sys_pwrite64_return)
+PPP_CB_EXTERN(on_x64_sys_pwritev_return)
+PPP_CB_EXTERN(on_x64_sys_pwritev2_return)
+PPP_CB_EXTERN(on_x64_sys_quotactl_return)
+PPP_CB_EXTERN(on_x64_sys_read_return)
+PPP_CB_EXTERN(on_x64_sys_readahead_return)
+PPP_CB_EXTERN(on_x64_sys_readlink_return)
+PPP_CB_EXTERN(on_x64_sys_readlinkat_return)
+PPP_CB_EXTERN(on_x64_sys_readv_return)
+PPP_CB_EXTERN(on_x64_sys_reboot_return)
+PPP_CB_EXTERN(on_x64_sys_recvfrom_return)
+PPP_CB_EXTERN(on_x64_sys_recvmmsg_return)
+PPP_CB_EXTERN(on_x64_sys_recvmsg_return)
+PPP_CB_EXTERN(on_x64_sys_remap_file_pages_return)
+PPP_CB_EXTERN(on_x64_sys_removexattr_return)
+PPP_CB_EXTERN(on_x64_sys_rename_return)
+PPP_CB_EXTERN(on_x64_sys_renameat_return)
+PPP_CB_EXTERN(on_x64_sys_renameat2_return)
+PPP_CB_EXTERN(on_x64_sys_request_key_return)
+PPP_CB_EXTERN(on_x64_sys_restart_syscall_return)
+PPP_CB_EXTERN(on_x64_sys_rmdir_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigpending_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigprocmask_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigqueueinfo_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigreturn_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigsuspend_return)
+PPP_CB_EXTERN(on_x64_sys_rt_sigtimedwait_return)
+PPP_CB_EXTERN(on_x64_sys_rt_tgsigqueueinfo_return)
+PPP_CB_EXTERN(on_x64_sys_sched_get_priority_max_return)
+PPP_CB_EXTERN(on_x64_sys_sched_get_priority_min_return)
+PPP_CB_EXTERN(on_x64_sys_sched_getaffinity_return)
+PPP_CB_EXTERN(on_x64_sys_sched_getattr_return)
+PPP_CB_EXTERN(on_x64_sys_sched_getparam_return)
+PPP_CB_EXTERN(on_x64_sys_sched_getscheduler_return)
+PPP_CB_EXTERN(on_x64_sys_sched_rr_get_interval_return)
+PPP_CB_EXTERN(on_x64_sys_sched_setaffinity_return)
+PPP_CB_EXTERN(on_x64_sys_sched_setattr_return)
+PPP_CB_EXTERN(on_x64_sys_sched_setparam_return)
+PPP_CB_EXTERN(on_x64_sys_sched_setscheduler_return)
+PPP_CB_EXTERN(on_x64_sys_sched_yield_return)
+PPP_CB_EXTERN(on_x64_sys_seccomp_return)
+PPP_CB_EXTERN(on_x64_sys_select_return)
+PPP_CB_EXTERN(on_x64_sys_semctl_return)
+PPP_CB_EXTERN(on_x64_sys_semget_return)
+PPP_CB_EXTERN(on_x64_sys_semop_return)
+PPP_CB_EXTERN(on_x64_sys_semtimedop_return)
+PPP_CB_EXTERN(on_x64_sys_sendfile_return)
+PPP_CB_EXTERN(on_x64_sys_sendmmsg_return)
+PPP_CB_EXTERN(on_x64_sys_sendmsg_return)
+PPP_CB_EXTERN(on_x64_sys_sendto_return)
+PPP_CB_EXTERN(on_x64_sys_set_mempolicy_return)
+PPP_CB_EXTERN(on_x64_sys_set_robust_list_return)
+PPP_CB_EXTERN(on_x64_sys_set_tid_address_return)
+PPP_CB_EXTERN(on_x64_sys_setdomainname_return)
+PPP_CB_EXTERN(on_x64_sys_setfsgid_return)
+PPP_CB_EXTERN(on_x64_sys_setfsuid_return)
+PPP_CB_EXTERN(on_x64_sys_setgid_return)
+PPP_CB_EXTERN(on_x64_sys_setgroups_return)
+PPP_CB_EXTERN(on_x64_sys_sethostname_return)
+PPP_CB_EXTERN(on_x64_sys_setitimer_return)
+PPP_CB_EXTERN(on_x64_sys_setns_return)
+PPP_CB_EXTERN(on_x64_sys_setpgid_return)
+PPP_CB_EXTERN(on_x64_sys_setpriority_return)
+PPP_CB_EXTERN(on_x64_sys_setregid_return)
+PPP_CB_EXTERN(on_x64_sys_setresgid_return)
+PPP_CB_EXTERN(on_x64_sys_setresuid_return)
+PPP_CB_EXTERN(on_x64_sys_setreuid_return)
+PPP_CB_EXTERN(on_x64_sys_setrlimit_return)
+PPP_CB_EXTERN(on_x64_sys_setsid_return)
+PPP_CB_EXTERN(on_x64_sys_setsockopt_return)
+PPP_CB_EXTERN(on_x64_sys_settimeofday_return)
+PPP_CB_EXTERN(on_x64_sys_setuid_return)
+PPP_CB_EXTERN(on_x64_sys_setxattr_return)
+PPP_CB_EXTERN(on_x64_sys_shmat_return)
+PPP_CB_EXTERN(on_x64_sys_shmctl_return)
+PPP_CB_EXTERN(on_x64_sys_shmdt_return)
+PPP_CB_EXTERN(on_x64_sys_shmget_return)
+PPP_CB_EXTERN(on_x64_sys_shutdown_return)
+PPP_CB_EXTERN(on_x64_sys_sigaltstack_return)
+PPP_CB_EXTERN(on_x64_sys_signalfd_return)
+PPP_CB_EXTERN(on_x64_sys_signalfd4_return)
+PPP_CB_EXTERN(on_x64_sys_socket_return)
+PPP_CB_EXTERN(on_x64_sys_socketpair_return)
+PPP_CB_EXTERN(on_x64_sys_splice_return)
+PPP_CB_EXTERN(on_x64_sys_statfs_return)
+PPP_CB_EXTERN(on_x64_sys_swapoff_return)
+PPP_CB_EXTERN(on_x64_sys_swapon_return)
+PPP_CB_EXTERN(on_x64_sys_symlink_return)
+PPP_CB_EXTERN(on_x64_sys_symlinkat_return)
+PPP_CB_EXTERN(on_x64_sys_sync_return)
+PPP_CB_EXTERN(on_x64_sys_sync_file_range_return)
+PPP_CB_EXTERN(on_x64_sys_syncfs_return)
+PPP_CB_EXTERN(on_x64_sys_sysctl_return)
+PPP_CB_EXTERN(on_x64_sys_sysfs_return)
+PPP_CB_EXTERN(on_x64_sys_sysinfo_return)
+PPP_CB_EXTERN(on_x64_sys_syslog_return)
+PPP_CB_EXTERN(on_x64_sys_tee_return)
+PPP_CB_EXTERN(on_x64_sys_tgkill_return)
+PPP_CB_EXTERN(on_x64_sys_time_return)
+PPP_CB_EXTERN(on_x64_sys_timer_create_return)
+PPP_CB_EXTERN(on_x64_sys_timer_delete_return)
+PPP_CB_EXTERN(on_x64_sys_timer_getoverrun_return)
+PPP_CB_EXTERN(on_x64_sys_timer_gettime_return)
+PPP_CB_EXTERN(on_x64_sys_timer_settime_return)
+PPP_CB_EXTERN(on_x64_sys_timerfd_create_return)
+PPP_CB_EXTERN(on_x64_sys_timerfd_gettime_return)
+PPP_CB_EXTERN(on_x64_sys_timerfd_settime_return)
+PPP_CB_EXTERN(on_x64_sys_times_return)
+PPP_CB_EXTERN(on_x64_sys_tkill_return)
+PPP_CB_EXTERN(on_x64_sys_truncate_return)
+PPP_CB_EXTERN(on_x64_sys_umask_return)
+PPP_CB_EXTERN(on_x64_sys_umount_return)
+PPP_CB_EXTERN(on_x64_sys_unlink_return)
+PPP_CB_EXTERN(on_x64_sys_unlinkat_return)
+PPP_CB_EXTERN(on_x64_sys_unshare_return)
+PPP_CB_EXTERN(on_x64_sys_uselib_return)
+PPP_CB_EXTERN(on_x64_sys_userfaultfd_return)
+PPP_CB_EXTERN(on_x64_sys_ustat_return)
+PPP_CB_EXTERN(on_x64_sys_utime_return)
+PPP_CB_EXTERN(on_x64_sys_utimensat_return)
+PPP_CB_EXTERN(on_x64_sys_utimes_return)
+PPP_CB_EXTERN(on_x64_sys_vfork_return)
+PPP_CB_EXTERN(on_x64_sys_vhangup_return)
+PPP_CB_EXTERN(on_x64_sys_vmsplice_return)
+PPP_CB_EXTERN(on_x64_sys_wait4_return)
+PPP_CB_EXTERN(on_x64_sys_waitid_return)
+PPP_CB_EXTERN(on_x64_sys_write_return)
+PPP_CB_EXTERN(on_x64_sys_writev_return)
+#endif
+#if defined(TARGET_I386)
 PPP_CB_EXTERN(on_get_thread_area_return)
 PPP_CB_EXTERN(on_NtAcceptConnectPort_return)
 PPP_CB_EXTERN(on_NtAccessCheck_return)
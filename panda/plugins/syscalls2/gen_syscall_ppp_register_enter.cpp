@@ -1,4 +1,4 @@
-#ifdef TARGET_ARM
+#if defined(TARGET_ARM)
 PPP_PROT_REG_CB(on_ARM_breakpoint_enter)
 PPP_PROT_REG_CB(on_ARM_cacheflush_enter)
 PPP_PROT_REG_CB(on_ARM_cmpxchg_enter)
@@ -318,7 +318,730 @@ PPP_PROT_REG_CB(on_sys_write_enter)
 PPP_PROT_REG_CB(on_sys_writev_enter)
 PPP_PROT_REG_CB(on_vfork_enter)
 #endif
-#ifdef TARGET_I386
+#if defined(TARGET_X86_64)
+PPP_PROT_REG_CB(on_x64_get_thread_area_enter)
+PPP_PROT_REG_CB(on_x64_NtAcceptConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheck_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckAndAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckByType_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckByTypeAndAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckByTypeResultList_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckByTypeResultListAndAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter)
+PPP_PROT_REG_CB(on_x64_NtAddAtom_enter)
+PPP_PROT_REG_CB(on_x64_NtAddBootEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtAddDriverEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtAdjustGroupsToken_enter)
+PPP_PROT_REG_CB(on_x64_NtAdjustPrivilegesToken_enter)
+PPP_PROT_REG_CB(on_x64_NtAlertResumeThread_enter)
+PPP_PROT_REG_CB(on_x64_NtAlertThread_enter)
+PPP_PROT_REG_CB(on_x64_NtAllocateLocallyUniqueId_enter)
+PPP_PROT_REG_CB(on_x64_NtAllocateReserveObject_enter)
+PPP_PROT_REG_CB(on_x64_NtAllocateUserPhysicalPages_enter)
+PPP_PROT_REG_CB(on_x64_NtAllocateUuids_enter)
+PPP_PROT_REG_CB(on_x64_NtAllocateVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcAcceptConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCancelMessage_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCreatePort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCreatePortSection_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCreateResourceReserve_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCreateSectionView_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcCreateSecurityContext_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcDeletePortSection_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcDeleteResourceReserve_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcDeleteSectionView_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcDeleteSecurityContext_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcDisconnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcImpersonateClientOfPort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcOpenSenderProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcOpenSenderThread_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcQueryInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcQueryInformationMessage_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcRevokeSecurityContext_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcSendWaitReceivePort_enter)
+PPP_PROT_REG_CB(on_x64_NtAlpcSetInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtApphelpCacheControl_enter)
+PPP_PROT_REG_CB(on_x64_NtAreMappedFilesTheSame_enter)
+PPP_PROT_REG_CB(on_x64_NtAssignProcessToJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtCallbackReturn_enter)
+PPP_PROT_REG_CB(on_x64_NtCancelIoFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCancelIoFileEx_enter)
+PPP_PROT_REG_CB(on_x64_NtCancelSynchronousIoFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCancelTimer_enter)
+PPP_PROT_REG_CB(on_x64_NtClearEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtClose_enter)
+PPP_PROT_REG_CB(on_x64_NtCloseObjectAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtCommitComplete_enter)
+PPP_PROT_REG_CB(on_x64_NtCommitEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtCommitTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtCompactKeys_enter)
+PPP_PROT_REG_CB(on_x64_NtCompareTokens_enter)
+PPP_PROT_REG_CB(on_x64_NtCompleteConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtCompressKey_enter)
+PPP_PROT_REG_CB(on_x64_NtConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtContinue_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateDebugObject_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateDirectoryObject_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateIoCompletion_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateJobSet_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateKey_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateKeyedEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateKeyTransacted_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateMailslotFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateMutant_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateNamedPipeFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCreatePagingFile_enter)
+PPP_PROT_REG_CB(on_x64_NtCreatePort_enter)
+PPP_PROT_REG_CB(on_x64_NtCreatePrivateNamespace_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateProcessEx_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateProfile_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateProfileEx_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateSection_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateSemaphore_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateSymbolicLinkObject_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateThread_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateThreadEx_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateTimer_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateToken_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateUserProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateWaitablePort_enter)
+PPP_PROT_REG_CB(on_x64_NtCreateWorkerFactory_enter)
+PPP_PROT_REG_CB(on_x64_NtDebugActiveProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtDebugContinue_enter)
+PPP_PROT_REG_CB(on_x64_NtDelayExecution_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteAtom_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteBootEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteDriverEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteFile_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteKey_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteObjectAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtDeletePrivateNamespace_enter)
+PPP_PROT_REG_CB(on_x64_NtDeleteValueKey_enter)
+PPP_PROT_REG_CB(on_x64_NtDeviceIoControlFile_enter)
+PPP_PROT_REG_CB(on_x64_NtDisableLastKnownGood_enter)
+PPP_PROT_REG_CB(on_x64_NtDisplayString_enter)
+PPP_PROT_REG_CB(on_x64_NtDrawText_enter)
+PPP_PROT_REG_CB(on_x64_NtDuplicateObject_enter)
+PPP_PROT_REG_CB(on_x64_NtDuplicateToken_enter)
+PPP_PROT_REG_CB(on_x64_NtEnableLastKnownGood_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateBootEntries_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateDriverEntries_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateKey_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateSystemEnvironmentValuesEx_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateTransactionObject_enter)
+PPP_PROT_REG_CB(on_x64_NtEnumerateValueKey_enter)
+PPP_PROT_REG_CB(on_x64_NtExtendSection_enter)
+PPP_PROT_REG_CB(on_x64_NtFilterToken_enter)
+PPP_PROT_REG_CB(on_x64_NtFindAtom_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushBuffersFile_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushInstallUILanguage_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushInstructionCache_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushKey_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushProcessWriteBuffers_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtFlushWriteBuffer_enter)
+PPP_PROT_REG_CB(on_x64_NtFreeUserPhysicalPages_enter)
+PPP_PROT_REG_CB(on_x64_NtFreeVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtFreezeRegistry_enter)
+PPP_PROT_REG_CB(on_x64_NtFreezeTransactions_enter)
+PPP_PROT_REG_CB(on_x64_NtFsControlFile_enter)
+PPP_PROT_REG_CB(on_x64_NtGetContextThread_enter)
+PPP_PROT_REG_CB(on_x64_NtGetCurrentProcessorNumber_enter)
+PPP_PROT_REG_CB(on_x64_NtGetDevicePowerState_enter)
+PPP_PROT_REG_CB(on_x64_NtGetMUIRegistryInfo_enter)
+PPP_PROT_REG_CB(on_x64_NtGetNextProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtGetNextThread_enter)
+PPP_PROT_REG_CB(on_x64_NtGetNlsSectionPtr_enter)
+PPP_PROT_REG_CB(on_x64_NtGetNotificationResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtGetPlugPlayEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtGetWriteWatch_enter)
+PPP_PROT_REG_CB(on_x64_NtImpersonateAnonymousToken_enter)
+PPP_PROT_REG_CB(on_x64_NtImpersonateClientOfPort_enter)
+PPP_PROT_REG_CB(on_x64_NtImpersonateThread_enter)
+PPP_PROT_REG_CB(on_x64_NtInitializeNlsFiles_enter)
+PPP_PROT_REG_CB(on_x64_NtInitializeRegistry_enter)
+PPP_PROT_REG_CB(on_x64_NtInitiatePowerAction_enter)
+PPP_PROT_REG_CB(on_x64_NtIsProcessInJob_enter)
+PPP_PROT_REG_CB(on_x64_NtIsSystemResumeAutomatic_enter)
+PPP_PROT_REG_CB(on_x64_NtIsUILanguageComitted_enter)
+PPP_PROT_REG_CB(on_x64_NtListenPort_enter)
+PPP_PROT_REG_CB(on_x64_NtLoadDriver_enter)
+PPP_PROT_REG_CB(on_x64_NtLoadKey_enter)
+PPP_PROT_REG_CB(on_x64_NtLoadKey2_enter)
+PPP_PROT_REG_CB(on_x64_NtLoadKeyEx_enter)
+PPP_PROT_REG_CB(on_x64_NtLockFile_enter)
+PPP_PROT_REG_CB(on_x64_NtLockProductActivationKeys_enter)
+PPP_PROT_REG_CB(on_x64_NtLockRegistryKey_enter)
+PPP_PROT_REG_CB(on_x64_NtLockVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtMakePermanentObject_enter)
+PPP_PROT_REG_CB(on_x64_NtMakeTemporaryObject_enter)
+PPP_PROT_REG_CB(on_x64_NtMapCMFModule_enter)
+PPP_PROT_REG_CB(on_x64_NtMapUserPhysicalPages_enter)
+PPP_PROT_REG_CB(on_x64_NtMapUserPhysicalPagesScatter_enter)
+PPP_PROT_REG_CB(on_x64_NtMapViewOfSection_enter)
+PPP_PROT_REG_CB(on_x64_NtModifyBootEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtModifyDriverEntry_enter)
+PPP_PROT_REG_CB(on_x64_NtNotifyChangeDirectoryFile_enter)
+PPP_PROT_REG_CB(on_x64_NtNotifyChangeKey_enter)
+PPP_PROT_REG_CB(on_x64_NtNotifyChangeMultipleKeys_enter)
+PPP_PROT_REG_CB(on_x64_NtNotifyChangeSession_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenDirectoryObject_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenFile_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenIoCompletion_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenKey_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenKeyedEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenKeyEx_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenKeyTransacted_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenKeyTransactedEx_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenMutant_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenObjectAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenPrivateNamespace_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenProcessToken_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenProcessTokenEx_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenSection_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenSemaphore_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenSession_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenSymbolicLinkObject_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenThread_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenThreadToken_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenThreadTokenEx_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenTimer_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtOpenTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtPlugPlayControl_enter)
+PPP_PROT_REG_CB(on_x64_NtPowerInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtPrepareComplete_enter)
+PPP_PROT_REG_CB(on_x64_NtPrepareEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtPrePrepareComplete_enter)
+PPP_PROT_REG_CB(on_x64_NtPrePrepareEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtPrivilegeCheck_enter)
+PPP_PROT_REG_CB(on_x64_NtPrivilegedServiceAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtPrivilegeObjectAuditAlarm_enter)
+PPP_PROT_REG_CB(on_x64_NtPropagationComplete_enter)
+PPP_PROT_REG_CB(on_x64_NtPropagationFailed_enter)
+PPP_PROT_REG_CB(on_x64_NtProtectVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtPulseEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryAttributesFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryBootEntryOrder_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryBootOptions_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDebugFilterState_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDefaultLocale_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDefaultUILanguage_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDirectoryFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDirectoryObject_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryDriverEntryOrder_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryEaFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryFullAttributesFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationAtom_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationPort_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationThread_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationToken_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInformationWorkerFactory_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryInstallUILanguage_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryIntervalProfile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryIoCompletion_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryKey_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryLicenseValue_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryMultipleValueKey_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryMutant_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryObject_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryOpenSubKeys_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryOpenSubKeysEx_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryPerformanceCounter_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryPortInformationProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryQuotaInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySection_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySecurityAttributesToken_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySecurityObject_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySemaphore_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySymbolicLinkObject_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySystemEnvironmentValue_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySystemEnvironmentValueEx_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySystemInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySystemInformationEx_enter)
+PPP_PROT_REG_CB(on_x64_NtQuerySystemTime_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryTimer_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryTimerResolution_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryValueKey_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtQueryVolumeInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtQueueApcThread_enter)
+PPP_PROT_REG_CB(on_x64_NtQueueApcThreadEx_enter)
+PPP_PROT_REG_CB(on_x64_NtRaiseException_enter)
+PPP_PROT_REG_CB(on_x64_NtRaiseHardError_enter)
+PPP_PROT_REG_CB(on_x64_NtReadFile_enter)
+PPP_PROT_REG_CB(on_x64_NtReadFileScatter_enter)
+PPP_PROT_REG_CB(on_x64_NtReadOnlyEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtReadRequestData_enter)
+PPP_PROT_REG_CB(on_x64_NtReadVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtRecoverEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtRecoverResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtRecoverTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtRegisterProtocolAddressInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtRegisterThreadTerminatePort_enter)
+PPP_PROT_REG_CB(on_x64_NtReleaseKeyedEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtReleaseMutant_enter)
+PPP_PROT_REG_CB(on_x64_NtReleaseSemaphore_enter)
+PPP_PROT_REG_CB(on_x64_NtReleaseWorkerFactoryWorker_enter)
+PPP_PROT_REG_CB(on_x64_NtRemoveIoCompletion_enter)
+PPP_PROT_REG_CB(on_x64_NtRemoveIoCompletionEx_enter)
+PPP_PROT_REG_CB(on_x64_NtRemoveProcessDebug_enter)
+PPP_PROT_REG_CB(on_x64_NtRenameKey_enter)
+PPP_PROT_REG_CB(on_x64_NtRenameTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtReplaceKey_enter)
+PPP_PROT_REG_CB(on_x64_NtReplacePartitionUnit_enter)
+PPP_PROT_REG_CB(on_x64_NtReplyPort_enter)
+PPP_PROT_REG_CB(on_x64_NtReplyWaitReceivePort_enter)
+PPP_PROT_REG_CB(on_x64_NtReplyWaitReceivePortEx_enter)
+PPP_PROT_REG_CB(on_x64_NtReplyWaitReplyPort_enter)
+PPP_PROT_REG_CB(on_x64_NtRequestPort_enter)
+PPP_PROT_REG_CB(on_x64_NtRequestWaitReplyPort_enter)
+PPP_PROT_REG_CB(on_x64_NtResetEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtResetWriteWatch_enter)
+PPP_PROT_REG_CB(on_x64_NtRestoreKey_enter)
+PPP_PROT_REG_CB(on_x64_NtResumeProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtResumeThread_enter)
+PPP_PROT_REG_CB(on_x64_NtRollbackComplete_enter)
+PPP_PROT_REG_CB(on_x64_NtRollbackEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtRollbackTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtRollforwardTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtSaveKey_enter)
+PPP_PROT_REG_CB(on_x64_NtSaveKeyEx_enter)
+PPP_PROT_REG_CB(on_x64_NtSaveMergedKeys_enter)
+PPP_PROT_REG_CB(on_x64_NtSecureConnectPort_enter)
+PPP_PROT_REG_CB(on_x64_NtSerializeBoot_enter)
+PPP_PROT_REG_CB(on_x64_NtSetBootEntryOrder_enter)
+PPP_PROT_REG_CB(on_x64_NtSetBootOptions_enter)
+PPP_PROT_REG_CB(on_x64_NtSetContextThread_enter)
+PPP_PROT_REG_CB(on_x64_NtSetDebugFilterState_enter)
+PPP_PROT_REG_CB(on_x64_NtSetDefaultHardErrorPort_enter)
+PPP_PROT_REG_CB(on_x64_NtSetDefaultLocale_enter)
+PPP_PROT_REG_CB(on_x64_NtSetDefaultUILanguage_enter)
+PPP_PROT_REG_CB(on_x64_NtSetDriverEntryOrder_enter)
+PPP_PROT_REG_CB(on_x64_NtSetEaFile_enter)
+PPP_PROT_REG_CB(on_x64_NtSetEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtSetEventBoostPriority_enter)
+PPP_PROT_REG_CB(on_x64_NtSetHighEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtSetHighWaitLowEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationDebugObject_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationEnlistment_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationKey_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationObject_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationResourceManager_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationThread_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationToken_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationTransaction_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationTransactionManager_enter)
+PPP_PROT_REG_CB(on_x64_NtSetInformationWorkerFactory_enter)
+PPP_PROT_REG_CB(on_x64_NtSetIntervalProfile_enter)
+PPP_PROT_REG_CB(on_x64_NtSetIoCompletion_enter)
+PPP_PROT_REG_CB(on_x64_NtSetIoCompletionEx_enter)
+PPP_PROT_REG_CB(on_x64_NtSetLdtEntries_enter)
+PPP_PROT_REG_CB(on_x64_NtSetLowEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtSetLowWaitHighEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtSetQuotaInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSecurityObject_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSystemEnvironmentValue_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSystemEnvironmentValueEx_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSystemInformation_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSystemPowerState_enter)
+PPP_PROT_REG_CB(on_x64_NtSetSystemTime_enter)
+PPP_PROT_REG_CB(on_x64_NtSetThreadExecutionState_enter)
+PPP_PROT_REG_CB(on_x64_NtSetTimer_enter)
+PPP_PROT_REG_CB(on_x64_NtSetTimerEx_enter)
+PPP_PROT_REG_CB(on_x64_NtSetTimerResolution_enter)
+PPP_PROT_REG_CB(on_x64_NtSetUuidSeed_enter)
+PPP_PROT_REG_CB(on_x64_NtSetValueKey_enter)
+PPP_PROT_REG_CB(on_x64_NtSetVolumeInformationFile_enter)
+PPP_PROT_REG_CB(on_x64_NtShutdownSystem_enter)
+PPP_PROT_REG_CB(on_x64_NtShutdownWorkerFactory_enter)
+PPP_PROT_REG_CB(on_x64_NtSignalAndWaitForSingleObject_enter)
+PPP_PROT_REG_CB(on_x64_NtSinglePhaseReject_enter)
+PPP_PROT_REG_CB(on_x64_NtStartProfile_enter)
+PPP_PROT_REG_CB(on_x64_NtStopProfile_enter)
+PPP_PROT_REG_CB(on_x64_NtSuspendProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtSuspendThread_enter)
+PPP_PROT_REG_CB(on_x64_NtSystemDebugControl_enter)
+PPP_PROT_REG_CB(on_x64_NtTerminateJobObject_enter)
+PPP_PROT_REG_CB(on_x64_NtTerminateProcess_enter)
+PPP_PROT_REG_CB(on_x64_NtTerminateThread_enter)
+PPP_PROT_REG_CB(on_x64_NtTestAlert_enter)
+PPP_PROT_REG_CB(on_x64_NtThawRegistry_enter)
+PPP_PROT_REG_CB(on_x64_NtThawTransactions_enter)
+PPP_PROT_REG_CB(on_x64_NtTraceControl_enter)
+PPP_PROT_REG_CB(on_x64_NtTraceEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtTranslateFilePath_enter)
+PPP_PROT_REG_CB(on_x64_NtUmsThreadYield_enter)
+PPP_PROT_REG_CB(on_x64_NtUnloadDriver_enter)
+PPP_PROT_REG_CB(on_x64_NtUnloadKey_enter)
+PPP_PROT_REG_CB(on_x64_NtUnloadKey2_enter)
+PPP_PROT_REG_CB(on_x64_NtUnloadKeyEx_enter)
+PPP_PROT_REG_CB(on_x64_NtUnlockFile_enter)
+PPP_PROT_REG_CB(on_x64_NtUnlockVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtUnmapViewOfSection_enter)
+PPP_PROT_REG_CB(on_x64_NtVdmControl_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForDebugEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForKeyedEvent_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForMultipleObjects_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForMultipleObjects32_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForSingleObject_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitForWorkViaWorkerFactory_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitHighEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtWaitLowEventPair_enter)
+PPP_PROT_REG_CB(on_x64_NtWorkerFactoryWorkerReady_enter)
+PPP_PROT_REG_CB(on_x64_NtWriteFile_enter)
+PPP_PROT_REG_CB(on_x64_NtWriteFileGather_enter)
+PPP_PROT_REG_CB(on_x64_NtWriteRequestData_enter)
+PPP_PROT_REG_CB(on_x64_NtWriteVirtualMemory_enter)
+PPP_PROT_REG_CB(on_x64_NtYieldExecution_enter)
+PPP_PROT_REG_CB(on_x64_rt_sigaction_enter)
+PPP_PROT_REG_CB(on_x64_set_thread_area_enter)
+PPP_PROT_REG_CB(on_x64_sys_accept_enter)
+PPP_PROT_REG_CB(on_x64_sys_accept4_enter)
+PPP_PROT_REG_CB(on_x64_sys_access_enter)
+PPP_PROT_REG_CB(on_x64_sys_acct_enter)
+PPP_PROT_REG_CB(on_x64_sys_add_key_enter)
+PPP_PROT_REG_CB(on_x64_sys_adjtimex_enter)
+PPP_PROT_REG_CB(on_x64_sys_alarm_enter)
+PPP_PROT_REG_CB(on_x64_sys_arch_prctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_bind_enter)
+PPP_PROT_REG_CB(on_x64_sys_bpf_enter)
+PPP_PROT_REG_CB(on_x64_sys_brk_enter)
+PPP_PROT_REG_CB(on_x64_sys_capget_enter)
+PPP_PROT_REG_CB(on_x64_sys_capset_enter)
+PPP_PROT_REG_CB(on_x64_sys_chdir_enter)
+PPP_PROT_REG_CB(on_x64_sys_chmod_enter)
+PPP_PROT_REG_CB(on_x64_sys_chown_enter)
+PPP_PROT_REG_CB(on_x64_sys_chroot_enter)
+PPP_PROT_REG_CB(on_x64_sys_clock_adjtime_enter)
+PPP_PROT_REG_CB(on_x64_sys_clock_getres_enter)
+PPP_PROT_REG_CB(on_x64_sys_clock_gettime_enter)
+PPP_PROT_REG_CB(on_x64_sys_clock_nanosleep_enter)
+PPP_PROT_REG_CB(on_x64_sys_clock_settime_enter)
+PPP_PROT_REG_CB(on_x64_sys_clone_enter)
+PPP_PROT_REG_CB(on_x64_sys_close_enter)
+PPP_PROT_REG_CB(on_x64_sys_connect_enter)
+PPP_PROT_REG_CB(on_x64_sys_copy_file_range_enter)
+PPP_PROT_REG_CB(on_x64_sys_creat_enter)
+PPP_PROT_REG_CB(on_x64_sys_delete_module_enter)
+PPP_PROT_REG_CB(on_x64_sys_dup_enter)
+PPP_PROT_REG_CB(on_x64_sys_dup2_enter)
+PPP_PROT_REG_CB(on_x64_sys_dup3_enter)
+PPP_PROT_REG_CB(on_x64_sys_epoll_create_enter)
+PPP_PROT_REG_CB(on_x64_sys_epoll_create1_enter)
+PPP_PROT_REG_CB(on_x64_sys_epoll_ctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_epoll_pwait_enter)
+PPP_PROT_REG_CB(on_x64_sys_epoll_wait_enter)
+PPP_PROT_REG_CB(on_x64_sys_eventfd_enter)
+PPP_PROT_REG_CB(on_x64_sys_eventfd2_enter)
+PPP_PROT_REG_CB(on_x64_sys_execve_enter)
+PPP_PROT_REG_CB(on_x64_sys_execveat_enter)
+PPP_PROT_REG_CB(on_x64_sys_exit_enter)
+PPP_PROT_REG_CB(on_x64_sys_exit_group_enter)
+PPP_PROT_REG_CB(on_x64_sys_faccessat_enter)
+PPP_PROT_REG_CB(on_x64_sys_fadvise64_enter)
+PPP_PROT_REG_CB(on_x64_sys_fallocate_enter)
+PPP_PROT_REG_CB(on_x64_sys_fanotify_init_enter)
+PPP_PROT_REG_CB(on_x64_sys_fanotify_mark_enter)
+PPP_PROT_REG_CB(on_x64_sys_fchdir_enter)
+PPP_PROT_REG_CB(on_x64_sys_fchmod_enter)
+PPP_PROT_REG_CB(on_x64_sys_fchmodat_enter)
+PPP_PROT_REG_CB(on_x64_sys_fchown_enter)
+PPP_PROT_REG_CB(on_x64_sys_fchownat_enter)
+PPP_PROT_REG_CB(on_x64_sys_fcntl_enter)
+PPP_PROT_REG_CB(on_x64_sys_fdatasync_enter)
+PPP_PROT_REG_CB(on_x64_sys_fgetxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_finit_module_enter)
+PPP_PROT_REG_CB(on_x64_sys_flistxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_flock_enter)
+PPP_PROT_REG_CB(on_x64_sys_fork_enter)
+PPP_PROT_REG_CB(on_x64_sys_fremovexattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_fsetxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_fstatfs_enter)
+PPP_PROT_REG_CB(on_x64_sys_fsync_enter)
+PPP_PROT_REG_CB(on_x64_sys_ftruncate_enter)
+PPP_PROT_REG_CB(on_x64_sys_futex_enter)
+PPP_PROT_REG_CB(on_x64_sys_futimesat_enter)
+PPP_PROT_REG_CB(on_x64_sys_get_mempolicy_enter)
+PPP_PROT_REG_CB(on_x64_sys_get_robust_list_enter)
+PPP_PROT_REG_CB(on_x64_sys_getcpu_enter)
+PPP_PROT_REG_CB(on_x64_sys_getcwd_enter)
+PPP_PROT_REG_CB(on_x64_sys_getdents_enter)
+PPP_PROT_REG_CB(on_x64_sys_getdents64_enter)
+PPP_PROT_REG_CB(on_x64_sys_getegid_enter)
+PPP_PROT_REG_CB(on_x64_sys_geteuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getgroups_enter)
+PPP_PROT_REG_CB(on_x64_sys_getitimer_enter)
+PPP_PROT_REG_CB(on_x64_sys_getpeername_enter)
+PPP_PROT_REG_CB(on_x64_sys_getpgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getpgrp_enter)
+PPP_PROT_REG_CB(on_x64_sys_getpid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getppid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getpriority_enter)
+PPP_PROT_REG_CB(on_x64_sys_getrandom_enter)
+PPP_PROT_REG_CB(on_x64_sys_getresgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getresuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getrlimit_enter)
+PPP_PROT_REG_CB(on_x64_sys_getrusage_enter)
+PPP_PROT_REG_CB(on_x64_sys_getsid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getsockname_enter)
+PPP_PROT_REG_CB(on_x64_sys_getsockopt_enter)
+PPP_PROT_REG_CB(on_x64_sys_gettid_enter)
+PPP_PROT_REG_CB(on_x64_sys_gettimeofday_enter)
+PPP_PROT_REG_CB(on_x64_sys_getuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_getxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_init_module_enter)
+PPP_PROT_REG_CB(on_x64_sys_inotify_add_watch_enter)
+PPP_PROT_REG_CB(on_x64_sys_inotify_init_enter)
+PPP_PROT_REG_CB(on_x64_sys_inotify_init1_enter)
+PPP_PROT_REG_CB(on_x64_sys_inotify_rm_watch_enter)
+PPP_PROT_REG_CB(on_x64_sys_io_cancel_enter)
+PPP_PROT_REG_CB(on_x64_sys_io_destroy_enter)
+PPP_PROT_REG_CB(on_x64_sys_io_getevents_enter)
+PPP_PROT_REG_CB(on_x64_sys_io_setup_enter)
+PPP_PROT_REG_CB(on_x64_sys_io_submit_enter)
+PPP_PROT_REG_CB(on_x64_sys_ioctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_ioperm_enter)
+PPP_PROT_REG_CB(on_x64_sys_iopl_enter)
+PPP_PROT_REG_CB(on_x64_sys_ioprio_get_enter)
+PPP_PROT_REG_CB(on_x64_sys_ioprio_set_enter)
+PPP_PROT_REG_CB(on_x64_sys_kcmp_enter)
+PPP_PROT_REG_CB(on_x64_sys_kexec_file_load_enter)
+PPP_PROT_REG_CB(on_x64_sys_kexec_load_enter)
+PPP_PROT_REG_CB(on_x64_sys_keyctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_kill_enter)
+PPP_PROT_REG_CB(on_x64_sys_lchown_enter)
+PPP_PROT_REG_CB(on_x64_sys_lgetxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_link_enter)
+PPP_PROT_REG_CB(on_x64_sys_linkat_enter)
+PPP_PROT_REG_CB(on_x64_sys_listen_enter)
+PPP_PROT_REG_CB(on_x64_sys_listxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_llistxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_lookup_dcookie_enter)
+PPP_PROT_REG_CB(on_x64_sys_lremovexattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_lseek_enter)
+PPP_PROT_REG_CB(on_x64_sys_lsetxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_madvise_enter)
+PPP_PROT_REG_CB(on_x64_sys_mbind_enter)
+PPP_PROT_REG_CB(on_x64_sys_membarrier_enter)
+PPP_PROT_REG_CB(on_x64_sys_memfd_create_enter)
+PPP_PROT_REG_CB(on_x64_sys_migrate_pages_enter)
+PPP_PROT_REG_CB(on_x64_sys_mincore_enter)
+PPP_PROT_REG_CB(on_x64_sys_mkdir_enter)
+PPP_PROT_REG_CB(on_x64_sys_mkdirat_enter)
+PPP_PROT_REG_CB(on_x64_sys_mknod_enter)
+PPP_PROT_REG_CB(on_x64_sys_mknodat_enter)
+PPP_PROT_REG_CB(on_x64_sys_mlock_enter)
+PPP_PROT_REG_CB(on_x64_sys_mlock2_enter)
+PPP_PROT_REG_CB(on_x64_sys_mlockall_enter)
+PPP_PROT_REG_CB(on_x64_sys_mmap_enter)
+PPP_PROT_REG_CB(on_x64_sys_modify_ldt_enter)
+PPP_PROT_REG_CB(on_x64_sys_mount_enter)
+PPP_PROT_REG_CB(on_x64_sys_move_pages_enter)
+PPP_PROT_REG_CB(on_x64_sys_mprotect_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_getsetattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_notify_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_open_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_timedreceive_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_timedsend_enter)
+PPP_PROT_REG_CB(on_x64_sys_mq_unlink_enter)
+PPP_PROT_REG_CB(on_x64_sys_mremap_enter)
+PPP_PROT_REG_CB(on_x64_sys_msgctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_msgget_enter)
+PPP_PROT_REG_CB(on_x64_sys_msgrcv_enter)
+PPP_PROT_REG_CB(on_x64_sys_msgsnd_enter)
+PPP_PROT_REG_CB(on_x64_sys_msync_enter)
+PPP_PROT_REG_CB(on_x64_sys_munlock_enter)
+PPP_PROT_REG_CB(on_x64_sys_munlockall_enter)
+PPP_PROT_REG_CB(on_x64_sys_munmap_enter)
+PPP_PROT_REG_CB(on_x64_sys_name_to_handle_at_enter)
+PPP_PROT_REG_CB(on_x64_sys_nanosleep_enter)
+PPP_PROT_REG_CB(on_x64_sys_newfstat_enter)
+PPP_PROT_REG_CB(on_x64_sys_newfstatat_enter)
+PPP_PROT_REG_CB(on_x64_sys_newlstat_enter)
+PPP_PROT_REG_CB(on_x64_sys_newstat_enter)
+PPP_PROT_REG_CB(on_x64_sys_newuname_enter)
+PPP_PROT_REG_CB(on_x64_sys_open_enter)
+PPP_PROT_REG_CB(on_x64_sys_open_by_handle_at_enter)
+PPP_PROT_REG_CB(on_x64_sys_openat_enter)
+PPP_PROT_REG_CB(on_x64_sys_pause_enter)
+PPP_PROT_REG_CB(on_x64_sys_perf_event_open_enter)
+PPP_PROT_REG_CB(on_x64_sys_personality_enter)
+PPP_PROT_REG_CB(on_x64_sys_pipe_enter)
+PPP_PROT_REG_CB(on_x64_sys_pipe2_enter)
+PPP_PROT_REG_CB(on_x64_sys_pivot_root_enter)
+PPP_PROT_REG_CB(on_x64_sys_pkey_alloc_enter)
+PPP_PROT_REG_CB(on_x64_sys_pkey_free_enter)
+PPP_PROT_REG_CB(on_x64_sys_pkey_mprotect_enter)
+PPP_PROT_REG_CB(on_x64_sys_poll_enter)
+PPP_PROT_REG_CB(on_x64_sys_ppoll_enter)
+PPP_PROT_REG_CB(on_x64_sys_prctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_pread64_enter)
+PPP_PROT_REG_CB(on_x64_sys_preadv_enter)
+PPP_PROT_REG_CB(on_x64_sys_preadv2_enter)
+PPP_PROT_REG_CB(on_x64_sys_prlimit64_enter)
+PPP_PROT_REG_CB(on_x64_sys_process_vm_readv_enter)
+PPP_PROT_REG_CB(on_x64_sys_process_vm_writev_enter)
+PPP_PROT_REG_CB(on_x64_sys_pselect6_enter)
+PPP_PROT_REG_CB(on_x64_sys_ptrace_enter)
+PPP_PROT_REG_CB(on_x64_sys_pwrite64_enter)
+PPP_PROT_REG_CB(on_x64_sys_pwritev_enter)
+PPP_PROT_REG_CB(on_x64_sys_pwritev2_enter)
+PPP_PROT_REG_CB(on_x64_sys_quotactl_enter)
+PPP_PROT_REG_CB(on_x64_sys_read_enter)
+PPP_PROT_REG_CB(on_x64_sys_readahead_enter)
+PPP_PROT_REG_CB(on_x64_sys_readlink_enter)
+PPP_PROT_REG_CB(on_x64_sys_readlinkat_enter)
+PPP_PROT_REG_CB(on_x64_sys_readv_enter)
+PPP_PROT_REG_CB(on_x64_sys_reboot_enter)
+PPP_PROT_REG_CB(on_x64_sys_recvfrom_enter)
+PPP_PROT_REG_CB(on_x64_sys_recvmmsg_enter)
+PPP_PROT_REG_CB(on_x64_sys_recvmsg_enter)
+PPP_PROT_REG_CB(on_x64_sys_remap_file_pages_enter)
+PPP_PROT_REG_CB(on_x64_sys_removexattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_rename_enter)
+PPP_PROT_REG_CB(on_x64_sys_renameat_enter)
+PPP_PROT_REG_CB(on_x64_sys_renameat2_enter)
+PPP_PROT_REG_CB(on_x64_sys_request_key_enter)
+PPP_PROT_REG_CB(on_x64_sys_restart_syscall_enter)
+PPP_PROT_REG_CB(on_x64_sys_rmdir_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigpending_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigprocmask_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigqueueinfo_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigreturn_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigsuspend_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_sigtimedwait_enter)
+PPP_PROT_REG_CB(on_x64_sys_rt_tgsigqueueinfo_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_get_priority_max_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_get_priority_min_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_getaffinity_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_getattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_getparam_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_getscheduler_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_rr_get_interval_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_setaffinity_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_setattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_setparam_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_setscheduler_enter)
+PPP_PROT_REG_CB(on_x64_sys_sched_yield_enter)
+PPP_PROT_REG_CB(on_x64_sys_seccomp_enter)
+PPP_PROT_REG_CB(on_x64_sys_select_enter)
+PPP_PROT_REG_CB(on_x64_sys_semctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_semget_enter)
+PPP_PROT_REG_CB(on_x64_sys_semop_enter)
+PPP_PROT_REG_CB(on_x64_sys_semtimedop_enter)
+PPP_PROT_REG_CB(on_x64_sys_sendfile_enter)
+PPP_PROT_REG_CB(on_x64_sys_sendmmsg_enter)
+PPP_PROT_REG_CB(on_x64_sys_sendmsg_enter)
+PPP_PROT_REG_CB(on_x64_sys_sendto_enter)
+PPP_PROT_REG_CB(on_x64_sys_set_mempolicy_enter)
+PPP_PROT_REG_CB(on_x64_sys_set_robust_list_enter)
+PPP_PROT_REG_CB(on_x64_sys_set_tid_address_enter)
+PPP_PROT_REG_CB(on_x64_sys_setdomainname_enter)
+PPP_PROT_REG_CB(on_x64_sys_setfsgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setfsuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setgroups_enter)
+PPP_PROT_REG_CB(on_x64_sys_sethostname_enter)
+PPP_PROT_REG_CB(on_x64_sys_setitimer_enter)
+PPP_PROT_REG_CB(on_x64_sys_setns_enter)
+PPP_PROT_REG_CB(on_x64_sys_setpgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setpriority_enter)
+PPP_PROT_REG_CB(on_x64_sys_setregid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setresgid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setresuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setreuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setrlimit_enter)
+PPP_PROT_REG_CB(on_x64_sys_setsid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setsockopt_enter)
+PPP_PROT_REG_CB(on_x64_sys_settimeofday_enter)
+PPP_PROT_REG_CB(on_x64_sys_setuid_enter)
+PPP_PROT_REG_CB(on_x64_sys_setxattr_enter)
+PPP_PROT_REG_CB(on_x64_sys_shmat_enter)
+PPP_PROT_REG_CB(on_x64_sys_shmctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_shmdt_enter)
+PPP_PROT_REG_CB(on_x64_sys_shmget_enter)
+PPP_PROT_REG_CB(on_x64_sys_shutdown_enter)
+PPP_PROT_REG_CB(on_x64_sys_sigaltstack_enter)
+PPP_PROT_REG_CB(on_x64_sys_signalfd_enter)
+PPP_PROT_REG_CB(on_x64_sys_signalfd4_enter)
+PPP_PROT_REG_CB(on_x64_sys_socket_enter)
+PPP_PROT_REG_CB(on_x64_sys_socketpair_enter)
+PPP_PROT_REG_CB(on_x64_sys_splice_enter)
+PPP_PROT_REG_CB(on_x64_sys_statfs_enter)
+PPP_PROT_REG_CB(on_x64_sys_swapoff_enter)
+PPP_PROT_REG_CB(on_x64_sys_swapon_enter)
+PPP_PROT_REG_CB(on_x64_sys_symlink_enter)
+PPP_PROT_REG_CB(on_x64_sys_symlinkat_enter)
+PPP_PROT_REG_CB(on_x64_sys_sync_enter)
+PPP_PROT_REG_CB(on_x64_sys_sync_file_range_enter)
+PPP_PROT_REG_CB(on_x64_sys_syncfs_enter)
+PPP_PROT_REG_CB(on_x64_sys_sysctl_enter)
+PPP_PROT_REG_CB(on_x64_sys_sysfs_enter)
+PPP_PROT_REG_CB(on_x64_sys_sysinfo_enter)
+PPP_PROT_REG_CB(on_x64_sys_syslog_enter)
+PPP_PROT_REG_CB(on_x64_sys_tee_enter)
+PPP_PROT_REG_CB(on_x64_sys_tgkill_enter)
+PPP_PROT_REG_CB(on_x64_sys_time_enter)
+PPP_PROT_REG_CB(on_x64_sys_timer_create_enter)
+PPP_PROT_REG_CB(on_x64_sys_timer_delete_enter)
+PPP_PROT_REG_CB(on_x64_sys_timer_getoverrun_enter)
+PPP_PROT_REG_CB(on_x64_sys_timer_gettime_enter)
+PPP_PROT_REG_CB(on_x64_sys_timer_settime_enter)
+PPP_PROT_REG_CB(on_x64_sys_timerfd_create_enter)
+PPP_PROT_REG_CB(on_x64_sys_timerfd_gettime_enter)
+PPP_PROT_REG_CB(on_x64_sys_timerfd_settime_enter)
+PPP_PROT_REG_CB(on_x64_sys_times_enter)
+PPP_PROT_REG_CB(on_x64_sys_tkill_enter)
+PPP_PROT_REG_CB(on_x64_sys_truncate_enter)
+PPP_PROT_REG_CB(on_x64_sys_umask_enter)
+PPP_PROT_REG_CB(on_x64_sys_umount_enter)
+PPP_PROT_REG_CB(on_x64_sys_unlink_enter)
+PPP_PROT_REG_CB(on_x64_sys_unlinkat_enter)
+PPP_PROT_REG_CB(on_x64_sys_unshare_enter)
+PPP_PROT_REG_CB(on_x64_sys_uselib_enter)
+PPP_PROT_REG_CB(on_x64_sys_userfaultfd_enter)
+PPP_PROT_REG_CB(on_x64_sys_ustat_enter)
+PPP_PROT_REG_CB(on_x64_sys_utime_enter)
+PPP_PROT_REG_CB(on_x64_sys_utimensat_enter)
+PPP_PROT_REG_CB(on_x64_sys_utimes_enter)
+PPP_PROT_REG_CB(on_x64_sys_vfork_enter)
+PPP_PROT_REG_CB(on_x64_sys_vhangup_enter)
+PPP_PROT_REG_CB(on_x64_sys_vmsplice_enter)
+PPP_PROT_REG_CB(on_x64_sys_wait4_enter)
+PPP_PROT_REG_CB(on_x64_sys_waitid_enter)
+PPP_PROT_REG_CB(on_x64_sys_write_enter)
+PPP_PROT_REG_CB(on_x64_sys_writev_enter)
+#endif
+#if defined(TARGET_I386)
 PPP_PROT_REG_CB(on_get_thread_area_enter)
 PPP_PROT_REG_CB(on_NtAcceptConnectPort_enter)
 PPP_PROT_REG_CB(on_NtAccessCheck_enter)
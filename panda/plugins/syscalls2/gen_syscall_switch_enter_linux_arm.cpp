@@ -10,25 +10,359 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_linux_arm(CPUState *cpu) {
+#if defined(TARGET_ARM)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[7];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_linux_arm(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_ARM)
+	if (PPP_CHECK_CB(on_sys_restart_syscall_enter) || PPP_CHECK_CB(on_sys_restart_syscall_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_sys_exit_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_fork_enter) || PPP_CHECK_CB(on_fork_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_sys_read_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_sys_write_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_sys_open_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_sys_close_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_sys_creat_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_sys_link_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_sys_unlink_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_execve_enter) || PPP_CHECK_CB(on_execve_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_sys_chdir_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_sys_mknod_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_sys_chmod_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_sys_lchown16_enter) || PPP_CHECK_CB(on_sys_lchown16_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_sys_lseek_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_sys_getpid_enter) || PPP_CHECK_CB(on_sys_getpid_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_sys_mount_return)) syscall_subscribe(bitmap, 21);
+	if (PPP_CHECK_CB(on_sys_setuid16_enter) || PPP_CHECK_CB(on_sys_setuid16_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_sys_getuid16_enter) || PPP_CHECK_CB(on_sys_getuid16_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_sys_ptrace_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_sys_pause_enter) || PPP_CHECK_CB(on_sys_pause_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_sys_access_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_sys_nice_enter) || PPP_CHECK_CB(on_sys_nice_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_sys_sync_enter) || PPP_CHECK_CB(on_sys_sync_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_sys_kill_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_sys_rename_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_sys_mkdir_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_sys_rmdir_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_sys_dup_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_sys_pipe_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_sys_times_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_sys_brk_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_sys_setgid16_enter) || PPP_CHECK_CB(on_sys_setgid16_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_sys_getgid16_enter) || PPP_CHECK_CB(on_sys_getgid16_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_sys_geteuid16_enter) || PPP_CHECK_CB(on_sys_geteuid16_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_sys_getegid16_enter) || PPP_CHECK_CB(on_sys_getegid16_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_sys_acct_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_sys_umount_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_sys_ioctl_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_sys_fcntl_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_sys_setpgid_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_sys_umask_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_sys_chroot_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_sys_ustat_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_sys_dup2_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_sys_getppid_enter) || PPP_CHECK_CB(on_sys_getppid_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_sys_getpgrp_enter) || PPP_CHECK_CB(on_sys_getpgrp_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_sys_setsid_enter) || PPP_CHECK_CB(on_sys_setsid_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_sigaction_enter) || PPP_CHECK_CB(on_sigaction_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_sys_setreuid16_enter) || PPP_CHECK_CB(on_sys_setreuid16_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_sys_setregid16_enter) || PPP_CHECK_CB(on_sys_setregid16_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_sigsuspend_enter) || PPP_CHECK_CB(on_sigsuspend_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_sys_sigpending_enter) || PPP_CHECK_CB(on_sys_sigpending_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_sys_sethostname_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_sys_setrlimit_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_sys_getrusage_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_sys_gettimeofday_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_sys_settimeofday_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_sys_getgroups16_enter) || PPP_CHECK_CB(on_sys_getgroups16_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_sys_setgroups16_enter) || PPP_CHECK_CB(on_sys_setgroups16_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_sys_symlink_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_sys_readlink_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_sys_uselib_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_sys_swapon_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_sys_reboot_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_sys_munmap_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_sys_truncate_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_sys_ftruncate_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_sys_fchmod_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_sys_fchown16_enter) || PPP_CHECK_CB(on_sys_fchown16_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_sys_getpriority_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_sys_setpriority_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_sys_statfs_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_sys_fstatfs_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_sys_syslog_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_sys_setitimer_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_sys_getitimer_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_sys_newstat_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_sys_newlstat_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_sys_newfstat_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_sys_vhangup_enter) || PPP_CHECK_CB(on_sys_vhangup_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_sys_wait4_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_sys_swapoff_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_sys_sysinfo_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_sys_fsync_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_sigreturn_enter) || PPP_CHECK_CB(on_sigreturn_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_clone_enter) || PPP_CHECK_CB(on_clone_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_sys_setdomainname_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_sys_newuname_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_sys_adjtimex_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_sys_mprotect_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_sys_sigprocmask_enter) || PPP_CHECK_CB(on_sys_sigprocmask_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_sys_init_module_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_sys_delete_module_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_sys_quotactl_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_sys_getpgid_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_sys_fchdir_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_sys_bdflush_enter) || PPP_CHECK_CB(on_sys_bdflush_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_sys_sysfs_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_sys_personality_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_sys_setfsuid16_enter) || PPP_CHECK_CB(on_sys_setfsuid16_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_sys_setfsgid16_enter) || PPP_CHECK_CB(on_sys_setfsgid16_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_sys_llseek_enter) || PPP_CHECK_CB(on_sys_llseek_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_sys_getdents_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_sys_select_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_sys_flock_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_sys_msync_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_sys_readv_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_sys_writev_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_sys_getsid_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_sys_fdatasync_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_sys_sysctl_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_sys_mlock_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_sys_munlock_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_sys_mlockall_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_sys_munlockall_enter) || PPP_CHECK_CB(on_sys_munlockall_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_sys_sched_setparam_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_sys_sched_getparam_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_sys_sched_setscheduler_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_sys_sched_getscheduler_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_sys_sched_yield_enter) || PPP_CHECK_CB(on_sys_sched_yield_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_sys_nanosleep_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_arm_mremap_enter) || PPP_CHECK_CB(on_arm_mremap_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_sys_setresuid16_enter) || PPP_CHECK_CB(on_sys_setresuid16_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_sys_getresuid16_enter) || PPP_CHECK_CB(on_sys_getresuid16_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_sys_poll_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_sys_nfsservctl_enter) || PPP_CHECK_CB(on_sys_nfsservctl_return)) syscall_subscribe(bitmap, 169);
+	if (PPP_CHECK_CB(on_sys_setresgid16_enter) || PPP_CHECK_CB(on_sys_setresgid16_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_sys_getresgid16_enter) || PPP_CHECK_CB(on_sys_getresgid16_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_sys_prctl_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_sigreturn_enter) || PPP_CHECK_CB(on_sigreturn_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_rt_sigaction_enter) || PPP_CHECK_CB(on_rt_sigaction_return)) syscall_subscribe(bitmap, 174);
+	if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_sys_rt_sigpending_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) syscall_subscribe(bitmap, 177);
+	if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_sys_pread64_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_sys_pwrite64_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_sys_chown16_enter) || PPP_CHECK_CB(on_sys_chown16_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_sys_getcwd_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_sys_capget_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_sys_capset_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_do_sigaltstack_enter) || PPP_CHECK_CB(on_do_sigaltstack_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_sys_sendfile_enter) || PPP_CHECK_CB(on_sys_sendfile_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_vfork_enter) || PPP_CHECK_CB(on_vfork_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_sys_getrlimit_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_do_mmap2_enter) || PPP_CHECK_CB(on_do_mmap2_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_sys_truncate64_enter) || PPP_CHECK_CB(on_sys_truncate64_return)) syscall_subscribe(bitmap, 193);
+	if (PPP_CHECK_CB(on_sys_ftruncate64_enter) || PPP_CHECK_CB(on_sys_ftruncate64_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_sys_stat64_enter) || PPP_CHECK_CB(on_sys_stat64_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_sys_lstat64_enter) || PPP_CHECK_CB(on_sys_lstat64_return)) syscall_subscribe(bitmap, 196);
+	if (PPP_CHECK_CB(on_sys_fstat64_enter) || PPP_CHECK_CB(on_sys_fstat64_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_sys_lchown_return)) syscall_subscribe(bitmap, 198);
+	if (PPP_CHECK_CB(on_sys_getuid_enter) || PPP_CHECK_CB(on_sys_getuid_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_sys_getgid_enter) || PPP_CHECK_CB(on_sys_getgid_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_sys_geteuid_enter) || PPP_CHECK_CB(on_sys_geteuid_return)) syscall_subscribe(bitmap, 201);
+	if (PPP_CHECK_CB(on_sys_getegid_enter) || PPP_CHECK_CB(on_sys_getegid_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_sys_setreuid_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_sys_setregid_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_sys_getgroups_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_sys_setgroups_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_sys_fchown_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_sys_setresuid_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_sys_getresuid_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_sys_setresgid_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_sys_getresgid_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_sys_chown_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_sys_setuid_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_sys_setgid_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_sys_setfsuid_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_sys_setfsgid_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_sys_getdents64_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_sys_pivot_root_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_sys_mincore_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_sys_madvise_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_sys_fcntl64_enter) || PPP_CHECK_CB(on_sys_fcntl64_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_sys_gettid_enter) || PPP_CHECK_CB(on_sys_gettid_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_sys_readahead_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_sys_setxattr_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_sys_lsetxattr_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_sys_fsetxattr_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_sys_getxattr_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_sys_lgetxattr_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_sys_fgetxattr_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_sys_listxattr_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_sys_llistxattr_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_sys_flistxattr_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_sys_removexattr_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_sys_lremovexattr_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_sys_fremovexattr_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_sys_tkill_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_sys_sendfile64_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_sys_futex_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_sys_sched_setaffinity_return)) syscall_subscribe(bitmap, 241);
+	if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_sys_sched_getaffinity_return)) syscall_subscribe(bitmap, 242);
+	if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_sys_io_setup_return)) syscall_subscribe(bitmap, 243);
+	if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_sys_io_destroy_return)) syscall_subscribe(bitmap, 244);
+	if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_sys_io_getevents_return)) syscall_subscribe(bitmap, 245);
+	if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_sys_io_submit_return)) syscall_subscribe(bitmap, 246);
+	if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_sys_io_cancel_return)) syscall_subscribe(bitmap, 247);
+	if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_sys_exit_group_return)) syscall_subscribe(bitmap, 248);
+	if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_sys_lookup_dcookie_return)) syscall_subscribe(bitmap, 249);
+	if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_sys_epoll_create_return)) syscall_subscribe(bitmap, 250);
+	if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_sys_epoll_ctl_return)) syscall_subscribe(bitmap, 251);
+	if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_sys_epoll_wait_return)) syscall_subscribe(bitmap, 252);
+	if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_sys_remap_file_pages_return)) syscall_subscribe(bitmap, 253);
+	if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_sys_set_tid_address_return)) syscall_subscribe(bitmap, 256);
+	if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_sys_timer_create_return)) syscall_subscribe(bitmap, 257);
+	if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_sys_timer_settime_return)) syscall_subscribe(bitmap, 258);
+	if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_sys_timer_gettime_return)) syscall_subscribe(bitmap, 259);
+	if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_sys_timer_getoverrun_return)) syscall_subscribe(bitmap, 260);
+	if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_sys_timer_delete_return)) syscall_subscribe(bitmap, 261);
+	if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_sys_clock_settime_return)) syscall_subscribe(bitmap, 262);
+	if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_sys_clock_gettime_return)) syscall_subscribe(bitmap, 263);
+	if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_sys_clock_getres_return)) syscall_subscribe(bitmap, 264);
+	if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_sys_clock_nanosleep_return)) syscall_subscribe(bitmap, 265);
+	if (PPP_CHECK_CB(on_sys_statfs64_enter) || PPP_CHECK_CB(on_sys_statfs64_return)) syscall_subscribe(bitmap, 266);
+	if (PPP_CHECK_CB(on_sys_fstatfs64_enter) || PPP_CHECK_CB(on_sys_fstatfs64_return)) syscall_subscribe(bitmap, 267);
+	if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_sys_tgkill_return)) syscall_subscribe(bitmap, 268);
+	if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_sys_utimes_return)) syscall_subscribe(bitmap, 269);
+	if (PPP_CHECK_CB(on_sys_arm_fadvise64_64_enter) || PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)) syscall_subscribe(bitmap, 270);
+	if (PPP_CHECK_CB(on_sys_pciconfig_iobase_enter) || PPP_CHECK_CB(on_sys_pciconfig_iobase_return)) syscall_subscribe(bitmap, 271);
+	if (PPP_CHECK_CB(on_sys_pciconfig_read_enter) || PPP_CHECK_CB(on_sys_pciconfig_read_return)) syscall_subscribe(bitmap, 272);
+	if (PPP_CHECK_CB(on_sys_pciconfig_write_enter) || PPP_CHECK_CB(on_sys_pciconfig_write_return)) syscall_subscribe(bitmap, 273);
+	if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_sys_mq_open_return)) syscall_subscribe(bitmap, 274);
+	if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_sys_mq_unlink_return)) syscall_subscribe(bitmap, 275);
+	if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_sys_mq_timedsend_return)) syscall_subscribe(bitmap, 276);
+	if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_sys_mq_timedreceive_return)) syscall_subscribe(bitmap, 277);
+	if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_sys_mq_notify_return)) syscall_subscribe(bitmap, 278);
+	if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_sys_mq_getsetattr_return)) syscall_subscribe(bitmap, 279);
+	if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_sys_waitid_return)) syscall_subscribe(bitmap, 280);
+	if (PPP_CHECK_CB(on_sys_socket_enter) || PPP_CHECK_CB(on_sys_socket_return)) syscall_subscribe(bitmap, 281);
+	if (PPP_CHECK_CB(on_sys_bind_enter) || PPP_CHECK_CB(on_sys_bind_return)) syscall_subscribe(bitmap, 282);
+	if (PPP_CHECK_CB(on_sys_connect_enter) || PPP_CHECK_CB(on_sys_connect_return)) syscall_subscribe(bitmap, 283);
+	if (PPP_CHECK_CB(on_sys_listen_enter) || PPP_CHECK_CB(on_sys_listen_return)) syscall_subscribe(bitmap, 284);
+	if (PPP_CHECK_CB(on_sys_accept_enter) || PPP_CHECK_CB(on_sys_accept_return)) syscall_subscribe(bitmap, 285);
+	if (PPP_CHECK_CB(on_sys_getsockname_enter) || PPP_CHECK_CB(on_sys_getsockname_return)) syscall_subscribe(bitmap, 286);
+	if (PPP_CHECK_CB(on_sys_getpeername_enter) || PPP_CHECK_CB(on_sys_getpeername_return)) syscall_subscribe(bitmap, 287);
+	if (PPP_CHECK_CB(on_sys_socketpair_enter) || PPP_CHECK_CB(on_sys_socketpair_return)) syscall_subscribe(bitmap, 288);
+	if (PPP_CHECK_CB(on_sys_send_enter) || PPP_CHECK_CB(on_sys_send_return)) syscall_subscribe(bitmap, 289);
+	if (PPP_CHECK_CB(on_sys_sendto_enter) || PPP_CHECK_CB(on_sys_sendto_return)) syscall_subscribe(bitmap, 290);
+	if (PPP_CHECK_CB(on_sys_recv_enter) || PPP_CHECK_CB(on_sys_recv_return)) syscall_subscribe(bitmap, 291);
+	if (PPP_CHECK_CB(on_sys_recvfrom_enter) || PPP_CHECK_CB(on_sys_recvfrom_return)) syscall_subscribe(bitmap, 292);
+	if (PPP_CHECK_CB(on_sys_shutdown_enter) || PPP_CHECK_CB(on_sys_shutdown_return)) syscall_subscribe(bitmap, 293);
+	if (PPP_CHECK_CB(on_sys_setsockopt_enter) || PPP_CHECK_CB(on_sys_setsockopt_return)) syscall_subscribe(bitmap, 294);
+	if (PPP_CHECK_CB(on_sys_getsockopt_enter) || PPP_CHECK_CB(on_sys_getsockopt_return)) syscall_subscribe(bitmap, 295);
+	if (PPP_CHECK_CB(on_sys_sendmsg_enter) || PPP_CHECK_CB(on_sys_sendmsg_return)) syscall_subscribe(bitmap, 296);
+	if (PPP_CHECK_CB(on_sys_recvmsg_enter) || PPP_CHECK_CB(on_sys_recvmsg_return)) syscall_subscribe(bitmap, 297);
+	if (PPP_CHECK_CB(on_sys_semop_enter) || PPP_CHECK_CB(on_sys_semop_return)) syscall_subscribe(bitmap, 298);
+	if (PPP_CHECK_CB(on_sys_semget_enter) || PPP_CHECK_CB(on_sys_semget_return)) syscall_subscribe(bitmap, 299);
+	if (PPP_CHECK_CB(on_sys_semctl_enter) || PPP_CHECK_CB(on_sys_semctl_return)) syscall_subscribe(bitmap, 300);
+	if (PPP_CHECK_CB(on_sys_msgsnd_enter) || PPP_CHECK_CB(on_sys_msgsnd_return)) syscall_subscribe(bitmap, 301);
+	if (PPP_CHECK_CB(on_sys_msgrcv_enter) || PPP_CHECK_CB(on_sys_msgrcv_return)) syscall_subscribe(bitmap, 302);
+	if (PPP_CHECK_CB(on_sys_msgget_enter) || PPP_CHECK_CB(on_sys_msgget_return)) syscall_subscribe(bitmap, 303);
+	if (PPP_CHECK_CB(on_sys_msgctl_enter) || PPP_CHECK_CB(on_sys_msgctl_return)) syscall_subscribe(bitmap, 304);
+	if (PPP_CHECK_CB(on_sys_shmat_enter) || PPP_CHECK_CB(on_sys_shmat_return)) syscall_subscribe(bitmap, 305);
+	if (PPP_CHECK_CB(on_sys_shmdt_enter) || PPP_CHECK_CB(on_sys_shmdt_return)) syscall_subscribe(bitmap, 306);
+	if (PPP_CHECK_CB(on_sys_shmget_enter) || PPP_CHECK_CB(on_sys_shmget_return)) syscall_subscribe(bitmap, 307);
+	if (PPP_CHECK_CB(on_sys_shmctl_enter) || PPP_CHECK_CB(on_sys_shmctl_return)) syscall_subscribe(bitmap, 308);
+	if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_sys_add_key_return)) syscall_subscribe(bitmap, 309);
+	if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_sys_request_key_return)) syscall_subscribe(bitmap, 310);
+	if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_sys_keyctl_return)) syscall_subscribe(bitmap, 311);
+	if (PPP_CHECK_CB(on_sys_semtimedop_enter) || PPP_CHECK_CB(on_sys_semtimedop_return)) syscall_subscribe(bitmap, 312);
+	if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_sys_ioprio_set_return)) syscall_subscribe(bitmap, 314);
+	if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_sys_ioprio_get_return)) syscall_subscribe(bitmap, 315);
+	if (PPP_CHECK_CB(on_sys_inotify_init_enter) || PPP_CHECK_CB(on_sys_inotify_init_return)) syscall_subscribe(bitmap, 316);
+	if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_sys_inotify_add_watch_return)) syscall_subscribe(bitmap, 317);
+	if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) syscall_subscribe(bitmap, 318);
+	if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_sys_mbind_return)) syscall_subscribe(bitmap, 319);
+	if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_sys_get_mempolicy_return)) syscall_subscribe(bitmap, 320);
+	if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_sys_set_mempolicy_return)) syscall_subscribe(bitmap, 321);
+	if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_sys_openat_return)) syscall_subscribe(bitmap, 322);
+	if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_sys_mkdirat_return)) syscall_subscribe(bitmap, 323);
+	if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_sys_mknodat_return)) syscall_subscribe(bitmap, 324);
+	if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_sys_fchownat_return)) syscall_subscribe(bitmap, 325);
+	if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_sys_futimesat_return)) syscall_subscribe(bitmap, 326);
+	if (PPP_CHECK_CB(on_sys_fstatat64_enter) || PPP_CHECK_CB(on_sys_fstatat64_return)) syscall_subscribe(bitmap, 327);
+	if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_sys_unlinkat_return)) syscall_subscribe(bitmap, 328);
+	if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_sys_renameat_return)) syscall_subscribe(bitmap, 329);
+	if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_sys_linkat_return)) syscall_subscribe(bitmap, 330);
+	if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_sys_symlinkat_return)) syscall_subscribe(bitmap, 331);
+	if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_sys_readlinkat_return)) syscall_subscribe(bitmap, 332);
+	if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_sys_fchmodat_return)) syscall_subscribe(bitmap, 333);
+	if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_sys_faccessat_return)) syscall_subscribe(bitmap, 334);
+	if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_sys_unshare_return)) syscall_subscribe(bitmap, 337);
+	if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_sys_set_robust_list_return)) syscall_subscribe(bitmap, 338);
+	if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_sys_get_robust_list_return)) syscall_subscribe(bitmap, 339);
+	if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_sys_splice_return)) syscall_subscribe(bitmap, 340);
+	if (PPP_CHECK_CB(on_sys_sync_file_range2_enter) || PPP_CHECK_CB(on_sys_sync_file_range2_return)) syscall_subscribe(bitmap, 341);
+	if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_sys_tee_return)) syscall_subscribe(bitmap, 342);
+	if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_sys_vmsplice_return)) syscall_subscribe(bitmap, 343);
+	if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_sys_move_pages_return)) syscall_subscribe(bitmap, 344);
+	if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_sys_getcpu_return)) syscall_subscribe(bitmap, 345);
+	if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_sys_kexec_load_return)) syscall_subscribe(bitmap, 347);
+	if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_sys_utimensat_return)) syscall_subscribe(bitmap, 348);
+	if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_sys_signalfd_return)) syscall_subscribe(bitmap, 349);
+	if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_sys_timerfd_create_return)) syscall_subscribe(bitmap, 350);
+	if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_sys_eventfd_return)) syscall_subscribe(bitmap, 351);
+	if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_sys_fallocate_return)) syscall_subscribe(bitmap, 352);
+	if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_sys_timerfd_settime_return)) syscall_subscribe(bitmap, 353);
+	if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_sys_timerfd_gettime_return)) syscall_subscribe(bitmap, 354);
+	if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_sys_signalfd4_return)) syscall_subscribe(bitmap, 355);
+	if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_sys_eventfd2_return)) syscall_subscribe(bitmap, 356);
+	if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_sys_epoll_create1_return)) syscall_subscribe(bitmap, 357);
+	if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_sys_dup3_return)) syscall_subscribe(bitmap, 358);
+	if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_sys_pipe2_return)) syscall_subscribe(bitmap, 359);
+	if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_sys_inotify_init1_return)) syscall_subscribe(bitmap, 360);
+	if (PPP_CHECK_CB(on_ARM_breakpoint_enter) || PPP_CHECK_CB(on_ARM_breakpoint_return)) syscall_subscribe(bitmap, 10420225);
+	if (PPP_CHECK_CB(on_ARM_cacheflush_enter) || PPP_CHECK_CB(on_ARM_cacheflush_return)) syscall_subscribe(bitmap, 10420226);
+	if (PPP_CHECK_CB(on_ARM_user26_mode_enter) || PPP_CHECK_CB(on_ARM_user26_mode_return)) syscall_subscribe(bitmap, 10420227);
+	if (PPP_CHECK_CB(on_ARM_usr32_mode_enter) || PPP_CHECK_CB(on_ARM_usr32_mode_return)) syscall_subscribe(bitmap, 10420228);
+	if (PPP_CHECK_CB(on_ARM_set_tls_enter) || PPP_CHECK_CB(on_ARM_set_tls_return)) syscall_subscribe(bitmap, 10420229);
+	if (PPP_CHECK_CB(on_ARM_cmpxchg_enter) || PPP_CHECK_CB(on_ARM_cmpxchg_return)) syscall_subscribe(bitmap, 10485744);
+	if (PPP_CHECK_CB(on_ARM_null_segfault_enter) || PPP_CHECK_CB(on_ARM_null_segfault_return)) syscall_subscribe(bitmap, 10420224);
+#endif
+}
+
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_ARM
+#if defined(TARGET_ARM)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[7];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[7]) {
 		// 0 long sys_restart_syscall ['void']
 		case 0: {
-			if (PPP_CHECK_CB(on_sys_restart_syscall_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_restart_syscall_return)) track_return = true;
 			PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
 		}; break;
 		
 		// 1 long sys_exit ['int error_code']
 		case 1: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_exit_return)) {
+			if (PPP_CHECK_CB(on_sys_exit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
@@ -36,8 +370,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 2 unsigned long fork ['void']
 		case 2: {
-			if (PPP_CHECK_CB(on_fork_return)) {
-			}
+			if (PPP_CHECK_CB(on_fork_return)) track_return = true;
 			PPP_RUN_CB(on_fork_enter, cpu, pc);
 		}; break;
 		
@@ -46,7 +379,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_read_return)) {
+			if (PPP_CHECK_CB(on_sys_read_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -59,7 +393,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_write_return)) {
+			if (PPP_CHECK_CB(on_sys_write_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -72,7 +407,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_open_return)) {
+			if (PPP_CHECK_CB(on_sys_open_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -83,7 +419,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 6 long sys_close ['unsigned int fd']
 		case 6: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_close_return)) {
+			if (PPP_CHECK_CB(on_sys_close_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
@@ -93,7 +430,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 8: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_creat_return)) {
+			if (PPP_CHECK_CB(on_sys_creat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -104,7 +442,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 9: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_link_return)) {
+			if (PPP_CHECK_CB(on_sys_link_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -114,7 +453,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 10 long sys_unlink ['const char __user *pathname']
 		case 10: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_unlink_return)) {
+			if (PPP_CHECK_CB(on_sys_unlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
@@ -125,7 +465,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_execve_return)) {
+			if (PPP_CHECK_CB(on_execve_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -136,7 +477,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 12 long sys_chdir ['const char __user *filename']
 		case 12: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_chdir_return)) {
+			if (PPP_CHECK_CB(on_sys_chdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
@@ -147,7 +489,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mknod_return)) {
+			if (PPP_CHECK_CB(on_sys_mknod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -159,7 +502,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 15: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_chmod_return)) {
+			if (PPP_CHECK_CB(on_sys_chmod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -171,7 +515,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lchown16_return)) {
+			if (PPP_CHECK_CB(on_sys_lchown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -184,7 +529,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lseek_return)) {
+			if (PPP_CHECK_CB(on_sys_lseek_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -194,8 +540,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 20 long sys_getpid ['void']
 		case 20: {
-			if (PPP_CHECK_CB(on_sys_getpid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getpid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
 		}; break;
 		
@@ -206,7 +551,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mount_return)) {
+			if (PPP_CHECK_CB(on_sys_mount_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -219,7 +565,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 23 long sys_setuid16 ['old_uid_t uid']
 		case 23: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setuid16_enter, cpu, pc, arg0);
@@ -227,8 +574,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 24 long sys_getuid16 ['void']
 		case 24: {
-			if (PPP_CHECK_CB(on_sys_getuid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getuid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getuid16_enter, cpu, pc);
 		}; break;
 		
@@ -238,7 +584,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_ptrace_return)) {
+			if (PPP_CHECK_CB(on_sys_ptrace_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -249,8 +596,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 29 long sys_pause ['void']
 		case 29: {
-			if (PPP_CHECK_CB(on_sys_pause_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_pause_return)) track_return = true;
 			PPP_RUN_CB(on_sys_pause_enter, cpu, pc);
 		}; break;
 		
@@ -258,7 +604,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 33: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_access_return)) {
+			if (PPP_CHECK_CB(on_sys_access_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -268,7 +615,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 34 long sys_nice ['int increment']
 		case 34: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_nice_return)) {
+			if (PPP_CHECK_CB(on_sys_nice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
@@ -276,8 +624,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 36 long sys_sync ['void']
 		case 36: {
-			if (PPP_CHECK_CB(on_sys_sync_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_sync_return)) track_return = true;
 			PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
 		}; break;
 		
@@ -285,7 +632,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 37: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_kill_return)) {
+			if (PPP_CHECK_CB(on_sys_kill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -296,7 +644,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 38: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rename_return)) {
+			if (PPP_CHECK_CB(on_sys_rename_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -307,7 +656,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 39: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mkdir_return)) {
+			if (PPP_CHECK_CB(on_sys_mkdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -317,7 +667,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 40 long sys_rmdir ['const char __user *pathname']
 		case 40: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_rmdir_return)) {
+			if (PPP_CHECK_CB(on_sys_rmdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
@@ -326,7 +677,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 41 long sys_dup ['unsigned int fildes']
 		case 41: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_dup_return)) {
+			if (PPP_CHECK_CB(on_sys_dup_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
@@ -335,7 +687,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 42 long sys_pipe ['int __user *']
 		case 42: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_pipe_return)) {
+			if (PPP_CHECK_CB(on_sys_pipe_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
@@ -344,7 +697,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 43 long sys_times ['struct tms __user *tbuf']
 		case 43: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_times_return)) {
+			if (PPP_CHECK_CB(on_sys_times_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
@@ -353,7 +707,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 45 long sys_brk ['unsigned long brk']
 		case 45: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_brk_return)) {
+			if (PPP_CHECK_CB(on_sys_brk_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
@@ -362,7 +717,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 46 long sys_setgid16 ['old_gid_t gid']
 		case 46: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setgid16_enter, cpu, pc, arg0);
@@ -370,29 +726,27 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 47 long sys_getgid16 ['void']
 		case 47: {
-			if (PPP_CHECK_CB(on_sys_getgid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getgid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getgid16_enter, cpu, pc);
 		}; break;
 		
 		// 49 long sys_geteuid16 ['void']
 		case 49: {
-			if (PPP_CHECK_CB(on_sys_geteuid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_geteuid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_geteuid16_enter, cpu, pc);
 		}; break;
 		
 		// 50 long sys_getegid16 ['void']
 		case 50: {
-			if (PPP_CHECK_CB(on_sys_getegid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getegid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getegid16_enter, cpu, pc);
 		}; break;
 		
 		// 51 long sys_acct ['const char __user *name']
 		case 51: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_acct_return)) {
+			if (PPP_CHECK_CB(on_sys_acct_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
@@ -402,7 +756,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 52: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_umount_return)) {
+			if (PPP_CHECK_CB(on_sys_umount_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -414,7 +769,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_ioctl_return)) {
+			if (PPP_CHECK_CB(on_sys_ioctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -427,7 +783,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fcntl_return)) {
+			if (PPP_CHECK_CB(on_sys_fcntl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -439,7 +796,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setpgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setpgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -449,7 +807,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 60 long sys_umask ['int mask']
 		case 60: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_umask_return)) {
+			if (PPP_CHECK_CB(on_sys_umask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
@@ -458,7 +817,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 61 long sys_chroot ['const char __user *filename']
 		case 61: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_chroot_return)) {
+			if (PPP_CHECK_CB(on_sys_chroot_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
@@ -468,7 +828,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 62: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ustat_return)) {
+			if (PPP_CHECK_CB(on_sys_ustat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -479,7 +840,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 63: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_dup2_return)) {
+			if (PPP_CHECK_CB(on_sys_dup2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -488,22 +850,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 64 long sys_getppid ['void']
 		case 64: {
-			if (PPP_CHECK_CB(on_sys_getppid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getppid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
 		}; break;
 		
 		// 65 long sys_getpgrp ['void']
 		case 65: {
-			if (PPP_CHECK_CB(on_sys_getpgrp_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getpgrp_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getpgrp_enter, cpu, pc);
 		}; break;
 		
 		// 66 long sys_setsid ['void']
 		case 66: {
-			if (PPP_CHECK_CB(on_sys_setsid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_setsid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
 		}; break;
 		
@@ -512,7 +871,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sigaction_return)) {
+			if (PPP_CHECK_CB(on_sigaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -524,7 +884,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 70: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setreuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setreuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -535,7 +896,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 71: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setregid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setregid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -547,7 +909,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sigsuspend_return)) {
+			if (PPP_CHECK_CB(on_sigsuspend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -558,7 +921,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 73 long sys_sigpending ['old_sigset_t __user *set']
 		case 73: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sigpending_return)) {
+			if (PPP_CHECK_CB(on_sys_sigpending_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
@@ -568,7 +932,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 74: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sethostname_return)) {
+			if (PPP_CHECK_CB(on_sys_sethostname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -579,7 +944,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 75: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setrlimit_return)) {
+			if (PPP_CHECK_CB(on_sys_setrlimit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -590,7 +956,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 77: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getrusage_return)) {
+			if (PPP_CHECK_CB(on_sys_getrusage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -601,7 +968,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 78: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_gettimeofday_return)) {
+			if (PPP_CHECK_CB(on_sys_gettimeofday_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -612,7 +980,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 79: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_settimeofday_return)) {
+			if (PPP_CHECK_CB(on_sys_settimeofday_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -623,7 +992,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 80: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getgroups16_return)) {
+			if (PPP_CHECK_CB(on_sys_getgroups16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -634,7 +1004,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 81: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setgroups16_return)) {
+			if (PPP_CHECK_CB(on_sys_setgroups16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -645,7 +1016,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 83: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_symlink_return)) {
+			if (PPP_CHECK_CB(on_sys_symlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -657,7 +1029,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readlink_return)) {
+			if (PPP_CHECK_CB(on_sys_readlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -668,7 +1041,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 86 long sys_uselib ['const char __user *library']
 		case 86: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_uselib_return)) {
+			if (PPP_CHECK_CB(on_sys_uselib_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
@@ -678,7 +1052,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 87: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_swapon_return)) {
+			if (PPP_CHECK_CB(on_sys_swapon_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -691,7 +1066,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_reboot_return)) {
+			if (PPP_CHECK_CB(on_sys_reboot_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -704,7 +1080,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 91: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_munmap_return)) {
+			if (PPP_CHECK_CB(on_sys_munmap_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -715,7 +1092,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 92: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_truncate_return)) {
+			if (PPP_CHECK_CB(on_sys_truncate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -726,7 +1104,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 93: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ftruncate_return)) {
+			if (PPP_CHECK_CB(on_sys_ftruncate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -737,7 +1116,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 94: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fchmod_return)) {
+			if (PPP_CHECK_CB(on_sys_fchmod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -749,7 +1129,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchown16_return)) {
+			if (PPP_CHECK_CB(on_sys_fchown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -761,7 +1142,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 96: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getpriority_return)) {
+			if (PPP_CHECK_CB(on_sys_getpriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -773,7 +1155,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setpriority_return)) {
+			if (PPP_CHECK_CB(on_sys_setpriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -785,7 +1168,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 99: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_statfs_return)) {
+			if (PPP_CHECK_CB(on_sys_statfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -796,7 +1180,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 100: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fstatfs_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -808,7 +1193,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_syslog_return)) {
+			if (PPP_CHECK_CB(on_sys_syslog_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -821,7 +1207,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setitimer_return)) {
+			if (PPP_CHECK_CB(on_sys_setitimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -833,7 +1220,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 105: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getitimer_return)) {
+			if (PPP_CHECK_CB(on_sys_getitimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -844,7 +1232,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 106: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -855,7 +1244,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 107: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newlstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newlstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -866,7 +1256,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 108: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newfstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newfstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -875,8 +1266,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 111 long sys_vhangup ['void']
 		case 111: {
-			if (PPP_CHECK_CB(on_sys_vhangup_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_vhangup_return)) track_return = true;
 			PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
 		}; break;
 		
@@ -886,7 +1276,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_wait4_return)) {
+			if (PPP_CHECK_CB(on_sys_wait4_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -898,7 +1289,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 115 long sys_swapoff ['const char __user *specialfile']
 		case 115: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_swapoff_return)) {
+			if (PPP_CHECK_CB(on_sys_swapoff_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
@@ -907,7 +1299,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 116 long sys_sysinfo ['struct sysinfo __user *info']
 		case 116: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sysinfo_return)) {
+			if (PPP_CHECK_CB(on_sys_sysinfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
@@ -916,7 +1309,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 118 long sys_fsync ['unsigned int fd']
 		case 118: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fsync_return)) {
+			if (PPP_CHECK_CB(on_sys_fsync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
@@ -924,8 +1318,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 119 int sigreturn ['void']
 		case 119: {
-			if (PPP_CHECK_CB(on_sigreturn_return)) {
-			}
+			if (PPP_CHECK_CB(on_sigreturn_return)) track_return = true;
 			PPP_RUN_CB(on_sigreturn_enter, cpu, pc);
 		}; break;
 		
@@ -937,7 +1330,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_clone_return)) {
+			if (PPP_CHECK_CB(on_clone_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -952,7 +1346,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 121: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setdomainname_return)) {
+			if (PPP_CHECK_CB(on_sys_setdomainname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -962,7 +1357,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 122 long sys_newuname ['struct new_utsname __user *name']
 		case 122: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_newuname_return)) {
+			if (PPP_CHECK_CB(on_sys_newuname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
@@ -971,7 +1367,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 124 long sys_adjtimex ['struct timex __user *txc_p']
 		case 124: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_adjtimex_return)) {
+			if (PPP_CHECK_CB(on_sys_adjtimex_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
@@ -982,7 +1379,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mprotect_return)) {
+			if (PPP_CHECK_CB(on_sys_mprotect_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -995,7 +1393,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sigprocmask_return)) {
+			if (PPP_CHECK_CB(on_sys_sigprocmask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1008,7 +1407,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_init_module_return)) {
+			if (PPP_CHECK_CB(on_sys_init_module_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1020,7 +1420,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 129: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_delete_module_return)) {
+			if (PPP_CHECK_CB(on_sys_delete_module_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1033,7 +1434,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_quotactl_return)) {
+			if (PPP_CHECK_CB(on_sys_quotactl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1045,7 +1447,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 132 long sys_getpgid ['pid_t pid']
 		case 132: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_getpgid_return)) {
+			if (PPP_CHECK_CB(on_sys_getpgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
@@ -1054,7 +1457,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 133 long sys_fchdir ['unsigned int fd']
 		case 133: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fchdir_return)) {
+			if (PPP_CHECK_CB(on_sys_fchdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
@@ -1064,7 +1468,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 134: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_bdflush_return)) {
+			if (PPP_CHECK_CB(on_sys_bdflush_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -1076,7 +1481,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sysfs_return)) {
+			if (PPP_CHECK_CB(on_sys_sysfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1087,7 +1493,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 136 long sys_personality ['u_long personality']
 		case 136: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_personality_return)) {
+			if (PPP_CHECK_CB(on_sys_personality_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
@@ -1096,7 +1503,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 138 long sys_setfsuid16 ['old_uid_t uid']
 		case 138: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsuid16_enter, cpu, pc, arg0);
@@ -1105,7 +1513,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 139 long sys_setfsgid16 ['old_gid_t gid']
 		case 139: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsgid16_enter, cpu, pc, arg0);
@@ -1118,7 +1527,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_llseek_return)) {
+			if (PPP_CHECK_CB(on_sys_llseek_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1133,7 +1543,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getdents_return)) {
+			if (PPP_CHECK_CB(on_sys_getdents_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1148,7 +1559,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_select_return)) {
+			if (PPP_CHECK_CB(on_sys_select_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1162,7 +1574,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 143: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_flock_return)) {
+			if (PPP_CHECK_CB(on_sys_flock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1174,7 +1587,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_msync_return)) {
+			if (PPP_CHECK_CB(on_sys_msync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1187,7 +1601,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readv_return)) {
+			if (PPP_CHECK_CB(on_sys_readv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1200,7 +1615,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_writev_return)) {
+			if (PPP_CHECK_CB(on_sys_writev_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1211,7 +1627,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 147 long sys_getsid ['pid_t pid']
 		case 147: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_getsid_return)) {
+			if (PPP_CHECK_CB(on_sys_getsid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
@@ -1220,7 +1637,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 148 long sys_fdatasync ['unsigned int fd']
 		case 148: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fdatasync_return)) {
+			if (PPP_CHECK_CB(on_sys_fdatasync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
@@ -1229,7 +1647,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 149 long sys_sysctl ['struct __sysctl_args __user *args']
 		case 149: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sysctl_return)) {
+			if (PPP_CHECK_CB(on_sys_sysctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
@@ -1239,7 +1658,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 150: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mlock_return)) {
+			if (PPP_CHECK_CB(on_sys_mlock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1250,7 +1670,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 151: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_munlock_return)) {
+			if (PPP_CHECK_CB(on_sys_munlock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1260,7 +1681,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 152 long sys_mlockall ['int flags']
 		case 152: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_mlockall_return)) {
+			if (PPP_CHECK_CB(on_sys_mlockall_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
@@ -1268,8 +1690,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 153 long sys_munlockall ['void']
 		case 153: {
-			if (PPP_CHECK_CB(on_sys_munlockall_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_munlockall_return)) track_return = true;
 			PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
 		}; break;
 		
@@ -1277,7 +1698,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 154: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_setparam_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setparam_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1288,7 +1710,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 155: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_getparam_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getparam_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1300,7 +1723,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1311,7 +1735,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 157 long sys_sched_getscheduler ['pid_t pid']
 		case 157: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
@@ -1319,15 +1744,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 158 long sys_sched_yield ['void']
 		case 158: {
-			if (PPP_CHECK_CB(on_sys_sched_yield_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_sched_yield_return)) track_return = true;
 			PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
 		}; break;
 		
 		// 159 long sys_sched_get_priority_max ['int policy']
 		case 159: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
@@ -1336,7 +1761,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 160 long sys_sched_get_priority_min ['int policy']
 		case 160: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
@@ -1346,7 +1772,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 161: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1357,7 +1784,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 162: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_nanosleep_return)) {
+			if (PPP_CHECK_CB(on_sys_nanosleep_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1371,7 +1799,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_arm_mremap_return)) {
+			if (PPP_CHECK_CB(on_arm_mremap_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1386,7 +1815,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setresuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1399,7 +1829,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_getresuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1412,7 +1843,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_poll_return)) {
+			if (PPP_CHECK_CB(on_sys_poll_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1425,7 +1857,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_nfsservctl_return)) {
+			if (PPP_CHECK_CB(on_sys_nfsservctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1438,7 +1871,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setresgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1451,7 +1885,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_getresgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1466,7 +1901,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_prctl_return)) {
+			if (PPP_CHECK_CB(on_sys_prctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1478,8 +1914,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 173 int sigreturn ['void']
 		case 173: {
-			if (PPP_CHECK_CB(on_sigreturn_return)) {
-			}
+			if (PPP_CHECK_CB(on_sigreturn_return)) track_return = true;
 			PPP_RUN_CB(on_sigreturn_enter, cpu, pc);
 		}; break;
 		
@@ -1489,7 +1924,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_rt_sigaction_return)) {
+			if (PPP_CHECK_CB(on_rt_sigaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1504,7 +1940,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1517,7 +1954,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 176: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1530,7 +1968,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1544,7 +1983,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1556,7 +1996,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 179: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1569,7 +2010,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_pread64_return)) {
+			if (PPP_CHECK_CB(on_sys_pread64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1584,7 +2026,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_pwrite64_return)) {
+			if (PPP_CHECK_CB(on_sys_pwrite64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1598,7 +2041,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_chown16_return)) {
+			if (PPP_CHECK_CB(on_sys_chown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1610,7 +2054,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 183: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getcwd_return)) {
+			if (PPP_CHECK_CB(on_sys_getcwd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1621,7 +2066,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 184: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_capget_return)) {
+			if (PPP_CHECK_CB(on_sys_capget_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1632,7 +2078,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 185: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_capset_return)) {
+			if (PPP_CHECK_CB(on_sys_capset_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1643,7 +2090,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 186: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_do_sigaltstack_return)) {
+			if (PPP_CHECK_CB(on_do_sigaltstack_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1656,7 +2104,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sendfile_return)) {
+			if (PPP_CHECK_CB(on_sys_sendfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1667,8 +2116,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 190 unsigned long vfork ['void']
 		case 190: {
-			if (PPP_CHECK_CB(on_vfork_return)) {
-			}
+			if (PPP_CHECK_CB(on_vfork_return)) track_return = true;
 			PPP_RUN_CB(on_vfork_enter, cpu, pc);
 		}; break;
 		
@@ -1676,7 +2124,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 191: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getrlimit_return)) {
+			if (PPP_CHECK_CB(on_sys_getrlimit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1691,7 +2140,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_do_mmap2_return)) {
+			if (PPP_CHECK_CB(on_do_mmap2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1706,7 +2156,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 193: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_truncate64_return)) {
+			if (PPP_CHECK_CB(on_sys_truncate64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 			}
@@ -1717,7 +2168,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 194: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ftruncate64_return)) {
+			if (PPP_CHECK_CB(on_sys_ftruncate64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 			}
@@ -1728,7 +2180,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 195: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_stat64_return)) {
+			if (PPP_CHECK_CB(on_sys_stat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1739,7 +2192,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 196: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_lstat64_return)) {
+			if (PPP_CHECK_CB(on_sys_lstat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1750,7 +2204,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 197: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fstat64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1762,7 +2217,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lchown_return)) {
+			if (PPP_CHECK_CB(on_sys_lchown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1772,29 +2228,25 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 199 long sys_getuid ['void']
 		case 199: {
-			if (PPP_CHECK_CB(on_sys_getuid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getuid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
 		}; break;
 		
 		// 200 long sys_getgid ['void']
 		case 200: {
-			if (PPP_CHECK_CB(on_sys_getgid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getgid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
 		}; break;
 		
 		// 201 long sys_geteuid ['void']
 		case 201: {
-			if (PPP_CHECK_CB(on_sys_geteuid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_geteuid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
 		}; break;
 		
 		// 202 long sys_getegid ['void']
 		case 202: {
-			if (PPP_CHECK_CB(on_sys_getegid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getegid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
 		}; break;
 		
@@ -1802,7 +2254,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 203: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setreuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setreuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1813,7 +2266,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 204: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setregid_return)) {
+			if (PPP_CHECK_CB(on_sys_setregid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1824,7 +2278,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 205: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getgroups_return)) {
+			if (PPP_CHECK_CB(on_sys_getgroups_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1835,7 +2290,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 206: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setgroups_return)) {
+			if (PPP_CHECK_CB(on_sys_setgroups_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1847,7 +2303,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchown_return)) {
+			if (PPP_CHECK_CB(on_sys_fchown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1860,7 +2317,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setresuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1873,7 +2331,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresuid_return)) {
+			if (PPP_CHECK_CB(on_sys_getresuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1886,7 +2345,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setresgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1899,7 +2359,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresgid_return)) {
+			if (PPP_CHECK_CB(on_sys_getresgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1912,7 +2373,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_chown_return)) {
+			if (PPP_CHECK_CB(on_sys_chown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1923,7 +2385,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 213 long sys_setuid ['uid_t uid']
 		case 213: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
@@ -1932,7 +2395,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 214 long sys_setgid ['gid_t gid']
 		case 214: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
@@ -1941,7 +2405,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 215 long sys_setfsuid ['uid_t uid']
 		case 215: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
@@ -1950,7 +2415,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 216 long sys_setfsgid ['gid_t gid']
 		case 216: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
@@ -1961,7 +2427,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getdents64_return)) {
+			if (PPP_CHECK_CB(on_sys_getdents64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1973,7 +2440,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 218: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_pivot_root_return)) {
+			if (PPP_CHECK_CB(on_sys_pivot_root_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1985,7 +2453,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mincore_return)) {
+			if (PPP_CHECK_CB(on_sys_mincore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1998,7 +2467,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_madvise_return)) {
+			if (PPP_CHECK_CB(on_sys_madvise_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2011,7 +2481,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fcntl64_return)) {
+			if (PPP_CHECK_CB(on_sys_fcntl64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2021,8 +2492,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 224 long sys_gettid ['void']
 		case 224: {
-			if (PPP_CHECK_CB(on_sys_gettid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_gettid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
 		}; break;
 		
@@ -2031,7 +2501,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readahead_return)) {
+			if (PPP_CHECK_CB(on_sys_readahead_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2046,7 +2517,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_setxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_setxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2063,7 +2535,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_lsetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lsetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2080,7 +2553,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_fsetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fsetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2096,7 +2570,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_getxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_getxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2111,7 +2586,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_lgetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lgetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2126,7 +2602,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fgetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fgetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2140,7 +2617,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_listxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_listxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2153,7 +2631,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_llistxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_llistxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2166,7 +2645,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_flistxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_flistxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2178,7 +2658,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 235: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_removexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_removexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2189,7 +2670,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 236: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_lremovexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lremovexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2200,7 +2682,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 237: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fremovexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fremovexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2211,7 +2694,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 238: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_tkill_return)) {
+			if (PPP_CHECK_CB(on_sys_tkill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -2224,7 +2708,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sendfile64_return)) {
+			if (PPP_CHECK_CB(on_sys_sendfile64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2241,7 +2726,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_futex_return)) {
+			if (PPP_CHECK_CB(on_sys_futex_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2257,7 +2743,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2270,7 +2757,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2282,7 +2770,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 243: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_io_setup_return)) {
+			if (PPP_CHECK_CB(on_sys_io_setup_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2292,7 +2781,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 244 long sys_io_destroy ['aio_context_t ctx']
 		case 244: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_io_destroy_return)) {
+			if (PPP_CHECK_CB(on_sys_io_destroy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
@@ -2305,7 +2795,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_io_getevents_return)) {
+			if (PPP_CHECK_CB(on_sys_io_getevents_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2320,7 +2811,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_io_submit_return)) {
+			if (PPP_CHECK_CB(on_sys_io_submit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2333,7 +2825,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_io_cancel_return)) {
+			if (PPP_CHECK_CB(on_sys_io_cancel_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2344,7 +2837,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 248 long sys_exit_group ['int error_code']
 		case 248: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_exit_group_return)) {
+			if (PPP_CHECK_CB(on_sys_exit_group_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
@@ -2355,7 +2849,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint64_t arg0 = get_64(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
+			if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint64_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2366,7 +2861,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 250 long sys_epoll_create ['int size']
 		case 250: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_epoll_create_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
@@ -2378,7 +2874,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2393,7 +2890,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_epoll_wait_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_wait_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2409,7 +2907,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
+			if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2422,7 +2921,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 256 long sys_set_tid_address ['int __user *tidptr']
 		case 256: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_set_tid_address_return)) {
+			if (PPP_CHECK_CB(on_sys_set_tid_address_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
@@ -2433,7 +2933,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_timer_create_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2447,7 +2948,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_timer_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2460,7 +2962,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 259: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timer_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2470,7 +2973,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 260 long sys_timer_getoverrun ['timer_t timer_id']
 		case 260: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
@@ -2479,7 +2983,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 261 long sys_timer_delete ['timer_t timer_id']
 		case 261: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_timer_delete_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_delete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
@@ -2489,7 +2994,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 262: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2500,7 +3006,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 263: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2511,7 +3018,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 264: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_getres_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_getres_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2524,7 +3032,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2538,7 +3047,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_statfs64_return)) {
+			if (PPP_CHECK_CB(on_sys_statfs64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2551,7 +3061,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fstatfs64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatfs64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2564,7 +3075,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_tgkill_return)) {
+			if (PPP_CHECK_CB(on_sys_tgkill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2576,7 +3088,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 269: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_utimes_return)) {
+			if (PPP_CHECK_CB(on_sys_utimes_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2589,7 +3102,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)) {
+			if (PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -2603,7 +3117,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_pciconfig_iobase_return)) {
+			if (PPP_CHECK_CB(on_sys_pciconfig_iobase_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2618,7 +3133,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_pciconfig_read_return)) {
+			if (PPP_CHECK_CB(on_sys_pciconfig_read_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2635,7 +3151,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_pciconfig_write_return)) {
+			if (PPP_CHECK_CB(on_sys_pciconfig_write_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2651,7 +3168,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_mq_open_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_open_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2663,7 +3181,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 275 long sys_mq_unlink ['const char __user *name']
 		case 275: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_mq_unlink_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_unlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
@@ -2676,7 +3195,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2693,7 +3213,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2707,7 +3228,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 278: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mq_notify_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_notify_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2719,7 +3241,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2734,7 +3257,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_waitid_return)) {
+			if (PPP_CHECK_CB(on_sys_waitid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2749,7 +3273,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_socket_return)) {
+			if (PPP_CHECK_CB(on_sys_socket_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2762,7 +3287,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_bind_return)) {
+			if (PPP_CHECK_CB(on_sys_bind_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2775,7 +3301,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_connect_return)) {
+			if (PPP_CHECK_CB(on_sys_connect_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2787,7 +3314,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 284: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_listen_return)) {
+			if (PPP_CHECK_CB(on_sys_listen_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -2799,7 +3327,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_accept_return)) {
+			if (PPP_CHECK_CB(on_sys_accept_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2812,7 +3341,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getsockname_return)) {
+			if (PPP_CHECK_CB(on_sys_getsockname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2825,7 +3355,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getpeername_return)) {
+			if (PPP_CHECK_CB(on_sys_getpeername_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2839,7 +3370,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_socketpair_return)) {
+			if (PPP_CHECK_CB(on_sys_socketpair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2854,7 +3386,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_send_return)) {
+			if (PPP_CHECK_CB(on_sys_send_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2871,7 +3404,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_sendto_return)) {
+			if (PPP_CHECK_CB(on_sys_sendto_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2888,7 +3422,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_recv_return)) {
+			if (PPP_CHECK_CB(on_sys_recv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2905,7 +3440,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_recvfrom_return)) {
+			if (PPP_CHECK_CB(on_sys_recvfrom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2920,7 +3456,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 293: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_shutdown_return)) {
+			if (PPP_CHECK_CB(on_sys_shutdown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -2934,7 +3471,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_setsockopt_return)) {
+			if (PPP_CHECK_CB(on_sys_setsockopt_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2951,7 +3489,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_getsockopt_return)) {
+			if (PPP_CHECK_CB(on_sys_getsockopt_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2966,7 +3505,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sendmsg_return)) {
+			if (PPP_CHECK_CB(on_sys_sendmsg_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2979,7 +3519,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_recvmsg_return)) {
+			if (PPP_CHECK_CB(on_sys_recvmsg_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2992,7 +3533,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_semop_return)) {
+			if (PPP_CHECK_CB(on_sys_semop_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3005,7 +3547,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_semget_return)) {
+			if (PPP_CHECK_CB(on_sys_semget_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3019,7 +3562,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_semctl_return)) {
+			if (PPP_CHECK_CB(on_sys_semctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3034,7 +3578,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_msgsnd_return)) {
+			if (PPP_CHECK_CB(on_sys_msgsnd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3050,7 +3595,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_msgrcv_return)) {
+			if (PPP_CHECK_CB(on_sys_msgrcv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3064,7 +3610,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 303: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_msgget_return)) {
+			if (PPP_CHECK_CB(on_sys_msgget_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3076,7 +3623,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_msgctl_return)) {
+			if (PPP_CHECK_CB(on_sys_msgctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3089,7 +3637,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_shmat_return)) {
+			if (PPP_CHECK_CB(on_sys_shmat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3100,7 +3649,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 306 long sys_shmdt ['char __user *shmaddr']
 		case 306: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_shmdt_return)) {
+			if (PPP_CHECK_CB(on_sys_shmdt_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
@@ -3111,7 +3661,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_shmget_return)) {
+			if (PPP_CHECK_CB(on_sys_shmget_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3124,7 +3675,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_shmctl_return)) {
+			if (PPP_CHECK_CB(on_sys_shmctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3139,7 +3691,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_add_key_return)) {
+			if (PPP_CHECK_CB(on_sys_add_key_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3155,7 +3708,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_request_key_return)) {
+			if (PPP_CHECK_CB(on_sys_request_key_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3171,7 +3725,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_keyctl_return)) {
+			if (PPP_CHECK_CB(on_sys_keyctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3187,7 +3742,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_semtimedop_return)) {
+			if (PPP_CHECK_CB(on_sys_semtimedop_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3201,7 +3757,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_ioprio_set_return)) {
+			if (PPP_CHECK_CB(on_sys_ioprio_set_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3213,7 +3770,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 315: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ioprio_get_return)) {
+			if (PPP_CHECK_CB(on_sys_ioprio_get_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3222,8 +3780,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 316 long sys_inotify_init ['void']
 		case 316: {
-			if (PPP_CHECK_CB(on_sys_inotify_init_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_inotify_init_return)) track_return = true;
 			PPP_RUN_CB(on_sys_inotify_init_enter, cpu, pc);
 		}; break;
 		
@@ -3232,7 +3789,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3244,7 +3802,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 318: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3259,7 +3818,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_mbind_return)) {
+			if (PPP_CHECK_CB(on_sys_mbind_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3277,7 +3837,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
+			if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3292,7 +3853,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
+			if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3306,7 +3868,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_openat_return)) {
+			if (PPP_CHECK_CB(on_sys_openat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3320,7 +3883,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mkdirat_return)) {
+			if (PPP_CHECK_CB(on_sys_mkdirat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3334,7 +3898,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_mknodat_return)) {
+			if (PPP_CHECK_CB(on_sys_mknodat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3350,7 +3915,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_fchownat_return)) {
+			if (PPP_CHECK_CB(on_sys_fchownat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3365,7 +3931,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_futimesat_return)) {
+			if (PPP_CHECK_CB(on_sys_futimesat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3379,7 +3946,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fstatat64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3393,7 +3961,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_unlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_unlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3407,7 +3976,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_renameat_return)) {
+			if (PPP_CHECK_CB(on_sys_renameat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3423,7 +3993,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_linkat_return)) {
+			if (PPP_CHECK_CB(on_sys_linkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3438,7 +4009,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_symlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_symlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3452,7 +4024,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_readlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_readlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3466,7 +4039,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchmodat_return)) {
+			if (PPP_CHECK_CB(on_sys_fchmodat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3479,7 +4053,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_faccessat_return)) {
+			if (PPP_CHECK_CB(on_sys_faccessat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3490,7 +4065,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 337 long sys_unshare ['unsigned long unshare_flags']
 		case 337: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_unshare_return)) {
+			if (PPP_CHECK_CB(on_sys_unshare_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
@@ -3500,7 +4076,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 338: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_set_robust_list_return)) {
+			if (PPP_CHECK_CB(on_sys_set_robust_list_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3512,7 +4089,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_get_robust_list_return)) {
+			if (PPP_CHECK_CB(on_sys_get_robust_list_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3528,7 +4106,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_splice_return)) {
+			if (PPP_CHECK_CB(on_sys_splice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3545,7 +4124,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sync_file_range2_return)) {
+			if (PPP_CHECK_CB(on_sys_sync_file_range2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -3560,7 +4140,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_tee_return)) {
+			if (PPP_CHECK_CB(on_sys_tee_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3575,7 +4156,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_vmsplice_return)) {
+			if (PPP_CHECK_CB(on_sys_vmsplice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3592,7 +4174,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_move_pages_return)) {
+			if (PPP_CHECK_CB(on_sys_move_pages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3608,7 +4191,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getcpu_return)) {
+			if (PPP_CHECK_CB(on_sys_getcpu_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3622,7 +4206,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_kexec_load_return)) {
+			if (PPP_CHECK_CB(on_sys_kexec_load_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3637,7 +4222,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_utimensat_return)) {
+			if (PPP_CHECK_CB(on_sys_utimensat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3651,7 +4237,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_signalfd_return)) {
+			if (PPP_CHECK_CB(on_sys_signalfd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3663,7 +4250,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 350: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timerfd_create_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3673,7 +4261,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 351 long sys_eventfd ['unsigned int count']
 		case 351: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_eventfd_return)) {
+			if (PPP_CHECK_CB(on_sys_eventfd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
@@ -3685,7 +4274,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fallocate_return)) {
+			if (PPP_CHECK_CB(on_sys_fallocate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -3700,7 +4290,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3713,7 +4304,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 354: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3726,7 +4318,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_signalfd4_return)) {
+			if (PPP_CHECK_CB(on_sys_signalfd4_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3739,7 +4332,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 356: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_eventfd2_return)) {
+			if (PPP_CHECK_CB(on_sys_eventfd2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3749,7 +4343,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 357 long sys_epoll_create1 ['int flags']
 		case 357: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_epoll_create1_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_create1_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
@@ -3760,7 +4355,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_dup3_return)) {
+			if (PPP_CHECK_CB(on_sys_dup3_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3772,7 +4368,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		case 359: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_pipe2_return)) {
+			if (PPP_CHECK_CB(on_sys_pipe2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3782,7 +4379,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		// 360 long sys_inotify_init1 ['int flags']
 		case 360: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_inotify_init1_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_init1_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
@@ -3790,8 +4388,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 10420225 long ARM_breakpoint ['']
 		case 10420225: {
-			if (PPP_CHECK_CB(on_ARM_breakpoint_return)) {
-			}
+			if (PPP_CHECK_CB(on_ARM_breakpoint_return)) track_return = true;
 			PPP_RUN_CB(on_ARM_breakpoint_enter, cpu, pc);
 		}; break;
 		
@@ -3800,7 +4397,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_ARM_cacheflush_return)) {
+			if (PPP_CHECK_CB(on_ARM_cacheflush_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3810,22 +4408,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 10420227 long ARM_user26_mode ['']
 		case 10420227: {
-			if (PPP_CHECK_CB(on_ARM_user26_mode_return)) {
-			}
+			if (PPP_CHECK_CB(on_ARM_user26_mode_return)) track_return = true;
 			PPP_RUN_CB(on_ARM_user26_mode_enter, cpu, pc);
 		}; break;
 		
 		// 10420228 long ARM_usr32_mode ['']
 		case 10420228: {
-			if (PPP_CHECK_CB(on_ARM_usr32_mode_return)) {
-			}
+			if (PPP_CHECK_CB(on_ARM_usr32_mode_return)) track_return = true;
 			PPP_RUN_CB(on_ARM_usr32_mode_enter, cpu, pc);
 		}; break;
 		
 		// 10420229 long ARM_set_tls ['unsigned long arg']
 		case 10420229: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_ARM_set_tls_return)) {
+			if (PPP_CHECK_CB(on_ARM_set_tls_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_ARM_set_tls_enter, cpu, pc, arg0);
@@ -3836,7 +4433,8 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_ARM_cmpxchg_return)) {
+			if (PPP_CHECK_CB(on_ARM_cmpxchg_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3846,16 +4444,20 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ulong pc) {
 		
 		// 10420224 long ARM_null_segfault ['']
 		case 10420224: {
-			if (PPP_CHECK_CB(on_ARM_null_segfault_return)) {
-			}
+			if (PPP_CHECK_CB(on_ARM_null_segfault_return)) track_return = true;
 			PPP_RUN_CB(on_ARM_null_segfault_enter, cpu, pc);
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[7]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[7]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,25 +10,367 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_linux_x86(CPUState *cpu) {
+#if defined(TARGET_I386)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[R_EAX];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_linux_x86(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_I386)
+	if (PPP_CHECK_CB(on_sys_restart_syscall_enter) || PPP_CHECK_CB(on_sys_restart_syscall_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_sys_exit_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_sys_fork_enter) || PPP_CHECK_CB(on_sys_fork_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_sys_read_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_sys_write_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_sys_open_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_sys_close_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_sys_waitpid_enter) || PPP_CHECK_CB(on_sys_waitpid_return)) syscall_subscribe(bitmap, 7);
+	if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_sys_creat_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_sys_link_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_sys_unlink_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_sys_execve_enter) || PPP_CHECK_CB(on_sys_execve_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_sys_chdir_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_sys_time_enter) || PPP_CHECK_CB(on_sys_time_return)) syscall_subscribe(bitmap, 13);
+	if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_sys_mknod_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_sys_chmod_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_sys_lchown16_enter) || PPP_CHECK_CB(on_sys_lchown16_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_sys_stat_enter) || PPP_CHECK_CB(on_sys_stat_return)) syscall_subscribe(bitmap, 18);
+	if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_sys_lseek_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_sys_getpid_enter) || PPP_CHECK_CB(on_sys_getpid_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_sys_mount_return)) syscall_subscribe(bitmap, 21);
+	if (PPP_CHECK_CB(on_sys_oldumount_enter) || PPP_CHECK_CB(on_sys_oldumount_return)) syscall_subscribe(bitmap, 22);
+	if (PPP_CHECK_CB(on_sys_setuid16_enter) || PPP_CHECK_CB(on_sys_setuid16_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_sys_getuid16_enter) || PPP_CHECK_CB(on_sys_getuid16_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_sys_stime_enter) || PPP_CHECK_CB(on_sys_stime_return)) syscall_subscribe(bitmap, 25);
+	if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_sys_ptrace_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_sys_alarm_enter) || PPP_CHECK_CB(on_sys_alarm_return)) syscall_subscribe(bitmap, 27);
+	if (PPP_CHECK_CB(on_sys_fstat_enter) || PPP_CHECK_CB(on_sys_fstat_return)) syscall_subscribe(bitmap, 28);
+	if (PPP_CHECK_CB(on_sys_pause_enter) || PPP_CHECK_CB(on_sys_pause_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_sys_utime_enter) || PPP_CHECK_CB(on_sys_utime_return)) syscall_subscribe(bitmap, 30);
+	if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_sys_access_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_sys_nice_enter) || PPP_CHECK_CB(on_sys_nice_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_sys_sync_enter) || PPP_CHECK_CB(on_sys_sync_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_sys_kill_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_sys_rename_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_sys_mkdir_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_sys_rmdir_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_sys_dup_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_sys_pipe_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_sys_times_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_sys_brk_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_sys_setgid16_enter) || PPP_CHECK_CB(on_sys_setgid16_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_sys_getgid16_enter) || PPP_CHECK_CB(on_sys_getgid16_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_sys_signal_enter) || PPP_CHECK_CB(on_sys_signal_return)) syscall_subscribe(bitmap, 48);
+	if (PPP_CHECK_CB(on_sys_geteuid16_enter) || PPP_CHECK_CB(on_sys_geteuid16_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_sys_getegid16_enter) || PPP_CHECK_CB(on_sys_getegid16_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_sys_acct_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_sys_umount_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_sys_ioctl_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_sys_fcntl_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_sys_setpgid_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_sys_olduname_enter) || PPP_CHECK_CB(on_sys_olduname_return)) syscall_subscribe(bitmap, 59);
+	if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_sys_umask_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_sys_chroot_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_sys_ustat_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_sys_dup2_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_sys_getppid_enter) || PPP_CHECK_CB(on_sys_getppid_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_sys_getpgrp_enter) || PPP_CHECK_CB(on_sys_getpgrp_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_sys_setsid_enter) || PPP_CHECK_CB(on_sys_setsid_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_sigaction_enter) || PPP_CHECK_CB(on_sigaction_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_sys_sgetmask_enter) || PPP_CHECK_CB(on_sys_sgetmask_return)) syscall_subscribe(bitmap, 68);
+	if (PPP_CHECK_CB(on_sys_ssetmask_enter) || PPP_CHECK_CB(on_sys_ssetmask_return)) syscall_subscribe(bitmap, 69);
+	if (PPP_CHECK_CB(on_sys_setreuid16_enter) || PPP_CHECK_CB(on_sys_setreuid16_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_sys_setregid16_enter) || PPP_CHECK_CB(on_sys_setregid16_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_sigsuspend_enter) || PPP_CHECK_CB(on_sigsuspend_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_sys_sigpending_enter) || PPP_CHECK_CB(on_sys_sigpending_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_sys_sethostname_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_sys_setrlimit_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_sys_old_getrlimit_enter) || PPP_CHECK_CB(on_sys_old_getrlimit_return)) syscall_subscribe(bitmap, 76);
+	if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_sys_getrusage_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_sys_gettimeofday_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_sys_settimeofday_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_sys_getgroups16_enter) || PPP_CHECK_CB(on_sys_getgroups16_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_sys_setgroups16_enter) || PPP_CHECK_CB(on_sys_setgroups16_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_sys_old_select_enter) || PPP_CHECK_CB(on_sys_old_select_return)) syscall_subscribe(bitmap, 82);
+	if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_sys_symlink_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_sys_lstat_enter) || PPP_CHECK_CB(on_sys_lstat_return)) syscall_subscribe(bitmap, 84);
+	if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_sys_readlink_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_sys_uselib_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_sys_swapon_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_sys_reboot_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_sys_old_readdir_enter) || PPP_CHECK_CB(on_sys_old_readdir_return)) syscall_subscribe(bitmap, 89);
+	if (PPP_CHECK_CB(on_sys_old_mmap_enter) || PPP_CHECK_CB(on_sys_old_mmap_return)) syscall_subscribe(bitmap, 90);
+	if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_sys_munmap_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_sys_truncate_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_sys_ftruncate_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_sys_fchmod_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_sys_fchown16_enter) || PPP_CHECK_CB(on_sys_fchown16_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_sys_getpriority_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_sys_setpriority_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_sys_statfs_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_sys_fstatfs_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_sys_ioperm_enter) || PPP_CHECK_CB(on_sys_ioperm_return)) syscall_subscribe(bitmap, 101);
+	if (PPP_CHECK_CB(on_sys_socketcall_enter) || PPP_CHECK_CB(on_sys_socketcall_return)) syscall_subscribe(bitmap, 102);
+	if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_sys_syslog_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_sys_setitimer_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_sys_getitimer_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_sys_newstat_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_sys_newlstat_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_sys_newfstat_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_sys_uname_enter) || PPP_CHECK_CB(on_sys_uname_return)) syscall_subscribe(bitmap, 109);
+	if (PPP_CHECK_CB(on_sys_iopl_enter) || PPP_CHECK_CB(on_sys_iopl_return)) syscall_subscribe(bitmap, 110);
+	if (PPP_CHECK_CB(on_sys_vhangup_enter) || PPP_CHECK_CB(on_sys_vhangup_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_sys_vm86old_enter) || PPP_CHECK_CB(on_sys_vm86old_return)) syscall_subscribe(bitmap, 113);
+	if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_sys_wait4_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_sys_swapoff_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_sys_sysinfo_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_sys_ipc_enter) || PPP_CHECK_CB(on_sys_ipc_return)) syscall_subscribe(bitmap, 117);
+	if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_sys_fsync_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_sys_sigreturn_enter) || PPP_CHECK_CB(on_sys_sigreturn_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_sys_clone_enter) || PPP_CHECK_CB(on_sys_clone_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_sys_setdomainname_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_sys_newuname_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_sys_modify_ldt_enter) || PPP_CHECK_CB(on_sys_modify_ldt_return)) syscall_subscribe(bitmap, 123);
+	if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_sys_adjtimex_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_sys_mprotect_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_sys_sigprocmask_enter) || PPP_CHECK_CB(on_sys_sigprocmask_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_sys_init_module_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_sys_delete_module_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_sys_quotactl_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_sys_getpgid_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_sys_fchdir_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_sys_bdflush_enter) || PPP_CHECK_CB(on_sys_bdflush_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_sys_sysfs_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_sys_personality_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_sys_setfsuid16_enter) || PPP_CHECK_CB(on_sys_setfsuid16_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_sys_setfsgid16_enter) || PPP_CHECK_CB(on_sys_setfsgid16_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_sys_llseek_enter) || PPP_CHECK_CB(on_sys_llseek_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_sys_getdents_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_sys_select_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_sys_flock_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_sys_msync_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_sys_readv_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_sys_writev_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_sys_getsid_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_sys_fdatasync_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_sys_sysctl_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_sys_mlock_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_sys_munlock_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_sys_mlockall_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_sys_munlockall_enter) || PPP_CHECK_CB(on_sys_munlockall_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_sys_sched_setparam_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_sys_sched_getparam_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_sys_sched_setscheduler_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_sys_sched_getscheduler_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_sys_sched_yield_enter) || PPP_CHECK_CB(on_sys_sched_yield_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_sys_nanosleep_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_sys_mremap_enter) || PPP_CHECK_CB(on_sys_mremap_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_sys_setresuid16_enter) || PPP_CHECK_CB(on_sys_setresuid16_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_sys_getresuid16_enter) || PPP_CHECK_CB(on_sys_getresuid16_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_sys_vm86_enter) || PPP_CHECK_CB(on_sys_vm86_return)) syscall_subscribe(bitmap, 166);
+	if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_sys_poll_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_sys_setresgid16_enter) || PPP_CHECK_CB(on_sys_setresgid16_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_sys_getresgid16_enter) || PPP_CHECK_CB(on_sys_getresgid16_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_sys_prctl_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_sys_rt_sigreturn_enter) || PPP_CHECK_CB(on_sys_rt_sigreturn_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_rt_sigaction_enter) || PPP_CHECK_CB(on_rt_sigaction_return)) syscall_subscribe(bitmap, 174);
+	if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_sys_rt_sigpending_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) syscall_subscribe(bitmap, 177);
+	if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_sys_pread64_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_sys_pwrite64_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_sys_chown16_enter) || PPP_CHECK_CB(on_sys_chown16_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_sys_getcwd_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_sys_capget_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_sys_capset_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_sys_sigaltstack_enter) || PPP_CHECK_CB(on_sys_sigaltstack_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_sys_sendfile_enter) || PPP_CHECK_CB(on_sys_sendfile_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_sys_vfork_enter) || PPP_CHECK_CB(on_sys_vfork_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_sys_getrlimit_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_sys_mmap_pgoff_enter) || PPP_CHECK_CB(on_sys_mmap_pgoff_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_sys_truncate64_enter) || PPP_CHECK_CB(on_sys_truncate64_return)) syscall_subscribe(bitmap, 193);
+	if (PPP_CHECK_CB(on_sys_ftruncate64_enter) || PPP_CHECK_CB(on_sys_ftruncate64_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_sys_stat64_enter) || PPP_CHECK_CB(on_sys_stat64_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_sys_lstat64_enter) || PPP_CHECK_CB(on_sys_lstat64_return)) syscall_subscribe(bitmap, 196);
+	if (PPP_CHECK_CB(on_sys_fstat64_enter) || PPP_CHECK_CB(on_sys_fstat64_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_sys_lchown_return)) syscall_subscribe(bitmap, 198);
+	if (PPP_CHECK_CB(on_sys_getuid_enter) || PPP_CHECK_CB(on_sys_getuid_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_sys_getgid_enter) || PPP_CHECK_CB(on_sys_getgid_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_sys_geteuid_enter) || PPP_CHECK_CB(on_sys_geteuid_return)) syscall_subscribe(bitmap, 201);
+	if (PPP_CHECK_CB(on_sys_getegid_enter) || PPP_CHECK_CB(on_sys_getegid_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_sys_setreuid_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_sys_setregid_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_sys_getgroups_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_sys_setgroups_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_sys_fchown_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_sys_setresuid_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_sys_getresuid_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_sys_setresgid_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_sys_getresgid_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_sys_chown_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_sys_setuid_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_sys_setgid_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_sys_setfsuid_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_sys_setfsgid_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_sys_pivot_root_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_sys_mincore_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_sys_madvise_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_sys_getdents64_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_sys_fcntl64_enter) || PPP_CHECK_CB(on_sys_fcntl64_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_sys_gettid_enter) || PPP_CHECK_CB(on_sys_gettid_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_sys_readahead_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_sys_setxattr_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_sys_lsetxattr_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_sys_fsetxattr_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_sys_getxattr_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_sys_lgetxattr_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_sys_fgetxattr_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_sys_listxattr_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_sys_llistxattr_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_sys_flistxattr_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_sys_removexattr_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_sys_lremovexattr_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_sys_fremovexattr_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_sys_tkill_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_sys_sendfile64_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_sys_futex_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_sys_sched_setaffinity_return)) syscall_subscribe(bitmap, 241);
+	if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_sys_sched_getaffinity_return)) syscall_subscribe(bitmap, 242);
+	if (PPP_CHECK_CB(on_set_thread_area_enter) || PPP_CHECK_CB(on_set_thread_area_return)) syscall_subscribe(bitmap, 243);
+	if (PPP_CHECK_CB(on_get_thread_area_enter) || PPP_CHECK_CB(on_get_thread_area_return)) syscall_subscribe(bitmap, 244);
+	if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_sys_io_setup_return)) syscall_subscribe(bitmap, 245);
+	if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_sys_io_destroy_return)) syscall_subscribe(bitmap, 246);
+	if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_sys_io_getevents_return)) syscall_subscribe(bitmap, 247);
+	if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_sys_io_submit_return)) syscall_subscribe(bitmap, 248);
+	if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_sys_io_cancel_return)) syscall_subscribe(bitmap, 249);
+	if (PPP_CHECK_CB(on_sys_fadvise64_enter) || PPP_CHECK_CB(on_sys_fadvise64_return)) syscall_subscribe(bitmap, 250);
+	if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_sys_exit_group_return)) syscall_subscribe(bitmap, 252);
+	if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_sys_lookup_dcookie_return)) syscall_subscribe(bitmap, 253);
+	if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_sys_epoll_create_return)) syscall_subscribe(bitmap, 254);
+	if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_sys_epoll_ctl_return)) syscall_subscribe(bitmap, 255);
+	if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_sys_epoll_wait_return)) syscall_subscribe(bitmap, 256);
+	if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_sys_remap_file_pages_return)) syscall_subscribe(bitmap, 257);
+	if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_sys_set_tid_address_return)) syscall_subscribe(bitmap, 258);
+	if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_sys_timer_create_return)) syscall_subscribe(bitmap, 259);
+	if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_sys_timer_settime_return)) syscall_subscribe(bitmap, 260);
+	if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_sys_timer_gettime_return)) syscall_subscribe(bitmap, 261);
+	if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_sys_timer_getoverrun_return)) syscall_subscribe(bitmap, 262);
+	if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_sys_timer_delete_return)) syscall_subscribe(bitmap, 263);
+	if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_sys_clock_settime_return)) syscall_subscribe(bitmap, 264);
+	if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_sys_clock_gettime_return)) syscall_subscribe(bitmap, 265);
+	if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_sys_clock_getres_return)) syscall_subscribe(bitmap, 266);
+	if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_sys_clock_nanosleep_return)) syscall_subscribe(bitmap, 267);
+	if (PPP_CHECK_CB(on_sys_statfs64_enter) || PPP_CHECK_CB(on_sys_statfs64_return)) syscall_subscribe(bitmap, 268);
+	if (PPP_CHECK_CB(on_sys_fstatfs64_enter) || PPP_CHECK_CB(on_sys_fstatfs64_return)) syscall_subscribe(bitmap, 269);
+	if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_sys_tgkill_return)) syscall_subscribe(bitmap, 270);
+	if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_sys_utimes_return)) syscall_subscribe(bitmap, 271);
+	if (PPP_CHECK_CB(on_sys_fadvise64_64_enter) || PPP_CHECK_CB(on_sys_fadvise64_64_return)) syscall_subscribe(bitmap, 272);
+	if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_sys_mbind_return)) syscall_subscribe(bitmap, 274);
+	if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_sys_get_mempolicy_return)) syscall_subscribe(bitmap, 275);
+	if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_sys_set_mempolicy_return)) syscall_subscribe(bitmap, 276);
+	if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_sys_mq_open_return)) syscall_subscribe(bitmap, 277);
+	if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_sys_mq_unlink_return)) syscall_subscribe(bitmap, 278);
+	if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_sys_mq_timedsend_return)) syscall_subscribe(bitmap, 279);
+	if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_sys_mq_timedreceive_return)) syscall_subscribe(bitmap, 280);
+	if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_sys_mq_notify_return)) syscall_subscribe(bitmap, 281);
+	if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_sys_mq_getsetattr_return)) syscall_subscribe(bitmap, 282);
+	if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_sys_kexec_load_return)) syscall_subscribe(bitmap, 283);
+	if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_sys_waitid_return)) syscall_subscribe(bitmap, 284);
+	if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_sys_add_key_return)) syscall_subscribe(bitmap, 286);
+	if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_sys_request_key_return)) syscall_subscribe(bitmap, 287);
+	if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_sys_keyctl_return)) syscall_subscribe(bitmap, 288);
+	if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_sys_ioprio_set_return)) syscall_subscribe(bitmap, 289);
+	if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_sys_ioprio_get_return)) syscall_subscribe(bitmap, 290);
+	if (PPP_CHECK_CB(on_sys_inotify_init_enter) || PPP_CHECK_CB(on_sys_inotify_init_return)) syscall_subscribe(bitmap, 291);
+	if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_sys_inotify_add_watch_return)) syscall_subscribe(bitmap, 292);
+	if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) syscall_subscribe(bitmap, 293);
+	if (PPP_CHECK_CB(on_sys_migrate_pages_enter) || PPP_CHECK_CB(on_sys_migrate_pages_return)) syscall_subscribe(bitmap, 294);
+	if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_sys_openat_return)) syscall_subscribe(bitmap, 295);
+	if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_sys_mkdirat_return)) syscall_subscribe(bitmap, 296);
+	if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_sys_mknodat_return)) syscall_subscribe(bitmap, 297);
+	if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_sys_fchownat_return)) syscall_subscribe(bitmap, 298);
+	if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_sys_futimesat_return)) syscall_subscribe(bitmap, 299);
+	if (PPP_CHECK_CB(on_sys_fstatat64_enter) || PPP_CHECK_CB(on_sys_fstatat64_return)) syscall_subscribe(bitmap, 300);
+	if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_sys_unlinkat_return)) syscall_subscribe(bitmap, 301);
+	if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_sys_renameat_return)) syscall_subscribe(bitmap, 302);
+	if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_sys_linkat_return)) syscall_subscribe(bitmap, 303);
+	if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_sys_symlinkat_return)) syscall_subscribe(bitmap, 304);
+	if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_sys_readlinkat_return)) syscall_subscribe(bitmap, 305);
+	if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_sys_fchmodat_return)) syscall_subscribe(bitmap, 306);
+	if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_sys_faccessat_return)) syscall_subscribe(bitmap, 307);
+	if (PPP_CHECK_CB(on_sys_pselect6_enter) || PPP_CHECK_CB(on_sys_pselect6_return)) syscall_subscribe(bitmap, 308);
+	if (PPP_CHECK_CB(on_sys_ppoll_enter) || PPP_CHECK_CB(on_sys_ppoll_return)) syscall_subscribe(bitmap, 309);
+	if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_sys_unshare_return)) syscall_subscribe(bitmap, 310);
+	if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_sys_set_robust_list_return)) syscall_subscribe(bitmap, 311);
+	if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_sys_get_robust_list_return)) syscall_subscribe(bitmap, 312);
+	if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_sys_splice_return)) syscall_subscribe(bitmap, 313);
+	if (PPP_CHECK_CB(on_sys_sync_file_range_enter) || PPP_CHECK_CB(on_sys_sync_file_range_return)) syscall_subscribe(bitmap, 314);
+	if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_sys_tee_return)) syscall_subscribe(bitmap, 315);
+	if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_sys_vmsplice_return)) syscall_subscribe(bitmap, 316);
+	if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_sys_move_pages_return)) syscall_subscribe(bitmap, 317);
+	if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_sys_getcpu_return)) syscall_subscribe(bitmap, 318);
+	if (PPP_CHECK_CB(on_sys_epoll_pwait_enter) || PPP_CHECK_CB(on_sys_epoll_pwait_return)) syscall_subscribe(bitmap, 319);
+	if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_sys_utimensat_return)) syscall_subscribe(bitmap, 320);
+	if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_sys_signalfd_return)) syscall_subscribe(bitmap, 321);
+	if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_sys_timerfd_create_return)) syscall_subscribe(bitmap, 322);
+	if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_sys_eventfd_return)) syscall_subscribe(bitmap, 323);
+	if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_sys_fallocate_return)) syscall_subscribe(bitmap, 324);
+	if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_sys_timerfd_settime_return)) syscall_subscribe(bitmap, 325);
+	if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_sys_timerfd_gettime_return)) syscall_subscribe(bitmap, 326);
+	if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_sys_signalfd4_return)) syscall_subscribe(bitmap, 327);
+	if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_sys_eventfd2_return)) syscall_subscribe(bitmap, 328);
+	if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_sys_epoll_create1_return)) syscall_subscribe(bitmap, 329);
+	if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_sys_dup3_return)) syscall_subscribe(bitmap, 330);
+	if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_sys_pipe2_return)) syscall_subscribe(bitmap, 331);
+	if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_sys_inotify_init1_return)) syscall_subscribe(bitmap, 332);
+	if (PPP_CHECK_CB(on_sys_preadv_enter) || PPP_CHECK_CB(on_sys_preadv_return)) syscall_subscribe(bitmap, 333);
+	if (PPP_CHECK_CB(on_sys_pwritev_enter) || PPP_CHECK_CB(on_sys_pwritev_return)) syscall_subscribe(bitmap, 334);
+	if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) || PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) syscall_subscribe(bitmap, 335);
+	if (PPP_CHECK_CB(on_sys_perf_event_open_enter) || PPP_CHECK_CB(on_sys_perf_event_open_return)) syscall_subscribe(bitmap, 336);
+	if (PPP_CHECK_CB(on_sys_recvmmsg_enter) || PPP_CHECK_CB(on_sys_recvmmsg_return)) syscall_subscribe(bitmap, 337);
+	if (PPP_CHECK_CB(on_sys_fanotify_init_enter) || PPP_CHECK_CB(on_sys_fanotify_init_return)) syscall_subscribe(bitmap, 338);
+	if (PPP_CHECK_CB(on_sys_fanotify_mark_enter) || PPP_CHECK_CB(on_sys_fanotify_mark_return)) syscall_subscribe(bitmap, 339);
+	if (PPP_CHECK_CB(on_sys_prlimit64_enter) || PPP_CHECK_CB(on_sys_prlimit64_return)) syscall_subscribe(bitmap, 340);
+	if (PPP_CHECK_CB(on_sys_name_to_handle_at_enter) || PPP_CHECK_CB(on_sys_name_to_handle_at_return)) syscall_subscribe(bitmap, 341);
+	if (PPP_CHECK_CB(on_sys_open_by_handle_at_enter) || PPP_CHECK_CB(on_sys_open_by_handle_at_return)) syscall_subscribe(bitmap, 342);
+	if (PPP_CHECK_CB(on_sys_clock_adjtime_enter) || PPP_CHECK_CB(on_sys_clock_adjtime_return)) syscall_subscribe(bitmap, 343);
+	if (PPP_CHECK_CB(on_sys_syncfs_enter) || PPP_CHECK_CB(on_sys_syncfs_return)) syscall_subscribe(bitmap, 344);
+	if (PPP_CHECK_CB(on_sys_sendmmsg_enter) || PPP_CHECK_CB(on_sys_sendmmsg_return)) syscall_subscribe(bitmap, 345);
+	if (PPP_CHECK_CB(on_sys_setns_enter) || PPP_CHECK_CB(on_sys_setns_return)) syscall_subscribe(bitmap, 346);
+	if (PPP_CHECK_CB(on_sys_process_vm_readv_enter) || PPP_CHECK_CB(on_sys_process_vm_readv_return)) syscall_subscribe(bitmap, 347);
+	if (PPP_CHECK_CB(on_sys_process_vm_writev_enter) || PPP_CHECK_CB(on_sys_process_vm_writev_return)) syscall_subscribe(bitmap, 348);
+#endif
+}
+
 void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[R_EAX];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[R_EAX]) {
 		// 0 long sys_restart_syscall ['void']
 		case 0: {
-			if (PPP_CHECK_CB(on_sys_restart_syscall_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_restart_syscall_return)) track_return = true;
 			PPP_RUN_CB(on_sys_restart_syscall_enter, cpu, pc);
 		}; break;
 		
 		// 1 long sys_exit ['int error_code']
 		case 1: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_exit_return)) {
+			if (PPP_CHECK_CB(on_sys_exit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
@@ -36,8 +378,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 2 pid_t sys_fork ['']
 		case 2: {
-			if (PPP_CHECK_CB(on_sys_fork_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_fork_return)) track_return = true;
 			PPP_RUN_CB(on_sys_fork_enter, cpu, pc);
 		}; break;
 		
@@ -46,7 +387,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_read_return)) {
+			if (PPP_CHECK_CB(on_sys_read_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -59,7 +401,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_write_return)) {
+			if (PPP_CHECK_CB(on_sys_write_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -72,7 +415,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_open_return)) {
+			if (PPP_CHECK_CB(on_sys_open_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -83,7 +427,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 6 long sys_close ['unsigned int fd']
 		case 6: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_close_return)) {
+			if (PPP_CHECK_CB(on_sys_close_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
@@ -94,7 +439,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_waitpid_return)) {
+			if (PPP_CHECK_CB(on_sys_waitpid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -106,7 +452,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 8: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_creat_return)) {
+			if (PPP_CHECK_CB(on_sys_creat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -117,7 +464,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 9: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_link_return)) {
+			if (PPP_CHECK_CB(on_sys_link_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -127,7 +475,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 10 long sys_unlink ['const char __user *pathname']
 		case 10: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_unlink_return)) {
+			if (PPP_CHECK_CB(on_sys_unlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
@@ -138,7 +487,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_execve_return)) {
+			if (PPP_CHECK_CB(on_sys_execve_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -149,7 +499,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 12 long sys_chdir ['const char __user *filename']
 		case 12: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_chdir_return)) {
+			if (PPP_CHECK_CB(on_sys_chdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
@@ -158,7 +509,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 13 long sys_time ['time_t __user *tloc']
 		case 13: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_time_return)) {
+			if (PPP_CHECK_CB(on_sys_time_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_time_enter, cpu, pc, arg0);
@@ -169,7 +521,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mknod_return)) {
+			if (PPP_CHECK_CB(on_sys_mknod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -181,7 +534,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 15: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_chmod_return)) {
+			if (PPP_CHECK_CB(on_sys_chmod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -193,7 +547,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lchown16_return)) {
+			if (PPP_CHECK_CB(on_sys_lchown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -205,7 +560,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 18: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_stat_return)) {
+			if (PPP_CHECK_CB(on_sys_stat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -217,7 +573,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lseek_return)) {
+			if (PPP_CHECK_CB(on_sys_lseek_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -227,8 +584,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 20 long sys_getpid ['void']
 		case 20: {
-			if (PPP_CHECK_CB(on_sys_getpid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getpid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getpid_enter, cpu, pc);
 		}; break;
 		
@@ -239,7 +595,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mount_return)) {
+			if (PPP_CHECK_CB(on_sys_mount_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -252,7 +609,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 22 long sys_oldumount ['char __user *name']
 		case 22: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_oldumount_return)) {
+			if (PPP_CHECK_CB(on_sys_oldumount_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_oldumount_enter, cpu, pc, arg0);
@@ -261,7 +619,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 23 long sys_setuid16 ['old_uid_t uid']
 		case 23: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setuid16_enter, cpu, pc, arg0);
@@ -269,15 +628,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 24 long sys_getuid16 ['void']
 		case 24: {
-			if (PPP_CHECK_CB(on_sys_getuid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getuid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getuid16_enter, cpu, pc);
 		}; break;
 		
 		// 25 long sys_stime ['time_t __user *tptr']
 		case 25: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_stime_return)) {
+			if (PPP_CHECK_CB(on_sys_stime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_stime_enter, cpu, pc, arg0);
@@ -289,7 +648,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_ptrace_return)) {
+			if (PPP_CHECK_CB(on_sys_ptrace_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -301,7 +661,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 27 long sys_alarm ['unsigned int seconds']
 		case 27: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_alarm_return)) {
+			if (PPP_CHECK_CB(on_sys_alarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_alarm_enter, cpu, pc, arg0);
@@ -311,7 +672,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 28: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fstat_return)) {
+			if (PPP_CHECK_CB(on_sys_fstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -320,8 +682,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 29 long sys_pause ['void']
 		case 29: {
-			if (PPP_CHECK_CB(on_sys_pause_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_pause_return)) track_return = true;
 			PPP_RUN_CB(on_sys_pause_enter, cpu, pc);
 		}; break;
 		
@@ -329,7 +690,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 30: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_utime_return)) {
+			if (PPP_CHECK_CB(on_sys_utime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -340,7 +702,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 33: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_access_return)) {
+			if (PPP_CHECK_CB(on_sys_access_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -350,7 +713,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 34 long sys_nice ['int increment']
 		case 34: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_nice_return)) {
+			if (PPP_CHECK_CB(on_sys_nice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
@@ -358,8 +722,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 36 long sys_sync ['void']
 		case 36: {
-			if (PPP_CHECK_CB(on_sys_sync_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_sync_return)) track_return = true;
 			PPP_RUN_CB(on_sys_sync_enter, cpu, pc);
 		}; break;
 		
@@ -367,7 +730,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 37: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_kill_return)) {
+			if (PPP_CHECK_CB(on_sys_kill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -378,7 +742,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 38: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rename_return)) {
+			if (PPP_CHECK_CB(on_sys_rename_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -389,7 +754,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 39: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mkdir_return)) {
+			if (PPP_CHECK_CB(on_sys_mkdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -399,7 +765,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 40 long sys_rmdir ['const char __user *pathname']
 		case 40: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_rmdir_return)) {
+			if (PPP_CHECK_CB(on_sys_rmdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
@@ -408,7 +775,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 41 long sys_dup ['unsigned int fildes']
 		case 41: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_dup_return)) {
+			if (PPP_CHECK_CB(on_sys_dup_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
@@ -417,7 +785,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 42 long sys_pipe ['int __user *fildes']
 		case 42: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_pipe_return)) {
+			if (PPP_CHECK_CB(on_sys_pipe_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
@@ -426,7 +795,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 43 long sys_times ['struct tms __user *tbuf']
 		case 43: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_times_return)) {
+			if (PPP_CHECK_CB(on_sys_times_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
@@ -435,7 +805,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 45 long sys_brk ['unsigned long brk']
 		case 45: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_brk_return)) {
+			if (PPP_CHECK_CB(on_sys_brk_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
@@ -444,7 +815,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 46 long sys_setgid16 ['old_gid_t gid']
 		case 46: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setgid16_enter, cpu, pc, arg0);
@@ -452,8 +824,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 47 long sys_getgid16 ['void']
 		case 47: {
-			if (PPP_CHECK_CB(on_sys_getgid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getgid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getgid16_enter, cpu, pc);
 		}; break;
 		
@@ -461,7 +832,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 48: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_signal_return)) {
+			if (PPP_CHECK_CB(on_sys_signal_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -470,22 +842,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 49 long sys_geteuid16 ['void']
 		case 49: {
-			if (PPP_CHECK_CB(on_sys_geteuid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_geteuid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_geteuid16_enter, cpu, pc);
 		}; break;
 		
 		// 50 long sys_getegid16 ['void']
 		case 50: {
-			if (PPP_CHECK_CB(on_sys_getegid16_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getegid16_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getegid16_enter, cpu, pc);
 		}; break;
 		
 		// 51 long sys_acct ['const char __user *name']
 		case 51: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_acct_return)) {
+			if (PPP_CHECK_CB(on_sys_acct_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
@@ -495,7 +866,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 52: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_umount_return)) {
+			if (PPP_CHECK_CB(on_sys_umount_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -507,7 +879,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_ioctl_return)) {
+			if (PPP_CHECK_CB(on_sys_ioctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -520,7 +893,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fcntl_return)) {
+			if (PPP_CHECK_CB(on_sys_fcntl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -532,7 +906,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setpgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setpgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -542,7 +917,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 59 long sys_olduname ['struct oldold_utsname __user *']
 		case 59: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_olduname_return)) {
+			if (PPP_CHECK_CB(on_sys_olduname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_olduname_enter, cpu, pc, arg0);
@@ -551,7 +927,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 60 long sys_umask ['int mask']
 		case 60: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_umask_return)) {
+			if (PPP_CHECK_CB(on_sys_umask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
@@ -560,7 +937,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 61 long sys_chroot ['const char __user *filename']
 		case 61: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_chroot_return)) {
+			if (PPP_CHECK_CB(on_sys_chroot_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
@@ -570,7 +948,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 62: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ustat_return)) {
+			if (PPP_CHECK_CB(on_sys_ustat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -581,7 +960,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 63: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_dup2_return)) {
+			if (PPP_CHECK_CB(on_sys_dup2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -590,22 +970,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 64 long sys_getppid ['void']
 		case 64: {
-			if (PPP_CHECK_CB(on_sys_getppid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getppid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getppid_enter, cpu, pc);
 		}; break;
 		
 		// 65 long sys_getpgrp ['void']
 		case 65: {
-			if (PPP_CHECK_CB(on_sys_getpgrp_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getpgrp_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getpgrp_enter, cpu, pc);
 		}; break;
 		
 		// 66 long sys_setsid ['void']
 		case 66: {
-			if (PPP_CHECK_CB(on_sys_setsid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_setsid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_setsid_enter, cpu, pc);
 		}; break;
 		
@@ -614,7 +991,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sigaction_return)) {
+			if (PPP_CHECK_CB(on_sigaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -624,15 +1002,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 68 long sys_sgetmask ['void']
 		case 68: {
-			if (PPP_CHECK_CB(on_sys_sgetmask_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_sgetmask_return)) track_return = true;
 			PPP_RUN_CB(on_sys_sgetmask_enter, cpu, pc);
 		}; break;
 		
 		// 69 long sys_ssetmask ['int newmask']
 		case 69: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_ssetmask_return)) {
+			if (PPP_CHECK_CB(on_sys_ssetmask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_ssetmask_enter, cpu, pc, arg0);
@@ -642,7 +1020,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 70: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setreuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setreuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -653,7 +1032,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 71: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setregid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setregid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -665,7 +1045,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sigsuspend_return)) {
+			if (PPP_CHECK_CB(on_sigsuspend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -676,7 +1057,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 73 long sys_sigpending ['old_sigset_t __user *set']
 		case 73: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sigpending_return)) {
+			if (PPP_CHECK_CB(on_sys_sigpending_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
@@ -686,7 +1068,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 74: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sethostname_return)) {
+			if (PPP_CHECK_CB(on_sys_sethostname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -697,7 +1080,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 75: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setrlimit_return)) {
+			if (PPP_CHECK_CB(on_sys_setrlimit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -708,7 +1092,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 76: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_old_getrlimit_return)) {
+			if (PPP_CHECK_CB(on_sys_old_getrlimit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -719,7 +1104,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 77: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getrusage_return)) {
+			if (PPP_CHECK_CB(on_sys_getrusage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -730,7 +1116,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 78: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_gettimeofday_return)) {
+			if (PPP_CHECK_CB(on_sys_gettimeofday_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -741,7 +1128,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 79: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_settimeofday_return)) {
+			if (PPP_CHECK_CB(on_sys_settimeofday_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -752,7 +1140,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 80: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getgroups16_return)) {
+			if (PPP_CHECK_CB(on_sys_getgroups16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -763,7 +1152,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 81: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setgroups16_return)) {
+			if (PPP_CHECK_CB(on_sys_setgroups16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -773,7 +1163,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 82 long sys_old_select ['struct sel_arg_struct __user *arg']
 		case 82: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_old_select_return)) {
+			if (PPP_CHECK_CB(on_sys_old_select_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_old_select_enter, cpu, pc, arg0);
@@ -783,7 +1174,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 83: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_symlink_return)) {
+			if (PPP_CHECK_CB(on_sys_symlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -794,7 +1186,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 84: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_lstat_return)) {
+			if (PPP_CHECK_CB(on_sys_lstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -806,7 +1199,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readlink_return)) {
+			if (PPP_CHECK_CB(on_sys_readlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -817,7 +1211,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 86 long sys_uselib ['const char __user *library']
 		case 86: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_uselib_return)) {
+			if (PPP_CHECK_CB(on_sys_uselib_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
@@ -827,7 +1222,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 87: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_swapon_return)) {
+			if (PPP_CHECK_CB(on_sys_swapon_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -840,7 +1236,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_reboot_return)) {
+			if (PPP_CHECK_CB(on_sys_reboot_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -854,7 +1251,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_old_readdir_return)) {
+			if (PPP_CHECK_CB(on_sys_old_readdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -865,7 +1263,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 90 long sys_old_mmap ['struct mmap_arg_struct __user *arg']
 		case 90: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_old_mmap_return)) {
+			if (PPP_CHECK_CB(on_sys_old_mmap_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_old_mmap_enter, cpu, pc, arg0);
@@ -875,7 +1274,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 91: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_munmap_return)) {
+			if (PPP_CHECK_CB(on_sys_munmap_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -886,7 +1286,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 92: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_truncate_return)) {
+			if (PPP_CHECK_CB(on_sys_truncate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -897,7 +1298,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 93: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ftruncate_return)) {
+			if (PPP_CHECK_CB(on_sys_ftruncate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -908,7 +1310,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 94: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fchmod_return)) {
+			if (PPP_CHECK_CB(on_sys_fchmod_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -920,7 +1323,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchown16_return)) {
+			if (PPP_CHECK_CB(on_sys_fchown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -932,7 +1336,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 96: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getpriority_return)) {
+			if (PPP_CHECK_CB(on_sys_getpriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -944,7 +1349,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setpriority_return)) {
+			if (PPP_CHECK_CB(on_sys_setpriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -956,7 +1362,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 99: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_statfs_return)) {
+			if (PPP_CHECK_CB(on_sys_statfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -967,7 +1374,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 100: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fstatfs_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -979,7 +1387,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_ioperm_return)) {
+			if (PPP_CHECK_CB(on_sys_ioperm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -991,7 +1400,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 102: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_socketcall_return)) {
+			if (PPP_CHECK_CB(on_sys_socketcall_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1003,7 +1413,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_syslog_return)) {
+			if (PPP_CHECK_CB(on_sys_syslog_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1016,7 +1427,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setitimer_return)) {
+			if (PPP_CHECK_CB(on_sys_setitimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1028,7 +1440,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 105: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getitimer_return)) {
+			if (PPP_CHECK_CB(on_sys_getitimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1039,7 +1452,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 106: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1050,7 +1464,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 107: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newlstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newlstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1061,7 +1476,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 108: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_newfstat_return)) {
+			if (PPP_CHECK_CB(on_sys_newfstat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1071,7 +1487,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 109 long sys_uname ['struct old_utsname __user *']
 		case 109: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_uname_return)) {
+			if (PPP_CHECK_CB(on_sys_uname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
@@ -1080,7 +1497,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 110 int sys_iopl ['int level']
 		case 110: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_iopl_return)) {
+			if (PPP_CHECK_CB(on_sys_iopl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_iopl_enter, cpu, pc, arg0);
@@ -1088,15 +1506,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 111 long sys_vhangup ['void']
 		case 111: {
-			if (PPP_CHECK_CB(on_sys_vhangup_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_vhangup_return)) track_return = true;
 			PPP_RUN_CB(on_sys_vhangup_enter, cpu, pc);
 		}; break;
 		
 		// 113 int sys_vm86old ['struct vm86_struct *info']
 		case 113: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_vm86old_return)) {
+			if (PPP_CHECK_CB(on_sys_vm86old_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_vm86old_enter, cpu, pc, arg0);
@@ -1108,7 +1526,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_wait4_return)) {
+			if (PPP_CHECK_CB(on_sys_wait4_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1120,7 +1539,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 115 long sys_swapoff ['const char __user *specialfile']
 		case 115: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_swapoff_return)) {
+			if (PPP_CHECK_CB(on_sys_swapoff_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
@@ -1129,7 +1549,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 116 long sys_sysinfo ['struct sysinfo __user *info']
 		case 116: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sysinfo_return)) {
+			if (PPP_CHECK_CB(on_sys_sysinfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
@@ -1143,7 +1564,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_ipc_return)) {
+			if (PPP_CHECK_CB(on_sys_ipc_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1157,7 +1579,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 118 long sys_fsync ['unsigned int fd']
 		case 118: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fsync_return)) {
+			if (PPP_CHECK_CB(on_sys_fsync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
@@ -1166,7 +1589,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 119 int sys_sigreturn ['unsigned long __unused']
 		case 119: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sigreturn_return)) {
+			if (PPP_CHECK_CB(on_sys_sigreturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sigreturn_enter, cpu, pc, arg0);
@@ -1179,7 +1603,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_clone_return)) {
+			if (PPP_CHECK_CB(on_sys_clone_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1193,7 +1618,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 121: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setdomainname_return)) {
+			if (PPP_CHECK_CB(on_sys_setdomainname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -1203,7 +1629,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 122 long sys_newuname ['struct new_utsname __user *name']
 		case 122: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_newuname_return)) {
+			if (PPP_CHECK_CB(on_sys_newuname_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
@@ -1214,7 +1641,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_modify_ldt_return)) {
+			if (PPP_CHECK_CB(on_sys_modify_ldt_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1225,7 +1653,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 124 long sys_adjtimex ['struct timex __user *txc_p']
 		case 124: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_adjtimex_return)) {
+			if (PPP_CHECK_CB(on_sys_adjtimex_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
@@ -1236,7 +1665,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mprotect_return)) {
+			if (PPP_CHECK_CB(on_sys_mprotect_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1249,7 +1679,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sigprocmask_return)) {
+			if (PPP_CHECK_CB(on_sys_sigprocmask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1262,7 +1693,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_init_module_return)) {
+			if (PPP_CHECK_CB(on_sys_init_module_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1274,7 +1706,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 129: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_delete_module_return)) {
+			if (PPP_CHECK_CB(on_sys_delete_module_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1287,7 +1720,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_quotactl_return)) {
+			if (PPP_CHECK_CB(on_sys_quotactl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1299,7 +1733,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 132 long sys_getpgid ['pid_t pid']
 		case 132: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_getpgid_return)) {
+			if (PPP_CHECK_CB(on_sys_getpgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
@@ -1308,7 +1743,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 133 long sys_fchdir ['unsigned int fd']
 		case 133: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fchdir_return)) {
+			if (PPP_CHECK_CB(on_sys_fchdir_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
@@ -1318,7 +1754,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 134: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_bdflush_return)) {
+			if (PPP_CHECK_CB(on_sys_bdflush_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -1330,7 +1767,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sysfs_return)) {
+			if (PPP_CHECK_CB(on_sys_sysfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1341,7 +1779,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 136 long sys_personality ['unsigned int personality']
 		case 136: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_personality_return)) {
+			if (PPP_CHECK_CB(on_sys_personality_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
@@ -1350,7 +1789,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 138 long sys_setfsuid16 ['old_uid_t uid']
 		case 138: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsuid16_enter, cpu, pc, arg0);
@@ -1359,7 +1799,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 139 long sys_setfsgid16 ['old_gid_t gid']
 		case 139: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsgid16_enter, cpu, pc, arg0);
@@ -1372,7 +1813,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_llseek_return)) {
+			if (PPP_CHECK_CB(on_sys_llseek_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1387,7 +1829,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getdents_return)) {
+			if (PPP_CHECK_CB(on_sys_getdents_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1402,7 +1845,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_select_return)) {
+			if (PPP_CHECK_CB(on_sys_select_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1416,7 +1860,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 143: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_flock_return)) {
+			if (PPP_CHECK_CB(on_sys_flock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1428,7 +1873,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_msync_return)) {
+			if (PPP_CHECK_CB(on_sys_msync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1441,7 +1887,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readv_return)) {
+			if (PPP_CHECK_CB(on_sys_readv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1454,7 +1901,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_writev_return)) {
+			if (PPP_CHECK_CB(on_sys_writev_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1465,7 +1913,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 147 long sys_getsid ['pid_t pid']
 		case 147: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_getsid_return)) {
+			if (PPP_CHECK_CB(on_sys_getsid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
@@ -1474,7 +1923,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 148 long sys_fdatasync ['unsigned int fd']
 		case 148: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_fdatasync_return)) {
+			if (PPP_CHECK_CB(on_sys_fdatasync_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
@@ -1483,7 +1933,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 149 long sys_sysctl ['struct __sysctl_args __user *args']
 		case 149: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sysctl_return)) {
+			if (PPP_CHECK_CB(on_sys_sysctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
@@ -1493,7 +1944,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 150: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mlock_return)) {
+			if (PPP_CHECK_CB(on_sys_mlock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1504,7 +1956,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 151: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_munlock_return)) {
+			if (PPP_CHECK_CB(on_sys_munlock_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1514,7 +1967,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 152 long sys_mlockall ['int flags']
 		case 152: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_mlockall_return)) {
+			if (PPP_CHECK_CB(on_sys_mlockall_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
@@ -1522,8 +1976,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 153 long sys_munlockall ['void']
 		case 153: {
-			if (PPP_CHECK_CB(on_sys_munlockall_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_munlockall_return)) track_return = true;
 			PPP_RUN_CB(on_sys_munlockall_enter, cpu, pc);
 		}; break;
 		
@@ -1531,7 +1984,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 154: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_setparam_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setparam_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1542,7 +1996,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 155: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_getparam_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getparam_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1554,7 +2009,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setscheduler_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1565,7 +2021,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 157 long sys_sched_getscheduler ['pid_t pid']
 		case 157: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getscheduler_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
@@ -1573,15 +2030,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 158 long sys_sched_yield ['void']
 		case 158: {
-			if (PPP_CHECK_CB(on_sys_sched_yield_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_sched_yield_return)) track_return = true;
 			PPP_RUN_CB(on_sys_sched_yield_enter, cpu, pc);
 		}; break;
 		
 		// 159 long sys_sched_get_priority_max ['int policy']
 		case 159: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_get_priority_max_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
@@ -1590,7 +2047,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 160 long sys_sched_get_priority_min ['int policy']
 		case 160: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_get_priority_min_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
@@ -1600,7 +2058,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 161: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1611,7 +2070,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 162: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_nanosleep_return)) {
+			if (PPP_CHECK_CB(on_sys_nanosleep_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1625,7 +2085,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mremap_return)) {
+			if (PPP_CHECK_CB(on_sys_mremap_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1640,7 +2101,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setresuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1653,7 +2115,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresuid16_return)) {
+			if (PPP_CHECK_CB(on_sys_getresuid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1665,7 +2128,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 166: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_vm86_return)) {
+			if (PPP_CHECK_CB(on_sys_vm86_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1677,7 +2141,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_poll_return)) {
+			if (PPP_CHECK_CB(on_sys_poll_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -1690,7 +2155,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_setresgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1703,7 +2169,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresgid16_return)) {
+			if (PPP_CHECK_CB(on_sys_getresgid16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1718,7 +2185,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_prctl_return)) {
+			if (PPP_CHECK_CB(on_sys_prctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1731,7 +2199,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 173 int sys_rt_sigreturn ['unsigned long __unused']
 		case 173: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_rt_sigreturn_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigreturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_rt_sigreturn_enter, cpu, pc, arg0);
@@ -1743,7 +2212,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_rt_sigaction_return)) {
+			if (PPP_CHECK_CB(on_rt_sigaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1758,7 +2228,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigprocmask_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1771,7 +2242,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 176: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigpending_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1784,7 +2256,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1798,7 +2271,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1810,7 +2284,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 179: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_sigsuspend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1823,7 +2298,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_pread64_return)) {
+			if (PPP_CHECK_CB(on_sys_pread64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1838,7 +2314,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_pwrite64_return)) {
+			if (PPP_CHECK_CB(on_sys_pwrite64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1852,7 +2329,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_chown16_return)) {
+			if (PPP_CHECK_CB(on_sys_chown16_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1864,7 +2342,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 183: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getcwd_return)) {
+			if (PPP_CHECK_CB(on_sys_getcwd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1875,7 +2354,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 184: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_capget_return)) {
+			if (PPP_CHECK_CB(on_sys_capget_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1886,7 +2366,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 185: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_capset_return)) {
+			if (PPP_CHECK_CB(on_sys_capset_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1897,7 +2378,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 186: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_sigaltstack_return)) {
+			if (PPP_CHECK_CB(on_sys_sigaltstack_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1910,7 +2392,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sendfile_return)) {
+			if (PPP_CHECK_CB(on_sys_sendfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1921,8 +2404,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 190 pid_t sys_vfork ['']
 		case 190: {
-			if (PPP_CHECK_CB(on_sys_vfork_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_vfork_return)) track_return = true;
 			PPP_RUN_CB(on_sys_vfork_enter, cpu, pc);
 		}; break;
 		
@@ -1930,7 +2412,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 191: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getrlimit_return)) {
+			if (PPP_CHECK_CB(on_sys_getrlimit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1945,7 +2428,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_mmap_pgoff_return)) {
+			if (PPP_CHECK_CB(on_sys_mmap_pgoff_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1960,7 +2444,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 193: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_truncate64_return)) {
+			if (PPP_CHECK_CB(on_sys_truncate64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 			}
@@ -1971,7 +2456,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 194: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ftruncate64_return)) {
+			if (PPP_CHECK_CB(on_sys_ftruncate64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 			}
@@ -1982,7 +2468,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 195: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_stat64_return)) {
+			if (PPP_CHECK_CB(on_sys_stat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1993,7 +2480,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 196: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_lstat64_return)) {
+			if (PPP_CHECK_CB(on_sys_lstat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2004,7 +2492,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 197: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fstat64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2016,7 +2505,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lchown_return)) {
+			if (PPP_CHECK_CB(on_sys_lchown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2026,29 +2516,25 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 199 long sys_getuid ['void']
 		case 199: {
-			if (PPP_CHECK_CB(on_sys_getuid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getuid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getuid_enter, cpu, pc);
 		}; break;
 		
 		// 200 long sys_getgid ['void']
 		case 200: {
-			if (PPP_CHECK_CB(on_sys_getgid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getgid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getgid_enter, cpu, pc);
 		}; break;
 		
 		// 201 long sys_geteuid ['void']
 		case 201: {
-			if (PPP_CHECK_CB(on_sys_geteuid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_geteuid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_geteuid_enter, cpu, pc);
 		}; break;
 		
 		// 202 long sys_getegid ['void']
 		case 202: {
-			if (PPP_CHECK_CB(on_sys_getegid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_getegid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_getegid_enter, cpu, pc);
 		}; break;
 		
@@ -2056,7 +2542,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 203: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setreuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setreuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2067,7 +2554,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 204: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setregid_return)) {
+			if (PPP_CHECK_CB(on_sys_setregid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2078,7 +2566,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 205: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_getgroups_return)) {
+			if (PPP_CHECK_CB(on_sys_getgroups_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2089,7 +2578,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 206: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setgroups_return)) {
+			if (PPP_CHECK_CB(on_sys_setgroups_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2101,7 +2591,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchown_return)) {
+			if (PPP_CHECK_CB(on_sys_fchown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2114,7 +2605,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setresuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2127,7 +2619,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresuid_return)) {
+			if (PPP_CHECK_CB(on_sys_getresuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2140,7 +2633,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_setresgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setresgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2153,7 +2647,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getresgid_return)) {
+			if (PPP_CHECK_CB(on_sys_getresgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2166,7 +2661,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_chown_return)) {
+			if (PPP_CHECK_CB(on_sys_chown_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2177,7 +2673,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 213 long sys_setuid ['uid_t uid']
 		case 213: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
@@ -2186,7 +2683,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 214 long sys_setgid ['gid_t gid']
 		case 214: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
@@ -2195,7 +2693,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 215 long sys_setfsuid ['uid_t uid']
 		case 215: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsuid_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsuid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
@@ -2204,7 +2703,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 216 long sys_setfsgid ['gid_t gid']
 		case 216: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_setfsgid_return)) {
+			if (PPP_CHECK_CB(on_sys_setfsgid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
@@ -2214,7 +2714,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 217: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_pivot_root_return)) {
+			if (PPP_CHECK_CB(on_sys_pivot_root_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2226,7 +2727,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mincore_return)) {
+			if (PPP_CHECK_CB(on_sys_mincore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2239,7 +2741,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_madvise_return)) {
+			if (PPP_CHECK_CB(on_sys_madvise_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2252,7 +2755,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getdents64_return)) {
+			if (PPP_CHECK_CB(on_sys_getdents64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2265,7 +2769,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fcntl64_return)) {
+			if (PPP_CHECK_CB(on_sys_fcntl64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2275,8 +2780,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 224 long sys_gettid ['void']
 		case 224: {
-			if (PPP_CHECK_CB(on_sys_gettid_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_gettid_return)) track_return = true;
 			PPP_RUN_CB(on_sys_gettid_enter, cpu, pc);
 		}; break;
 		
@@ -2285,7 +2789,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint64_t arg1 = get_64(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_readahead_return)) {
+			if (PPP_CHECK_CB(on_sys_readahead_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2300,7 +2805,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_setxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_setxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2317,7 +2823,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_lsetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lsetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2334,7 +2841,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_fsetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fsetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2350,7 +2858,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_getxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_getxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2365,7 +2874,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_lgetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lgetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2380,7 +2890,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fgetxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fgetxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2394,7 +2905,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_listxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_listxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2407,7 +2919,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_llistxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_llistxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2420,7 +2933,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_flistxattr_return)) {
+			if (PPP_CHECK_CB(on_sys_flistxattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2432,7 +2946,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 235: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_removexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_removexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2443,7 +2958,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 236: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_lremovexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_lremovexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2454,7 +2970,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 237: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fremovexattr_return)) {
+			if (PPP_CHECK_CB(on_sys_fremovexattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2465,7 +2982,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 238: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_tkill_return)) {
+			if (PPP_CHECK_CB(on_sys_tkill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -2478,7 +2996,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sendfile64_return)) {
+			if (PPP_CHECK_CB(on_sys_sendfile64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2495,7 +3014,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_futex_return)) {
+			if (PPP_CHECK_CB(on_sys_futex_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2511,7 +3031,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_setaffinity_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2524,7 +3045,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) {
+			if (PPP_CHECK_CB(on_sys_sched_getaffinity_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2535,7 +3057,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 243 int set_thread_area ['struct user_desc *u_info']
 		case 243: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_set_thread_area_return)) {
+			if (PPP_CHECK_CB(on_set_thread_area_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_set_thread_area_enter, cpu, pc, arg0);
@@ -2544,7 +3067,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 244 int get_thread_area ['struct user_desc *u_info']
 		case 244: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_get_thread_area_return)) {
+			if (PPP_CHECK_CB(on_get_thread_area_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_get_thread_area_enter, cpu, pc, arg0);
@@ -2554,7 +3078,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 245: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_io_setup_return)) {
+			if (PPP_CHECK_CB(on_sys_io_setup_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2564,7 +3089,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 246 long sys_io_destroy ['aio_context_t ctx']
 		case 246: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_io_destroy_return)) {
+			if (PPP_CHECK_CB(on_sys_io_destroy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
@@ -2577,7 +3103,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_io_getevents_return)) {
+			if (PPP_CHECK_CB(on_sys_io_getevents_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2592,7 +3119,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_io_submit_return)) {
+			if (PPP_CHECK_CB(on_sys_io_submit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2605,7 +3133,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_io_cancel_return)) {
+			if (PPP_CHECK_CB(on_sys_io_cancel_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2619,7 +3148,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint64_t arg1 = get_64(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fadvise64_return)) {
+			if (PPP_CHECK_CB(on_sys_fadvise64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2631,7 +3161,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 252 long sys_exit_group ['int error_code']
 		case 252: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_exit_group_return)) {
+			if (PPP_CHECK_CB(on_sys_exit_group_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
@@ -2642,7 +3173,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint64_t arg0 = get_64(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) {
+			if (PPP_CHECK_CB(on_sys_lookup_dcookie_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint64_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2653,7 +3185,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 254 long sys_epoll_create ['int size']
 		case 254: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_epoll_create_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
@@ -2665,7 +3198,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_ctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2680,7 +3214,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_epoll_wait_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_wait_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2696,7 +3231,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) {
+			if (PPP_CHECK_CB(on_sys_remap_file_pages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2709,7 +3245,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 258 long sys_set_tid_address ['int __user *tidptr']
 		case 258: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_set_tid_address_return)) {
+			if (PPP_CHECK_CB(on_sys_set_tid_address_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
@@ -2720,7 +3257,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_timer_create_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2734,7 +3272,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_timer_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2747,7 +3286,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 261: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timer_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2757,7 +3297,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 262 long sys_timer_getoverrun ['timer_t timer_id']
 		case 262: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_getoverrun_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
@@ -2766,7 +3307,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 263 long sys_timer_delete ['timer_t timer_id']
 		case 263: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_timer_delete_return)) {
+			if (PPP_CHECK_CB(on_sys_timer_delete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
@@ -2776,7 +3318,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 264: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2787,7 +3330,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 265: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2798,7 +3342,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 266: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_getres_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_getres_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2811,7 +3356,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_nanosleep_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2825,7 +3371,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_statfs64_return)) {
+			if (PPP_CHECK_CB(on_sys_statfs64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2838,7 +3385,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fstatfs64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatfs64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2851,7 +3399,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_tgkill_return)) {
+			if (PPP_CHECK_CB(on_sys_tgkill_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -2863,7 +3412,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 271: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_utimes_return)) {
+			if (PPP_CHECK_CB(on_sys_utimes_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2876,7 +3426,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint64_t arg1 = get_64(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fadvise64_64_return)) {
+			if (PPP_CHECK_CB(on_sys_fadvise64_64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -2893,7 +3444,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_mbind_return)) {
+			if (PPP_CHECK_CB(on_sys_mbind_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2911,7 +3463,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) {
+			if (PPP_CHECK_CB(on_sys_get_mempolicy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2926,7 +3479,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) {
+			if (PPP_CHECK_CB(on_sys_set_mempolicy_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2940,7 +3494,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_mq_open_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_open_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2952,7 +3507,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 278 long sys_mq_unlink ['const char __user *name']
 		case 278: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_mq_unlink_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_unlink_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
@@ -2965,7 +3521,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_timedsend_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2982,7 +3539,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_timedreceive_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2996,7 +3554,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 281: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_mq_notify_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_notify_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3008,7 +3567,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) {
+			if (PPP_CHECK_CB(on_sys_mq_getsetattr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3022,7 +3582,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_kexec_load_return)) {
+			if (PPP_CHECK_CB(on_sys_kexec_load_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3038,7 +3599,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_waitid_return)) {
+			if (PPP_CHECK_CB(on_sys_waitid_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3055,7 +3617,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_add_key_return)) {
+			if (PPP_CHECK_CB(on_sys_add_key_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3071,7 +3634,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_request_key_return)) {
+			if (PPP_CHECK_CB(on_sys_request_key_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3087,7 +3651,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_keyctl_return)) {
+			if (PPP_CHECK_CB(on_sys_keyctl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3102,7 +3667,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_ioprio_set_return)) {
+			if (PPP_CHECK_CB(on_sys_ioprio_set_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3114,7 +3680,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 290: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_ioprio_get_return)) {
+			if (PPP_CHECK_CB(on_sys_ioprio_get_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3123,8 +3690,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 291 long sys_inotify_init ['void']
 		case 291: {
-			if (PPP_CHECK_CB(on_sys_inotify_init_return)) {
-			}
+			if (PPP_CHECK_CB(on_sys_inotify_init_return)) track_return = true;
 			PPP_RUN_CB(on_sys_inotify_init_enter, cpu, pc);
 		}; break;
 		
@@ -3133,7 +3699,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_add_watch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3145,7 +3712,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 293: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_rm_watch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3158,7 +3726,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_migrate_pages_return)) {
+			if (PPP_CHECK_CB(on_sys_migrate_pages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3173,7 +3742,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_openat_return)) {
+			if (PPP_CHECK_CB(on_sys_openat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3187,7 +3757,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_mkdirat_return)) {
+			if (PPP_CHECK_CB(on_sys_mkdirat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3201,7 +3772,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_mknodat_return)) {
+			if (PPP_CHECK_CB(on_sys_mknodat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3217,7 +3789,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_fchownat_return)) {
+			if (PPP_CHECK_CB(on_sys_fchownat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3232,7 +3805,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_futimesat_return)) {
+			if (PPP_CHECK_CB(on_sys_futimesat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3246,7 +3820,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fstatat64_return)) {
+			if (PPP_CHECK_CB(on_sys_fstatat64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3260,7 +3835,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_unlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_unlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3274,7 +3850,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_renameat_return)) {
+			if (PPP_CHECK_CB(on_sys_renameat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3290,7 +3867,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_linkat_return)) {
+			if (PPP_CHECK_CB(on_sys_linkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3305,7 +3883,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_symlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_symlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3319,7 +3898,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_readlinkat_return)) {
+			if (PPP_CHECK_CB(on_sys_readlinkat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3333,7 +3913,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_fchmodat_return)) {
+			if (PPP_CHECK_CB(on_sys_fchmodat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3346,7 +3927,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_faccessat_return)) {
+			if (PPP_CHECK_CB(on_sys_faccessat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3362,7 +3944,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_pselect6_return)) {
+			if (PPP_CHECK_CB(on_sys_pselect6_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3380,7 +3963,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_ppoll_return)) {
+			if (PPP_CHECK_CB(on_sys_ppoll_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3393,7 +3977,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 310 long sys_unshare ['unsigned long unshare_flags']
 		case 310: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_unshare_return)) {
+			if (PPP_CHECK_CB(on_sys_unshare_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
@@ -3403,7 +3988,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 311: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_set_robust_list_return)) {
+			if (PPP_CHECK_CB(on_sys_set_robust_list_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3415,7 +4001,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_get_robust_list_return)) {
+			if (PPP_CHECK_CB(on_sys_get_robust_list_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3431,7 +4018,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_splice_return)) {
+			if (PPP_CHECK_CB(on_sys_splice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3448,7 +4036,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint64_t arg1 = get_64(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sync_file_range_return)) {
+			if (PPP_CHECK_CB(on_sys_sync_file_range_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint64_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -3463,7 +4052,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_tee_return)) {
+			if (PPP_CHECK_CB(on_sys_tee_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3478,7 +4068,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_vmsplice_return)) {
+			if (PPP_CHECK_CB(on_sys_vmsplice_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3495,7 +4086,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_move_pages_return)) {
+			if (PPP_CHECK_CB(on_sys_move_pages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3511,7 +4103,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_getcpu_return)) {
+			if (PPP_CHECK_CB(on_sys_getcpu_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3527,7 +4120,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_epoll_pwait_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_pwait_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3544,7 +4138,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_utimensat_return)) {
+			if (PPP_CHECK_CB(on_sys_utimensat_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3558,7 +4153,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_signalfd_return)) {
+			if (PPP_CHECK_CB(on_sys_signalfd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3570,7 +4166,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 322: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timerfd_create_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_create_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3580,7 +4177,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 323 long sys_eventfd ['unsigned int count']
 		case 323: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_eventfd_return)) {
+			if (PPP_CHECK_CB(on_sys_eventfd_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
@@ -3592,7 +4190,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint64_t arg2 = get_64(cpu, 2);
 			uint64_t arg3 = get_64(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_fallocate_return)) {
+			if (PPP_CHECK_CB(on_sys_fallocate_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -3607,7 +4206,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_settime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3620,7 +4220,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 326: {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) {
+			if (PPP_CHECK_CB(on_sys_timerfd_gettime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3633,7 +4234,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_signalfd4_return)) {
+			if (PPP_CHECK_CB(on_sys_signalfd4_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3646,7 +4248,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 328: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_eventfd2_return)) {
+			if (PPP_CHECK_CB(on_sys_eventfd2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3656,7 +4259,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 329 long sys_epoll_create1 ['int flags']
 		case 329: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_epoll_create1_return)) {
+			if (PPP_CHECK_CB(on_sys_epoll_create1_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
@@ -3667,7 +4271,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_dup3_return)) {
+			if (PPP_CHECK_CB(on_sys_dup3_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3679,7 +4284,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 331: {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_pipe2_return)) {
+			if (PPP_CHECK_CB(on_sys_pipe2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3689,7 +4295,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 332 long sys_inotify_init1 ['int flags']
 		case 332: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_inotify_init1_return)) {
+			if (PPP_CHECK_CB(on_sys_inotify_init1_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
@@ -3702,7 +4309,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_preadv_return)) {
+			if (PPP_CHECK_CB(on_sys_preadv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3719,7 +4327,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_pwritev_return)) {
+			if (PPP_CHECK_CB(on_sys_pwritev_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3735,7 +4344,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) {
+			if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3751,7 +4361,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg2 = get_s32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_perf_event_open_return)) {
+			if (PPP_CHECK_CB(on_sys_perf_event_open_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3768,7 +4379,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_recvmmsg_return)) {
+			if (PPP_CHECK_CB(on_sys_recvmmsg_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3782,7 +4394,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 338: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_fanotify_init_return)) {
+			if (PPP_CHECK_CB(on_sys_fanotify_init_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3796,7 +4409,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint64_t arg2 = get_64(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_fanotify_mark_return)) {
+			if (PPP_CHECK_CB(on_sys_fanotify_mark_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint64_t));
@@ -3812,7 +4426,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_prlimit64_return)) {
+			if (PPP_CHECK_CB(on_sys_prlimit64_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3828,7 +4443,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_sys_name_to_handle_at_return)) {
+			if (PPP_CHECK_CB(on_sys_name_to_handle_at_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3843,7 +4459,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			int32_t arg0 = get_s32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			int32_t arg2 = get_s32(cpu, 2);
-			if (PPP_CHECK_CB(on_sys_open_by_handle_at_return)) {
+			if (PPP_CHECK_CB(on_sys_open_by_handle_at_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(int32_t));
@@ -3855,7 +4472,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 343: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_clock_adjtime_return)) {
+			if (PPP_CHECK_CB(on_sys_clock_adjtime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3865,7 +4483,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		// 344 long sys_syncfs ['int fd']
 		case 344: {
 			int32_t arg0 = get_s32(cpu, 0);
-			if (PPP_CHECK_CB(on_sys_syncfs_return)) {
+			if (PPP_CHECK_CB(on_sys_syncfs_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 			}
 			PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
@@ -3877,7 +4496,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_sys_sendmmsg_return)) {
+			if (PPP_CHECK_CB(on_sys_sendmmsg_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3890,7 +4510,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		case 346: {
 			int32_t arg0 = get_s32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
-			if (PPP_CHECK_CB(on_sys_setns_return)) {
+			if (PPP_CHECK_CB(on_sys_setns_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(int32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 			}
@@ -3905,7 +4526,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_process_vm_readv_return)) {
+			if (PPP_CHECK_CB(on_sys_process_vm_readv_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3924,7 +4546,8 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_sys_process_vm_writev_return)) {
+			if (PPP_CHECK_CB(on_sys_process_vm_writev_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3936,10 +4559,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ulong pc) {
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[R_EAX]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[R_EAX]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,13 +10,266 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_windows_2000_x86(CPUState *cpu) {
+#if defined(TARGET_I386)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[R_EAX];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_windows_2000_x86(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_I386)
+	if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) syscall_subscribe(bitmap, 7);
+	if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) syscall_subscribe(bitmap, 13);
+	if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) syscall_subscribe(bitmap, 17);
+	if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) syscall_subscribe(bitmap, 18);
+	if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) syscall_subscribe(bitmap, 21);
+	if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) syscall_subscribe(bitmap, 25);
+	if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) syscall_subscribe(bitmap, 27);
+	if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) syscall_subscribe(bitmap, 28);
+	if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) syscall_subscribe(bitmap, 30);
+	if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) syscall_subscribe(bitmap, 31);
+	if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) syscall_subscribe(bitmap, 32);
+	if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) syscall_subscribe(bitmap, 35);
+	if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) syscall_subscribe(bitmap, 44);
+	if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) syscall_subscribe(bitmap, 48);
+	if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) syscall_subscribe(bitmap, 53);
+	if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) syscall_subscribe(bitmap, 56);
+	if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) syscall_subscribe(bitmap, 58);
+	if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) syscall_subscribe(bitmap, 59);
+	if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) syscall_subscribe(bitmap, 68);
+	if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) syscall_subscribe(bitmap, 69);
+	if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) syscall_subscribe(bitmap, 82);
+	if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) syscall_subscribe(bitmap, 84);
+	if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) syscall_subscribe(bitmap, 89);
+	if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) syscall_subscribe(bitmap, 90);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) syscall_subscribe(bitmap, 98);
+	if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) syscall_subscribe(bitmap, 101);
+	if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) syscall_subscribe(bitmap, 102);
+	if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) syscall_subscribe(bitmap, 109);
+	if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) syscall_subscribe(bitmap, 110);
+	if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) syscall_subscribe(bitmap, 112);
+	if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) syscall_subscribe(bitmap, 113);
+	if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) syscall_subscribe(bitmap, 117);
+	if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) syscall_subscribe(bitmap, 123);
+	if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) syscall_subscribe(bitmap, 127);
+	if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) syscall_subscribe(bitmap, 130);
+	if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) syscall_subscribe(bitmap, 137);
+	if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) syscall_subscribe(bitmap, 166);
+	if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) syscall_subscribe(bitmap, 167);
+	if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) syscall_subscribe(bitmap, 169);
+	if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) syscall_subscribe(bitmap, 188);
+	if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) syscall_subscribe(bitmap, 189);
+	if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) syscall_subscribe(bitmap, 193);
+	if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) syscall_subscribe(bitmap, 196);
+	if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) syscall_subscribe(bitmap, 198);
+	if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) syscall_subscribe(bitmap, 201);
+	if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) syscall_subscribe(bitmap, 222);
+	if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) syscall_subscribe(bitmap, 223);
+	if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) syscall_subscribe(bitmap, 247);
+#endif
+}
+
 void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[R_EAX];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[R_EAX]) {
 		// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 		case 0: {
@@ -26,7 +279,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -47,7 +301,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -73,7 +328,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -102,7 +358,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -136,7 +393,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -170,7 +428,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -204,7 +463,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -244,7 +504,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
 			uint32_t arg16 = get_32(cpu, 16);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -271,7 +532,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+			if (PPP_CHECK_CB(on_NtAddAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -287,7 +549,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -306,7 +569,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -321,7 +585,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 11: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -331,7 +596,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 12 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 		case 12: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -340,7 +606,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 13 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 		case 13: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -351,7 +618,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -365,7 +633,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -382,7 +651,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -397,7 +667,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 17: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -408,7 +679,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 18: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -420,7 +692,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -432,7 +705,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 20: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -443,7 +717,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 21: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCancelTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -453,7 +728,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 23 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 		case 23: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+			if (PPP_CHECK_CB(on_NtClearEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -462,7 +738,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 24 NTSTATUS NtClose ['HANDLE Handle']
 		case 24: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClose_return)) {
+			if (PPP_CHECK_CB(on_NtClose_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -473,7 +750,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -484,7 +762,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 26 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 		case 26: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -500,7 +779,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -517,7 +797,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 28: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtContinue_return)) {
+			if (PPP_CHECK_CB(on_NtContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -529,7 +810,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -544,7 +826,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -559,7 +842,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -580,7 +864,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -602,7 +887,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -616,7 +902,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -633,7 +920,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -655,7 +943,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -674,7 +963,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -699,7 +989,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
 			uint32_t arg13 = get_32(cpu, 13);
-			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -724,7 +1015,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -740,7 +1032,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -760,7 +1053,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -784,7 +1078,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -807,7 +1102,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -826,7 +1122,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -842,7 +1139,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -861,7 +1159,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+			if (PPP_CHECK_CB(on_NtCreateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -880,7 +1179,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -904,7 +1204,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
-			if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+			if (PPP_CHECK_CB(on_NtCreateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -929,7 +1230,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -943,7 +1245,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 50: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+			if (PPP_CHECK_CB(on_NtDelayExecution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -953,7 +1256,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 51 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 		case 51: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -962,7 +1266,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 52 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 		case 52: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -971,7 +1276,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 53 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 		case 53: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -982,7 +1288,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -994,7 +1301,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 55: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1013,7 +1321,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1031,7 +1340,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 57 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+			if (PPP_CHECK_CB(on_NtDisplayString_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1046,7 +1356,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1066,7 +1377,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1085,7 +1397,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1104,7 +1417,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1119,7 +1433,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 62: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+			if (PPP_CHECK_CB(on_NtExtendSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1134,7 +1449,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+			if (PPP_CHECK_CB(on_NtFilterToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1150,7 +1466,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+			if (PPP_CHECK_CB(on_NtFindAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1162,7 +1479,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 65: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1174,7 +1492,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1185,7 +1504,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 67 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 		case 67: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+			if (PPP_CHECK_CB(on_NtFlushKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -1197,7 +1517,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1208,8 +1529,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 69 NTSTATUS NtFlushWriteBuffer ['']
 		case 69: {
-			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) track_return = true;
 			PPP_RUN_CB(on_NtFlushWriteBuffer_enter, cpu, pc);
 		}; break;
 		
@@ -1218,7 +1538,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1232,7 +1553,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1253,7 +1575,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtFsControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1272,7 +1595,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 73: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtGetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1283,7 +1607,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 74: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1296,7 +1621,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1314,7 +1640,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1329,7 +1656,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 78 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 		case 78: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -1339,7 +1667,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 79: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1351,7 +1680,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1362,7 +1692,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 81 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 		case 81: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -1374,7 +1705,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1385,8 +1717,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 83 BOOLEAN NtIsSystemResumeAutomatic ['']
 		case 83: {
-			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) track_return = true;
 			PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, cpu, pc);
 		}; break;
 		
@@ -1394,7 +1725,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 84: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtListenPort_return)) {
+			if (PPP_CHECK_CB(on_NtListenPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1404,7 +1736,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 85 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 		case 85: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtLoadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -1414,7 +1747,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 86: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1426,7 +1760,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1446,7 +1781,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtLockFile_return)) {
+			if (PPP_CHECK_CB(on_NtLockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1467,7 +1803,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1479,7 +1816,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 90 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 		case 90: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -1490,7 +1828,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1503,7 +1842,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1523,7 +1863,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1549,7 +1890,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1575,7 +1917,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1604,7 +1947,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1626,7 +1970,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1639,7 +1984,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1652,7 +1998,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1668,7 +2015,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+			if (PPP_CHECK_CB(on_NtOpenFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1684,7 +2032,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1697,7 +2046,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1710,7 +2060,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1723,7 +2074,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+			if (PPP_CHECK_CB(on_NtOpenMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1745,7 +2097,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1768,7 +2121,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1782,7 +2136,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1795,7 +2150,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1808,7 +2164,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1821,7 +2178,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1835,7 +2193,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1850,7 +2209,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1864,7 +2224,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1877,7 +2238,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1892,7 +2254,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+			if (PPP_CHECK_CB(on_NtPowerInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1907,7 +2270,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1922,7 +2286,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1940,7 +2305,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1958,7 +2324,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1972,7 +2339,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 120: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+			if (PPP_CHECK_CB(on_NtPulseEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1986,7 +2354,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2000,7 +2369,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 122: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2011,7 +2381,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 123: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2021,7 +2392,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 124 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 		case 124: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -2040,7 +2412,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2065,7 +2438,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2088,7 +2462,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2109,7 +2484,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2123,7 +2499,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 129: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2137,7 +2514,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2154,7 +2532,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2171,7 +2550,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2188,7 +2568,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2205,7 +2586,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2222,7 +2604,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2239,7 +2622,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2252,7 +2636,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 137 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 		case 137: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -2262,7 +2647,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 138: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2276,7 +2662,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2294,7 +2681,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2312,7 +2700,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2329,7 +2718,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2343,7 +2733,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 143: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2354,7 +2745,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 144: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2372,7 +2764,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2393,7 +2786,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2410,7 +2804,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2427,7 +2822,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2442,7 +2838,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2456,7 +2853,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2471,7 +2869,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2483,7 +2882,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 152 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 		case 152: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -2496,7 +2896,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2511,7 +2912,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2527,7 +2929,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2546,7 +2949,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2564,7 +2968,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2581,7 +2986,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2596,7 +3002,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseException_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2612,7 +3019,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2634,7 +3042,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFile_return)) {
+			if (PPP_CHECK_CB(on_NtReadFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2659,7 +3068,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2681,7 +3091,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtReadRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2699,7 +3110,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2712,7 +3124,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 165 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 		case 165: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -2722,7 +3135,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 166: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2734,7 +3148,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2749,7 +3164,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2764,7 +3180,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+			if (PPP_CHECK_CB(on_NtReplaceKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2776,7 +3193,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 170: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2789,7 +3207,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2805,7 +3224,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2819,7 +3239,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 173: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2830,7 +3251,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 175: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2842,7 +3264,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2854,7 +3277,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 178: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtResetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2866,7 +3290,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2879,7 +3304,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+			if (PPP_CHECK_CB(on_NtRestoreKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2891,7 +3317,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 181: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2902,7 +3329,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 182: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2914,7 +3342,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2933,7 +3362,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2954,7 +3384,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2968,7 +3399,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 186: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2978,7 +3410,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 187 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 		case 187: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -2988,7 +3421,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 188: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2998,7 +3432,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 189 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 		case 189: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3010,7 +3445,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3023,7 +3459,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 191: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtSetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3033,7 +3470,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 192 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 		case 192: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -3042,7 +3480,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 193 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 		case 193: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3055,7 +3494,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3071,7 +3511,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3086,7 +3527,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3101,7 +3543,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3116,7 +3559,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3131,7 +3575,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3146,7 +3591,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3159,7 +3605,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 201: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3174,7 +3621,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3188,7 +3636,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 203 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 		case 203: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -3197,7 +3646,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 204 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 		case 204: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3209,7 +3659,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3223,7 +3674,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3235,7 +3687,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 207: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3247,7 +3700,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3260,7 +3714,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3272,7 +3727,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 210: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3283,7 +3739,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 211: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3299,7 +3756,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3316,7 +3774,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3327,7 +3786,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 214 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 		case 214: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -3341,7 +3801,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3359,7 +3820,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3372,7 +3834,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 217 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 		case 217: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -3384,7 +3847,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3396,7 +3860,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 219 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 		case 219: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStartProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -3405,7 +3870,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 220 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 		case 220: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStopProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -3415,7 +3881,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 221: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3430,7 +3897,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3445,7 +3913,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 223: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3456,7 +3925,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 224: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3467,7 +3937,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 225: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3476,15 +3947,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 226 NTSTATUS NtTestAlert ['']
 		case 226: {
-			if (PPP_CHECK_CB(on_NtTestAlert_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtTestAlert_return)) track_return = true;
 			PPP_RUN_CB(on_NtTestAlert_enter, cpu, pc);
 		}; break;
 		
 		// 227 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 		case 227: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -3493,7 +3964,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 228 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 		case 228: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -3506,7 +3978,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3522,7 +3995,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3535,7 +4009,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 231: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3546,7 +4021,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		case 232: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+			if (PPP_CHECK_CB(on_NtVdmControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3560,7 +4036,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3575,7 +4052,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3586,7 +4064,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 235 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 		case 235: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3595,7 +4074,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		// 236 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 		case 236: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3612,7 +4092,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3637,7 +4118,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3659,7 +4141,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3677,7 +4160,8 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3689,16 +4173,20 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 247 NTSTATUS NtYieldExecution ['']
 		case 247: {
-			if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtYieldExecution_return)) track_return = true;
 			PPP_RUN_CB(on_NtYieldExecution_enter, cpu, pc);
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[R_EAX]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[R_EAX]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,13 +10,429 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_windows_7_x86(CPUState *cpu) {
+#if defined(TARGET_I386)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[R_EAX];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_windows_7_x86(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_I386)
+	if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) syscall_subscribe(bitmap, 7);
+	if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_NtAddBootEntry_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_NtAddDriverEntry_enter) || PPP_CHECK_CB(on_NtAddDriverEntry_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) syscall_subscribe(bitmap, 13);
+	if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_NtAllocateReserveObject_enter) || PPP_CHECK_CB(on_NtAllocateReserveObject_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) syscall_subscribe(bitmap, 17);
+	if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) syscall_subscribe(bitmap, 18);
+	if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_NtAlpcCancelMessage_enter) || PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) syscall_subscribe(bitmap, 21);
+	if (PPP_CHECK_CB(on_NtAlpcConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcConnectPort_return)) syscall_subscribe(bitmap, 22);
+	if (PPP_CHECK_CB(on_NtAlpcCreatePort_enter) || PPP_CHECK_CB(on_NtAlpcCreatePort_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_enter) || PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) syscall_subscribe(bitmap, 25);
+	if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_enter) || PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) syscall_subscribe(bitmap, 27);
+	if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_enter) || PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) syscall_subscribe(bitmap, 28);
+	if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) syscall_subscribe(bitmap, 30);
+	if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) syscall_subscribe(bitmap, 31);
+	if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_enter) || PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) syscall_subscribe(bitmap, 32);
+	if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) syscall_subscribe(bitmap, 35);
+	if (PPP_CHECK_CB(on_NtAlpcQueryInformation_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_enter) || PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_NtAlpcSetInformation_enter) || PPP_CHECK_CB(on_NtAlpcSetInformation_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_NtApphelpCacheControl_enter) || PPP_CHECK_CB(on_NtApphelpCacheControl_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) syscall_subscribe(bitmap, 44);
+	if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_NtCancelIoFileEx_enter) || PPP_CHECK_CB(on_NtCancelIoFileEx_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_enter) || PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) syscall_subscribe(bitmap, 48);
+	if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_NtCommitComplete_enter) || PPP_CHECK_CB(on_NtCommitComplete_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_NtCommitEnlistment_enter) || PPP_CHECK_CB(on_NtCommitEnlistment_return)) syscall_subscribe(bitmap, 53);
+	if (PPP_CHECK_CB(on_NtCommitTransaction_enter) || PPP_CHECK_CB(on_NtCommitTransaction_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) syscall_subscribe(bitmap, 56);
+	if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) syscall_subscribe(bitmap, 58);
+	if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) syscall_subscribe(bitmap, 59);
+	if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_NtCreateEnlistment_enter) || PPP_CHECK_CB(on_NtCreateEnlistment_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) syscall_subscribe(bitmap, 68);
+	if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) syscall_subscribe(bitmap, 69);
+	if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_NtCreateKeyTransacted_enter) || PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) syscall_subscribe(bitmap, 76);
+	if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_enter) || PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_NtCreateProfileEx_enter) || PPP_CHECK_CB(on_NtCreateProfileEx_return)) syscall_subscribe(bitmap, 82);
+	if (PPP_CHECK_CB(on_NtCreateResourceManager_enter) || PPP_CHECK_CB(on_NtCreateResourceManager_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) syscall_subscribe(bitmap, 84);
+	if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_NtCreateThreadEx_enter) || PPP_CHECK_CB(on_NtCreateThreadEx_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) syscall_subscribe(bitmap, 89);
+	if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) syscall_subscribe(bitmap, 90);
+	if (PPP_CHECK_CB(on_NtCreateTransaction_enter) || PPP_CHECK_CB(on_NtCreateTransaction_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_NtCreateTransactionManager_enter) || PPP_CHECK_CB(on_NtCreateTransactionManager_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_NtCreateUserProcess_enter) || PPP_CHECK_CB(on_NtCreateUserProcess_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_NtCreateWorkerFactory_enter) || PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) syscall_subscribe(bitmap, 98);
+	if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_NtDeleteBootEntry_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_NtDeleteDriverEntry_enter) || PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) syscall_subscribe(bitmap, 101);
+	if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) syscall_subscribe(bitmap, 102);
+	if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_enter) || PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_NtDisableLastKnownGood_enter) || PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) syscall_subscribe(bitmap, 109);
+	if (PPP_CHECK_CB(on_NtDrawText_enter) || PPP_CHECK_CB(on_NtDrawText_return)) syscall_subscribe(bitmap, 110);
+	if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) syscall_subscribe(bitmap, 112);
+	if (PPP_CHECK_CB(on_NtEnableLastKnownGood_enter) || PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) syscall_subscribe(bitmap, 113);
+	if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_enter) || PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) syscall_subscribe(bitmap, 117);
+	if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_enter) || PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) syscall_subscribe(bitmap, 123);
+	if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_enter) || PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_enter) || PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) syscall_subscribe(bitmap, 127);
+	if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) syscall_subscribe(bitmap, 130);
+	if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_NtFreezeRegistry_enter) || PPP_CHECK_CB(on_NtFreezeRegistry_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_NtFreezeTransactions_enter) || PPP_CHECK_CB(on_NtFreezeTransactions_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_enter) || PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) syscall_subscribe(bitmap, 137);
+	if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_enter) || PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_NtGetNextProcess_enter) || PPP_CHECK_CB(on_NtGetNextProcess_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_NtGetNextThread_enter) || PPP_CHECK_CB(on_NtGetNextThread_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_enter) || PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_enter) || PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_NtInitializeNlsFiles_enter) || PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_NtIsUILanguageComitted_enter) || PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_NtLoadKeyEx_enter) || PPP_CHECK_CB(on_NtLoadKeyEx_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_NtMapCMFModule_enter) || PPP_CHECK_CB(on_NtMapCMFModule_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) syscall_subscribe(bitmap, 166);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) syscall_subscribe(bitmap, 167);
+	if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) syscall_subscribe(bitmap, 169);
+	if (PPP_CHECK_CB(on_NtModifyDriverEntry_enter) || PPP_CHECK_CB(on_NtModifyDriverEntry_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_NtNotifyChangeSession_enter) || PPP_CHECK_CB(on_NtNotifyChangeSession_return)) syscall_subscribe(bitmap, 174);
+	if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_NtOpenEnlistment_enter) || PPP_CHECK_CB(on_NtOpenEnlistment_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) syscall_subscribe(bitmap, 177);
+	if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_NtOpenKeyEx_enter) || PPP_CHECK_CB(on_NtOpenKeyEx_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_NtOpenKeyTransacted_enter) || PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_enter) || PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) syscall_subscribe(bitmap, 188);
+	if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_enter) || PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) syscall_subscribe(bitmap, 189);
+	if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_NtOpenResourceManager_enter) || PPP_CHECK_CB(on_NtOpenResourceManager_return)) syscall_subscribe(bitmap, 193);
+	if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_NtOpenSession_enter) || PPP_CHECK_CB(on_NtOpenSession_return)) syscall_subscribe(bitmap, 196);
+	if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) syscall_subscribe(bitmap, 198);
+	if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) syscall_subscribe(bitmap, 201);
+	if (PPP_CHECK_CB(on_NtOpenTransaction_enter) || PPP_CHECK_CB(on_NtOpenTransaction_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_NtOpenTransactionManager_enter) || PPP_CHECK_CB(on_NtOpenTransactionManager_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_NtPrepareComplete_enter) || PPP_CHECK_CB(on_NtPrepareComplete_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_NtPrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrepareEnlistment_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_NtPrePrepareComplete_enter) || PPP_CHECK_CB(on_NtPrePrepareComplete_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_NtPropagationComplete_enter) || PPP_CHECK_CB(on_NtPropagationComplete_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_NtPropagationFailed_enter) || PPP_CHECK_CB(on_NtPropagationFailed_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_NtQueryBootOptions_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) syscall_subscribe(bitmap, 222);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) syscall_subscribe(bitmap, 223);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_enter) || PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_enter) || PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_NtQueryInformationTransaction_enter) || PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) syscall_subscribe(bitmap, 241);
+	if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) syscall_subscribe(bitmap, 242);
+	if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) syscall_subscribe(bitmap, 243);
+	if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) syscall_subscribe(bitmap, 244);
+	if (PPP_CHECK_CB(on_NtQueryLicenseValue_enter) || PPP_CHECK_CB(on_NtQueryLicenseValue_return)) syscall_subscribe(bitmap, 245);
+	if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) syscall_subscribe(bitmap, 246);
+	if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) syscall_subscribe(bitmap, 247);
+	if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) syscall_subscribe(bitmap, 248);
+	if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) syscall_subscribe(bitmap, 249);
+	if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) syscall_subscribe(bitmap, 250);
+	if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) syscall_subscribe(bitmap, 251);
+	if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) syscall_subscribe(bitmap, 252);
+	if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) syscall_subscribe(bitmap, 253);
+	if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) syscall_subscribe(bitmap, 254);
+	if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_enter) || PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) syscall_subscribe(bitmap, 255);
+	if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) syscall_subscribe(bitmap, 256);
+	if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) syscall_subscribe(bitmap, 257);
+	if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) syscall_subscribe(bitmap, 258);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) syscall_subscribe(bitmap, 259);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) syscall_subscribe(bitmap, 260);
+	if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) syscall_subscribe(bitmap, 261);
+	if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_enter) || PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) syscall_subscribe(bitmap, 262);
+	if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) syscall_subscribe(bitmap, 263);
+	if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) syscall_subscribe(bitmap, 264);
+	if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) syscall_subscribe(bitmap, 265);
+	if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) syscall_subscribe(bitmap, 266);
+	if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) syscall_subscribe(bitmap, 267);
+	if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) syscall_subscribe(bitmap, 268);
+	if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) syscall_subscribe(bitmap, 269);
+	if (PPP_CHECK_CB(on_NtQueueApcThreadEx_enter) || PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) syscall_subscribe(bitmap, 270);
+	if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) syscall_subscribe(bitmap, 271);
+	if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) syscall_subscribe(bitmap, 272);
+	if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) syscall_subscribe(bitmap, 273);
+	if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) syscall_subscribe(bitmap, 274);
+	if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_enter) || PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) syscall_subscribe(bitmap, 275);
+	if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) syscall_subscribe(bitmap, 276);
+	if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) syscall_subscribe(bitmap, 277);
+	if (PPP_CHECK_CB(on_NtRecoverEnlistment_enter) || PPP_CHECK_CB(on_NtRecoverEnlistment_return)) syscall_subscribe(bitmap, 278);
+	if (PPP_CHECK_CB(on_NtRecoverResourceManager_enter) || PPP_CHECK_CB(on_NtRecoverResourceManager_return)) syscall_subscribe(bitmap, 279);
+	if (PPP_CHECK_CB(on_NtRecoverTransactionManager_enter) || PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) syscall_subscribe(bitmap, 280);
+	if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_enter) || PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) syscall_subscribe(bitmap, 281);
+	if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) syscall_subscribe(bitmap, 282);
+	if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) syscall_subscribe(bitmap, 283);
+	if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) syscall_subscribe(bitmap, 284);
+	if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) syscall_subscribe(bitmap, 285);
+	if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_enter) || PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) syscall_subscribe(bitmap, 286);
+	if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) syscall_subscribe(bitmap, 287);
+	if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) syscall_subscribe(bitmap, 288);
+	if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) syscall_subscribe(bitmap, 289);
+	if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) syscall_subscribe(bitmap, 290);
+	if (PPP_CHECK_CB(on_NtRenameTransactionManager_enter) || PPP_CHECK_CB(on_NtRenameTransactionManager_return)) syscall_subscribe(bitmap, 291);
+	if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) syscall_subscribe(bitmap, 292);
+	if (PPP_CHECK_CB(on_NtReplacePartitionUnit_enter) || PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) syscall_subscribe(bitmap, 293);
+	if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) syscall_subscribe(bitmap, 294);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) syscall_subscribe(bitmap, 295);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) syscall_subscribe(bitmap, 296);
+	if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) syscall_subscribe(bitmap, 297);
+	if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) syscall_subscribe(bitmap, 298);
+	if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) syscall_subscribe(bitmap, 299);
+	if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) syscall_subscribe(bitmap, 300);
+	if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) syscall_subscribe(bitmap, 301);
+	if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) syscall_subscribe(bitmap, 302);
+	if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) syscall_subscribe(bitmap, 303);
+	if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) syscall_subscribe(bitmap, 304);
+	if (PPP_CHECK_CB(on_NtRollbackComplete_enter) || PPP_CHECK_CB(on_NtRollbackComplete_return)) syscall_subscribe(bitmap, 305);
+	if (PPP_CHECK_CB(on_NtRollbackEnlistment_enter) || PPP_CHECK_CB(on_NtRollbackEnlistment_return)) syscall_subscribe(bitmap, 306);
+	if (PPP_CHECK_CB(on_NtRollbackTransaction_enter) || PPP_CHECK_CB(on_NtRollbackTransaction_return)) syscall_subscribe(bitmap, 307);
+	if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_enter) || PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) syscall_subscribe(bitmap, 308);
+	if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) syscall_subscribe(bitmap, 309);
+	if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) syscall_subscribe(bitmap, 310);
+	if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) syscall_subscribe(bitmap, 311);
+	if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) syscall_subscribe(bitmap, 312);
+	if (PPP_CHECK_CB(on_NtSerializeBoot_enter) || PPP_CHECK_CB(on_NtSerializeBoot_return)) syscall_subscribe(bitmap, 313);
+	if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) syscall_subscribe(bitmap, 314);
+	if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_NtSetBootOptions_return)) syscall_subscribe(bitmap, 315);
+	if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) syscall_subscribe(bitmap, 316);
+	if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) syscall_subscribe(bitmap, 317);
+	if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) syscall_subscribe(bitmap, 318);
+	if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) syscall_subscribe(bitmap, 319);
+	if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) syscall_subscribe(bitmap, 320);
+	if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) syscall_subscribe(bitmap, 321);
+	if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) syscall_subscribe(bitmap, 322);
+	if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) syscall_subscribe(bitmap, 323);
+	if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) syscall_subscribe(bitmap, 324);
+	if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) syscall_subscribe(bitmap, 325);
+	if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) syscall_subscribe(bitmap, 326);
+	if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) syscall_subscribe(bitmap, 327);
+	if (PPP_CHECK_CB(on_NtSetInformationEnlistment_enter) || PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) syscall_subscribe(bitmap, 328);
+	if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) syscall_subscribe(bitmap, 329);
+	if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) syscall_subscribe(bitmap, 330);
+	if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) syscall_subscribe(bitmap, 331);
+	if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) syscall_subscribe(bitmap, 332);
+	if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) syscall_subscribe(bitmap, 333);
+	if (PPP_CHECK_CB(on_NtSetInformationResourceManager_enter) || PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) syscall_subscribe(bitmap, 334);
+	if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) syscall_subscribe(bitmap, 335);
+	if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) syscall_subscribe(bitmap, 336);
+	if (PPP_CHECK_CB(on_NtSetInformationTransaction_enter) || PPP_CHECK_CB(on_NtSetInformationTransaction_return)) syscall_subscribe(bitmap, 337);
+	if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) syscall_subscribe(bitmap, 338);
+	if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) syscall_subscribe(bitmap, 339);
+	if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) syscall_subscribe(bitmap, 340);
+	if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) syscall_subscribe(bitmap, 341);
+	if (PPP_CHECK_CB(on_NtSetIoCompletionEx_enter) || PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) syscall_subscribe(bitmap, 342);
+	if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) syscall_subscribe(bitmap, 343);
+	if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) syscall_subscribe(bitmap, 344);
+	if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) syscall_subscribe(bitmap, 345);
+	if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) syscall_subscribe(bitmap, 346);
+	if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) syscall_subscribe(bitmap, 347);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) syscall_subscribe(bitmap, 348);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) syscall_subscribe(bitmap, 349);
+	if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) syscall_subscribe(bitmap, 350);
+	if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) syscall_subscribe(bitmap, 351);
+	if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) syscall_subscribe(bitmap, 352);
+	if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) syscall_subscribe(bitmap, 353);
+	if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) syscall_subscribe(bitmap, 354);
+	if (PPP_CHECK_CB(on_NtSetTimerEx_enter) || PPP_CHECK_CB(on_NtSetTimerEx_return)) syscall_subscribe(bitmap, 355);
+	if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) syscall_subscribe(bitmap, 356);
+	if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) syscall_subscribe(bitmap, 357);
+	if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) syscall_subscribe(bitmap, 358);
+	if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) syscall_subscribe(bitmap, 359);
+	if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) syscall_subscribe(bitmap, 360);
+	if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_enter) || PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) syscall_subscribe(bitmap, 361);
+	if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) syscall_subscribe(bitmap, 362);
+	if (PPP_CHECK_CB(on_NtSinglePhaseReject_enter) || PPP_CHECK_CB(on_NtSinglePhaseReject_return)) syscall_subscribe(bitmap, 363);
+	if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) syscall_subscribe(bitmap, 364);
+	if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) syscall_subscribe(bitmap, 365);
+	if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) syscall_subscribe(bitmap, 366);
+	if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) syscall_subscribe(bitmap, 367);
+	if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) syscall_subscribe(bitmap, 368);
+	if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) syscall_subscribe(bitmap, 369);
+	if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) syscall_subscribe(bitmap, 370);
+	if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) syscall_subscribe(bitmap, 371);
+	if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) syscall_subscribe(bitmap, 372);
+	if (PPP_CHECK_CB(on_NtThawRegistry_enter) || PPP_CHECK_CB(on_NtThawRegistry_return)) syscall_subscribe(bitmap, 373);
+	if (PPP_CHECK_CB(on_NtThawTransactions_enter) || PPP_CHECK_CB(on_NtThawTransactions_return)) syscall_subscribe(bitmap, 374);
+	if (PPP_CHECK_CB(on_NtTraceControl_enter) || PPP_CHECK_CB(on_NtTraceControl_return)) syscall_subscribe(bitmap, 375);
+	if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) syscall_subscribe(bitmap, 376);
+	if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) syscall_subscribe(bitmap, 377);
+	if (PPP_CHECK_CB(on_NtUmsThreadYield_enter) || PPP_CHECK_CB(on_NtUmsThreadYield_return)) syscall_subscribe(bitmap, 378);
+	if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) syscall_subscribe(bitmap, 379);
+	if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) syscall_subscribe(bitmap, 380);
+	if (PPP_CHECK_CB(on_NtUnloadKey2_enter) || PPP_CHECK_CB(on_NtUnloadKey2_return)) syscall_subscribe(bitmap, 381);
+	if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) syscall_subscribe(bitmap, 382);
+	if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) syscall_subscribe(bitmap, 383);
+	if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) syscall_subscribe(bitmap, 384);
+	if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) syscall_subscribe(bitmap, 385);
+	if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) syscall_subscribe(bitmap, 386);
+	if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) syscall_subscribe(bitmap, 387);
+	if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) syscall_subscribe(bitmap, 388);
+	if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) syscall_subscribe(bitmap, 389);
+	if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) syscall_subscribe(bitmap, 390);
+	if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) syscall_subscribe(bitmap, 391);
+	if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_enter) || PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) syscall_subscribe(bitmap, 392);
+	if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) syscall_subscribe(bitmap, 393);
+	if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) syscall_subscribe(bitmap, 394);
+	if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_enter) || PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) syscall_subscribe(bitmap, 395);
+	if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) syscall_subscribe(bitmap, 396);
+	if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) syscall_subscribe(bitmap, 397);
+	if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) syscall_subscribe(bitmap, 398);
+	if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) syscall_subscribe(bitmap, 399);
+	if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) syscall_subscribe(bitmap, 400);
+#endif
+}
+
 void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[R_EAX];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[R_EAX]) {
 		// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 		case 0: {
@@ -26,7 +442,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -47,7 +464,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -73,7 +491,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -102,7 +521,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -136,7 +556,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -170,7 +591,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -204,7 +626,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -244,7 +667,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
 			uint32_t arg16 = get_32(cpu, 16);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -271,7 +695,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+			if (PPP_CHECK_CB(on_NtAddAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -283,7 +708,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 9: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAddBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtAddBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -294,7 +720,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 10: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
+			if (PPP_CHECK_CB(on_NtAddDriverEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -309,7 +736,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -328,7 +756,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -343,7 +772,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 13: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -353,7 +783,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 14 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 		case 14: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -362,7 +793,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 15 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 		case 15: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -373,7 +805,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAllocateReserveObject_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateReserveObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -386,7 +819,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -400,7 +834,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -417,7 +852,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -439,7 +875,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -458,7 +895,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -479,7 +917,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAlpcConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -500,7 +939,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcCreatePort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCreatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -516,7 +956,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -533,7 +974,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -547,7 +989,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -560,7 +1003,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -573,7 +1017,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -586,7 +1031,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -599,7 +1045,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -612,7 +1059,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -624,7 +1072,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 32: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -636,7 +1085,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -652,7 +1102,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -671,7 +1122,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -689,7 +1141,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -707,7 +1160,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -723,7 +1177,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -741,7 +1196,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -760,7 +1216,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAlpcSetInformation_return)) {
+			if (PPP_CHECK_CB(on_NtAlpcSetInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -773,7 +1230,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 41: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
+			if (PPP_CHECK_CB(on_NtApphelpCacheControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -784,7 +1242,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 42: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -795,7 +1254,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 43: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -807,7 +1267,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -819,7 +1280,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 45: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -831,7 +1293,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCancelIoFileEx_return)) {
+			if (PPP_CHECK_CB(on_NtCancelIoFileEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -844,7 +1307,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) {
+			if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -856,7 +1320,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 48: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCancelTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -866,7 +1331,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 49 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 		case 49: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+			if (PPP_CHECK_CB(on_NtClearEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -875,7 +1341,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 50 NTSTATUS NtClose ['HANDLE Handle']
 		case 50: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClose_return)) {
+			if (PPP_CHECK_CB(on_NtClose_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -886,7 +1353,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -898,7 +1366,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 52: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCommitComplete_return)) {
+			if (PPP_CHECK_CB(on_NtCommitComplete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -909,7 +1378,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 53: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtCommitEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -920,7 +1390,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 54: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCommitTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtCommitTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -931,7 +1402,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 55: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
+			if (PPP_CHECK_CB(on_NtCompactKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -943,7 +1415,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
+			if (PPP_CHECK_CB(on_NtCompareTokens_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -954,7 +1427,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 57 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -963,7 +1437,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 58 NTSTATUS NtCompressKey ['HANDLE Key']
 		case 58: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+			if (PPP_CHECK_CB(on_NtCompressKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompressKey_enter, cpu, pc, arg0);
@@ -979,7 +1454,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -996,7 +1472,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 60: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtContinue_return)) {
+			if (PPP_CHECK_CB(on_NtContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1009,7 +1486,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1023,7 +1501,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1041,7 +1520,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1061,7 +1541,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1076,7 +1557,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1097,7 +1579,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1119,7 +1602,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1133,7 +1617,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1146,7 +1631,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1163,7 +1649,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1181,7 +1668,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1200,7 +1688,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1223,7 +1712,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1242,7 +1732,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1267,7 +1758,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
 			uint32_t arg13 = get_32(cpu, 13);
-			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1292,7 +1784,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1308,7 +1801,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1324,7 +1818,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1343,7 +1838,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1367,7 +1863,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1392,7 +1889,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1418,7 +1916,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtCreateProfileEx_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProfileEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1442,7 +1941,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtCreateResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1463,7 +1963,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1482,7 +1983,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1498,7 +2000,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1517,7 +2020,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+			if (PPP_CHECK_CB(on_NtCreateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1543,7 +2047,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateThreadEx_return)) {
+			if (PPP_CHECK_CB(on_NtCreateThreadEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1565,7 +2070,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1589,7 +2095,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
-			if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+			if (PPP_CHECK_CB(on_NtCreateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1619,7 +2126,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtCreateTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1642,7 +2150,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtCreateTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1666,7 +2175,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateUserProcess_return)) {
+			if (PPP_CHECK_CB(on_NtCreateUserProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1689,7 +2199,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1711,7 +2222,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) {
+			if (PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1730,7 +2242,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 96: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1742,7 +2255,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
+			if (PPP_CHECK_CB(on_NtDebugContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1754,7 +2268,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 98: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+			if (PPP_CHECK_CB(on_NtDelayExecution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1764,7 +2279,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 99 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 		case 99: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1773,7 +2289,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 100 NTSTATUS NtDeleteBootEntry ['ULONG Id']
 		case 100: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteBootEntry_enter, cpu, pc, arg0);
@@ -1782,7 +2299,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 101 NTSTATUS NtDeleteDriverEntry ['ULONG Id']
 		case 101: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteDriverEntry_enter, cpu, pc, arg0);
@@ -1791,7 +2309,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 102 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 		case 102: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -1800,7 +2319,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 103 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 		case 103: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -1811,7 +2331,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1822,7 +2343,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 105 NTSTATUS NtDeletePrivateNamespace ['HANDLE NamespaceHandle']
 		case 105: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
+			if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeletePrivateNamespace_enter, cpu, pc, arg0);
@@ -1832,7 +2354,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 106: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1851,7 +2374,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1868,15 +2392,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 108 NTSTATUS NtDisableLastKnownGood ['']
 		case 108: {
-			if (PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) track_return = true;
 			PPP_RUN_CB(on_NtDisableLastKnownGood_enter, cpu, pc);
 		}; break;
 		
 		// 109 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 		case 109: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+			if (PPP_CHECK_CB(on_NtDisplayString_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1885,7 +2409,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 110 NTSTATUS NtDrawText ['PUNICODE_STRING Text']
 		case 110: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDrawText_return)) {
+			if (PPP_CHECK_CB(on_NtDrawText_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDrawText_enter, cpu, pc, arg0);
@@ -1900,7 +2425,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1920,7 +2446,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1933,8 +2460,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 113 NTSTATUS NtEnableLastKnownGood ['']
 		case 113: {
-			if (PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) track_return = true;
 			PPP_RUN_CB(on_NtEnableLastKnownGood_enter, cpu, pc);
 		}; break;
 		
@@ -1942,7 +2468,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 114: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1953,7 +2480,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 115: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1968,7 +2496,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1984,7 +2513,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1999,7 +2529,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2017,7 +2548,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2032,7 +2564,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 120: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+			if (PPP_CHECK_CB(on_NtExtendSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2047,7 +2580,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+			if (PPP_CHECK_CB(on_NtFilterToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2063,7 +2597,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+			if (PPP_CHECK_CB(on_NtFindAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2075,7 +2610,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 123: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2086,7 +2622,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 124: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2098,7 +2635,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2109,7 +2647,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 126 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 		case 126: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+			if (PPP_CHECK_CB(on_NtFlushKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -2117,8 +2656,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 127 VOID NtFlushProcessWriteBuffers ['']
 		case 127: {
-			if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) track_return = true;
 			PPP_RUN_CB(on_NtFlushProcessWriteBuffers_enter, cpu, pc);
 		}; break;
 		
@@ -2128,7 +2666,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2139,8 +2678,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 129 NTSTATUS NtFlushWriteBuffer ['']
 		case 129: {
-			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) track_return = true;
 			PPP_RUN_CB(on_NtFlushWriteBuffer_enter, cpu, pc);
 		}; break;
 		
@@ -2149,7 +2687,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2163,7 +2702,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2175,7 +2715,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 132 NTSTATUS NtFreezeRegistry ['ULONG TimeOutInSeconds']
 		case 132: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
+			if (PPP_CHECK_CB(on_NtFreezeRegistry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtFreezeRegistry_enter, cpu, pc, arg0);
@@ -2185,7 +2726,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 133: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
+			if (PPP_CHECK_CB(on_NtFreezeTransactions_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2204,7 +2746,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtFsControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2223,7 +2766,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 135: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtGetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2232,8 +2776,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 136 ULONG NtGetCurrentProcessorNumber ['']
 		case 136: {
-			if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) track_return = true;
 			PPP_RUN_CB(on_NtGetCurrentProcessorNumber_enter, cpu, pc);
 		}; break;
 		
@@ -2241,7 +2784,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 137: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2253,7 +2797,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) {
+			if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2268,7 +2813,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtGetNextProcess_return)) {
+			if (PPP_CHECK_CB(on_NtGetNextProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2286,7 +2832,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtGetNextThread_return)) {
+			if (PPP_CHECK_CB(on_NtGetNextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2304,7 +2851,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) {
+			if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2323,7 +2871,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2341,7 +2890,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2359,7 +2909,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2374,7 +2925,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 145 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 		case 145: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -2384,7 +2936,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 146: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2396,7 +2949,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2409,7 +2963,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) {
+			if (PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2420,7 +2975,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 149 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 		case 149: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -2432,7 +2988,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2445,7 +3002,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 151: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2454,15 +3012,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 152 BOOLEAN NtIsSystemResumeAutomatic ['']
 		case 152: {
-			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) track_return = true;
 			PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, cpu, pc);
 		}; break;
 		
 		// 153 NTSTATUS NtIsUILanguageComitted ['']
 		case 153: {
-			if (PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) track_return = true;
 			PPP_RUN_CB(on_NtIsUILanguageComitted_enter, cpu, pc);
 		}; break;
 		
@@ -2470,7 +3026,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 154: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtListenPort_return)) {
+			if (PPP_CHECK_CB(on_NtListenPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2480,7 +3037,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 155 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 		case 155: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtLoadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -2490,7 +3048,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 156: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2502,7 +3061,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2516,7 +3076,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtLoadKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2537,7 +3098,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtLockFile_return)) {
+			if (PPP_CHECK_CB(on_NtLockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2556,7 +3118,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 160: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2566,7 +3129,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 161 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 		case 161: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLockRegistryKey_enter, cpu, pc, arg0);
@@ -2578,7 +3142,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2590,7 +3155,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 163 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 		case 163: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakePermanentObject_enter, cpu, pc, arg0);
@@ -2599,7 +3165,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 164 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 		case 164: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -2613,7 +3180,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtMapCMFModule_return)) {
+			if (PPP_CHECK_CB(on_NtMapCMFModule_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2629,7 +3197,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2642,7 +3211,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2662,7 +3232,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2680,7 +3251,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 169 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 		case 169: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtModifyBootEntry_enter, cpu, pc, arg0);
@@ -2689,7 +3261,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 170 NTSTATUS NtModifyDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry']
 		case 170: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
+			if (PPP_CHECK_CB(on_NtModifyDriverEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtModifyDriverEntry_enter, cpu, pc, arg0);
@@ -2706,7 +3279,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2732,7 +3306,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2761,7 +3336,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2788,7 +3364,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtNotifyChangeSession_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeSession_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2806,7 +3383,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2821,7 +3399,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2836,7 +3415,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2849,7 +3429,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2865,7 +3446,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+			if (PPP_CHECK_CB(on_NtOpenFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2881,7 +3463,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2894,7 +3477,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2907,7 +3491,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2921,7 +3506,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2935,7 +3521,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2949,7 +3536,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2965,7 +3553,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2980,7 +3569,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+			if (PPP_CHECK_CB(on_NtOpenMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3002,7 +3592,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3025,7 +3616,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) {
+			if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3040,7 +3632,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3054,7 +3647,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3068,7 +3662,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3084,7 +3679,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtOpenResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3099,7 +3695,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3112,7 +3709,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3125,7 +3723,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSession_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSession_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3138,7 +3737,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3152,7 +3752,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3167,7 +3768,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3183,7 +3785,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3198,7 +3801,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3213,7 +3817,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3231,7 +3836,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtOpenTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3247,7 +3853,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3262,7 +3869,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+			if (PPP_CHECK_CB(on_NtPowerInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3276,7 +3884,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 206: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPrepareComplete_return)) {
+			if (PPP_CHECK_CB(on_NtPrepareComplete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3287,7 +3896,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 207: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtPrepareEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3298,7 +3908,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 208: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
+			if (PPP_CHECK_CB(on_NtPrePrepareComplete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3309,7 +3920,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 209: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3321,7 +3933,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3336,7 +3949,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3354,7 +3968,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3371,7 +3986,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtPropagationComplete_return)) {
+			if (PPP_CHECK_CB(on_NtPropagationComplete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3385,7 +4001,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPropagationFailed_return)) {
+			if (PPP_CHECK_CB(on_NtPropagationFailed_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3400,7 +4017,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3414,7 +4032,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 216: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+			if (PPP_CHECK_CB(on_NtPulseEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3425,7 +4044,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 217: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3436,7 +4056,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 218: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3447,7 +4068,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 219: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
+			if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3458,7 +4080,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 220: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3469,7 +4092,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 221: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3479,7 +4103,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 222 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 		case 222: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3498,7 +4123,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3523,7 +4149,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3539,7 +4166,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 225: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3557,7 +4185,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3578,7 +4207,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3592,7 +4222,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 228: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3606,7 +4237,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3623,7 +4255,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3640,7 +4273,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3657,7 +4291,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3674,7 +4309,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3691,7 +4327,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3708,7 +4345,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3725,7 +4363,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3742,7 +4381,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3759,7 +4399,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3776,7 +4417,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3793,7 +4435,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3806,7 +4449,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 241 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 		case 241: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -3816,7 +4460,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 242: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3830,7 +4475,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3847,7 +4493,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3864,7 +4511,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryLicenseValue_return)) {
+			if (PPP_CHECK_CB(on_NtQueryLicenseValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3882,7 +4530,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3900,7 +4549,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3917,7 +4567,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3931,7 +4582,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 249: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3944,7 +4596,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) {
+			if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3957,7 +4610,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 251: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3966,8 +4620,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 252 NTSTATUS NtQueryPortInformationProcess ['']
 		case 252: {
-			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) track_return = true;
 			PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, cpu, pc);
 		}; break;
 		
@@ -3982,7 +4635,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4003,7 +4657,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4021,7 +4676,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4039,7 +4695,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4056,7 +4713,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4071,7 +4729,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4085,7 +4744,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4101,7 +4761,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4117,7 +4778,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4134,7 +4796,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4148,7 +4811,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 263 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 		case 263: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -4161,7 +4825,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4176,7 +4841,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4192,7 +4858,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4211,7 +4878,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4229,7 +4897,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4246,7 +4915,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4264,7 +4934,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) {
+			if (PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4280,7 +4951,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseException_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4296,7 +4968,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4318,7 +4991,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFile_return)) {
+			if (PPP_CHECK_CB(on_NtReadFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4343,7 +5017,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4361,7 +5036,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 275: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4376,7 +5052,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtReadRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4394,7 +5071,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4408,7 +5086,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 278: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtRecoverEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4418,7 +5097,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 279 NTSTATUS NtRecoverResourceManager ['HANDLE ResourceManagerHandle']
 		case 279: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtRecoverResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRecoverResourceManager_enter, cpu, pc, arg0);
@@ -4427,7 +5107,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 280 NTSTATUS NtRecoverTransactionManager ['HANDLE TransactionManagerHandle']
 		case 280: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRecoverTransactionManager_enter, cpu, pc, arg0);
@@ -4440,7 +5121,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) {
+			if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4453,7 +5135,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 282 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 		case 282: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -4465,7 +5148,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4478,7 +5162,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 284: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4490,7 +5175,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4501,7 +5187,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 286 NTSTATUS NtReleaseWorkerFactoryWorker ['HANDLE WorkerFactoryHandle']
 		case 286: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtReleaseWorkerFactoryWorker_enter, cpu, pc, arg0);
@@ -4514,7 +5201,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4532,7 +5220,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4547,7 +5236,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 289: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4558,7 +5248,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 290: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRenameKey_return)) {
+			if (PPP_CHECK_CB(on_NtRenameKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4569,7 +5260,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 291: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtRenameTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4581,7 +5273,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+			if (PPP_CHECK_CB(on_NtReplaceKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4594,7 +5287,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) {
+			if (PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4606,7 +5300,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 294: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4619,7 +5314,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4635,7 +5331,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4649,7 +5346,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 297: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4660,7 +5358,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 298: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4672,7 +5371,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4684,7 +5384,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 300: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtResetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4696,7 +5397,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4709,7 +5411,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+			if (PPP_CHECK_CB(on_NtRestoreKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4720,7 +5423,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 303 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 		case 303: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+			if (PPP_CHECK_CB(on_NtResumeProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtResumeProcess_enter, cpu, pc, arg0);
@@ -4730,7 +5434,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 304: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4741,7 +5446,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 305: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRollbackComplete_return)) {
+			if (PPP_CHECK_CB(on_NtRollbackComplete_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4752,7 +5458,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 306: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtRollbackEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4763,7 +5470,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 307: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtRollbackTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4774,7 +5482,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 308: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4785,7 +5494,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 309: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4797,7 +5507,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4810,7 +5521,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4829,7 +5541,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4845,8 +5558,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 313 NTSTATUS NtSerializeBoot ['']
 		case 313: {
-			if (PPP_CHECK_CB(on_NtSerializeBoot_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtSerializeBoot_return)) track_return = true;
 			PPP_RUN_CB(on_NtSerializeBoot_enter, cpu, pc);
 		}; break;
 		
@@ -4854,7 +5566,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 314: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4865,7 +5578,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 315: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetBootOptions_return)) {
+			if (PPP_CHECK_CB(on_NtSetBootOptions_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4876,7 +5590,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 316: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4888,7 +5603,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4899,7 +5615,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 318 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 		case 318: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -4909,7 +5626,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 319: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4919,7 +5637,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 320 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 		case 320: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -4929,7 +5648,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 321: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4942,7 +5662,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4955,7 +5676,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 323: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtSetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4965,7 +5687,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 324 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 		case 324: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetEventBoostPriority_enter, cpu, pc, arg0);
@@ -4974,7 +5697,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 325 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 		case 325: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -4983,7 +5707,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 326 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 		case 326: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -4996,7 +5721,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5012,7 +5738,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5028,7 +5755,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5044,7 +5772,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5059,7 +5788,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5074,7 +5804,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5089,7 +5820,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5104,7 +5836,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5119,7 +5852,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5134,7 +5868,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5149,7 +5884,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationTransaction_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationTransaction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5164,7 +5900,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5179,7 +5916,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5192,7 +5930,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 340: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5206,7 +5945,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5224,7 +5964,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) {
+			if (PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5243,7 +5984,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5257,7 +5999,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 344 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 		case 344: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -5266,7 +6009,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 345 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 		case 345: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -5278,7 +6022,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5292,7 +6037,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5304,7 +6050,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 348: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5318,7 +6065,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5333,7 +6081,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5346,7 +6095,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5358,7 +6108,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 352: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5369,7 +6120,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 353: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5385,7 +6137,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5403,7 +6156,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetTimerEx_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimerEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5417,7 +6171,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5428,7 +6183,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 357 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 		case 357: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -5442,7 +6198,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5460,7 +6217,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5473,7 +6231,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 360 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 		case 360: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -5483,7 +6242,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 361: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
+			if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5496,7 +6256,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5509,7 +6270,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 363: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
+			if (PPP_CHECK_CB(on_NtSinglePhaseReject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5519,7 +6281,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 364 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 		case 364: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStartProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -5528,7 +6291,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 365 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 		case 365: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStopProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -5537,7 +6301,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 366 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 		case 366: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSuspendProcess_enter, cpu, pc, arg0);
@@ -5547,7 +6312,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 367: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5562,7 +6328,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5577,7 +6344,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 369: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5588,7 +6356,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 370: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5599,7 +6368,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 371: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5608,22 +6378,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 372 NTSTATUS NtTestAlert ['']
 		case 372: {
-			if (PPP_CHECK_CB(on_NtTestAlert_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtTestAlert_return)) track_return = true;
 			PPP_RUN_CB(on_NtTestAlert_enter, cpu, pc);
 		}; break;
 		
 		// 373 NTSTATUS NtThawRegistry ['']
 		case 373: {
-			if (PPP_CHECK_CB(on_NtThawRegistry_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtThawRegistry_return)) track_return = true;
 			PPP_RUN_CB(on_NtThawRegistry_enter, cpu, pc);
 		}; break;
 		
 		// 374 NTSTATUS NtThawTransactions ['']
 		case 374: {
-			if (PPP_CHECK_CB(on_NtThawTransactions_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtThawTransactions_return)) track_return = true;
 			PPP_RUN_CB(on_NtThawTransactions_enter, cpu, pc);
 		}; break;
 		
@@ -5635,7 +6402,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtTraceControl_return)) {
+			if (PPP_CHECK_CB(on_NtTraceControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5652,7 +6420,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
+			if (PPP_CHECK_CB(on_NtTraceEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5667,7 +6436,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5679,7 +6449,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 378 NTSTATUS NtUmsThreadYield ['PVOID SchedulerParam']
 		case 378: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
+			if (PPP_CHECK_CB(on_NtUmsThreadYield_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUmsThreadYield_enter, cpu, pc, arg0);
@@ -5688,7 +6459,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 379 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 		case 379: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -5697,7 +6469,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 380 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 		case 380: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -5707,7 +6480,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 381: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnloadKey2_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKey2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5718,7 +6492,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 382: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5732,7 +6507,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5748,7 +6524,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5761,7 +6538,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 385: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5772,7 +6550,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 386: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+			if (PPP_CHECK_CB(on_NtVdmControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5785,7 +6564,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5800,7 +6580,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5816,7 +6597,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5833,7 +6615,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5848,7 +6631,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5860,7 +6644,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		case 392: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -5870,7 +6655,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 393 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 		case 393: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -5879,7 +6665,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 394 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 		case 394: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -5888,7 +6675,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		// 395 NTSTATUS NtWorkerFactoryWorkerReady ['HANDLE WorkerFactoryHandle']
 		case 395: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
+			if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWorkerFactoryWorkerReady_enter, cpu, pc, arg0);
@@ -5905,7 +6693,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5930,7 +6719,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5952,7 +6742,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5970,7 +6761,8 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -5982,16 +6774,20 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 400 NTSTATUS NtYieldExecution ['']
 		case 400: {
-			if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtYieldExecution_return)) track_return = true;
 			PPP_RUN_CB(on_NtYieldExecution_enter, cpu, pc);
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[R_EAX]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[R_EAX]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,13 +10,309 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_windows_xpsp2_x86(CPUState *cpu) {
+#if defined(TARGET_I386)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[R_EAX];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_windows_xpsp2_x86(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_I386)
+	if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) syscall_subscribe(bitmap, 7);
+	if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_NtAddBootEntry_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) syscall_subscribe(bitmap, 13);
+	if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) syscall_subscribe(bitmap, 17);
+	if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) syscall_subscribe(bitmap, 18);
+	if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) syscall_subscribe(bitmap, 22);
+	if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) syscall_subscribe(bitmap, 25);
+	if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) syscall_subscribe(bitmap, 27);
+	if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) syscall_subscribe(bitmap, 28);
+	if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) syscall_subscribe(bitmap, 30);
+	if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) syscall_subscribe(bitmap, 31);
+	if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) syscall_subscribe(bitmap, 32);
+	if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) syscall_subscribe(bitmap, 35);
+	if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) syscall_subscribe(bitmap, 44);
+	if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) syscall_subscribe(bitmap, 48);
+	if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) syscall_subscribe(bitmap, 53);
+	if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) syscall_subscribe(bitmap, 56);
+	if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) syscall_subscribe(bitmap, 58);
+	if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) syscall_subscribe(bitmap, 59);
+	if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_NtDeleteBootEntry_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) syscall_subscribe(bitmap, 68);
+	if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) syscall_subscribe(bitmap, 69);
+	if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) syscall_subscribe(bitmap, 76);
+	if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) syscall_subscribe(bitmap, 82);
+	if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) syscall_subscribe(bitmap, 84);
+	if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) syscall_subscribe(bitmap, 89);
+	if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) syscall_subscribe(bitmap, 90);
+	if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) syscall_subscribe(bitmap, 98);
+	if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) syscall_subscribe(bitmap, 101);
+	if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) syscall_subscribe(bitmap, 102);
+	if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) syscall_subscribe(bitmap, 109);
+	if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) syscall_subscribe(bitmap, 110);
+	if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) syscall_subscribe(bitmap, 112);
+	if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) syscall_subscribe(bitmap, 113);
+	if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) syscall_subscribe(bitmap, 117);
+	if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) syscall_subscribe(bitmap, 123);
+	if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) syscall_subscribe(bitmap, 127);
+	if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) syscall_subscribe(bitmap, 130);
+	if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) syscall_subscribe(bitmap, 137);
+	if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_NtQueryBootOptions_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) syscall_subscribe(bitmap, 166);
+	if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) syscall_subscribe(bitmap, 167);
+	if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) syscall_subscribe(bitmap, 169);
+	if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) syscall_subscribe(bitmap, 174);
+	if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) syscall_subscribe(bitmap, 177);
+	if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) syscall_subscribe(bitmap, 188);
+	if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) syscall_subscribe(bitmap, 189);
+	if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) syscall_subscribe(bitmap, 193);
+	if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) syscall_subscribe(bitmap, 196);
+	if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_NtSetBootOptions_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) syscall_subscribe(bitmap, 222);
+	if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) syscall_subscribe(bitmap, 223);
+	if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) syscall_subscribe(bitmap, 241);
+	if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) syscall_subscribe(bitmap, 242);
+	if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) syscall_subscribe(bitmap, 243);
+	if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) syscall_subscribe(bitmap, 244);
+	if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) syscall_subscribe(bitmap, 245);
+	if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) syscall_subscribe(bitmap, 246);
+	if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) syscall_subscribe(bitmap, 247);
+	if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) syscall_subscribe(bitmap, 248);
+	if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) syscall_subscribe(bitmap, 249);
+	if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) syscall_subscribe(bitmap, 250);
+	if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) syscall_subscribe(bitmap, 251);
+	if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) syscall_subscribe(bitmap, 252);
+	if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) syscall_subscribe(bitmap, 253);
+	if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) syscall_subscribe(bitmap, 254);
+	if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) syscall_subscribe(bitmap, 255);
+	if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) syscall_subscribe(bitmap, 256);
+	if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) syscall_subscribe(bitmap, 257);
+	if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) syscall_subscribe(bitmap, 258);
+	if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) syscall_subscribe(bitmap, 259);
+	if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) syscall_subscribe(bitmap, 260);
+	if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) syscall_subscribe(bitmap, 261);
+	if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) syscall_subscribe(bitmap, 262);
+	if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) syscall_subscribe(bitmap, 263);
+	if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) syscall_subscribe(bitmap, 264);
+	if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) syscall_subscribe(bitmap, 265);
+	if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) syscall_subscribe(bitmap, 266);
+	if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) syscall_subscribe(bitmap, 267);
+	if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) syscall_subscribe(bitmap, 268);
+	if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) syscall_subscribe(bitmap, 269);
+	if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) syscall_subscribe(bitmap, 270);
+	if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) syscall_subscribe(bitmap, 271);
+	if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) syscall_subscribe(bitmap, 272);
+	if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) syscall_subscribe(bitmap, 273);
+	if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) syscall_subscribe(bitmap, 274);
+	if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) syscall_subscribe(bitmap, 275);
+	if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) syscall_subscribe(bitmap, 276);
+	if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) syscall_subscribe(bitmap, 277);
+	if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) syscall_subscribe(bitmap, 278);
+	if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) syscall_subscribe(bitmap, 279);
+	if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) syscall_subscribe(bitmap, 280);
+	if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) syscall_subscribe(bitmap, 281);
+	if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) syscall_subscribe(bitmap, 282);
+	if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) syscall_subscribe(bitmap, 283);
+#endif
+}
+
 void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[R_EAX];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[R_EAX]) {
 		// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 		case 0: {
@@ -26,7 +322,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -47,7 +344,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -73,7 +371,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -102,7 +401,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -136,7 +436,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -170,7 +471,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -204,7 +506,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -244,7 +547,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
 			uint32_t arg16 = get_32(cpu, 16);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -271,7 +575,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+			if (PPP_CHECK_CB(on_NtAddAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -283,7 +588,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 9: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAddBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtAddBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -298,7 +604,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -317,7 +624,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -332,7 +640,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 12: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -342,7 +651,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 13 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 		case 13: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -351,7 +661,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 14 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 		case 14: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -362,7 +673,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -376,7 +688,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -393,7 +706,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -408,7 +722,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 18: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -419,7 +734,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 19: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -431,7 +747,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -443,7 +760,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 22: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -454,7 +772,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 23: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCancelTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -464,7 +783,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 24 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 		case 24: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+			if (PPP_CHECK_CB(on_NtClearEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -473,7 +793,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 25 NTSTATUS NtClose ['HANDLE Handle']
 		case 25: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClose_return)) {
+			if (PPP_CHECK_CB(on_NtClose_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -484,7 +805,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -496,7 +818,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 27: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
+			if (PPP_CHECK_CB(on_NtCompactKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -508,7 +831,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
+			if (PPP_CHECK_CB(on_NtCompareTokens_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -519,7 +843,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 29 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 		case 29: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -528,7 +853,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 30 NTSTATUS NtCompressKey ['HANDLE Key']
 		case 30: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+			if (PPP_CHECK_CB(on_NtCompressKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompressKey_enter, cpu, pc, arg0);
@@ -544,7 +870,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -561,7 +888,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 32: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtContinue_return)) {
+			if (PPP_CHECK_CB(on_NtContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -574,7 +902,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -588,7 +917,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -603,7 +933,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -618,7 +949,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -639,7 +971,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -661,7 +994,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -675,7 +1009,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -688,7 +1023,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -705,7 +1041,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -727,7 +1064,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -746,7 +1084,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -771,7 +1110,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
 			uint32_t arg13 = get_32(cpu, 13);
-			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -796,7 +1136,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -812,7 +1153,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -832,7 +1174,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -856,7 +1199,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -881,7 +1225,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -904,7 +1249,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -923,7 +1269,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -939,7 +1286,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -958,7 +1306,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+			if (PPP_CHECK_CB(on_NtCreateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -977,7 +1326,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1001,7 +1351,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
-			if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+			if (PPP_CHECK_CB(on_NtCreateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1026,7 +1377,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1040,7 +1392,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1052,7 +1405,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
+			if (PPP_CHECK_CB(on_NtDebugContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1064,7 +1418,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 59: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+			if (PPP_CHECK_CB(on_NtDelayExecution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1074,7 +1429,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 60 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 		case 60: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1083,7 +1439,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 61 NTSTATUS NtDeleteBootEntry ['ULONG Id']
 		case 61: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteBootEntry_enter, cpu, pc, arg0);
@@ -1092,7 +1449,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 62 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 		case 62: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -1101,7 +1459,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 63 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 		case 63: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -1112,7 +1471,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1124,7 +1484,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 65: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1143,7 +1504,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1161,7 +1523,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 67 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 		case 67: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+			if (PPP_CHECK_CB(on_NtDisplayString_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1176,7 +1539,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1196,7 +1560,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1211,7 +1576,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 70: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1226,7 +1592,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1242,7 +1609,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1258,7 +1626,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1273,7 +1642,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 74: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+			if (PPP_CHECK_CB(on_NtExtendSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1288,7 +1658,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+			if (PPP_CHECK_CB(on_NtFilterToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1304,7 +1675,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+			if (PPP_CHECK_CB(on_NtFindAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1316,7 +1688,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 77: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1328,7 +1701,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1339,7 +1713,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 79 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 		case 79: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+			if (PPP_CHECK_CB(on_NtFlushKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -1351,7 +1726,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1362,8 +1738,7 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 81 NTSTATUS NtFlushWriteBuffer ['']
 		case 81: {
-			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) track_return = true;
 			PPP_RUN_CB(on_NtFlushWriteBuffer_enter, cpu, pc);
 		}; break;
 		
@@ -1372,7 +1747,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1386,7 +1762,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1407,7 +1784,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtFsControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1426,7 +1804,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 85: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtGetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1437,7 +1816,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 86: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1450,7 +1830,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1468,7 +1849,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1483,7 +1865,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 89 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 		case 89: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -1493,7 +1876,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 90: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1505,7 +1889,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1516,7 +1901,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 92 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 		case 92: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -1528,7 +1914,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1541,7 +1928,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 94: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1550,8 +1938,7 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 95 BOOLEAN NtIsSystemResumeAutomatic ['']
 		case 95: {
-			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) track_return = true;
 			PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, cpu, pc);
 		}; break;
 		
@@ -1559,7 +1946,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 96: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtListenPort_return)) {
+			if (PPP_CHECK_CB(on_NtListenPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1569,7 +1957,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 97 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 		case 97: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtLoadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -1579,7 +1968,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 98: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1591,7 +1981,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1611,7 +2002,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtLockFile_return)) {
+			if (PPP_CHECK_CB(on_NtLockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1630,7 +2022,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 101: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1640,7 +2033,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 102 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 		case 102: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLockRegistryKey_enter, cpu, pc, arg0);
@@ -1652,7 +2046,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1664,7 +2059,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 104 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 		case 104: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakePermanentObject_enter, cpu, pc, arg0);
@@ -1673,7 +2069,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 105 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 		case 105: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -1684,7 +2081,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1697,7 +2095,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1717,7 +2116,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1735,7 +2135,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 109 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 		case 109: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtModifyBootEntry_enter, cpu, pc, arg0);
@@ -1752,7 +2153,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1778,7 +2180,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1807,7 +2210,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1829,7 +2233,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1842,7 +2247,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1855,7 +2261,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1871,7 +2278,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+			if (PPP_CHECK_CB(on_NtOpenFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1887,7 +2295,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1900,7 +2309,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1913,7 +2323,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1926,7 +2337,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+			if (PPP_CHECK_CB(on_NtOpenMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1948,7 +2360,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1971,7 +2384,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1985,7 +2399,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1999,7 +2414,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2013,7 +2429,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2026,7 +2443,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2039,7 +2457,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2053,7 +2472,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2068,7 +2488,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2084,7 +2505,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2099,7 +2521,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2112,7 +2535,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2127,7 +2551,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+			if (PPP_CHECK_CB(on_NtPowerInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2142,7 +2567,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2158,7 +2584,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2176,7 +2603,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2193,7 +2621,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2207,7 +2636,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 138: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+			if (PPP_CHECK_CB(on_NtPulseEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2218,7 +2648,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 139: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2229,7 +2660,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 140: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2240,7 +2672,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 141: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
+			if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2251,7 +2684,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 142: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2262,7 +2696,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 143: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2272,7 +2707,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 144 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 		case 144: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -2291,7 +2727,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2316,7 +2753,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2339,7 +2777,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2360,7 +2799,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2374,7 +2814,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 149: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2388,7 +2829,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2405,7 +2847,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2422,7 +2865,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2439,7 +2883,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2456,7 +2901,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2473,7 +2919,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2490,7 +2937,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2503,7 +2951,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 157 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 		case 157: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -2513,7 +2962,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 158: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2527,7 +2977,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2544,7 +2995,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2562,7 +3014,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2580,7 +3033,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2597,7 +3051,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2611,7 +3066,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 164: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2622,7 +3078,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 165: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2640,7 +3097,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2661,7 +3119,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2678,7 +3137,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2695,7 +3155,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2710,7 +3171,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2724,7 +3186,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2740,7 +3203,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2756,7 +3220,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2768,7 +3233,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 174 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 		case 174: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -2781,7 +3247,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2796,7 +3263,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2812,7 +3280,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2831,7 +3300,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2849,7 +3319,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2866,7 +3337,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2881,7 +3353,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseException_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2897,7 +3370,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2919,7 +3393,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFile_return)) {
+			if (PPP_CHECK_CB(on_NtReadFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2944,7 +3419,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2966,7 +3442,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtReadRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2984,7 +3461,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2997,7 +3475,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 187 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 		case 187: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -3007,7 +3486,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 188: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3019,7 +3499,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3034,7 +3515,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3048,7 +3530,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 191: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3059,7 +3542,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 192: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRenameKey_return)) {
+			if (PPP_CHECK_CB(on_NtRenameKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3071,7 +3555,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+			if (PPP_CHECK_CB(on_NtReplaceKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3083,7 +3568,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 194: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3096,7 +3582,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3112,7 +3599,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3126,7 +3614,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 197: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3137,7 +3626,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 199: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3149,7 +3639,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3161,7 +3652,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 202: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtResetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3173,7 +3665,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3186,7 +3679,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+			if (PPP_CHECK_CB(on_NtRestoreKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3197,7 +3691,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 205 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 		case 205: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+			if (PPP_CHECK_CB(on_NtResumeProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtResumeProcess_enter, cpu, pc, arg0);
@@ -3207,7 +3702,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 206: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3218,7 +3714,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 207: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3230,7 +3727,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3243,7 +3741,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3262,7 +3761,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3280,7 +3780,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 211: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
+			if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3291,7 +3792,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 212: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetBootOptions_return)) {
+			if (PPP_CHECK_CB(on_NtSetBootOptions_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3302,7 +3804,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 213: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3314,7 +3817,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3325,7 +3829,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 215 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 		case 215: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -3335,7 +3840,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 216: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3345,7 +3851,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 217 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 		case 217: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3357,7 +3864,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3370,7 +3878,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 219: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtSetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3380,7 +3889,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 220 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 		case 220: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetEventBoostPriority_enter, cpu, pc, arg0);
@@ -3389,7 +3899,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 221 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 		case 221: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -3398,7 +3909,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 222 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 		case 222: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3411,7 +3923,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3428,7 +3941,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3444,7 +3958,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3459,7 +3974,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3474,7 +3990,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3489,7 +4006,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3504,7 +4022,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3519,7 +4038,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3532,7 +4052,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 231: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3546,7 +4067,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3564,7 +4086,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3578,7 +4101,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 234 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 		case 234: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -3587,7 +4111,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 235 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 		case 235: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3599,7 +4124,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3613,7 +4139,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3625,7 +4152,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 238: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3639,7 +4167,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3654,7 +4183,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3667,7 +4197,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3679,7 +4210,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 242: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3690,7 +4222,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 243: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3706,7 +4239,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3723,7 +4257,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3734,7 +4269,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 246 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 		case 246: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -3748,7 +4284,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3766,7 +4303,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3779,7 +4317,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 249 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 		case 249: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -3791,7 +4330,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3803,7 +4343,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 251 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 		case 251: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStartProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -3812,7 +4353,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 252 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 		case 252: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStopProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -3821,7 +4363,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 253 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 		case 253: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSuspendProcess_enter, cpu, pc, arg0);
@@ -3831,7 +4374,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 254: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3846,7 +4390,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3861,7 +4406,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 256: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3872,7 +4418,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 257: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3883,7 +4430,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 258: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3892,8 +4440,7 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 259 NTSTATUS NtTestAlert ['']
 		case 259: {
-			if (PPP_CHECK_CB(on_NtTestAlert_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtTestAlert_return)) track_return = true;
 			PPP_RUN_CB(on_NtTestAlert_enter, cpu, pc);
 		}; break;
 		
@@ -3903,7 +4450,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
+			if (PPP_CHECK_CB(on_NtTraceEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3918,7 +4466,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3930,7 +4479,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 262 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 		case 262: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -3939,7 +4489,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 263 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 		case 263: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -3949,7 +4500,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 264: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3963,7 +4515,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3979,7 +4532,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3992,7 +4546,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 267: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4003,7 +4558,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		case 268: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+			if (PPP_CHECK_CB(on_NtVdmControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -4016,7 +4572,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4032,7 +4589,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4047,7 +4605,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4058,7 +4617,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 272 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 		case 272: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -4067,7 +4627,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		// 273 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 		case 273: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -4084,7 +4645,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4109,7 +4671,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4131,7 +4694,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4149,7 +4713,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4161,8 +4726,7 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 278 NTSTATUS NtYieldExecution ['']
 		case 278: {
-			if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtYieldExecution_return)) track_return = true;
 			PPP_RUN_CB(on_NtYieldExecution_enter, cpu, pc);
 		}; break;
 		
@@ -4172,7 +4736,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4186,7 +4751,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4200,7 +4766,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4215,7 +4782,8 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4226,16 +4794,20 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 283 NTSTATUS NtQueryPortInformationProcess ['']
 		case 283: {
-			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) track_return = true;
 			PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, cpu, pc);
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[R_EAX]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[R_EAX]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,13 +10,302 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_windows_xpsp3_x86(CPUState *cpu) {
+#if defined(TARGET_I386)
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return env->regs[R_EAX];
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_windows_xpsp3_x86(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if defined(TARGET_I386)
+	if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) syscall_subscribe(bitmap, 0);
+	if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) syscall_subscribe(bitmap, 1);
+	if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) syscall_subscribe(bitmap, 2);
+	if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) syscall_subscribe(bitmap, 3);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) syscall_subscribe(bitmap, 4);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) syscall_subscribe(bitmap, 5);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) syscall_subscribe(bitmap, 6);
+	if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) syscall_subscribe(bitmap, 7);
+	if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) syscall_subscribe(bitmap, 8);
+	if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) syscall_subscribe(bitmap, 9);
+	if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) syscall_subscribe(bitmap, 10);
+	if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) syscall_subscribe(bitmap, 11);
+	if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) syscall_subscribe(bitmap, 12);
+	if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) syscall_subscribe(bitmap, 13);
+	if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) syscall_subscribe(bitmap, 14);
+	if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) syscall_subscribe(bitmap, 15);
+	if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) syscall_subscribe(bitmap, 16);
+	if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) syscall_subscribe(bitmap, 17);
+	if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) syscall_subscribe(bitmap, 18);
+	if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) syscall_subscribe(bitmap, 19);
+	if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) syscall_subscribe(bitmap, 20);
+	if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) syscall_subscribe(bitmap, 21);
+	if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) syscall_subscribe(bitmap, 22);
+	if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) syscall_subscribe(bitmap, 23);
+	if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) syscall_subscribe(bitmap, 24);
+	if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) syscall_subscribe(bitmap, 25);
+	if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) syscall_subscribe(bitmap, 26);
+	if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) syscall_subscribe(bitmap, 27);
+	if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) syscall_subscribe(bitmap, 28);
+	if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) syscall_subscribe(bitmap, 29);
+	if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) syscall_subscribe(bitmap, 30);
+	if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) syscall_subscribe(bitmap, 31);
+	if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) syscall_subscribe(bitmap, 32);
+	if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) syscall_subscribe(bitmap, 33);
+	if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) syscall_subscribe(bitmap, 34);
+	if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) syscall_subscribe(bitmap, 35);
+	if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) syscall_subscribe(bitmap, 36);
+	if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) syscall_subscribe(bitmap, 37);
+	if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) syscall_subscribe(bitmap, 38);
+	if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) syscall_subscribe(bitmap, 39);
+	if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) syscall_subscribe(bitmap, 40);
+	if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) syscall_subscribe(bitmap, 41);
+	if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) syscall_subscribe(bitmap, 42);
+	if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) syscall_subscribe(bitmap, 43);
+	if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) syscall_subscribe(bitmap, 44);
+	if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) syscall_subscribe(bitmap, 45);
+	if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) syscall_subscribe(bitmap, 46);
+	if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) syscall_subscribe(bitmap, 47);
+	if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) syscall_subscribe(bitmap, 48);
+	if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) syscall_subscribe(bitmap, 49);
+	if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) syscall_subscribe(bitmap, 50);
+	if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) syscall_subscribe(bitmap, 51);
+	if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) syscall_subscribe(bitmap, 52);
+	if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) syscall_subscribe(bitmap, 53);
+	if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) syscall_subscribe(bitmap, 54);
+	if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) syscall_subscribe(bitmap, 55);
+	if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) syscall_subscribe(bitmap, 56);
+	if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) syscall_subscribe(bitmap, 57);
+	if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) syscall_subscribe(bitmap, 58);
+	if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) syscall_subscribe(bitmap, 59);
+	if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) syscall_subscribe(bitmap, 60);
+	if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) syscall_subscribe(bitmap, 61);
+	if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) syscall_subscribe(bitmap, 62);
+	if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) syscall_subscribe(bitmap, 63);
+	if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) syscall_subscribe(bitmap, 64);
+	if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) syscall_subscribe(bitmap, 65);
+	if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) syscall_subscribe(bitmap, 66);
+	if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) syscall_subscribe(bitmap, 67);
+	if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) syscall_subscribe(bitmap, 68);
+	if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) syscall_subscribe(bitmap, 69);
+	if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) syscall_subscribe(bitmap, 70);
+	if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) syscall_subscribe(bitmap, 71);
+	if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) syscall_subscribe(bitmap, 72);
+	if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) syscall_subscribe(bitmap, 73);
+	if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) syscall_subscribe(bitmap, 74);
+	if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) syscall_subscribe(bitmap, 75);
+	if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) syscall_subscribe(bitmap, 76);
+	if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) syscall_subscribe(bitmap, 77);
+	if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) syscall_subscribe(bitmap, 78);
+	if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) syscall_subscribe(bitmap, 79);
+	if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) syscall_subscribe(bitmap, 80);
+	if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) syscall_subscribe(bitmap, 81);
+	if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) syscall_subscribe(bitmap, 82);
+	if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) syscall_subscribe(bitmap, 83);
+	if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) syscall_subscribe(bitmap, 84);
+	if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) syscall_subscribe(bitmap, 85);
+	if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) syscall_subscribe(bitmap, 86);
+	if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) syscall_subscribe(bitmap, 87);
+	if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) syscall_subscribe(bitmap, 88);
+	if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) syscall_subscribe(bitmap, 89);
+	if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) syscall_subscribe(bitmap, 90);
+	if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) syscall_subscribe(bitmap, 91);
+	if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) syscall_subscribe(bitmap, 92);
+	if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) syscall_subscribe(bitmap, 93);
+	if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) syscall_subscribe(bitmap, 94);
+	if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) syscall_subscribe(bitmap, 95);
+	if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) syscall_subscribe(bitmap, 96);
+	if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) syscall_subscribe(bitmap, 97);
+	if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) syscall_subscribe(bitmap, 98);
+	if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) syscall_subscribe(bitmap, 99);
+	if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) syscall_subscribe(bitmap, 100);
+	if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) syscall_subscribe(bitmap, 101);
+	if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) syscall_subscribe(bitmap, 102);
+	if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) syscall_subscribe(bitmap, 103);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) syscall_subscribe(bitmap, 104);
+	if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) syscall_subscribe(bitmap, 105);
+	if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) syscall_subscribe(bitmap, 106);
+	if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) syscall_subscribe(bitmap, 107);
+	if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) syscall_subscribe(bitmap, 108);
+	if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) syscall_subscribe(bitmap, 109);
+	if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) syscall_subscribe(bitmap, 110);
+	if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) syscall_subscribe(bitmap, 111);
+	if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) syscall_subscribe(bitmap, 112);
+	if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) syscall_subscribe(bitmap, 113);
+	if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) syscall_subscribe(bitmap, 114);
+	if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) syscall_subscribe(bitmap, 115);
+	if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) syscall_subscribe(bitmap, 116);
+	if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) syscall_subscribe(bitmap, 117);
+	if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) syscall_subscribe(bitmap, 118);
+	if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) syscall_subscribe(bitmap, 119);
+	if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) syscall_subscribe(bitmap, 120);
+	if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) syscall_subscribe(bitmap, 121);
+	if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) syscall_subscribe(bitmap, 122);
+	if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) syscall_subscribe(bitmap, 123);
+	if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) syscall_subscribe(bitmap, 124);
+	if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) syscall_subscribe(bitmap, 125);
+	if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) syscall_subscribe(bitmap, 126);
+	if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) syscall_subscribe(bitmap, 127);
+	if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) syscall_subscribe(bitmap, 128);
+	if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) syscall_subscribe(bitmap, 129);
+	if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) syscall_subscribe(bitmap, 130);
+	if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) syscall_subscribe(bitmap, 131);
+	if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) syscall_subscribe(bitmap, 132);
+	if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) syscall_subscribe(bitmap, 133);
+	if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) syscall_subscribe(bitmap, 134);
+	if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) syscall_subscribe(bitmap, 135);
+	if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) syscall_subscribe(bitmap, 136);
+	if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) syscall_subscribe(bitmap, 137);
+	if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) syscall_subscribe(bitmap, 138);
+	if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) syscall_subscribe(bitmap, 139);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) syscall_subscribe(bitmap, 140);
+	if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) syscall_subscribe(bitmap, 141);
+	if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) syscall_subscribe(bitmap, 142);
+	if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) syscall_subscribe(bitmap, 143);
+	if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) syscall_subscribe(bitmap, 144);
+	if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) syscall_subscribe(bitmap, 145);
+	if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) syscall_subscribe(bitmap, 146);
+	if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) syscall_subscribe(bitmap, 147);
+	if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) syscall_subscribe(bitmap, 148);
+	if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) syscall_subscribe(bitmap, 149);
+	if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) syscall_subscribe(bitmap, 150);
+	if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) syscall_subscribe(bitmap, 151);
+	if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) syscall_subscribe(bitmap, 152);
+	if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) syscall_subscribe(bitmap, 153);
+	if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) syscall_subscribe(bitmap, 154);
+	if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) syscall_subscribe(bitmap, 155);
+	if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) syscall_subscribe(bitmap, 156);
+	if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) syscall_subscribe(bitmap, 157);
+	if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) syscall_subscribe(bitmap, 158);
+	if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) syscall_subscribe(bitmap, 159);
+	if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) syscall_subscribe(bitmap, 160);
+	if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) syscall_subscribe(bitmap, 161);
+	if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) syscall_subscribe(bitmap, 162);
+	if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) syscall_subscribe(bitmap, 163);
+	if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) syscall_subscribe(bitmap, 164);
+	if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) syscall_subscribe(bitmap, 165);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) syscall_subscribe(bitmap, 166);
+	if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) syscall_subscribe(bitmap, 167);
+	if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) syscall_subscribe(bitmap, 168);
+	if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) syscall_subscribe(bitmap, 169);
+	if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) syscall_subscribe(bitmap, 170);
+	if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) syscall_subscribe(bitmap, 171);
+	if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) syscall_subscribe(bitmap, 172);
+	if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) syscall_subscribe(bitmap, 173);
+	if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) syscall_subscribe(bitmap, 174);
+	if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) syscall_subscribe(bitmap, 175);
+	if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) syscall_subscribe(bitmap, 176);
+	if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) syscall_subscribe(bitmap, 177);
+	if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) syscall_subscribe(bitmap, 178);
+	if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) syscall_subscribe(bitmap, 179);
+	if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) syscall_subscribe(bitmap, 180);
+	if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) syscall_subscribe(bitmap, 181);
+	if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) syscall_subscribe(bitmap, 182);
+	if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) syscall_subscribe(bitmap, 183);
+	if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) syscall_subscribe(bitmap, 184);
+	if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) syscall_subscribe(bitmap, 185);
+	if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) syscall_subscribe(bitmap, 186);
+	if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) syscall_subscribe(bitmap, 187);
+	if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) syscall_subscribe(bitmap, 188);
+	if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) syscall_subscribe(bitmap, 189);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) syscall_subscribe(bitmap, 190);
+	if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) syscall_subscribe(bitmap, 191);
+	if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) syscall_subscribe(bitmap, 192);
+	if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) syscall_subscribe(bitmap, 194);
+	if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) syscall_subscribe(bitmap, 195);
+	if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) syscall_subscribe(bitmap, 197);
+	if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) syscall_subscribe(bitmap, 198);
+	if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) syscall_subscribe(bitmap, 199);
+	if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) syscall_subscribe(bitmap, 200);
+	if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) syscall_subscribe(bitmap, 201);
+	if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) syscall_subscribe(bitmap, 202);
+	if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) syscall_subscribe(bitmap, 203);
+	if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) syscall_subscribe(bitmap, 204);
+	if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) syscall_subscribe(bitmap, 205);
+	if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) syscall_subscribe(bitmap, 206);
+	if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) syscall_subscribe(bitmap, 207);
+	if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) syscall_subscribe(bitmap, 208);
+	if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) syscall_subscribe(bitmap, 209);
+	if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) syscall_subscribe(bitmap, 210);
+	if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) syscall_subscribe(bitmap, 211);
+	if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) syscall_subscribe(bitmap, 212);
+	if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) syscall_subscribe(bitmap, 213);
+	if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) syscall_subscribe(bitmap, 214);
+	if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) syscall_subscribe(bitmap, 215);
+	if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) syscall_subscribe(bitmap, 216);
+	if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) syscall_subscribe(bitmap, 217);
+	if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) syscall_subscribe(bitmap, 218);
+	if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) syscall_subscribe(bitmap, 219);
+	if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) syscall_subscribe(bitmap, 220);
+	if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) syscall_subscribe(bitmap, 221);
+	if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) syscall_subscribe(bitmap, 222);
+	if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) syscall_subscribe(bitmap, 223);
+	if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) syscall_subscribe(bitmap, 224);
+	if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) syscall_subscribe(bitmap, 225);
+	if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) syscall_subscribe(bitmap, 226);
+	if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) syscall_subscribe(bitmap, 227);
+	if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) syscall_subscribe(bitmap, 228);
+	if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) syscall_subscribe(bitmap, 229);
+	if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) syscall_subscribe(bitmap, 230);
+	if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) syscall_subscribe(bitmap, 231);
+	if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) syscall_subscribe(bitmap, 232);
+	if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) syscall_subscribe(bitmap, 233);
+	if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) syscall_subscribe(bitmap, 234);
+	if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) syscall_subscribe(bitmap, 235);
+	if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) syscall_subscribe(bitmap, 236);
+	if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) syscall_subscribe(bitmap, 237);
+	if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) syscall_subscribe(bitmap, 238);
+	if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) syscall_subscribe(bitmap, 239);
+	if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) syscall_subscribe(bitmap, 240);
+	if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) syscall_subscribe(bitmap, 241);
+	if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) syscall_subscribe(bitmap, 242);
+	if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) syscall_subscribe(bitmap, 243);
+	if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) syscall_subscribe(bitmap, 244);
+	if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) syscall_subscribe(bitmap, 245);
+	if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) syscall_subscribe(bitmap, 246);
+	if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) syscall_subscribe(bitmap, 247);
+	if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) syscall_subscribe(bitmap, 248);
+	if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) syscall_subscribe(bitmap, 249);
+	if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) syscall_subscribe(bitmap, 250);
+	if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) syscall_subscribe(bitmap, 251);
+	if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) syscall_subscribe(bitmap, 252);
+	if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) syscall_subscribe(bitmap, 253);
+	if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) syscall_subscribe(bitmap, 254);
+	if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) syscall_subscribe(bitmap, 255);
+	if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) syscall_subscribe(bitmap, 256);
+	if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) syscall_subscribe(bitmap, 257);
+	if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) syscall_subscribe(bitmap, 258);
+	if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) syscall_subscribe(bitmap, 259);
+	if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) syscall_subscribe(bitmap, 260);
+	if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) syscall_subscribe(bitmap, 261);
+	if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) syscall_subscribe(bitmap, 262);
+	if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) syscall_subscribe(bitmap, 263);
+	if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) syscall_subscribe(bitmap, 264);
+	if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) syscall_subscribe(bitmap, 265);
+	if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) syscall_subscribe(bitmap, 266);
+	if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) syscall_subscribe(bitmap, 267);
+	if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) syscall_subscribe(bitmap, 268);
+	if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) syscall_subscribe(bitmap, 269);
+	if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) syscall_subscribe(bitmap, 270);
+	if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) syscall_subscribe(bitmap, 271);
+	if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) syscall_subscribe(bitmap, 272);
+	if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) syscall_subscribe(bitmap, 273);
+	if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) syscall_subscribe(bitmap, 274);
+	if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) syscall_subscribe(bitmap, 275);
+#endif
+}
+
 void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = env->regs[R_EAX];
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch(env->regs[R_EAX]) {
 		// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 		case 0: {
@@ -26,7 +315,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -47,7 +337,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -73,7 +364,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -102,7 +394,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -136,7 +429,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -170,7 +464,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -204,7 +499,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg13 = get_32(cpu, 13);
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -244,7 +540,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg14 = get_32(cpu, 14);
 			uint32_t arg15 = get_32(cpu, 15);
 			uint32_t arg16 = get_32(cpu, 16);
-			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
+			if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -271,7 +568,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAddAtom_return)) {
+			if (PPP_CHECK_CB(on_NtAddAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -283,7 +581,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 9: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -298,7 +597,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -317,7 +617,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
+			if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -332,7 +633,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 12: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -342,7 +644,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 13 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 		case 13: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+			if (PPP_CHECK_CB(on_NtAlertThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -351,7 +654,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 14 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 		case 14: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -362,7 +666,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -376,7 +681,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateUuids_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -393,7 +699,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -408,7 +715,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 18: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
+			if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -419,7 +727,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 19: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -431,7 +740,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
+			if (PPP_CHECK_CB(on_NtCallbackReturn_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -442,7 +752,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 21 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 		case 21: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+			if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtModifyBootEntry_enter, cpu, pc, arg0);
@@ -452,7 +763,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 22: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
+			if (PPP_CHECK_CB(on_NtCancelIoFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -463,7 +775,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 23: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCancelTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -473,7 +786,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 24 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 		case 24: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+			if (PPP_CHECK_CB(on_NtClearEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -482,7 +796,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 25 NTSTATUS NtClose ['HANDLE Handle']
 		case 25: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtClose_return)) {
+			if (PPP_CHECK_CB(on_NtClose_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -493,7 +808,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -505,7 +821,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 27: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
+			if (PPP_CHECK_CB(on_NtCompactKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -517,7 +834,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
+			if (PPP_CHECK_CB(on_NtCompareTokens_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -528,7 +846,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 29 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 		case 29: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -537,7 +856,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 30 NTSTATUS NtCompressKey ['HANDLE Key']
 		case 30: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+			if (PPP_CHECK_CB(on_NtCompressKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtCompressKey_enter, cpu, pc, arg0);
@@ -553,7 +873,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -570,7 +891,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 32: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtContinue_return)) {
+			if (PPP_CHECK_CB(on_NtContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -583,7 +905,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -597,7 +920,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -612,7 +936,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -627,7 +952,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtCreateEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -648,7 +974,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtCreateFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -670,7 +997,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -684,7 +1012,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -697,7 +1026,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
+			if (PPP_CHECK_CB(on_NtCreateJobSet_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -714,7 +1044,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateKey_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -736,7 +1067,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -755,7 +1087,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
+			if (PPP_CHECK_CB(on_NtCreateMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -780,7 +1113,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
 			uint32_t arg13 = get_32(cpu, 13);
-			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -805,7 +1139,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -821,7 +1156,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreatePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -841,7 +1177,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -865,7 +1202,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -890,7 +1228,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
+			if (PPP_CHECK_CB(on_NtCreateProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -913,7 +1252,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtCreateSection_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -932,7 +1272,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			int32_t arg3 = get_s32(cpu, 3);
 			int32_t arg4 = get_s32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -948,7 +1289,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -967,7 +1309,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
-			if (PPP_CHECK_CB(on_NtCreateThread_return)) {
+			if (PPP_CHECK_CB(on_NtCreateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -986,7 +1329,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
+			if (PPP_CHECK_CB(on_NtCreateTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1010,7 +1354,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
 			uint32_t arg12 = get_32(cpu, 12);
-			if (PPP_CHECK_CB(on_NtCreateToken_return)) {
+			if (PPP_CHECK_CB(on_NtCreateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1035,7 +1380,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
+			if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1049,7 +1395,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 57: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
+			if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1061,7 +1408,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
+			if (PPP_CHECK_CB(on_NtDebugContinue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1073,7 +1421,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 59: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
+			if (PPP_CHECK_CB(on_NtDelayExecution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1083,7 +1432,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 60 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 		case 60: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1092,7 +1442,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 61 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 		case 61: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -1101,7 +1452,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 62 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 		case 62: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -1112,7 +1464,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1124,7 +1477,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 64: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1143,7 +1497,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1161,7 +1516,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 66 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 		case 66: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+			if (PPP_CHECK_CB(on_NtDisplayString_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1176,7 +1532,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1196,7 +1553,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
+			if (PPP_CHECK_CB(on_NtDuplicateToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1215,7 +1573,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1231,7 +1590,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1247,7 +1607,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1262,7 +1623,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 72: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtExtendSection_return)) {
+			if (PPP_CHECK_CB(on_NtExtendSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1277,7 +1639,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtFilterToken_return)) {
+			if (PPP_CHECK_CB(on_NtFilterToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1293,7 +1656,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFindAtom_return)) {
+			if (PPP_CHECK_CB(on_NtFindAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1305,7 +1669,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 75: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
+			if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1317,7 +1682,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
+			if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1328,7 +1694,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 77 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 		case 77: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+			if (PPP_CHECK_CB(on_NtFlushKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -1340,7 +1707,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1351,8 +1719,7 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 79 NTSTATUS NtFlushWriteBuffer ['']
 		case 79: {
-			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) track_return = true;
 			PPP_RUN_CB(on_NtFlushWriteBuffer_enter, cpu, pc);
 		}; break;
 		
@@ -1361,7 +1728,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1375,7 +1743,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1396,7 +1765,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
+			if (PPP_CHECK_CB(on_NtFsControlFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1415,7 +1785,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 83: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtGetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1426,7 +1797,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 84: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
+			if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1439,7 +1811,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
+			if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1457,7 +1830,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1472,7 +1846,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 87 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 		case 87: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -1482,7 +1857,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 88: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1494,7 +1870,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
+			if (PPP_CHECK_CB(on_NtImpersonateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1505,7 +1882,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 90 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 		case 90: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+			if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -1517,7 +1895,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
+			if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1530,7 +1909,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 92: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
+			if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1539,8 +1919,7 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 93 BOOLEAN NtIsSystemResumeAutomatic ['']
 		case 93: {
-			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) track_return = true;
 			PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, cpu, pc);
 		}; break;
 		
@@ -1548,7 +1927,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 94: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtListenPort_return)) {
+			if (PPP_CHECK_CB(on_NtListenPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1558,7 +1938,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 95 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 		case 95: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtLoadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -1568,7 +1949,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 96: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLoadKey_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1580,7 +1962,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
+			if (PPP_CHECK_CB(on_NtLoadKey2_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1600,7 +1983,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtLockFile_return)) {
+			if (PPP_CHECK_CB(on_NtLockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1619,7 +2003,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 99: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
+			if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -1629,7 +2014,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 100 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 		case 100: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+			if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtLockRegistryKey_enter, cpu, pc, arg0);
@@ -1641,7 +2027,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1653,7 +2040,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 102 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 		case 102: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakePermanentObject_enter, cpu, pc, arg0);
@@ -1662,7 +2050,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 103 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 		case 103: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+			if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -1673,7 +2062,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1686,7 +2076,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
+			if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1706,7 +2097,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1732,7 +2124,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1758,7 +2151,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
-			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1787,7 +2181,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
+			if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1809,7 +2204,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1822,7 +2218,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1835,7 +2232,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtOpenEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1851,7 +2249,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtOpenFile_return)) {
+			if (PPP_CHECK_CB(on_NtOpenFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1867,7 +2266,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1880,7 +2280,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1893,7 +2294,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKey_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1906,7 +2308,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
+			if (PPP_CHECK_CB(on_NtOpenMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1928,7 +2331,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
 			uint32_t arg11 = get_32(cpu, 11);
-			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1951,7 +2355,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1965,7 +2370,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1979,7 +2385,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -1993,7 +2400,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSection_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2006,7 +2414,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2019,7 +2428,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2033,7 +2443,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThread_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2048,7 +2459,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2064,7 +2476,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
+			if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2079,7 +2492,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
+			if (PPP_CHECK_CB(on_NtOpenTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2092,7 +2506,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
+			if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2107,7 +2522,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
+			if (PPP_CHECK_CB(on_NtPowerInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2122,7 +2538,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2138,7 +2555,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2156,7 +2574,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
+			if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2173,7 +2592,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2187,7 +2607,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 135: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
+			if (PPP_CHECK_CB(on_NtPulseEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2198,7 +2619,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 136: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2209,7 +2631,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 137: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2220,7 +2643,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 138: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2230,7 +2654,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 139 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 		case 139: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -2249,7 +2674,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg8 = get_32(cpu, 8);
 			uint32_t arg9 = get_32(cpu, 9);
 			uint32_t arg10 = get_32(cpu, 10);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2274,7 +2700,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2297,7 +2724,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2318,7 +2746,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
+			if (PPP_CHECK_CB(on_NtQueryEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2332,7 +2761,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 144: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2346,7 +2776,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2363,7 +2794,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2380,7 +2812,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2397,7 +2830,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2414,7 +2848,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2431,7 +2866,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2448,7 +2884,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2461,7 +2898,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 152 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 		case 152: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -2471,7 +2909,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 153: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2485,7 +2924,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2502,7 +2942,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2520,7 +2961,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2538,7 +2980,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
+			if (PPP_CHECK_CB(on_NtQueryMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2555,7 +2998,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryObject_return)) {
+			if (PPP_CHECK_CB(on_NtQueryObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2569,7 +3013,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 159: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
+			if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2580,7 +3025,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 160: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
+			if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2598,7 +3044,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2619,7 +3066,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySection_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2636,7 +3084,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2653,7 +3102,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2668,7 +3118,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2682,7 +3133,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2698,7 +3150,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2714,7 +3167,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2726,7 +3180,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 169 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 		case 169: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -2739,7 +3194,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2754,7 +3210,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2770,7 +3227,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtQueryValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2789,7 +3247,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2807,7 +3266,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2824,7 +3284,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
+			if (PPP_CHECK_CB(on_NtQueueApcThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2839,7 +3300,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRaiseException_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseException_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2855,7 +3317,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
+			if (PPP_CHECK_CB(on_NtRaiseHardError_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2877,7 +3340,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFile_return)) {
+			if (PPP_CHECK_CB(on_NtReadFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2902,7 +3366,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
+			if (PPP_CHECK_CB(on_NtReadFileScatter_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2924,7 +3389,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtReadRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2942,7 +3408,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2955,7 +3422,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 182 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 		case 182: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+			if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -2965,7 +3433,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 183: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseMutant_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -2977,7 +3446,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			int32_t arg1 = get_s32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(int32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -2992,7 +3462,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3006,7 +3477,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 186: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
+			if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3017,7 +3489,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 187: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRenameKey_return)) {
+			if (PPP_CHECK_CB(on_NtRenameKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3029,7 +3502,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
+			if (PPP_CHECK_CB(on_NtReplaceKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3041,7 +3515,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 189: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3054,7 +3529,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3070,7 +3546,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3084,7 +3561,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 192: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3095,7 +3573,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 194: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtRequestPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3107,7 +3586,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
+			if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3119,7 +3599,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 197: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtResetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3131,7 +3612,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
+			if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3144,7 +3626,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
+			if (PPP_CHECK_CB(on_NtRestoreKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3155,7 +3638,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 200 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 		case 200: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+			if (PPP_CHECK_CB(on_NtResumeProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtResumeProcess_enter, cpu, pc, arg0);
@@ -3165,7 +3649,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 201: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtResumeThread_return)) {
+			if (PPP_CHECK_CB(on_NtResumeThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3176,7 +3661,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 202: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSaveKey_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3188,7 +3674,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3201,7 +3688,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
+			if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3220,7 +3708,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
+			if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3238,7 +3727,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 206: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetContextThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3250,7 +3740,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
+			if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3261,7 +3752,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 208 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 		case 208: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -3271,7 +3763,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 209: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3281,7 +3774,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 210 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 		case 210: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+			if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3293,7 +3787,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetEaFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3306,7 +3801,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 212: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetEvent_return)) {
+			if (PPP_CHECK_CB(on_NtSetEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3316,7 +3812,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 213 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 		case 213: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+			if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetEventBoostPriority_enter, cpu, pc, arg0);
@@ -3325,7 +3822,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 214 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 		case 214: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -3334,7 +3832,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 215 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 		case 215: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3347,7 +3846,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3364,7 +3864,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3380,7 +3881,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3395,7 +3897,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3410,7 +3913,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3425,7 +3929,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3440,7 +3945,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3455,7 +3961,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
+			if (PPP_CHECK_CB(on_NtSetInformationToken_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3468,7 +3975,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 224: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
+			if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3482,7 +3990,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
+			if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3500,7 +4009,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
+			if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3514,7 +4024,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 227 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 		case 227: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -3523,7 +4034,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 228 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 		case 228: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3535,7 +4047,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3549,7 +4062,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
+			if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3561,7 +4075,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 231: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3573,7 +4088,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3586,7 +4102,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3598,7 +4115,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 234: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
+			if (PPP_CHECK_CB(on_NtSetSystemTime_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3609,7 +4127,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 235: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
+			if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3625,7 +4144,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg4 = get_32(cpu, 4);
 			int32_t arg5 = get_s32(cpu, 5);
 			uint32_t arg6 = get_32(cpu, 6);
-			if (PPP_CHECK_CB(on_NtSetTimer_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimer_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3642,7 +4162,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
+			if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3653,7 +4174,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 238 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 		case 238: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+			if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -3667,7 +4189,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
+			if (PPP_CHECK_CB(on_NtSetValueKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3685,7 +4208,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
+			if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3698,7 +4222,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 241 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 		case 241: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+			if (PPP_CHECK_CB(on_NtShutdownSystem_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -3710,7 +4235,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3722,7 +4248,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 243 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 		case 243: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStartProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -3731,7 +4258,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 244 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 		case 244: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+			if (PPP_CHECK_CB(on_NtStopProfile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -3740,7 +4268,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 245 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 		case 245: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtSuspendProcess_enter, cpu, pc, arg0);
@@ -3750,7 +4279,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 246: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
+			if (PPP_CHECK_CB(on_NtSuspendThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3765,7 +4295,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
+			if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3780,7 +4311,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 248: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3791,7 +4323,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 249: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateProcess_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3802,7 +4335,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 250: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
+			if (PPP_CHECK_CB(on_NtTerminateThread_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3811,8 +4345,7 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 251 NTSTATUS NtTestAlert ['']
 		case 251: {
-			if (PPP_CHECK_CB(on_NtTestAlert_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtTestAlert_return)) track_return = true;
 			PPP_RUN_CB(on_NtTestAlert_enter, cpu, pc);
 		}; break;
 		
@@ -3822,7 +4355,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
+			if (PPP_CHECK_CB(on_NtTraceEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3837,7 +4371,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
+			if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3849,7 +4384,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 254 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 		case 254: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadDriver_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -3858,7 +4394,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 255 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 		case 255: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKey_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -3868,7 +4405,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 256: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
+			if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3882,7 +4420,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3898,7 +4437,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3911,7 +4451,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 259: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
+			if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3922,7 +4463,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		case 260: {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
-			if (PPP_CHECK_CB(on_NtVdmControl_return)) {
+			if (PPP_CHECK_CB(on_NtVdmControl_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 			}
@@ -3935,7 +4477,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3951,7 +4494,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3966,7 +4510,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -3977,7 +4522,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 264 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 		case 264: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3986,7 +4532,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		// 265 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 		case 265: {
 			uint32_t arg0 = get_32(cpu, 0);
-			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+			if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 			}
 			PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -4003,7 +4550,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFile_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFile_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4028,7 +4576,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg6 = get_32(cpu, 6);
 			uint32_t arg7 = get_32(cpu, 7);
 			uint32_t arg8 = get_32(cpu, 8);
-			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
+			if (PPP_CHECK_CB(on_NtWriteFileGather_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4050,7 +4599,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
 			uint32_t arg5 = get_32(cpu, 5);
-			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
+			if (PPP_CHECK_CB(on_NtWriteRequestData_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4068,7 +4618,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
 			uint32_t arg4 = get_32(cpu, 4);
-			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
+			if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4080,8 +4631,7 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 270 NTSTATUS NtYieldExecution ['']
 		case 270: {
-			if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtYieldExecution_return)) track_return = true;
 			PPP_RUN_CB(on_NtYieldExecution_enter, cpu, pc);
 		}; break;
 		
@@ -4091,7 +4641,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4105,7 +4656,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg0 = get_32(cpu, 0);
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
-			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4119,7 +4671,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4134,7 +4687,8 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 			uint32_t arg1 = get_32(cpu, 1);
 			uint32_t arg2 = get_32(cpu, 2);
 			uint32_t arg3 = get_32(cpu, 3);
-			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
+			if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) track_return = true;
+			if (track_return) {
 				memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 				memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 				memcpy(rp.params[2], &arg2, sizeof(uint32_t));
@@ -4145,16 +4699,20 @@ void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ulong pc) {
 		
 		// 275 NTSTATUS NtQueryPortInformationProcess ['']
 		case 275: {
-			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
-			}
+			if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) track_return = true;
 			PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, cpu, pc);
 		}; break;
 		
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, env->regs[R_EAX]);
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, env->regs[R_EAX]);
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
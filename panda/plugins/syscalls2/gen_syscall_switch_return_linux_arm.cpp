@@ -10,7 +10,7 @@ extern "C" {
 }
 
 void syscall_return_switch_linux_arm(CPUState *cpu, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {
-#ifdef TARGET_ARM
+#if defined(TARGET_ARM)
 	switch(ordinal) {
 		// 0 long sys_restart_syscall ['void']
 		case 0: {
@@ -10,7 +10,7 @@ extern "C" {
 }
 
 void syscall_return_switch_linux_x86(CPUState *cpu, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	switch(ordinal) {
 		// 0 long sys_restart_syscall ['void']
 		case 0: {
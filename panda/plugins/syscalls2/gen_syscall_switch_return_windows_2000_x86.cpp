@@ -10,7 +10,7 @@ extern "C" {
 }
 
 void syscall_return_switch_windows_2000_x86(CPUState *cpu, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {
-#ifdef TARGET_I386
+#if defined(TARGET_I386)
 	switch(ordinal) {
 		// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 		case 0: {
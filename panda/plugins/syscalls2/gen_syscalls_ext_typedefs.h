@@ -1,4 +1,4 @@
-#ifdef TARGET_ARM
+#if defined(TARGET_ARM)
 typedef void (*on_ARM_breakpoint_enter_t)(CPUState* cpu, target_ulong pc);
 typedef void (*on_ARM_breakpoint_return_t)(CPUState* cpu, target_ulong pc);
 typedef void (*on_ARM_cacheflush_enter_t)(CPUState* cpu, target_ulong pc, uint32_t start, uint32_t end, uint32_t flags);
@@ -636,7 +636,1451 @@ typedef void (*on_sys_writev_return_t)(CPUState* cpu, target_ulong pc, uint32_t
 typedef void (*on_vfork_enter_t)(CPUState* cpu, target_ulong pc);
 typedef void (*on_vfork_return_t)(CPUState* cpu, target_ulong pc);
 #endif
-#ifdef TARGET_I386
+#if defined(TARGET_X86_64)
+typedef void (*on_x64_get_thread_area_enter_t)(CPUState* cpu, target_ulong pc, uint64_t u_info);
+typedef void (*on_x64_get_thread_area_return_t)(CPUState* cpu, target_ulong pc, uint64_t u_info);
+typedef void (*on_x64_NtAcceptConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ConnectionRequest, uint32_t AcceptConnection, uint64_t ServerView, uint64_t ClientView);
+typedef void (*on_x64_NtAcceptConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ConnectionRequest, uint32_t AcceptConnection, uint64_t ServerView, uint64_t ClientView);
+typedef void (*on_x64_NtAccessCheck_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheck_return_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheckAndAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint32_t DesiredAccess, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckAndAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint32_t DesiredAccess, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByType_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheckByType_return_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheckByTypeAndAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByTypeAndAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByTypeResultList_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheckByTypeResultList_return_t)(CPUState* cpu, target_ulong pc, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint64_t PrivilegeSet, uint64_t PrivilegeSetLength, uint64_t GrantedAccess, uint64_t AccessStatus);
+typedef void (*on_x64_NtAccessCheckByTypeResultListAndAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByTypeResultListAndAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ClientToken, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ClientToken, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t PrincipalSelfSid, uint32_t DesiredAccess, uint32_t AuditType, uint32_t Flags, uint64_t ObjectTypeList, uint32_t ObjectTypeListLength, uint64_t GenericMapping, uint32_t ObjectCreation, uint64_t GrantedAccess, uint64_t AccessStatus, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtAddAtom_enter_t)(CPUState* cpu, target_ulong pc, uint64_t AtomName, uint32_t Length, uint64_t Atom);
+typedef void (*on_x64_NtAddAtom_return_t)(CPUState* cpu, target_ulong pc, uint64_t AtomName, uint32_t Length, uint64_t Atom);
+typedef void (*on_x64_NtAddBootEntry_enter_t)(CPUState* cpu, target_ulong pc, uint64_t BootEntry, uint64_t Id);
+typedef void (*on_x64_NtAddBootEntry_return_t)(CPUState* cpu, target_ulong pc, uint64_t BootEntry, uint64_t Id);
+typedef void (*on_x64_NtAddDriverEntry_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DriverEntry, uint64_t Id);
+typedef void (*on_x64_NtAddDriverEntry_return_t)(CPUState* cpu, target_ulong pc, uint64_t DriverEntry, uint64_t Id);
+typedef void (*on_x64_NtAdjustGroupsToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t ResetToDefault, uint64_t NewState, uint32_t BufferLength, uint64_t PreviousState, uint64_t ReturnLength);
+typedef void (*on_x64_NtAdjustGroupsToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t ResetToDefault, uint64_t NewState, uint32_t BufferLength, uint64_t PreviousState, uint64_t ReturnLength);
+typedef void (*on_x64_NtAdjustPrivilegesToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t DisableAllPrivileges, uint64_t NewState, uint32_t BufferLength, uint64_t PreviousState, uint64_t ReturnLength);
+typedef void (*on_x64_NtAdjustPrivilegesToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t DisableAllPrivileges, uint64_t NewState, uint32_t BufferLength, uint64_t PreviousState, uint64_t ReturnLength);
+typedef void (*on_x64_NtAlertResumeThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtAlertResumeThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtAlertThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle);
+typedef void (*on_x64_NtAlertThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle);
+typedef void (*on_x64_NtAllocateLocallyUniqueId_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Luid);
+typedef void (*on_x64_NtAllocateLocallyUniqueId_return_t)(CPUState* cpu, target_ulong pc, uint64_t Luid);
+typedef void (*on_x64_NtAllocateReserveObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MemoryReserveHandle, uint64_t ObjectAttributes, uint32_t Type);
+typedef void (*on_x64_NtAllocateReserveObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t MemoryReserveHandle, uint64_t ObjectAttributes, uint32_t Type);
+typedef void (*on_x64_NtAllocateUserPhysicalPages_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtAllocateUserPhysicalPages_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtAllocateUuids_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Time, uint64_t Range, uint64_t Sequence, uint64_t Seed);
+typedef void (*on_x64_NtAllocateUuids_return_t)(CPUState* cpu, target_ulong pc, uint64_t Time, uint64_t Range, uint64_t Sequence, uint64_t Seed);
+typedef void (*on_x64_NtAllocateVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t ZeroBits, uint64_t RegionSize, uint32_t AllocationType, uint32_t Protect);
+typedef void (*on_x64_NtAllocateVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t ZeroBits, uint64_t RegionSize, uint32_t AllocationType, uint32_t Protect);
+typedef void (*on_x64_NtAlpcAcceptConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ConnectionPortHandle, uint32_t Flags, uint64_t ObjectAttributes, uint64_t PortAttributes, uint64_t PortContext, uint64_t ConnectionRequest, uint64_t ConnectionMessageAttributes, uint32_t AcceptConnection);
+typedef void (*on_x64_NtAlpcAcceptConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ConnectionPortHandle, uint32_t Flags, uint64_t ObjectAttributes, uint64_t PortAttributes, uint64_t PortContext, uint64_t ConnectionRequest, uint64_t ConnectionMessageAttributes, uint32_t AcceptConnection);
+typedef void (*on_x64_NtAlpcCancelMessage_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t MessageContext);
+typedef void (*on_x64_NtAlpcCancelMessage_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t MessageContext);
+typedef void (*on_x64_NtAlpcConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t ObjectAttributes, uint64_t PortAttributes, uint32_t Flags, uint64_t RequiredServerSid, uint64_t ConnectionMessage, uint64_t BufferLength, uint64_t OutMessageAttributes, uint64_t InMessageAttributes, uint64_t Timeout);
+typedef void (*on_x64_NtAlpcConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t ObjectAttributes, uint64_t PortAttributes, uint32_t Flags, uint64_t RequiredServerSid, uint64_t ConnectionMessage, uint64_t BufferLength, uint64_t OutMessageAttributes, uint64_t InMessageAttributes, uint64_t Timeout);
+typedef void (*on_x64_NtAlpcCreatePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint64_t PortAttributes);
+typedef void (*on_x64_NtAlpcCreatePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint64_t PortAttributes);
+typedef void (*on_x64_NtAlpcCreatePortSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SectionHandle, uint64_t SectionSize, uint64_t AlpcSectionHandle, uint64_t ActualSectionSize);
+typedef void (*on_x64_NtAlpcCreatePortSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SectionHandle, uint64_t SectionSize, uint64_t AlpcSectionHandle, uint64_t ActualSectionSize);
+typedef void (*on_x64_NtAlpcCreateResourceReserve_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t MessageSize, uint64_t ResourceId);
+typedef void (*on_x64_NtAlpcCreateResourceReserve_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t MessageSize, uint64_t ResourceId);
+typedef void (*on_x64_NtAlpcCreateSectionView_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ViewAttributes);
+typedef void (*on_x64_NtAlpcCreateSectionView_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ViewAttributes);
+typedef void (*on_x64_NtAlpcCreateSecurityContext_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SecurityAttribute);
+typedef void (*on_x64_NtAlpcCreateSecurityContext_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SecurityAttribute);
+typedef void (*on_x64_NtAlpcDeletePortSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SectionHandle);
+typedef void (*on_x64_NtAlpcDeletePortSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SectionHandle);
+typedef void (*on_x64_NtAlpcDeleteResourceReserve_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ResourceId);
+typedef void (*on_x64_NtAlpcDeleteResourceReserve_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ResourceId);
+typedef void (*on_x64_NtAlpcDeleteSectionView_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ViewBase);
+typedef void (*on_x64_NtAlpcDeleteSectionView_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ViewBase);
+typedef void (*on_x64_NtAlpcDeleteSecurityContext_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ContextHandle);
+typedef void (*on_x64_NtAlpcDeleteSecurityContext_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ContextHandle);
+typedef void (*on_x64_NtAlpcDisconnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags);
+typedef void (*on_x64_NtAlpcDisconnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags);
+typedef void (*on_x64_NtAlpcImpersonateClientOfPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortMessage, uint64_t Reserved);
+typedef void (*on_x64_NtAlpcImpersonateClientOfPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortMessage, uint64_t Reserved);
+typedef void (*on_x64_NtAlpcOpenSenderProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t PortHandle, uint64_t PortMessage, uint32_t Flags, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtAlpcOpenSenderProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t PortHandle, uint64_t PortMessage, uint32_t Flags, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtAlpcOpenSenderThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PortHandle, uint64_t PortMessage, uint32_t Flags, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtAlpcOpenSenderThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PortHandle, uint64_t PortMessage, uint32_t Flags, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtAlpcQueryInformation_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t PortInformationClass, uint64_t PortInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtAlpcQueryInformation_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t PortInformationClass, uint64_t PortInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtAlpcQueryInformationMessage_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortMessage, uint32_t MessageInformationClass, uint64_t MessageInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtAlpcQueryInformationMessage_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortMessage, uint32_t MessageInformationClass, uint64_t MessageInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtAlpcRevokeSecurityContext_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ContextHandle);
+typedef void (*on_x64_NtAlpcRevokeSecurityContext_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t ContextHandle);
+typedef void (*on_x64_NtAlpcSendWaitReceivePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SendMessage, uint64_t SendMessageAttributes, uint64_t ReceiveMessage, uint64_t BufferLength, uint64_t ReceiveMessageAttributes, uint64_t Timeout);
+typedef void (*on_x64_NtAlpcSendWaitReceivePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t Flags, uint64_t SendMessage, uint64_t SendMessageAttributes, uint64_t ReceiveMessage, uint64_t BufferLength, uint64_t ReceiveMessageAttributes, uint64_t Timeout);
+typedef void (*on_x64_NtAlpcSetInformation_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t PortInformationClass, uint64_t PortInformation, uint32_t Length);
+typedef void (*on_x64_NtAlpcSetInformation_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint32_t PortInformationClass, uint64_t PortInformation, uint32_t Length);
+typedef void (*on_x64_NtApphelpCacheControl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t type, uint64_t buf);
+typedef void (*on_x64_NtApphelpCacheControl_return_t)(CPUState* cpu, target_ulong pc, uint32_t type, uint64_t buf);
+typedef void (*on_x64_NtAreMappedFilesTheSame_enter_t)(CPUState* cpu, target_ulong pc, uint64_t File1MappedAsAnImage, uint64_t File2MappedAsFile);
+typedef void (*on_x64_NtAreMappedFilesTheSame_return_t)(CPUState* cpu, target_ulong pc, uint64_t File1MappedAsAnImage, uint64_t File2MappedAsFile);
+typedef void (*on_x64_NtAssignProcessToJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint64_t ProcessHandle);
+typedef void (*on_x64_NtAssignProcessToJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint64_t ProcessHandle);
+typedef void (*on_x64_NtCallbackReturn_enter_t)(CPUState* cpu, target_ulong pc, uint64_t OutputBuffer, uint32_t OutputLength, uint32_t Status);
+typedef void (*on_x64_NtCallbackReturn_return_t)(CPUState* cpu, target_ulong pc, uint64_t OutputBuffer, uint32_t OutputLength, uint32_t Status);
+typedef void (*on_x64_NtCancelIoFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelIoFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelIoFileEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoRequestToCancel, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelIoFileEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoRequestToCancel, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelSynchronousIoFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t IoRequestToCancel, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelSynchronousIoFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t IoRequestToCancel, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtCancelTimer_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint64_t CurrentState);
+typedef void (*on_x64_NtCancelTimer_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint64_t CurrentState);
+typedef void (*on_x64_NtClearEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle);
+typedef void (*on_x64_NtClearEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle);
+typedef void (*on_x64_NtClose_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtClose_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtCloseObjectAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint32_t GenerateOnClose);
+typedef void (*on_x64_NtCloseObjectAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint32_t GenerateOnClose);
+typedef void (*on_x64_NtCommitComplete_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtCommitComplete_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtCommitEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtCommitEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtCommitTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t Wait);
+typedef void (*on_x64_NtCommitTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t Wait);
+typedef void (*on_x64_NtCompactKeys_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t KeyArray);
+typedef void (*on_x64_NtCompactKeys_return_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t KeyArray);
+typedef void (*on_x64_NtCompareTokens_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FirstTokenHandle, uint64_t SecondTokenHandle, uint64_t Equal);
+typedef void (*on_x64_NtCompareTokens_return_t)(CPUState* cpu, target_ulong pc, uint64_t FirstTokenHandle, uint64_t SecondTokenHandle, uint64_t Equal);
+typedef void (*on_x64_NtCompleteConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle);
+typedef void (*on_x64_NtCompleteConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle);
+typedef void (*on_x64_NtCompressKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Key);
+typedef void (*on_x64_NtCompressKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t Key);
+typedef void (*on_x64_NtConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t SecurityQos, uint64_t ClientView, uint64_t ServerView, uint64_t MaxMessageLength, uint64_t ConnectionInformation, uint64_t ConnectionInformationLength);
+typedef void (*on_x64_NtConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t SecurityQos, uint64_t ClientView, uint64_t ServerView, uint64_t MaxMessageLength, uint64_t ConnectionInformation, uint64_t ConnectionInformationLength);
+typedef void (*on_x64_NtContinue_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ContextRecord, uint32_t TestAlert);
+typedef void (*on_x64_NtContinue_return_t)(CPUState* cpu, target_ulong pc, uint64_t ContextRecord, uint32_t TestAlert);
+typedef void (*on_x64_NtCreateDebugObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Flags);
+typedef void (*on_x64_NtCreateDebugObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Flags);
+typedef void (*on_x64_NtCreateDirectoryObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateDirectoryObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t DesiredAccess, uint64_t ResourceManagerHandle, uint64_t TransactionHandle, uint64_t ObjectAttributes, uint32_t CreateOptions, uint32_t NotificationMask, uint64_t EnlistmentKey);
+typedef void (*on_x64_NtCreateEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t DesiredAccess, uint64_t ResourceManagerHandle, uint64_t TransactionHandle, uint64_t ObjectAttributes, uint32_t CreateOptions, uint32_t NotificationMask, uint64_t EnlistmentKey);
+typedef void (*on_x64_NtCreateEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t EventType, uint32_t InitialState);
+typedef void (*on_x64_NtCreateEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t EventType, uint32_t InitialState);
+typedef void (*on_x64_NtCreateEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint64_t AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint64_t EaBuffer, uint32_t EaLength);
+typedef void (*on_x64_NtCreateFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint64_t AllocationSize, uint32_t FileAttributes, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint64_t EaBuffer, uint32_t EaLength);
+typedef void (*on_x64_NtCreateIoCompletion_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Count);
+typedef void (*on_x64_NtCreateIoCompletion_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Count);
+typedef void (*on_x64_NtCreateJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtCreateJobSet_enter_t)(CPUState* cpu, target_ulong pc, uint32_t NumJob, uint64_t UserJobSet, uint32_t Flags);
+typedef void (*on_x64_NtCreateJobSet_return_t)(CPUState* cpu, target_ulong pc, uint32_t NumJob, uint64_t UserJobSet, uint32_t Flags);
+typedef void (*on_x64_NtCreateKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TitleIndex, uint64_t Class, uint32_t CreateOptions, uint64_t Disposition);
+typedef void (*on_x64_NtCreateKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TitleIndex, uint64_t Class, uint32_t CreateOptions, uint64_t Disposition);
+typedef void (*on_x64_NtCreateKeyedEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Flags);
+typedef void (*on_x64_NtCreateKeyedEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t Flags);
+typedef void (*on_x64_NtCreateKeyTransacted_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TitleIndex, uint64_t Class, uint32_t CreateOptions, uint64_t TransactionHandle, uint64_t Disposition);
+typedef void (*on_x64_NtCreateKeyTransacted_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TitleIndex, uint64_t Class, uint32_t CreateOptions, uint64_t TransactionHandle, uint64_t Disposition);
+typedef void (*on_x64_NtCreateMailslotFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t CreateOptions, uint32_t MailslotQuota, uint32_t MaximumMessageSize, uint64_t ReadTimeout);
+typedef void (*on_x64_NtCreateMailslotFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t CreateOptions, uint32_t MailslotQuota, uint32_t MaximumMessageSize, uint64_t ReadTimeout);
+typedef void (*on_x64_NtCreateMutant_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t InitialOwner);
+typedef void (*on_x64_NtCreateMutant_return_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t InitialOwner);
+typedef void (*on_x64_NtCreateNamedPipeFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint32_t NamedPipeType, uint32_t ReadMode, uint32_t CompletionMode, uint32_t MaximumInstances, uint32_t InboundQuota, uint32_t OutboundQuota, uint64_t DefaultTimeout);
+typedef void (*on_x64_NtCreateNamedPipeFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t ShareAccess, uint32_t CreateDisposition, uint32_t CreateOptions, uint32_t NamedPipeType, uint32_t ReadMode, uint32_t CompletionMode, uint32_t MaximumInstances, uint32_t InboundQuota, uint32_t OutboundQuota, uint64_t DefaultTimeout);
+typedef void (*on_x64_NtCreatePagingFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PageFileName, uint64_t MinimumSize, uint64_t MaximumSize, uint32_t Priority);
+typedef void (*on_x64_NtCreatePagingFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t PageFileName, uint64_t MinimumSize, uint64_t MaximumSize, uint32_t Priority);
+typedef void (*on_x64_NtCreatePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint32_t MaxConnectionInfoLength, uint32_t MaxMessageLength, uint32_t MaxPoolUsage);
+typedef void (*on_x64_NtCreatePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint32_t MaxConnectionInfoLength, uint32_t MaxMessageLength, uint32_t MaxPoolUsage);
+typedef void (*on_x64_NtCreatePrivateNamespace_enter_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t BoundaryDescriptor);
+typedef void (*on_x64_NtCreatePrivateNamespace_return_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t BoundaryDescriptor);
+typedef void (*on_x64_NtCreateProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ParentProcess, uint32_t InheritObjectTable, uint64_t SectionHandle, uint64_t DebugPort, uint64_t ExceptionPort);
+typedef void (*on_x64_NtCreateProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ParentProcess, uint32_t InheritObjectTable, uint64_t SectionHandle, uint64_t DebugPort, uint64_t ExceptionPort);
+typedef void (*on_x64_NtCreateProcessEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ParentProcess, uint32_t Flags, uint64_t SectionHandle, uint64_t DebugPort, uint64_t ExceptionPort, uint32_t JobMemberLevel);
+typedef void (*on_x64_NtCreateProcessEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ParentProcess, uint32_t Flags, uint64_t SectionHandle, uint64_t DebugPort, uint64_t ExceptionPort, uint32_t JobMemberLevel);
+typedef void (*on_x64_NtCreateProfile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle, uint64_t Process, uint64_t RangeBase, uint64_t RangeSize, uint32_t BucketSize, uint64_t Buffer, uint32_t BufferSize, uint32_t ProfileSource, uint64_t Affinity);
+typedef void (*on_x64_NtCreateProfile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle, uint64_t Process, uint64_t RangeBase, uint64_t RangeSize, uint32_t BucketSize, uint64_t Buffer, uint32_t BufferSize, uint32_t ProfileSource, uint64_t Affinity);
+typedef void (*on_x64_NtCreateProfileEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle, uint64_t Process, uint64_t ProfileBase, uint64_t ProfileSize, uint32_t BucketSize, uint64_t Buffer, uint32_t BufferSize, uint32_t ProfileSource, uint32_t GroupAffinityCount, uint64_t GroupAffinity);
+typedef void (*on_x64_NtCreateProfileEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle, uint64_t Process, uint64_t ProfileBase, uint64_t ProfileSize, uint32_t BucketSize, uint64_t Buffer, uint32_t BufferSize, uint32_t ProfileSource, uint32_t GroupAffinityCount, uint64_t GroupAffinity);
+typedef void (*on_x64_NtCreateResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t DesiredAccess, uint64_t TmHandle, uint64_t RmGuid, uint64_t ObjectAttributes, uint32_t CreateOptions, uint64_t Description);
+typedef void (*on_x64_NtCreateResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t DesiredAccess, uint64_t TmHandle, uint64_t RmGuid, uint64_t ObjectAttributes, uint32_t CreateOptions, uint64_t Description);
+typedef void (*on_x64_NtCreateSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t MaximumSize, uint32_t SectionPageProtection, uint32_t AllocationAttributes, uint64_t FileHandle);
+typedef void (*on_x64_NtCreateSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t MaximumSize, uint32_t SectionPageProtection, uint32_t AllocationAttributes, uint64_t FileHandle);
+typedef void (*on_x64_NtCreateSemaphore_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, int32_t InitialCount, int32_t MaximumCount);
+typedef void (*on_x64_NtCreateSemaphore_return_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, int32_t InitialCount, int32_t MaximumCount);
+typedef void (*on_x64_NtCreateSymbolicLinkObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LinkTarget);
+typedef void (*on_x64_NtCreateSymbolicLinkObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LinkTarget);
+typedef void (*on_x64_NtCreateThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ProcessHandle, uint64_t ClientId, uint64_t ThreadContext, uint64_t InitialTeb, uint32_t CreateSuspended);
+typedef void (*on_x64_NtCreateThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ProcessHandle, uint64_t ClientId, uint64_t ThreadContext, uint64_t InitialTeb, uint32_t CreateSuspended);
+typedef void (*on_x64_NtCreateThreadEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ProcessHandle, uint64_t StartRoutine, uint64_t Argument, uint32_t CreateFlags, uint64_t ZeroBits, uint64_t StackSize, uint64_t MaximumStackSize, uint64_t AttributeList);
+typedef void (*on_x64_NtCreateThreadEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ProcessHandle, uint64_t StartRoutine, uint64_t Argument, uint32_t CreateFlags, uint64_t ZeroBits, uint64_t StackSize, uint64_t MaximumStackSize, uint64_t AttributeList);
+typedef void (*on_x64_NtCreateTimer_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TimerType);
+typedef void (*on_x64_NtCreateTimer_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TimerType);
+typedef void (*on_x64_NtCreateToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TokenType, uint64_t AuthenticationId, uint64_t ExpirationTime, uint64_t User, uint64_t Groups, uint64_t Privileges, uint64_t Owner, uint64_t PrimaryGroup, uint64_t DefaultDacl, uint64_t TokenSource);
+typedef void (*on_x64_NtCreateToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t TokenType, uint64_t AuthenticationId, uint64_t ExpirationTime, uint64_t User, uint64_t Groups, uint64_t Privileges, uint64_t Owner, uint64_t PrimaryGroup, uint64_t DefaultDacl, uint64_t TokenSource);
+typedef void (*on_x64_NtCreateTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t Uow, uint64_t TmHandle, uint32_t CreateOptions, uint32_t IsolationLevel, uint32_t IsolationFlags, uint64_t Timeout, uint64_t Description);
+typedef void (*on_x64_NtCreateTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t Uow, uint64_t TmHandle, uint32_t CreateOptions, uint32_t IsolationLevel, uint32_t IsolationFlags, uint64_t Timeout, uint64_t Description);
+typedef void (*on_x64_NtCreateTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LogFileName, uint32_t CreateOptions, uint32_t CommitStrength);
+typedef void (*on_x64_NtCreateTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LogFileName, uint32_t CreateOptions, uint32_t CommitStrength);
+typedef void (*on_x64_NtCreateUserProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ThreadHandle, uint32_t ProcessDesiredAccess, uint32_t ThreadDesiredAccess, uint64_t ProcessObjectAttributes, uint64_t ThreadObjectAttributes, uint32_t ProcessFlags, uint32_t ThreadFlags, uint64_t ProcessParameters, uint64_t CreateInfo, uint64_t AttributeList);
+typedef void (*on_x64_NtCreateUserProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ThreadHandle, uint32_t ProcessDesiredAccess, uint32_t ThreadDesiredAccess, uint64_t ProcessObjectAttributes, uint64_t ThreadObjectAttributes, uint32_t ProcessFlags, uint32_t ThreadFlags, uint64_t ProcessParameters, uint64_t CreateInfo, uint64_t AttributeList);
+typedef void (*on_x64_NtCreateWaitablePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint32_t MaxConnectionInfoLength, uint32_t MaxMessageLength, uint32_t MaxPoolUsage);
+typedef void (*on_x64_NtCreateWaitablePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ObjectAttributes, uint32_t MaxConnectionInfoLength, uint32_t MaxMessageLength, uint32_t MaxPoolUsage);
+typedef void (*on_x64_NtCreateWorkerFactory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandleReturn, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t CompletionPortHandle, uint64_t WorkerProcessHandle, uint64_t StartRoutine, uint64_t StartParameter, uint32_t MaxThreadCount, uint64_t StackReserve, uint64_t StackCommit);
+typedef void (*on_x64_NtCreateWorkerFactory_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandleReturn, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t CompletionPortHandle, uint64_t WorkerProcessHandle, uint64_t StartRoutine, uint64_t StartParameter, uint32_t MaxThreadCount, uint64_t StackReserve, uint64_t StackCommit);
+typedef void (*on_x64_NtDebugActiveProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t DebugObjectHandle);
+typedef void (*on_x64_NtDebugActiveProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t DebugObjectHandle);
+typedef void (*on_x64_NtDebugContinue_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint64_t ClientId, uint32_t ContinueStatus);
+typedef void (*on_x64_NtDebugContinue_return_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint64_t ClientId, uint32_t ContinueStatus);
+typedef void (*on_x64_NtDelayExecution_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Alertable, uint64_t DelayInterval);
+typedef void (*on_x64_NtDelayExecution_return_t)(CPUState* cpu, target_ulong pc, uint32_t Alertable, uint64_t DelayInterval);
+typedef void (*on_x64_NtDeleteAtom_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Atom);
+typedef void (*on_x64_NtDeleteAtom_return_t)(CPUState* cpu, target_ulong pc, uint32_t Atom);
+typedef void (*on_x64_NtDeleteBootEntry_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Id);
+typedef void (*on_x64_NtDeleteBootEntry_return_t)(CPUState* cpu, target_ulong pc, uint32_t Id);
+typedef void (*on_x64_NtDeleteDriverEntry_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Id);
+typedef void (*on_x64_NtDeleteDriverEntry_return_t)(CPUState* cpu, target_ulong pc, uint32_t Id);
+typedef void (*on_x64_NtDeleteFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtDeleteFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtDeleteKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtDeleteKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtDeleteObjectAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint32_t GenerateOnClose);
+typedef void (*on_x64_NtDeleteObjectAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint32_t GenerateOnClose);
+typedef void (*on_x64_NtDeletePrivateNamespace_enter_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle);
+typedef void (*on_x64_NtDeletePrivateNamespace_return_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle);
+typedef void (*on_x64_NtDeleteValueKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName);
+typedef void (*on_x64_NtDeleteValueKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName);
+typedef void (*on_x64_NtDeviceIoControlFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t IoControlCode, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtDeviceIoControlFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t IoControlCode, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtDisableLastKnownGood_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtDisableLastKnownGood_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtDisplayString_enter_t)(CPUState* cpu, target_ulong pc, uint64_t String);
+typedef void (*on_x64_NtDisplayString_return_t)(CPUState* cpu, target_ulong pc, uint64_t String);
+typedef void (*on_x64_NtDrawText_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Text);
+typedef void (*on_x64_NtDrawText_return_t)(CPUState* cpu, target_ulong pc, uint64_t Text);
+typedef void (*on_x64_NtDuplicateObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SourceProcessHandle, uint64_t SourceHandle, uint64_t TargetProcessHandle, uint64_t TargetHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Options);
+typedef void (*on_x64_NtDuplicateObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t SourceProcessHandle, uint64_t SourceHandle, uint64_t TargetProcessHandle, uint64_t TargetHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Options);
+typedef void (*on_x64_NtDuplicateToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ExistingTokenHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t EffectiveOnly, uint32_t TokenType, uint64_t NewTokenHandle);
+typedef void (*on_x64_NtDuplicateToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t ExistingTokenHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t EffectiveOnly, uint32_t TokenType, uint64_t NewTokenHandle);
+typedef void (*on_x64_NtEnableLastKnownGood_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtEnableLastKnownGood_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtEnumerateBootEntries_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateBootEntries_return_t)(CPUState* cpu, target_ulong pc, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateDriverEntries_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateDriverEntries_return_t)(CPUState* cpu, target_ulong pc, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t Index, uint32_t KeyInformationClass, uint64_t KeyInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtEnumerateKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t Index, uint32_t KeyInformationClass, uint64_t KeyInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtEnumerateSystemEnvironmentValuesEx_enter_t)(CPUState* cpu, target_ulong pc, uint32_t InformationClass, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateSystemEnvironmentValuesEx_return_t)(CPUState* cpu, target_ulong pc, uint32_t InformationClass, uint64_t Buffer, uint64_t BufferLength);
+typedef void (*on_x64_NtEnumerateTransactionObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t RootObjectHandle, uint32_t QueryType, uint64_t ObjectCursor, uint32_t ObjectCursorLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtEnumerateTransactionObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t RootObjectHandle, uint32_t QueryType, uint64_t ObjectCursor, uint32_t ObjectCursorLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtEnumerateValueKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t Index, uint32_t KeyValueInformationClass, uint64_t KeyValueInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtEnumerateValueKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t Index, uint32_t KeyValueInformationClass, uint64_t KeyValueInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtExtendSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint64_t NewSectionSize);
+typedef void (*on_x64_NtExtendSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint64_t NewSectionSize);
+typedef void (*on_x64_NtFilterToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ExistingTokenHandle, uint32_t Flags, uint64_t SidsToDisable, uint64_t PrivilegesToDelete, uint64_t RestrictedSids, uint64_t NewTokenHandle);
+typedef void (*on_x64_NtFilterToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t ExistingTokenHandle, uint32_t Flags, uint64_t SidsToDisable, uint64_t PrivilegesToDelete, uint64_t RestrictedSids, uint64_t NewTokenHandle);
+typedef void (*on_x64_NtFindAtom_enter_t)(CPUState* cpu, target_ulong pc, uint64_t AtomName, uint32_t Length, uint64_t Atom);
+typedef void (*on_x64_NtFindAtom_return_t)(CPUState* cpu, target_ulong pc, uint64_t AtomName, uint32_t Length, uint64_t Atom);
+typedef void (*on_x64_NtFlushBuffersFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtFlushBuffersFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock);
+typedef void (*on_x64_NtFlushInstallUILanguage_enter_t)(CPUState* cpu, target_ulong pc, uint32_t InstallUILanguage, uint32_t SetComittedFlag);
+typedef void (*on_x64_NtFlushInstallUILanguage_return_t)(CPUState* cpu, target_ulong pc, uint32_t InstallUILanguage, uint32_t SetComittedFlag);
+typedef void (*on_x64_NtFlushInstructionCache_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Length);
+typedef void (*on_x64_NtFlushInstructionCache_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Length);
+typedef void (*on_x64_NtFlushKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtFlushKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtFlushProcessWriteBuffers_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtFlushProcessWriteBuffers_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtFlushVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint64_t IoStatus);
+typedef void (*on_x64_NtFlushVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint64_t IoStatus);
+typedef void (*on_x64_NtFlushWriteBuffer_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtFlushWriteBuffer_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtFreeUserPhysicalPages_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtFreeUserPhysicalPages_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtFreeVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t FreeType);
+typedef void (*on_x64_NtFreeVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t FreeType);
+typedef void (*on_x64_NtFreezeRegistry_enter_t)(CPUState* cpu, target_ulong pc, uint32_t TimeOutInSeconds);
+typedef void (*on_x64_NtFreezeRegistry_return_t)(CPUState* cpu, target_ulong pc, uint32_t TimeOutInSeconds);
+typedef void (*on_x64_NtFreezeTransactions_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FreezeTimeout, uint64_t ThawTimeout);
+typedef void (*on_x64_NtFreezeTransactions_return_t)(CPUState* cpu, target_ulong pc, uint64_t FreezeTimeout, uint64_t ThawTimeout);
+typedef void (*on_x64_NtFsControlFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t IoControlCode, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtFsControlFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t IoControlCode, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtGetContextThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ThreadContext);
+typedef void (*on_x64_NtGetContextThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ThreadContext);
+typedef void (*on_x64_NtGetCurrentProcessorNumber_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtGetCurrentProcessorNumber_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtGetDevicePowerState_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Device, uint64_t State);
+typedef void (*on_x64_NtGetDevicePowerState_return_t)(CPUState* cpu, target_ulong pc, uint64_t Device, uint64_t State);
+typedef void (*on_x64_NtGetMUIRegistryInfo_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Flags, uint64_t DataSize, uint64_t Data);
+typedef void (*on_x64_NtGetMUIRegistryInfo_return_t)(CPUState* cpu, target_ulong pc, uint32_t Flags, uint64_t DataSize, uint64_t Data);
+typedef void (*on_x64_NtGetNextProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Flags, uint64_t NewProcessHandle);
+typedef void (*on_x64_NtGetNextProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Flags, uint64_t NewProcessHandle);
+typedef void (*on_x64_NtGetNextThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Flags, uint64_t NewThreadHandle);
+typedef void (*on_x64_NtGetNextThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Flags, uint64_t NewThreadHandle);
+typedef void (*on_x64_NtGetNlsSectionPtr_enter_t)(CPUState* cpu, target_ulong pc, uint32_t SectionType, uint32_t SectionData, uint64_t ContextData, uint64_t SectionPointer, uint64_t SectionSize);
+typedef void (*on_x64_NtGetNlsSectionPtr_return_t)(CPUState* cpu, target_ulong pc, uint32_t SectionType, uint32_t SectionData, uint64_t ContextData, uint64_t SectionPointer, uint64_t SectionSize);
+typedef void (*on_x64_NtGetNotificationResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint64_t TransactionNotification, uint32_t NotificationLength, uint64_t Timeout, uint64_t ReturnLength, uint32_t Asynchronous, uint64_t AsynchronousContext);
+typedef void (*on_x64_NtGetNotificationResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint64_t TransactionNotification, uint32_t NotificationLength, uint64_t Timeout, uint64_t ReturnLength, uint32_t Asynchronous, uint64_t AsynchronousContext);
+typedef void (*on_x64_NtGetPlugPlayEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t Context, uint64_t EventBlock, uint32_t EventBufferSize);
+typedef void (*on_x64_NtGetPlugPlayEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t Context, uint64_t EventBlock, uint32_t EventBufferSize);
+typedef void (*on_x64_NtGetWriteWatch_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t Flags, uint64_t BaseAddress, uint64_t RegionSize, uint64_t UserAddressArray, uint64_t EntriesInUserAddressArray, uint64_t Granularity);
+typedef void (*on_x64_NtGetWriteWatch_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t Flags, uint64_t BaseAddress, uint64_t RegionSize, uint64_t UserAddressArray, uint64_t EntriesInUserAddressArray, uint64_t Granularity);
+typedef void (*on_x64_NtImpersonateAnonymousToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle);
+typedef void (*on_x64_NtImpersonateAnonymousToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle);
+typedef void (*on_x64_NtImpersonateClientOfPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message);
+typedef void (*on_x64_NtImpersonateClientOfPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message);
+typedef void (*on_x64_NtImpersonateThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ServerThreadHandle, uint64_t ClientThreadHandle, uint64_t SecurityQos);
+typedef void (*on_x64_NtImpersonateThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ServerThreadHandle, uint64_t ClientThreadHandle, uint64_t SecurityQos);
+typedef void (*on_x64_NtInitializeNlsFiles_enter_t)(CPUState* cpu, target_ulong pc, uint64_t BaseAddress, uint64_t DefaultLocaleId, uint64_t DefaultCasingTableSize);
+typedef void (*on_x64_NtInitializeNlsFiles_return_t)(CPUState* cpu, target_ulong pc, uint64_t BaseAddress, uint64_t DefaultLocaleId, uint64_t DefaultCasingTableSize);
+typedef void (*on_x64_NtInitializeRegistry_enter_t)(CPUState* cpu, target_ulong pc, uint32_t BootCondition);
+typedef void (*on_x64_NtInitializeRegistry_return_t)(CPUState* cpu, target_ulong pc, uint32_t BootCondition);
+typedef void (*on_x64_NtInitiatePowerAction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SystemAction, uint32_t MinSystemState, uint32_t Flags, uint32_t Asynchronous);
+typedef void (*on_x64_NtInitiatePowerAction_return_t)(CPUState* cpu, target_ulong pc, uint64_t SystemAction, uint32_t MinSystemState, uint32_t Flags, uint32_t Asynchronous);
+typedef void (*on_x64_NtIsProcessInJob_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t JobHandle);
+typedef void (*on_x64_NtIsProcessInJob_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t JobHandle);
+typedef void (*on_x64_NtIsSystemResumeAutomatic_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtIsSystemResumeAutomatic_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtIsUILanguageComitted_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtIsUILanguageComitted_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtListenPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ConnectionRequest);
+typedef void (*on_x64_NtListenPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ConnectionRequest);
+typedef void (*on_x64_NtLoadDriver_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DriverServiceName);
+typedef void (*on_x64_NtLoadDriver_return_t)(CPUState* cpu, target_ulong pc, uint64_t DriverServiceName);
+typedef void (*on_x64_NtLoadKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile);
+typedef void (*on_x64_NtLoadKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile);
+typedef void (*on_x64_NtLoadKey2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile, uint32_t Flags);
+typedef void (*on_x64_NtLoadKey2_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile, uint32_t Flags);
+typedef void (*on_x64_NtLoadKeyEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile, uint32_t Flags, uint64_t TrustClassKey);
+typedef void (*on_x64_NtLoadKeyEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t SourceFile, uint32_t Flags, uint64_t TrustClassKey);
+typedef void (*on_x64_NtLockFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t ByteOffset, uint64_t Length, uint32_t Key, uint32_t FailImmediately, uint32_t ExclusiveLock);
+typedef void (*on_x64_NtLockFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t ByteOffset, uint64_t Length, uint32_t Key, uint32_t FailImmediately, uint32_t ExclusiveLock);
+typedef void (*on_x64_NtLockProductActivationKeys_enter_t)(CPUState* cpu, target_ulong pc, uint64_t pPrivateVer, uint64_t pSafeMode);
+typedef void (*on_x64_NtLockProductActivationKeys_return_t)(CPUState* cpu, target_ulong pc, uint64_t pPrivateVer, uint64_t pSafeMode);
+typedef void (*on_x64_NtLockRegistryKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtLockRegistryKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle);
+typedef void (*on_x64_NtLockVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t MapType);
+typedef void (*on_x64_NtLockVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t MapType);
+typedef void (*on_x64_NtMakePermanentObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtMakePermanentObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtMakeTemporaryObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtMakeTemporaryObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle);
+typedef void (*on_x64_NtMapCMFModule_enter_t)(CPUState* cpu, target_ulong pc, uint32_t What, uint32_t Index, uint64_t CacheIndexOut, uint64_t CacheFlagsOut, uint64_t ViewSizeOut, uint64_t BaseAddress);
+typedef void (*on_x64_NtMapCMFModule_return_t)(CPUState* cpu, target_ulong pc, uint32_t What, uint32_t Index, uint64_t CacheIndexOut, uint64_t CacheFlagsOut, uint64_t ViewSizeOut, uint64_t BaseAddress);
+typedef void (*on_x64_NtMapUserPhysicalPages_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VirtualAddress, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtMapUserPhysicalPages_return_t)(CPUState* cpu, target_ulong pc, uint64_t VirtualAddress, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtMapUserPhysicalPagesScatter_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VirtualAddresses, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtMapUserPhysicalPagesScatter_return_t)(CPUState* cpu, target_ulong pc, uint64_t VirtualAddresses, uint64_t NumberOfPages, uint64_t UserPfnArray);
+typedef void (*on_x64_NtMapViewOfSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t ZeroBits, uint64_t CommitSize, uint64_t SectionOffset, uint64_t ViewSize, uint32_t InheritDisposition, uint32_t AllocationType, uint32_t Win32Protect);
+typedef void (*on_x64_NtMapViewOfSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t ZeroBits, uint64_t CommitSize, uint64_t SectionOffset, uint64_t ViewSize, uint32_t InheritDisposition, uint32_t AllocationType, uint32_t Win32Protect);
+typedef void (*on_x64_NtModifyBootEntry_enter_t)(CPUState* cpu, target_ulong pc, uint64_t BootEntry);
+typedef void (*on_x64_NtModifyBootEntry_return_t)(CPUState* cpu, target_ulong pc, uint64_t BootEntry);
+typedef void (*on_x64_NtModifyDriverEntry_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DriverEntry);
+typedef void (*on_x64_NtModifyDriverEntry_return_t)(CPUState* cpu, target_ulong pc, uint64_t DriverEntry);
+typedef void (*on_x64_NtNotifyChangeDirectoryFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t CompletionFilter, uint32_t WatchTree);
+typedef void (*on_x64_NtNotifyChangeDirectoryFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t CompletionFilter, uint32_t WatchTree);
+typedef void (*on_x64_NtNotifyChangeKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t CompletionFilter, uint32_t WatchTree, uint64_t Buffer, uint32_t BufferSize, uint32_t Asynchronous);
+typedef void (*on_x64_NtNotifyChangeKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t CompletionFilter, uint32_t WatchTree, uint64_t Buffer, uint32_t BufferSize, uint32_t Asynchronous);
+typedef void (*on_x64_NtNotifyChangeMultipleKeys_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MasterKeyHandle, uint32_t Count, uint64_t SlaveObjects, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t CompletionFilter, uint32_t WatchTree, uint64_t Buffer, uint32_t BufferSize, uint32_t Asynchronous);
+typedef void (*on_x64_NtNotifyChangeMultipleKeys_return_t)(CPUState* cpu, target_ulong pc, uint64_t MasterKeyHandle, uint32_t Count, uint64_t SlaveObjects, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint32_t CompletionFilter, uint32_t WatchTree, uint64_t Buffer, uint32_t BufferSize, uint32_t Asynchronous);
+typedef void (*on_x64_NtNotifyChangeSession_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Session, uint32_t IoStateSequence, uint64_t Reserved, uint32_t Action, uint32_t IoState, uint32_t IoState2, uint64_t Buffer, uint32_t BufferSize);
+typedef void (*on_x64_NtNotifyChangeSession_return_t)(CPUState* cpu, target_ulong pc, uint64_t Session, uint32_t IoStateSequence, uint64_t Reserved, uint32_t Action, uint32_t IoState, uint32_t IoState2, uint64_t Buffer, uint32_t BufferSize);
+typedef void (*on_x64_NtOpenDirectoryObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenDirectoryObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t DesiredAccess, uint64_t ResourceManagerHandle, uint64_t EnlistmentGuid, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t DesiredAccess, uint64_t ResourceManagerHandle, uint64_t EnlistmentGuid, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions);
+typedef void (*on_x64_NtOpenFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t IoStatusBlock, uint32_t ShareAccess, uint32_t OpenOptions);
+typedef void (*on_x64_NtOpenIoCompletion_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenIoCompletion_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenKeyedEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenKeyedEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenKeyEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t OpenOptions);
+typedef void (*on_x64_NtOpenKeyEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t OpenOptions);
+typedef void (*on_x64_NtOpenKeyTransacted_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t TransactionHandle);
+typedef void (*on_x64_NtOpenKeyTransacted_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t TransactionHandle);
+typedef void (*on_x64_NtOpenKeyTransactedEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t OpenOptions, uint64_t TransactionHandle);
+typedef void (*on_x64_NtOpenKeyTransactedEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint32_t OpenOptions, uint64_t TransactionHandle);
+typedef void (*on_x64_NtOpenMutant_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenMutant_return_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenObjectAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t ClientToken, uint32_t DesiredAccess, uint32_t GrantedAccess, uint64_t Privileges, uint32_t ObjectCreation, uint32_t AccessGranted, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtOpenObjectAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ObjectTypeName, uint64_t ObjectName, uint64_t SecurityDescriptor, uint64_t ClientToken, uint32_t DesiredAccess, uint32_t GrantedAccess, uint64_t Privileges, uint32_t ObjectCreation, uint32_t AccessGranted, uint64_t GenerateOnClose);
+typedef void (*on_x64_NtOpenPrivateNamespace_enter_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t BoundaryDescriptor);
+typedef void (*on_x64_NtOpenPrivateNamespace_return_t)(CPUState* cpu, target_ulong pc, uint64_t NamespaceHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t BoundaryDescriptor);
+typedef void (*on_x64_NtOpenProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ClientId);
+typedef void (*on_x64_NtOpenProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ClientId);
+typedef void (*on_x64_NtOpenProcessToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenProcessToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenProcessTokenEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenProcessTokenEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t DesiredAccess, uint64_t TmHandle, uint64_t ResourceManagerGuid, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t DesiredAccess, uint64_t TmHandle, uint64_t ResourceManagerGuid, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSemaphore_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSemaphore_return_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSession_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SessionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSession_return_t)(CPUState* cpu, target_ulong pc, uint64_t SessionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSymbolicLinkObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenSymbolicLinkObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ClientId);
+typedef void (*on_x64_NtOpenThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t ClientId);
+typedef void (*on_x64_NtOpenThreadToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t OpenAsSelf, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenThreadToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t OpenAsSelf, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenThreadTokenEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t OpenAsSelf, uint32_t HandleAttributes, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenThreadTokenEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t DesiredAccess, uint32_t OpenAsSelf, uint32_t HandleAttributes, uint64_t TokenHandle);
+typedef void (*on_x64_NtOpenTimer_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenTimer_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes);
+typedef void (*on_x64_NtOpenTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t Uow, uint64_t TmHandle);
+typedef void (*on_x64_NtOpenTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t Uow, uint64_t TmHandle);
+typedef void (*on_x64_NtOpenTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LogFileName, uint64_t TmIdentity, uint32_t OpenOptions);
+typedef void (*on_x64_NtOpenTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t DesiredAccess, uint64_t ObjectAttributes, uint64_t LogFileName, uint64_t TmIdentity, uint32_t OpenOptions);
+typedef void (*on_x64_NtPlugPlayControl_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PnPControlClass, uint64_t PnPControlData, uint32_t PnPControlDataLength);
+typedef void (*on_x64_NtPlugPlayControl_return_t)(CPUState* cpu, target_ulong pc, uint64_t PnPControlClass, uint64_t PnPControlData, uint32_t PnPControlDataLength);
+typedef void (*on_x64_NtPowerInformation_enter_t)(CPUState* cpu, target_ulong pc, uint64_t InformationLevel, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtPowerInformation_return_t)(CPUState* cpu, target_ulong pc, uint64_t InformationLevel, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength);
+typedef void (*on_x64_NtPrepareComplete_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrepareComplete_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrepareEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrepareEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrePrepareComplete_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrePrepareComplete_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrePrepareEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrePrepareEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtPrivilegeCheck_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ClientToken, uint64_t RequiredPrivileges, uint64_t Result);
+typedef void (*on_x64_NtPrivilegeCheck_return_t)(CPUState* cpu, target_ulong pc, uint64_t ClientToken, uint64_t RequiredPrivileges, uint64_t Result);
+typedef void (*on_x64_NtPrivilegedServiceAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t ServiceName, uint64_t ClientToken, uint64_t Privileges, uint32_t AccessGranted);
+typedef void (*on_x64_NtPrivilegedServiceAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t ServiceName, uint64_t ClientToken, uint64_t Privileges, uint32_t AccessGranted);
+typedef void (*on_x64_NtPrivilegeObjectAuditAlarm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t Privileges, uint32_t AccessGranted);
+typedef void (*on_x64_NtPrivilegeObjectAuditAlarm_return_t)(CPUState* cpu, target_ulong pc, uint64_t SubsystemName, uint64_t HandleId, uint64_t ClientToken, uint32_t DesiredAccess, uint64_t Privileges, uint32_t AccessGranted);
+typedef void (*on_x64_NtPropagationComplete_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t RequestCookie, uint32_t BufferLength, uint64_t Buffer);
+typedef void (*on_x64_NtPropagationComplete_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t RequestCookie, uint32_t BufferLength, uint64_t Buffer);
+typedef void (*on_x64_NtPropagationFailed_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t RequestCookie, uint32_t PropStatus);
+typedef void (*on_x64_NtPropagationFailed_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t RequestCookie, uint32_t PropStatus);
+typedef void (*on_x64_NtProtectVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t NewProtectWin32, uint64_t OldProtect);
+typedef void (*on_x64_NtProtectVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t NewProtectWin32, uint64_t OldProtect);
+typedef void (*on_x64_NtPulseEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtPulseEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtQueryAttributesFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes, uint64_t FileInformation);
+typedef void (*on_x64_NtQueryAttributesFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes, uint64_t FileInformation);
+typedef void (*on_x64_NtQueryBootEntryOrder_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint64_t Count);
+typedef void (*on_x64_NtQueryBootEntryOrder_return_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint64_t Count);
+typedef void (*on_x64_NtQueryBootOptions_enter_t)(CPUState* cpu, target_ulong pc, uint64_t BootOptions, uint64_t BootOptionsLength);
+typedef void (*on_x64_NtQueryBootOptions_return_t)(CPUState* cpu, target_ulong pc, uint64_t BootOptions, uint64_t BootOptionsLength);
+typedef void (*on_x64_NtQueryDebugFilterState_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ComponentId, uint32_t Level);
+typedef void (*on_x64_NtQueryDebugFilterState_return_t)(CPUState* cpu, target_ulong pc, uint32_t ComponentId, uint32_t Level);
+typedef void (*on_x64_NtQueryDefaultLocale_enter_t)(CPUState* cpu, target_ulong pc, uint32_t UserProfile, uint64_t DefaultLocaleId);
+typedef void (*on_x64_NtQueryDefaultLocale_return_t)(CPUState* cpu, target_ulong pc, uint32_t UserProfile, uint64_t DefaultLocaleId);
+typedef void (*on_x64_NtQueryDefaultUILanguage_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DefaultUILanguageId);
+typedef void (*on_x64_NtQueryDefaultUILanguage_return_t)(CPUState* cpu, target_ulong pc, uint64_t DefaultUILanguageId);
+typedef void (*on_x64_NtQueryDirectoryFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass, uint32_t ReturnSingleEntry, uint64_t FileName, uint32_t RestartScan);
+typedef void (*on_x64_NtQueryDirectoryFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass, uint32_t ReturnSingleEntry, uint64_t FileName, uint32_t RestartScan);
+typedef void (*on_x64_NtQueryDirectoryObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint32_t RestartScan, uint64_t Context, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryDirectoryObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t DirectoryHandle, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint32_t RestartScan, uint64_t Context, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryDriverEntryOrder_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint64_t Count);
+typedef void (*on_x64_NtQueryDriverEntryOrder_return_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint64_t Count);
+typedef void (*on_x64_NtQueryEaFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint64_t EaList, uint32_t EaListLength, uint64_t EaIndex, uint32_t RestartScan);
+typedef void (*on_x64_NtQueryEaFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint64_t EaList, uint32_t EaListLength, uint64_t EaIndex, uint32_t RestartScan);
+typedef void (*on_x64_NtQueryEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t EventInformationClass, uint64_t EventInformation, uint32_t EventInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint32_t EventInformationClass, uint64_t EventInformation, uint32_t EventInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryFullAttributesFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes, uint64_t FileInformation);
+typedef void (*on_x64_NtQueryFullAttributesFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ObjectAttributes, uint64_t FileInformation);
+typedef void (*on_x64_NtQueryInformationAtom_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Atom, uint32_t InformationClass, uint64_t AtomInformation, uint32_t AtomInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationAtom_return_t)(CPUState* cpu, target_ulong pc, uint32_t Atom, uint32_t InformationClass, uint64_t AtomInformation, uint32_t AtomInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t EnlistmentInformationClass, uint64_t EnlistmentInformation, uint32_t EnlistmentInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t EnlistmentInformationClass, uint64_t EnlistmentInformation, uint32_t EnlistmentInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass);
+typedef void (*on_x64_NtQueryInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass);
+typedef void (*on_x64_NtQueryInformationJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t JobObjectInformationClass, uint64_t JobObjectInformation, uint32_t JobObjectInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t JobObjectInformationClass, uint64_t JobObjectInformation, uint32_t JobObjectInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortInformationClass, uint64_t PortInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortInformationClass, uint64_t PortInformation, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ProcessInformationClass, uint64_t ProcessInformation, uint32_t ProcessInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ProcessInformationClass, uint64_t ProcessInformation, uint32_t ProcessInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t ResourceManagerInformationClass, uint64_t ResourceManagerInformation, uint32_t ResourceManagerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t ResourceManagerInformationClass, uint64_t ResourceManagerInformation, uint32_t ResourceManagerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ThreadInformationClass, uint64_t ThreadInformation, uint32_t ThreadInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ThreadInformationClass, uint64_t ThreadInformation, uint32_t ThreadInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t TokenInformationClass, uint64_t TokenInformation, uint32_t TokenInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t TokenInformationClass, uint64_t TokenInformation, uint32_t TokenInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t TransactionInformationClass, uint64_t TransactionInformation, uint32_t TransactionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t TransactionInformationClass, uint64_t TransactionInformation, uint32_t TransactionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle, uint32_t TransactionManagerInformationClass, uint64_t TransactionManagerInformation, uint32_t TransactionManagerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle, uint32_t TransactionManagerInformationClass, uint64_t TransactionManagerInformation, uint32_t TransactionManagerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationWorkerFactory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint32_t WorkerFactoryInformationClass, uint64_t WorkerFactoryInformation, uint32_t WorkerFactoryInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInformationWorkerFactory_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint32_t WorkerFactoryInformationClass, uint64_t WorkerFactoryInformation, uint32_t WorkerFactoryInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryInstallUILanguage_enter_t)(CPUState* cpu, target_ulong pc, uint64_t InstallUILanguageId);
+typedef void (*on_x64_NtQueryInstallUILanguage_return_t)(CPUState* cpu, target_ulong pc, uint64_t InstallUILanguageId);
+typedef void (*on_x64_NtQueryIntervalProfile_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ProfileSource, uint64_t Interval);
+typedef void (*on_x64_NtQueryIntervalProfile_return_t)(CPUState* cpu, target_ulong pc, uint32_t ProfileSource, uint64_t Interval);
+typedef void (*on_x64_NtQueryIoCompletion_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t IoCompletionInformationClass, uint64_t IoCompletionInformation, uint32_t IoCompletionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryIoCompletion_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint32_t IoCompletionInformationClass, uint64_t IoCompletionInformation, uint32_t IoCompletionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t KeyInformationClass, uint64_t KeyInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtQueryKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t KeyInformationClass, uint64_t KeyInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtQueryLicenseValue_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Name, uint64_t Type, uint64_t Buffer, uint32_t Length, uint64_t ReturnedLength);
+typedef void (*on_x64_NtQueryLicenseValue_return_t)(CPUState* cpu, target_ulong pc, uint64_t Name, uint64_t Type, uint64_t Buffer, uint32_t Length, uint64_t ReturnedLength);
+typedef void (*on_x64_NtQueryMultipleValueKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueEntries, uint32_t EntryCount, uint64_t ValueBuffer, uint64_t BufferLength, uint64_t RequiredBufferLength);
+typedef void (*on_x64_NtQueryMultipleValueKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueEntries, uint32_t EntryCount, uint64_t ValueBuffer, uint64_t BufferLength, uint64_t RequiredBufferLength);
+typedef void (*on_x64_NtQueryMutant_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t MutantInformationClass, uint64_t MutantInformation, uint32_t MutantInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryMutant_return_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint32_t MutantInformationClass, uint64_t MutantInformation, uint32_t MutantInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t ObjectInformationClass, uint64_t ObjectInformation, uint32_t ObjectInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t ObjectInformationClass, uint64_t ObjectInformation, uint32_t ObjectInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryOpenSubKeys_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t HandleCount);
+typedef void (*on_x64_NtQueryOpenSubKeys_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t HandleCount);
+typedef void (*on_x64_NtQueryOpenSubKeysEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint32_t BufferLength, uint64_t Buffer, uint64_t RequiredSize);
+typedef void (*on_x64_NtQueryOpenSubKeysEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint32_t BufferLength, uint64_t Buffer, uint64_t RequiredSize);
+typedef void (*on_x64_NtQueryPerformanceCounter_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PerformanceCounter, uint64_t PerformanceFrequency);
+typedef void (*on_x64_NtQueryPerformanceCounter_return_t)(CPUState* cpu, target_ulong pc, uint64_t PerformanceCounter, uint64_t PerformanceFrequency);
+typedef void (*on_x64_NtQueryPortInformationProcess_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtQueryPortInformationProcess_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtQueryQuotaInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint64_t SidList, uint32_t SidListLength, uint64_t StartSid, uint32_t RestartScan);
+typedef void (*on_x64_NtQueryQuotaInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint32_t ReturnSingleEntry, uint64_t SidList, uint32_t SidListLength, uint64_t StartSid, uint32_t RestartScan);
+typedef void (*on_x64_NtQuerySection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t SectionInformationClass, uint64_t SectionInformation, uint64_t SectionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySection_return_t)(CPUState* cpu, target_ulong pc, uint64_t SectionHandle, uint32_t SectionInformationClass, uint64_t SectionInformation, uint64_t SectionInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySecurityAttributesToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint64_t Attributes, uint32_t NumberOfAttributes, uint64_t Buffer, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySecurityAttributesToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint64_t Attributes, uint32_t NumberOfAttributes, uint64_t Buffer, uint32_t Length, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySecurityObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t SecurityInformation, uint64_t SecurityDescriptor, uint32_t Length, uint64_t LengthNeeded);
+typedef void (*on_x64_NtQuerySecurityObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t SecurityInformation, uint64_t SecurityDescriptor, uint32_t Length, uint64_t LengthNeeded);
+typedef void (*on_x64_NtQuerySemaphore_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t SemaphoreInformationClass, uint64_t SemaphoreInformation, uint32_t SemaphoreInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySemaphore_return_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, uint32_t SemaphoreInformationClass, uint64_t SemaphoreInformation, uint32_t SemaphoreInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySymbolicLinkObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint64_t LinkTarget, uint64_t ReturnedLength);
+typedef void (*on_x64_NtQuerySymbolicLinkObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t LinkHandle, uint64_t LinkTarget, uint64_t ReturnedLength);
+typedef void (*on_x64_NtQuerySystemEnvironmentValue_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VariableValue, uint32_t ValueLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemEnvironmentValue_return_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VariableValue, uint32_t ValueLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemEnvironmentValueEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VendorGuid, uint64_t Value, uint64_t ValueLength, uint64_t Attributes);
+typedef void (*on_x64_NtQuerySystemEnvironmentValueEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VendorGuid, uint64_t Value, uint64_t ValueLength, uint64_t Attributes);
+typedef void (*on_x64_NtQuerySystemInformation_enter_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t SystemInformation, uint32_t SystemInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemInformation_return_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t SystemInformation, uint32_t SystemInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemInformationEx_enter_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t QueryInformation, uint32_t QueryInformationLength, uint64_t SystemInformation, uint32_t SystemInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemInformationEx_return_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t QueryInformation, uint32_t QueryInformationLength, uint64_t SystemInformation, uint32_t SystemInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQuerySystemTime_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SystemTime);
+typedef void (*on_x64_NtQuerySystemTime_return_t)(CPUState* cpu, target_ulong pc, uint64_t SystemTime);
+typedef void (*on_x64_NtQueryTimer_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t TimerInformationClass, uint64_t TimerInformation, uint32_t TimerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryTimer_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t TimerInformationClass, uint64_t TimerInformation, uint32_t TimerInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryTimerResolution_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MaximumTime, uint64_t MinimumTime, uint64_t CurrentTime);
+typedef void (*on_x64_NtQueryTimerResolution_return_t)(CPUState* cpu, target_ulong pc, uint64_t MaximumTime, uint64_t MinimumTime, uint64_t CurrentTime);
+typedef void (*on_x64_NtQueryValueKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName, uint32_t KeyValueInformationClass, uint64_t KeyValueInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtQueryValueKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName, uint32_t KeyValueInformationClass, uint64_t KeyValueInformation, uint32_t Length, uint64_t ResultLength);
+typedef void (*on_x64_NtQueryVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint32_t MemoryInformationClass, uint64_t MemoryInformation, uint64_t MemoryInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint32_t MemoryInformationClass, uint64_t MemoryInformation, uint64_t MemoryInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtQueryVolumeInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FsInformation, uint32_t Length, uint32_t FsInformationClass);
+typedef void (*on_x64_NtQueryVolumeInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FsInformation, uint32_t Length, uint32_t FsInformationClass);
+typedef void (*on_x64_NtQueueApcThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ApcRoutine, uint64_t ApcArgument1, uint64_t ApcArgument2, uint64_t ApcArgument3);
+typedef void (*on_x64_NtQueueApcThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ApcRoutine, uint64_t ApcArgument1, uint64_t ApcArgument2, uint64_t ApcArgument3);
+typedef void (*on_x64_NtQueueApcThreadEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t UserApcReserveHandle, uint64_t ApcRoutine, uint64_t ApcArgument1, uint64_t ApcArgument2, uint64_t ApcArgument3);
+typedef void (*on_x64_NtQueueApcThreadEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t UserApcReserveHandle, uint64_t ApcRoutine, uint64_t ApcArgument1, uint64_t ApcArgument2, uint64_t ApcArgument3);
+typedef void (*on_x64_NtRaiseException_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ExceptionRecord, uint64_t ContextRecord, uint32_t FirstChance);
+typedef void (*on_x64_NtRaiseException_return_t)(CPUState* cpu, target_ulong pc, uint64_t ExceptionRecord, uint64_t ContextRecord, uint32_t FirstChance);
+typedef void (*on_x64_NtRaiseHardError_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ErrorStatus, uint32_t NumberOfParameters, uint32_t UnicodeStringParameterMask, uint64_t Parameters, uint32_t ValidResponseOptions, uint64_t Response);
+typedef void (*on_x64_NtRaiseHardError_return_t)(CPUState* cpu, target_ulong pc, uint32_t ErrorStatus, uint32_t NumberOfParameters, uint32_t UnicodeStringParameterMask, uint64_t Parameters, uint32_t ValidResponseOptions, uint64_t Response);
+typedef void (*on_x64_NtReadFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtReadFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtReadFileScatter_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t SegmentArray, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtReadFileScatter_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t SegmentArray, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtReadOnlyEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtReadOnlyEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtReadRequestData_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message, uint32_t DataEntryIndex, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesRead);
+typedef void (*on_x64_NtReadRequestData_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message, uint32_t DataEntryIndex, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesRead);
+typedef void (*on_x64_NtReadVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesRead);
+typedef void (*on_x64_NtReadVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesRead);
+typedef void (*on_x64_NtRecoverEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t EnlistmentKey);
+typedef void (*on_x64_NtRecoverEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t EnlistmentKey);
+typedef void (*on_x64_NtRecoverResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle);
+typedef void (*on_x64_NtRecoverResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle);
+typedef void (*on_x64_NtRecoverTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle);
+typedef void (*on_x64_NtRecoverTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle);
+typedef void (*on_x64_NtRegisterProtocolAddressInformation_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManager, uint64_t ProtocolId, uint32_t ProtocolInformationSize, uint64_t ProtocolInformation, uint32_t CreateOptions);
+typedef void (*on_x64_NtRegisterProtocolAddressInformation_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManager, uint64_t ProtocolId, uint32_t ProtocolInformationSize, uint64_t ProtocolInformation, uint32_t CreateOptions);
+typedef void (*on_x64_NtRegisterThreadTerminatePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle);
+typedef void (*on_x64_NtRegisterThreadTerminatePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle);
+typedef void (*on_x64_NtReleaseKeyedEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint64_t KeyValue, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtReleaseKeyedEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint64_t KeyValue, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtReleaseMutant_enter_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint64_t PreviousCount);
+typedef void (*on_x64_NtReleaseMutant_return_t)(CPUState* cpu, target_ulong pc, uint64_t MutantHandle, uint64_t PreviousCount);
+typedef void (*on_x64_NtReleaseSemaphore_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, int32_t ReleaseCount, uint64_t PreviousCount);
+typedef void (*on_x64_NtReleaseSemaphore_return_t)(CPUState* cpu, target_ulong pc, uint64_t SemaphoreHandle, int32_t ReleaseCount, uint64_t PreviousCount);
+typedef void (*on_x64_NtReleaseWorkerFactoryWorker_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle);
+typedef void (*on_x64_NtReleaseWorkerFactoryWorker_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle);
+typedef void (*on_x64_NtRemoveIoCompletion_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t KeyContext, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Timeout);
+typedef void (*on_x64_NtRemoveIoCompletion_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t KeyContext, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Timeout);
+typedef void (*on_x64_NtRemoveIoCompletionEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t IoCompletionInformation, uint32_t Count, uint64_t NumEntriesRemoved, uint64_t Timeout, uint32_t Alertable);
+typedef void (*on_x64_NtRemoveIoCompletionEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t IoCompletionInformation, uint32_t Count, uint64_t NumEntriesRemoved, uint64_t Timeout, uint32_t Alertable);
+typedef void (*on_x64_NtRemoveProcessDebug_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t DebugObjectHandle);
+typedef void (*on_x64_NtRemoveProcessDebug_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t DebugObjectHandle);
+typedef void (*on_x64_NtRenameKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t NewName);
+typedef void (*on_x64_NtRenameKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t NewName);
+typedef void (*on_x64_NtRenameTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t LogFileName, uint64_t ExistingTransactionManagerGuid);
+typedef void (*on_x64_NtRenameTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t LogFileName, uint64_t ExistingTransactionManagerGuid);
+typedef void (*on_x64_NtReplaceKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t NewFile, uint64_t TargetHandle, uint64_t OldFile);
+typedef void (*on_x64_NtReplaceKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t NewFile, uint64_t TargetHandle, uint64_t OldFile);
+typedef void (*on_x64_NtReplacePartitionUnit_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetInstancePath, uint64_t SpareInstancePath, uint32_t Flags);
+typedef void (*on_x64_NtReplacePartitionUnit_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetInstancePath, uint64_t SpareInstancePath, uint32_t Flags);
+typedef void (*on_x64_NtReplyPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ReplyMessage);
+typedef void (*on_x64_NtReplyPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ReplyMessage);
+typedef void (*on_x64_NtReplyWaitReceivePort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ReplyMessage, uint64_t ReceiveMessage);
+typedef void (*on_x64_NtReplyWaitReceivePort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ReplyMessage, uint64_t ReceiveMessage);
+typedef void (*on_x64_NtReplyWaitReceivePortEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ReplyMessage, uint64_t ReceiveMessage, uint64_t Timeout);
+typedef void (*on_x64_NtReplyWaitReceivePortEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortContext, uint64_t ReplyMessage, uint64_t ReceiveMessage, uint64_t Timeout);
+typedef void (*on_x64_NtReplyWaitReplyPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ReplyMessage);
+typedef void (*on_x64_NtReplyWaitReplyPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t ReplyMessage);
+typedef void (*on_x64_NtRequestPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t RequestMessage);
+typedef void (*on_x64_NtRequestPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t RequestMessage);
+typedef void (*on_x64_NtRequestWaitReplyPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t RequestMessage, uint64_t ReplyMessage);
+typedef void (*on_x64_NtRequestWaitReplyPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t RequestMessage, uint64_t ReplyMessage);
+typedef void (*on_x64_NtResetEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtResetEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtResetWriteWatch_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize);
+typedef void (*on_x64_NtResetWriteWatch_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize);
+typedef void (*on_x64_NtRestoreKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle, uint32_t Flags);
+typedef void (*on_x64_NtRestoreKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle, uint32_t Flags);
+typedef void (*on_x64_NtResumeProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle);
+typedef void (*on_x64_NtResumeProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle);
+typedef void (*on_x64_NtResumeThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtResumeThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtRollbackComplete_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtRollbackComplete_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtRollbackEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtRollbackEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtRollbackTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t Wait);
+typedef void (*on_x64_NtRollbackTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t Wait);
+typedef void (*on_x64_NtRollforwardTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtRollforwardTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionManagerHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtSaveKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle);
+typedef void (*on_x64_NtSaveKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle);
+typedef void (*on_x64_NtSaveKeyEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle, uint32_t Format);
+typedef void (*on_x64_NtSaveKeyEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t FileHandle, uint32_t Format);
+typedef void (*on_x64_NtSaveMergedKeys_enter_t)(CPUState* cpu, target_ulong pc, uint64_t HighPrecedenceKeyHandle, uint64_t LowPrecedenceKeyHandle, uint64_t FileHandle);
+typedef void (*on_x64_NtSaveMergedKeys_return_t)(CPUState* cpu, target_ulong pc, uint64_t HighPrecedenceKeyHandle, uint64_t LowPrecedenceKeyHandle, uint64_t FileHandle);
+typedef void (*on_x64_NtSecureConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t SecurityQos, uint64_t ClientView, uint64_t RequiredServerSid, uint64_t ServerView, uint64_t MaxMessageLength, uint64_t ConnectionInformation, uint64_t ConnectionInformationLength);
+typedef void (*on_x64_NtSecureConnectPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t PortName, uint64_t SecurityQos, uint64_t ClientView, uint64_t RequiredServerSid, uint64_t ServerView, uint64_t MaxMessageLength, uint64_t ConnectionInformation, uint64_t ConnectionInformationLength);
+typedef void (*on_x64_NtSerializeBoot_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtSerializeBoot_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtSetBootEntryOrder_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint32_t Count);
+typedef void (*on_x64_NtSetBootEntryOrder_return_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint32_t Count);
+typedef void (*on_x64_NtSetBootOptions_enter_t)(CPUState* cpu, target_ulong pc, uint64_t BootOptions, uint32_t FieldsToChange);
+typedef void (*on_x64_NtSetBootOptions_return_t)(CPUState* cpu, target_ulong pc, uint64_t BootOptions, uint32_t FieldsToChange);
+typedef void (*on_x64_NtSetContextThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ThreadContext);
+typedef void (*on_x64_NtSetContextThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t ThreadContext);
+typedef void (*on_x64_NtSetDebugFilterState_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ComponentId, uint32_t Level, uint32_t State);
+typedef void (*on_x64_NtSetDebugFilterState_return_t)(CPUState* cpu, target_ulong pc, uint32_t ComponentId, uint32_t Level, uint32_t State);
+typedef void (*on_x64_NtSetDefaultHardErrorPort_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DefaultHardErrorPort);
+typedef void (*on_x64_NtSetDefaultHardErrorPort_return_t)(CPUState* cpu, target_ulong pc, uint64_t DefaultHardErrorPort);
+typedef void (*on_x64_NtSetDefaultLocale_enter_t)(CPUState* cpu, target_ulong pc, uint32_t UserProfile, uint32_t DefaultLocaleId);
+typedef void (*on_x64_NtSetDefaultLocale_return_t)(CPUState* cpu, target_ulong pc, uint32_t UserProfile, uint32_t DefaultLocaleId);
+typedef void (*on_x64_NtSetDefaultUILanguage_enter_t)(CPUState* cpu, target_ulong pc, uint32_t DefaultUILanguageId);
+typedef void (*on_x64_NtSetDefaultUILanguage_return_t)(CPUState* cpu, target_ulong pc, uint32_t DefaultUILanguageId);
+typedef void (*on_x64_NtSetDriverEntryOrder_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint32_t Count);
+typedef void (*on_x64_NtSetDriverEntryOrder_return_t)(CPUState* cpu, target_ulong pc, uint64_t Ids, uint32_t Count);
+typedef void (*on_x64_NtSetEaFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length);
+typedef void (*on_x64_NtSetEaFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length);
+typedef void (*on_x64_NtSetEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtSetEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle, uint64_t PreviousState);
+typedef void (*on_x64_NtSetEventBoostPriority_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle);
+typedef void (*on_x64_NtSetEventBoostPriority_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventHandle);
+typedef void (*on_x64_NtSetHighEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetHighEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetHighWaitLowEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetHighWaitLowEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetInformationDebugObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t DebugObjectInformationClass, uint64_t DebugInformation, uint32_t DebugInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtSetInformationDebugObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t DebugObjectInformationClass, uint64_t DebugInformation, uint32_t DebugInformationLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtSetInformationEnlistment_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t EnlistmentInformationClass, uint64_t EnlistmentInformation, uint32_t EnlistmentInformationLength);
+typedef void (*on_x64_NtSetInformationEnlistment_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint32_t EnlistmentInformationClass, uint64_t EnlistmentInformation, uint32_t EnlistmentInformationLength);
+typedef void (*on_x64_NtSetInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass);
+typedef void (*on_x64_NtSetInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FileInformation, uint32_t Length, uint32_t FileInformationClass);
+typedef void (*on_x64_NtSetInformationJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t JobObjectInformationClass, uint64_t JobObjectInformation, uint32_t JobObjectInformationLength);
+typedef void (*on_x64_NtSetInformationJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t JobObjectInformationClass, uint64_t JobObjectInformation, uint32_t JobObjectInformationLength);
+typedef void (*on_x64_NtSetInformationKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t KeySetInformationClass, uint64_t KeySetInformation, uint32_t KeySetInformationLength);
+typedef void (*on_x64_NtSetInformationKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint32_t KeySetInformationClass, uint64_t KeySetInformation, uint32_t KeySetInformationLength);
+typedef void (*on_x64_NtSetInformationObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t ObjectInformationClass, uint64_t ObjectInformation, uint32_t ObjectInformationLength);
+typedef void (*on_x64_NtSetInformationObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t ObjectInformationClass, uint64_t ObjectInformation, uint32_t ObjectInformationLength);
+typedef void (*on_x64_NtSetInformationProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ProcessInformationClass, uint64_t ProcessInformation, uint32_t ProcessInformationLength);
+typedef void (*on_x64_NtSetInformationProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t ProcessInformationClass, uint64_t ProcessInformation, uint32_t ProcessInformationLength);
+typedef void (*on_x64_NtSetInformationResourceManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t ResourceManagerInformationClass, uint64_t ResourceManagerInformation, uint32_t ResourceManagerInformationLength);
+typedef void (*on_x64_NtSetInformationResourceManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t ResourceManagerHandle, uint32_t ResourceManagerInformationClass, uint64_t ResourceManagerInformation, uint32_t ResourceManagerInformationLength);
+typedef void (*on_x64_NtSetInformationThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ThreadInformationClass, uint64_t ThreadInformation, uint32_t ThreadInformationLength);
+typedef void (*on_x64_NtSetInformationThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ThreadInformationClass, uint64_t ThreadInformation, uint32_t ThreadInformationLength);
+typedef void (*on_x64_NtSetInformationToken_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t TokenInformationClass, uint64_t TokenInformation, uint32_t TokenInformationLength);
+typedef void (*on_x64_NtSetInformationToken_return_t)(CPUState* cpu, target_ulong pc, uint64_t TokenHandle, uint32_t TokenInformationClass, uint64_t TokenInformation, uint32_t TokenInformationLength);
+typedef void (*on_x64_NtSetInformationTransaction_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t TransactionInformationClass, uint64_t TransactionInformation, uint32_t TransactionInformationLength);
+typedef void (*on_x64_NtSetInformationTransaction_return_t)(CPUState* cpu, target_ulong pc, uint64_t TransactionHandle, uint32_t TransactionInformationClass, uint64_t TransactionInformation, uint32_t TransactionInformationLength);
+typedef void (*on_x64_NtSetInformationTransactionManager_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t TransactionManagerInformationClass, uint64_t TransactionManagerInformation, uint32_t TransactionManagerInformationLength);
+typedef void (*on_x64_NtSetInformationTransactionManager_return_t)(CPUState* cpu, target_ulong pc, uint64_t TmHandle, uint32_t TransactionManagerInformationClass, uint64_t TransactionManagerInformation, uint32_t TransactionManagerInformationLength);
+typedef void (*on_x64_NtSetInformationWorkerFactory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint32_t WorkerFactoryInformationClass, uint64_t WorkerFactoryInformation, uint32_t WorkerFactoryInformationLength);
+typedef void (*on_x64_NtSetInformationWorkerFactory_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint32_t WorkerFactoryInformationClass, uint64_t WorkerFactoryInformation, uint32_t WorkerFactoryInformationLength);
+typedef void (*on_x64_NtSetIntervalProfile_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Interval, uint32_t Source);
+typedef void (*on_x64_NtSetIntervalProfile_return_t)(CPUState* cpu, target_ulong pc, uint32_t Interval, uint32_t Source);
+typedef void (*on_x64_NtSetIoCompletion_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t KeyContext, uint64_t ApcContext, uint32_t IoStatus, uint64_t IoStatusInformation);
+typedef void (*on_x64_NtSetIoCompletion_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t KeyContext, uint64_t ApcContext, uint32_t IoStatus, uint64_t IoStatusInformation);
+typedef void (*on_x64_NtSetIoCompletionEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t IoCompletionReserveHandle, uint64_t KeyContext, uint64_t ApcContext, uint32_t IoStatus, uint64_t IoStatusInformation);
+typedef void (*on_x64_NtSetIoCompletionEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t IoCompletionHandle, uint64_t IoCompletionReserveHandle, uint64_t KeyContext, uint64_t ApcContext, uint32_t IoStatus, uint64_t IoStatusInformation);
+typedef void (*on_x64_NtSetLdtEntries_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Selector0, uint32_t Entry0Low, uint32_t Entry0Hi, uint32_t Selector1, uint32_t Entry1Low, uint32_t Entry1Hi);
+typedef void (*on_x64_NtSetLdtEntries_return_t)(CPUState* cpu, target_ulong pc, uint32_t Selector0, uint32_t Entry0Low, uint32_t Entry0Hi, uint32_t Selector1, uint32_t Entry1Low, uint32_t Entry1Hi);
+typedef void (*on_x64_NtSetLowEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetLowEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetLowWaitHighEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetLowWaitHighEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtSetQuotaInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length);
+typedef void (*on_x64_NtSetQuotaInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length);
+typedef void (*on_x64_NtSetSecurityObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t SecurityInformation, uint64_t SecurityDescriptor);
+typedef void (*on_x64_NtSetSecurityObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t SecurityInformation, uint64_t SecurityDescriptor);
+typedef void (*on_x64_NtSetSystemEnvironmentValue_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VariableValue);
+typedef void (*on_x64_NtSetSystemEnvironmentValue_return_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VariableValue);
+typedef void (*on_x64_NtSetSystemEnvironmentValueEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VendorGuid, uint64_t Value, uint32_t ValueLength, uint32_t Attributes);
+typedef void (*on_x64_NtSetSystemEnvironmentValueEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t VariableName, uint64_t VendorGuid, uint64_t Value, uint32_t ValueLength, uint32_t Attributes);
+typedef void (*on_x64_NtSetSystemInformation_enter_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t SystemInformation, uint32_t SystemInformationLength);
+typedef void (*on_x64_NtSetSystemInformation_return_t)(CPUState* cpu, target_ulong pc, uint32_t SystemInformationClass, uint64_t SystemInformation, uint32_t SystemInformationLength);
+typedef void (*on_x64_NtSetSystemPowerState_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SystemAction, uint32_t MinSystemState, uint32_t Flags);
+typedef void (*on_x64_NtSetSystemPowerState_return_t)(CPUState* cpu, target_ulong pc, uint64_t SystemAction, uint32_t MinSystemState, uint32_t Flags);
+typedef void (*on_x64_NtSetSystemTime_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SystemTime, uint64_t PreviousTime);
+typedef void (*on_x64_NtSetSystemTime_return_t)(CPUState* cpu, target_ulong pc, uint64_t SystemTime, uint64_t PreviousTime);
+typedef void (*on_x64_NtSetThreadExecutionState_enter_t)(CPUState* cpu, target_ulong pc, uint32_t esFlags, uint64_t PreviousFlags);
+typedef void (*on_x64_NtSetThreadExecutionState_return_t)(CPUState* cpu, target_ulong pc, uint32_t esFlags, uint64_t PreviousFlags);
+typedef void (*on_x64_NtSetTimer_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint64_t DueTime, uint64_t TimerApcRoutine, uint64_t TimerContext, uint32_t WakeTimer, int32_t Period, uint64_t PreviousState);
+typedef void (*on_x64_NtSetTimer_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint64_t DueTime, uint64_t TimerApcRoutine, uint64_t TimerContext, uint32_t WakeTimer, int32_t Period, uint64_t PreviousState);
+typedef void (*on_x64_NtSetTimerEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t TimerSetInformationClass, uint64_t TimerSetInformation, uint32_t TimerSetInformationLength);
+typedef void (*on_x64_NtSetTimerEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t TimerHandle, uint32_t TimerSetInformationClass, uint64_t TimerSetInformation, uint32_t TimerSetInformationLength);
+typedef void (*on_x64_NtSetTimerResolution_enter_t)(CPUState* cpu, target_ulong pc, uint32_t DesiredTime, uint32_t SetResolution, uint64_t ActualTime);
+typedef void (*on_x64_NtSetTimerResolution_return_t)(CPUState* cpu, target_ulong pc, uint32_t DesiredTime, uint32_t SetResolution, uint64_t ActualTime);
+typedef void (*on_x64_NtSetUuidSeed_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Seed);
+typedef void (*on_x64_NtSetUuidSeed_return_t)(CPUState* cpu, target_ulong pc, uint64_t Seed);
+typedef void (*on_x64_NtSetValueKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName, uint32_t TitleIndex, uint32_t Type, uint64_t Data, uint32_t DataSize);
+typedef void (*on_x64_NtSetValueKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyHandle, uint64_t ValueName, uint32_t TitleIndex, uint32_t Type, uint64_t Data, uint32_t DataSize);
+typedef void (*on_x64_NtSetVolumeInformationFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FsInformation, uint32_t Length, uint32_t FsInformationClass);
+typedef void (*on_x64_NtSetVolumeInformationFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t FsInformation, uint32_t Length, uint32_t FsInformationClass);
+typedef void (*on_x64_NtShutdownSystem_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Action);
+typedef void (*on_x64_NtShutdownSystem_return_t)(CPUState* cpu, target_ulong pc, uint32_t Action);
+typedef void (*on_x64_NtShutdownWorkerFactory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint64_t PendingWorkerCount);
+typedef void (*on_x64_NtShutdownWorkerFactory_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint64_t PendingWorkerCount);
+typedef void (*on_x64_NtSignalAndWaitForSingleObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SignalHandle, uint64_t WaitHandle, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtSignalAndWaitForSingleObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t SignalHandle, uint64_t WaitHandle, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtSinglePhaseReject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtSinglePhaseReject_return_t)(CPUState* cpu, target_ulong pc, uint64_t EnlistmentHandle, uint64_t TmVirtualClock);
+typedef void (*on_x64_NtStartProfile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle);
+typedef void (*on_x64_NtStartProfile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle);
+typedef void (*on_x64_NtStopProfile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle);
+typedef void (*on_x64_NtStopProfile_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProfileHandle);
+typedef void (*on_x64_NtSuspendProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle);
+typedef void (*on_x64_NtSuspendProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle);
+typedef void (*on_x64_NtSuspendThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtSuspendThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint64_t PreviousSuspendCount);
+typedef void (*on_x64_NtSystemDebugControl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Command, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtSystemDebugControl_return_t)(CPUState* cpu, target_ulong pc, uint32_t Command, uint64_t InputBuffer, uint32_t InputBufferLength, uint64_t OutputBuffer, uint32_t OutputBufferLength, uint64_t ReturnLength);
+typedef void (*on_x64_NtTerminateJobObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTerminateJobObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t JobHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTerminateProcess_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTerminateProcess_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTerminateThread_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTerminateThread_return_t)(CPUState* cpu, target_ulong pc, uint64_t ThreadHandle, uint32_t ExitStatus);
+typedef void (*on_x64_NtTestAlert_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtTestAlert_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtThawRegistry_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtThawRegistry_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtThawTransactions_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtThawTransactions_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtTraceControl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t FunctionCode, uint64_t InBuffer, uint32_t InBufferLen, uint64_t OutBuffer, uint32_t OutBufferLen, uint64_t ReturnLength);
+typedef void (*on_x64_NtTraceControl_return_t)(CPUState* cpu, target_ulong pc, uint32_t FunctionCode, uint64_t InBuffer, uint32_t InBufferLen, uint64_t OutBuffer, uint32_t OutBufferLen, uint64_t ReturnLength);
+typedef void (*on_x64_NtTraceEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TraceHandle, uint32_t Flags, uint32_t FieldSize, uint64_t Fields);
+typedef void (*on_x64_NtTraceEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t TraceHandle, uint32_t Flags, uint32_t FieldSize, uint64_t Fields);
+typedef void (*on_x64_NtTranslateFilePath_enter_t)(CPUState* cpu, target_ulong pc, uint64_t InputFilePath, uint32_t OutputType, uint64_t OutputFilePath, uint64_t OutputFilePathLength);
+typedef void (*on_x64_NtTranslateFilePath_return_t)(CPUState* cpu, target_ulong pc, uint64_t InputFilePath, uint32_t OutputType, uint64_t OutputFilePath, uint64_t OutputFilePathLength);
+typedef void (*on_x64_NtUmsThreadYield_enter_t)(CPUState* cpu, target_ulong pc, uint64_t SchedulerParam);
+typedef void (*on_x64_NtUmsThreadYield_return_t)(CPUState* cpu, target_ulong pc, uint64_t SchedulerParam);
+typedef void (*on_x64_NtUnloadDriver_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DriverServiceName);
+typedef void (*on_x64_NtUnloadDriver_return_t)(CPUState* cpu, target_ulong pc, uint64_t DriverServiceName);
+typedef void (*on_x64_NtUnloadKey_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey);
+typedef void (*on_x64_NtUnloadKey_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey);
+typedef void (*on_x64_NtUnloadKey2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint32_t Flags);
+typedef void (*on_x64_NtUnloadKey2_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint32_t Flags);
+typedef void (*on_x64_NtUnloadKeyEx_enter_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t Event);
+typedef void (*on_x64_NtUnloadKeyEx_return_t)(CPUState* cpu, target_ulong pc, uint64_t TargetKey, uint64_t Event);
+typedef void (*on_x64_NtUnlockFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t ByteOffset, uint64_t Length, uint32_t Key);
+typedef void (*on_x64_NtUnlockFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t IoStatusBlock, uint64_t ByteOffset, uint64_t Length, uint32_t Key);
+typedef void (*on_x64_NtUnlockVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t MapType);
+typedef void (*on_x64_NtUnlockVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t RegionSize, uint32_t MapType);
+typedef void (*on_x64_NtUnmapViewOfSection_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress);
+typedef void (*on_x64_NtUnmapViewOfSection_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress);
+typedef void (*on_x64_NtVdmControl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Service, uint64_t ServiceData);
+typedef void (*on_x64_NtVdmControl_return_t)(CPUState* cpu, target_ulong pc, uint32_t Service, uint64_t ServiceData);
+typedef void (*on_x64_NtWaitForDebugEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t Alertable, uint64_t Timeout, uint64_t WaitStateChange);
+typedef void (*on_x64_NtWaitForDebugEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t DebugObjectHandle, uint32_t Alertable, uint64_t Timeout, uint64_t WaitStateChange);
+typedef void (*on_x64_NtWaitForKeyedEvent_enter_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint64_t KeyValue, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForKeyedEvent_return_t)(CPUState* cpu, target_ulong pc, uint64_t KeyedEventHandle, uint64_t KeyValue, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForMultipleObjects_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t Handles, uint32_t WaitType, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForMultipleObjects_return_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t Handles, uint32_t WaitType, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForMultipleObjects32_enter_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t Handles, uint32_t WaitType, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForMultipleObjects32_return_t)(CPUState* cpu, target_ulong pc, uint32_t Count, uint64_t Handles, uint32_t WaitType, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForSingleObject_enter_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForSingleObject_return_t)(CPUState* cpu, target_ulong pc, uint64_t Handle, uint32_t Alertable, uint64_t Timeout);
+typedef void (*on_x64_NtWaitForWorkViaWorkerFactory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint64_t MiniPacket);
+typedef void (*on_x64_NtWaitForWorkViaWorkerFactory_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle, uint64_t MiniPacket);
+typedef void (*on_x64_NtWaitHighEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtWaitHighEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtWaitLowEventPair_enter_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtWaitLowEventPair_return_t)(CPUState* cpu, target_ulong pc, uint64_t EventPairHandle);
+typedef void (*on_x64_NtWorkerFactoryWorkerReady_enter_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle);
+typedef void (*on_x64_NtWorkerFactoryWorkerReady_return_t)(CPUState* cpu, target_ulong pc, uint64_t WorkerFactoryHandle);
+typedef void (*on_x64_NtWriteFile_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtWriteFile_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t Buffer, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtWriteFileGather_enter_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t SegmentArray, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtWriteFileGather_return_t)(CPUState* cpu, target_ulong pc, uint64_t FileHandle, uint64_t Event, uint64_t ApcRoutine, uint64_t ApcContext, uint64_t IoStatusBlock, uint64_t SegmentArray, uint32_t Length, uint64_t ByteOffset, uint64_t Key);
+typedef void (*on_x64_NtWriteRequestData_enter_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message, uint32_t DataEntryIndex, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesWritten);
+typedef void (*on_x64_NtWriteRequestData_return_t)(CPUState* cpu, target_ulong pc, uint64_t PortHandle, uint64_t Message, uint32_t DataEntryIndex, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesWritten);
+typedef void (*on_x64_NtWriteVirtualMemory_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesWritten);
+typedef void (*on_x64_NtWriteVirtualMemory_return_t)(CPUState* cpu, target_ulong pc, uint64_t ProcessHandle, uint64_t BaseAddress, uint64_t Buffer, uint64_t BufferSize, uint64_t NumberOfBytesWritten);
+typedef void (*on_x64_NtYieldExecution_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_NtYieldExecution_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_rt_sigaction_enter_t)(CPUState* cpu, target_ulong pc, int32_t sig, uint64_t act, uint64_t oact, uint64_t sigsetsize);
+typedef void (*on_x64_rt_sigaction_return_t)(CPUState* cpu, target_ulong pc, int32_t sig, uint64_t act, uint64_t oact, uint64_t sigsetsize);
+typedef void (*on_x64_set_thread_area_enter_t)(CPUState* cpu, target_ulong pc, uint64_t u_info);
+typedef void (*on_x64_set_thread_area_return_t)(CPUState* cpu, target_ulong pc, uint64_t u_info);
+typedef void (*on_x64_sys_accept_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_accept_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_accept4_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, int32_t arg3);
+typedef void (*on_x64_sys_accept4_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, int32_t arg3);
+typedef void (*on_x64_sys_access_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t mode);
+typedef void (*on_x64_sys_access_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t mode);
+typedef void (*on_x64_sys_acct_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_acct_return_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_add_key_enter_t)(CPUState* cpu, target_ulong pc, uint64_t _type, uint64_t _description, uint64_t _payload, uint64_t plen, uint32_t destringid);
+typedef void (*on_x64_sys_add_key_return_t)(CPUState* cpu, target_ulong pc, uint64_t _type, uint64_t _description, uint64_t _payload, uint64_t plen, uint32_t destringid);
+typedef void (*on_x64_sys_adjtimex_enter_t)(CPUState* cpu, target_ulong pc, uint64_t txc_p);
+typedef void (*on_x64_sys_adjtimex_return_t)(CPUState* cpu, target_ulong pc, uint64_t txc_p);
+typedef void (*on_x64_sys_alarm_enter_t)(CPUState* cpu, target_ulong pc, uint32_t seconds);
+typedef void (*on_x64_sys_alarm_return_t)(CPUState* cpu, target_ulong pc, uint32_t seconds);
+typedef void (*on_x64_sys_arch_prctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg2);
+typedef void (*on_x64_sys_arch_prctl_return_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg2);
+typedef void (*on_x64_sys_bind_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_bind_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_bpf_enter_t)(CPUState* cpu, target_ulong pc, int32_t cmd, uint64_t attr, uint32_t size);
+typedef void (*on_x64_sys_bpf_return_t)(CPUState* cpu, target_ulong pc, int32_t cmd, uint64_t attr, uint32_t size);
+typedef void (*on_x64_sys_brk_enter_t)(CPUState* cpu, target_ulong pc, uint64_t brk);
+typedef void (*on_x64_sys_brk_return_t)(CPUState* cpu, target_ulong pc, uint64_t brk);
+typedef void (*on_x64_sys_capget_enter_t)(CPUState* cpu, target_ulong pc, uint64_t header, uint64_t dataptr);
+typedef void (*on_x64_sys_capget_return_t)(CPUState* cpu, target_ulong pc, uint64_t header, uint64_t dataptr);
+typedef void (*on_x64_sys_capset_enter_t)(CPUState* cpu, target_ulong pc, uint64_t header, uint64_t _data);
+typedef void (*on_x64_sys_capset_return_t)(CPUState* cpu, target_ulong pc, uint64_t header, uint64_t _data);
+typedef void (*on_x64_sys_chdir_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename);
+typedef void (*on_x64_sys_chdir_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename);
+typedef void (*on_x64_sys_chmod_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t mode);
+typedef void (*on_x64_sys_chmod_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t mode);
+typedef void (*on_x64_sys_chown_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_chown_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_chroot_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename);
+typedef void (*on_x64_sys_chroot_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename);
+typedef void (*on_x64_sys_clock_adjtime_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tx);
+typedef void (*on_x64_sys_clock_adjtime_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tx);
+typedef void (*on_x64_sys_clock_getres_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clock_getres_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clock_gettime_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clock_gettime_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clock_nanosleep_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, int32_t flags, uint64_t rqtp, uint64_t rmtp);
+typedef void (*on_x64_sys_clock_nanosleep_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, int32_t flags, uint64_t rqtp, uint64_t rmtp);
+typedef void (*on_x64_sys_clock_settime_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clock_settime_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t tp);
+typedef void (*on_x64_sys_clone_enter_t)(CPUState* cpu, target_ulong pc, uint64_t clone_flags, uint64_t newsp, uint64_t parent_tidptr, uint64_t child_tidptr, uint64_t tls);
+typedef void (*on_x64_sys_clone_return_t)(CPUState* cpu, target_ulong pc, uint64_t clone_flags, uint64_t newsp, uint64_t parent_tidptr, uint64_t child_tidptr, uint64_t tls);
+typedef void (*on_x64_sys_close_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_close_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_connect_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_connect_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_copy_file_range_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd_in, uint64_t off_in, int32_t fd_out, uint64_t off_out, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_copy_file_range_return_t)(CPUState* cpu, target_ulong pc, int32_t fd_in, uint64_t off_in, int32_t fd_out, uint64_t off_out, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_creat_enter_t)(CPUState* cpu, target_ulong pc, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_creat_return_t)(CPUState* cpu, target_ulong pc, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_delete_module_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name_user, uint32_t flags);
+typedef void (*on_x64_sys_delete_module_return_t)(CPUState* cpu, target_ulong pc, uint64_t name_user, uint32_t flags);
+typedef void (*on_x64_sys_dup_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fildes);
+typedef void (*on_x64_sys_dup_return_t)(CPUState* cpu, target_ulong pc, uint32_t fildes);
+typedef void (*on_x64_sys_dup2_enter_t)(CPUState* cpu, target_ulong pc, uint32_t oldfd, uint32_t newfd);
+typedef void (*on_x64_sys_dup2_return_t)(CPUState* cpu, target_ulong pc, uint32_t oldfd, uint32_t newfd);
+typedef void (*on_x64_sys_dup3_enter_t)(CPUState* cpu, target_ulong pc, uint32_t oldfd, uint32_t newfd, int32_t flags);
+typedef void (*on_x64_sys_dup3_return_t)(CPUState* cpu, target_ulong pc, uint32_t oldfd, uint32_t newfd, int32_t flags);
+typedef void (*on_x64_sys_epoll_create_enter_t)(CPUState* cpu, target_ulong pc, int32_t size);
+typedef void (*on_x64_sys_epoll_create_return_t)(CPUState* cpu, target_ulong pc, int32_t size);
+typedef void (*on_x64_sys_epoll_create1_enter_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_epoll_create1_return_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_epoll_ctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t epfd, int32_t op, int32_t fd, uint64_t event);
+typedef void (*on_x64_sys_epoll_ctl_return_t)(CPUState* cpu, target_ulong pc, int32_t epfd, int32_t op, int32_t fd, uint64_t event);
+typedef void (*on_x64_sys_epoll_pwait_enter_t)(CPUState* cpu, target_ulong pc, int32_t epfd, uint64_t events, int32_t maxevents, int32_t timeout, uint64_t sigmask, uint64_t sigsetsize);
+typedef void (*on_x64_sys_epoll_pwait_return_t)(CPUState* cpu, target_ulong pc, int32_t epfd, uint64_t events, int32_t maxevents, int32_t timeout, uint64_t sigmask, uint64_t sigsetsize);
+typedef void (*on_x64_sys_epoll_wait_enter_t)(CPUState* cpu, target_ulong pc, int32_t epfd, uint64_t events, int32_t maxevents, int32_t timeout);
+typedef void (*on_x64_sys_epoll_wait_return_t)(CPUState* cpu, target_ulong pc, int32_t epfd, uint64_t events, int32_t maxevents, int32_t timeout);
+typedef void (*on_x64_sys_eventfd_enter_t)(CPUState* cpu, target_ulong pc, uint32_t count);
+typedef void (*on_x64_sys_eventfd_return_t)(CPUState* cpu, target_ulong pc, uint32_t count);
+typedef void (*on_x64_sys_eventfd2_enter_t)(CPUState* cpu, target_ulong pc, uint32_t count, int32_t flags);
+typedef void (*on_x64_sys_eventfd2_return_t)(CPUState* cpu, target_ulong pc, uint32_t count, int32_t flags);
+typedef void (*on_x64_sys_execve_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t argv, uint64_t envp);
+typedef void (*on_x64_sys_execve_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t argv, uint64_t envp);
+typedef void (*on_x64_sys_execveat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t argv, uint64_t envp, int32_t flags);
+typedef void (*on_x64_sys_execveat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t argv, uint64_t envp, int32_t flags);
+typedef void (*on_x64_sys_exit_enter_t)(CPUState* cpu, target_ulong pc, int32_t error_code);
+typedef void (*on_x64_sys_exit_return_t)(CPUState* cpu, target_ulong pc, int32_t error_code);
+typedef void (*on_x64_sys_exit_group_enter_t)(CPUState* cpu, target_ulong pc, int32_t error_code);
+typedef void (*on_x64_sys_exit_group_return_t)(CPUState* cpu, target_ulong pc, int32_t error_code);
+typedef void (*on_x64_sys_faccessat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t mode);
+typedef void (*on_x64_sys_faccessat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t mode);
+typedef void (*on_x64_sys_fadvise64_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t len, int32_t advice);
+typedef void (*on_x64_sys_fadvise64_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t len, int32_t advice);
+typedef void (*on_x64_sys_fallocate_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t mode, uint64_t offset, uint64_t len);
+typedef void (*on_x64_sys_fallocate_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t mode, uint64_t offset, uint64_t len);
+typedef void (*on_x64_sys_fanotify_init_enter_t)(CPUState* cpu, target_ulong pc, uint32_t flags, uint32_t event_f_flags);
+typedef void (*on_x64_sys_fanotify_init_return_t)(CPUState* cpu, target_ulong pc, uint32_t flags, uint32_t event_f_flags);
+typedef void (*on_x64_sys_fanotify_mark_enter_t)(CPUState* cpu, target_ulong pc, int32_t fanotify_fd, uint32_t flags, uint64_t mask, int32_t fd, uint64_t pathname);
+typedef void (*on_x64_sys_fanotify_mark_return_t)(CPUState* cpu, target_ulong pc, int32_t fanotify_fd, uint32_t flags, uint64_t mask, int32_t fd, uint64_t pathname);
+typedef void (*on_x64_sys_fchdir_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_fchdir_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_fchmod_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t mode);
+typedef void (*on_x64_sys_fchmod_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t mode);
+typedef void (*on_x64_sys_fchmodat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint32_t mode);
+typedef void (*on_x64_sys_fchmodat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint32_t mode);
+typedef void (*on_x64_sys_fchown_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_fchown_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_fchownat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint32_t user, uint32_t group, int32_t flag);
+typedef void (*on_x64_sys_fchownat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint32_t user, uint32_t group, int32_t flag);
+typedef void (*on_x64_sys_fcntl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_fcntl_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_fdatasync_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_fdatasync_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_fgetxattr_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_fgetxattr_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_finit_module_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t uargs, int32_t flags);
+typedef void (*on_x64_sys_finit_module_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t uargs, int32_t flags);
+typedef void (*on_x64_sys_flistxattr_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_flistxattr_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_flock_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd);
+typedef void (*on_x64_sys_flock_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd);
+typedef void (*on_x64_sys_fork_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_fork_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_fremovexattr_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name);
+typedef void (*on_x64_sys_fremovexattr_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name);
+typedef void (*on_x64_sys_fsetxattr_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_fsetxattr_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_fstatfs_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf);
+typedef void (*on_x64_sys_fstatfs_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf);
+typedef void (*on_x64_sys_fsync_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_fsync_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd);
+typedef void (*on_x64_sys_ftruncate_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t length);
+typedef void (*on_x64_sys_ftruncate_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t length);
+typedef void (*on_x64_sys_futex_enter_t)(CPUState* cpu, target_ulong pc, uint64_t uaddr, int32_t op, uint32_t val, uint64_t utime, uint64_t uaddr2, uint32_t val3);
+typedef void (*on_x64_sys_futex_return_t)(CPUState* cpu, target_ulong pc, uint64_t uaddr, int32_t op, uint32_t val, uint64_t utime, uint64_t uaddr2, uint32_t val3);
+typedef void (*on_x64_sys_futimesat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t utimes);
+typedef void (*on_x64_sys_futimesat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t utimes);
+typedef void (*on_x64_sys_get_mempolicy_enter_t)(CPUState* cpu, target_ulong pc, uint64_t policy, uint64_t nmask, uint64_t maxnode, uint64_t addr, uint64_t flags);
+typedef void (*on_x64_sys_get_mempolicy_return_t)(CPUState* cpu, target_ulong pc, uint64_t policy, uint64_t nmask, uint64_t maxnode, uint64_t addr, uint64_t flags);
+typedef void (*on_x64_sys_get_robust_list_enter_t)(CPUState* cpu, target_ulong pc, int32_t pid, uint64_t head_ptr, uint64_t len_ptr);
+typedef void (*on_x64_sys_get_robust_list_return_t)(CPUState* cpu, target_ulong pc, int32_t pid, uint64_t head_ptr, uint64_t len_ptr);
+typedef void (*on_x64_sys_getcpu_enter_t)(CPUState* cpu, target_ulong pc, uint64_t _cpu, uint64_t node, uint64_t cache);
+typedef void (*on_x64_sys_getcpu_return_t)(CPUState* cpu, target_ulong pc, uint64_t _cpu, uint64_t node, uint64_t cache);
+typedef void (*on_x64_sys_getcwd_enter_t)(CPUState* cpu, target_ulong pc, uint64_t buf, uint64_t size);
+typedef void (*on_x64_sys_getcwd_return_t)(CPUState* cpu, target_ulong pc, uint64_t buf, uint64_t size);
+typedef void (*on_x64_sys_getdents_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t dirent, uint32_t count);
+typedef void (*on_x64_sys_getdents_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t dirent, uint32_t count);
+typedef void (*on_x64_sys_getdents64_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t dirent, uint32_t count);
+typedef void (*on_x64_sys_getdents64_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t dirent, uint32_t count);
+typedef void (*on_x64_sys_getegid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getegid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_geteuid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_geteuid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getgid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getgid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getgroups_enter_t)(CPUState* cpu, target_ulong pc, int32_t gidsetsize, uint64_t grouplist);
+typedef void (*on_x64_sys_getgroups_return_t)(CPUState* cpu, target_ulong pc, int32_t gidsetsize, uint64_t grouplist);
+typedef void (*on_x64_sys_getitimer_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, uint64_t value);
+typedef void (*on_x64_sys_getitimer_return_t)(CPUState* cpu, target_ulong pc, int32_t which, uint64_t value);
+typedef void (*on_x64_sys_getpeername_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_getpeername_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_getpgid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_getpgid_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_getpgrp_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getpgrp_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getpid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getpid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getppid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getppid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getpriority_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who);
+typedef void (*on_x64_sys_getpriority_return_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who);
+typedef void (*on_x64_sys_getrandom_enter_t)(CPUState* cpu, target_ulong pc, uint64_t buf, uint64_t count, uint32_t flags);
+typedef void (*on_x64_sys_getrandom_return_t)(CPUState* cpu, target_ulong pc, uint64_t buf, uint64_t count, uint32_t flags);
+typedef void (*on_x64_sys_getresgid_enter_t)(CPUState* cpu, target_ulong pc, uint64_t rgid, uint64_t egid, uint64_t sgid);
+typedef void (*on_x64_sys_getresgid_return_t)(CPUState* cpu, target_ulong pc, uint64_t rgid, uint64_t egid, uint64_t sgid);
+typedef void (*on_x64_sys_getresuid_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ruid, uint64_t euid, uint64_t suid);
+typedef void (*on_x64_sys_getresuid_return_t)(CPUState* cpu, target_ulong pc, uint64_t ruid, uint64_t euid, uint64_t suid);
+typedef void (*on_x64_sys_getrlimit_enter_t)(CPUState* cpu, target_ulong pc, uint32_t resource, uint64_t rlim);
+typedef void (*on_x64_sys_getrlimit_return_t)(CPUState* cpu, target_ulong pc, uint32_t resource, uint64_t rlim);
+typedef void (*on_x64_sys_getrusage_enter_t)(CPUState* cpu, target_ulong pc, int32_t who, uint64_t ru);
+typedef void (*on_x64_sys_getrusage_return_t)(CPUState* cpu, target_ulong pc, int32_t who, uint64_t ru);
+typedef void (*on_x64_sys_getsid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_getsid_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_getsockname_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_getsockname_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_getsockopt_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t level, int32_t optname, uint64_t optval, uint64_t optlen);
+typedef void (*on_x64_sys_getsockopt_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t level, int32_t optname, uint64_t optval, uint64_t optlen);
+typedef void (*on_x64_sys_gettid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_gettid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_gettimeofday_enter_t)(CPUState* cpu, target_ulong pc, uint64_t tv, uint64_t tz);
+typedef void (*on_x64_sys_gettimeofday_return_t)(CPUState* cpu, target_ulong pc, uint64_t tv, uint64_t tz);
+typedef void (*on_x64_sys_getuid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getuid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_getxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_getxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_init_module_enter_t)(CPUState* cpu, target_ulong pc, uint64_t umod, uint64_t len, uint64_t uargs);
+typedef void (*on_x64_sys_init_module_return_t)(CPUState* cpu, target_ulong pc, uint64_t umod, uint64_t len, uint64_t uargs);
+typedef void (*on_x64_sys_inotify_add_watch_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t path, uint32_t mask);
+typedef void (*on_x64_sys_inotify_add_watch_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t path, uint32_t mask);
+typedef void (*on_x64_sys_inotify_init_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_inotify_init_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_inotify_init1_enter_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_inotify_init1_return_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_inotify_rm_watch_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t wd);
+typedef void (*on_x64_sys_inotify_rm_watch_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t wd);
+typedef void (*on_x64_sys_io_cancel_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ctx_id, uint64_t iocb, uint64_t result);
+typedef void (*on_x64_sys_io_cancel_return_t)(CPUState* cpu, target_ulong pc, uint32_t ctx_id, uint64_t iocb, uint64_t result);
+typedef void (*on_x64_sys_io_destroy_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ctx);
+typedef void (*on_x64_sys_io_destroy_return_t)(CPUState* cpu, target_ulong pc, uint32_t ctx);
+typedef void (*on_x64_sys_io_getevents_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ctx_id, uint64_t min_nr, uint64_t nr, uint64_t events, uint64_t timeout);
+typedef void (*on_x64_sys_io_getevents_return_t)(CPUState* cpu, target_ulong pc, uint32_t ctx_id, uint64_t min_nr, uint64_t nr, uint64_t events, uint64_t timeout);
+typedef void (*on_x64_sys_io_setup_enter_t)(CPUState* cpu, target_ulong pc, uint32_t nr_reqs, uint64_t ctx);
+typedef void (*on_x64_sys_io_setup_return_t)(CPUState* cpu, target_ulong pc, uint32_t nr_reqs, uint64_t ctx);
+typedef void (*on_x64_sys_io_submit_enter_t)(CPUState* cpu, target_ulong pc, uint32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_io_submit_return_t)(CPUState* cpu, target_ulong pc, uint32_t arg0, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_ioctl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_ioctl_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_ioperm_enter_t)(CPUState* cpu, target_ulong pc, uint64_t from, uint64_t num, int32_t on);
+typedef void (*on_x64_sys_ioperm_return_t)(CPUState* cpu, target_ulong pc, uint64_t from, uint64_t num, int32_t on);
+typedef void (*on_x64_sys_iopl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t level);
+typedef void (*on_x64_sys_iopl_return_t)(CPUState* cpu, target_ulong pc, uint32_t level);
+typedef void (*on_x64_sys_ioprio_get_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who);
+typedef void (*on_x64_sys_ioprio_get_return_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who);
+typedef void (*on_x64_sys_ioprio_set_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who, int32_t ioprio);
+typedef void (*on_x64_sys_ioprio_set_return_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who, int32_t ioprio);
+typedef void (*on_x64_sys_kcmp_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid1, uint32_t pid2, int32_t type, uint64_t idx1, uint64_t idx2);
+typedef void (*on_x64_sys_kcmp_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid1, uint32_t pid2, int32_t type, uint64_t idx1, uint64_t idx2);
+typedef void (*on_x64_sys_kexec_file_load_enter_t)(CPUState* cpu, target_ulong pc, int32_t kernel_fd, int32_t initrd_fd, uint64_t cmdline_len, uint64_t cmdline_ptr, uint64_t flags);
+typedef void (*on_x64_sys_kexec_file_load_return_t)(CPUState* cpu, target_ulong pc, int32_t kernel_fd, int32_t initrd_fd, uint64_t cmdline_len, uint64_t cmdline_ptr, uint64_t flags);
+typedef void (*on_x64_sys_kexec_load_enter_t)(CPUState* cpu, target_ulong pc, uint64_t entry, uint64_t nr_segments, uint64_t segments, uint64_t flags);
+typedef void (*on_x64_sys_kexec_load_return_t)(CPUState* cpu, target_ulong pc, uint64_t entry, uint64_t nr_segments, uint64_t segments, uint64_t flags);
+typedef void (*on_x64_sys_keyctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t cmd, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_keyctl_return_t)(CPUState* cpu, target_ulong pc, int32_t cmd, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_kill_enter_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_kill_return_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_lchown_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_lchown_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint32_t user, uint32_t group);
+typedef void (*on_x64_sys_lgetxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_lgetxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size);
+typedef void (*on_x64_sys_link_enter_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, uint64_t newname);
+typedef void (*on_x64_sys_link_return_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, uint64_t newname);
+typedef void (*on_x64_sys_linkat_enter_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname, int32_t flags);
+typedef void (*on_x64_sys_linkat_return_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname, int32_t flags);
+typedef void (*on_x64_sys_listen_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1);
+typedef void (*on_x64_sys_listen_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1);
+typedef void (*on_x64_sys_listxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_listxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_llistxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_llistxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t list, uint64_t size);
+typedef void (*on_x64_sys_lookup_dcookie_enter_t)(CPUState* cpu, target_ulong pc, uint64_t cookie64, uint64_t buf, uint64_t len);
+typedef void (*on_x64_sys_lookup_dcookie_return_t)(CPUState* cpu, target_ulong pc, uint64_t cookie64, uint64_t buf, uint64_t len);
+typedef void (*on_x64_sys_lremovexattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name);
+typedef void (*on_x64_sys_lremovexattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name);
+typedef void (*on_x64_sys_lseek_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t offset, uint32_t origin);
+typedef void (*on_x64_sys_lseek_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t offset, uint32_t origin);
+typedef void (*on_x64_sys_lsetxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_lsetxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_madvise_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t behavior);
+typedef void (*on_x64_sys_madvise_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t behavior);
+typedef void (*on_x64_sys_mbind_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t mode, uint64_t nmask, uint64_t maxnode, uint32_t flags);
+typedef void (*on_x64_sys_mbind_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t mode, uint64_t nmask, uint64_t maxnode, uint32_t flags);
+typedef void (*on_x64_sys_membarrier_enter_t)(CPUState* cpu, target_ulong pc, int32_t cmd, int32_t flags);
+typedef void (*on_x64_sys_membarrier_return_t)(CPUState* cpu, target_ulong pc, int32_t cmd, int32_t flags);
+typedef void (*on_x64_sys_memfd_create_enter_t)(CPUState* cpu, target_ulong pc, uint64_t uname_ptr, uint32_t flags);
+typedef void (*on_x64_sys_memfd_create_return_t)(CPUState* cpu, target_ulong pc, uint64_t uname_ptr, uint32_t flags);
+typedef void (*on_x64_sys_migrate_pages_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t maxnode, uint64_t from, uint64_t to);
+typedef void (*on_x64_sys_migrate_pages_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t maxnode, uint64_t from, uint64_t to);
+typedef void (*on_x64_sys_mincore_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t vec);
+typedef void (*on_x64_sys_mincore_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t vec);
+typedef void (*on_x64_sys_mkdir_enter_t)(CPUState* cpu, target_ulong pc, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_mkdir_return_t)(CPUState* cpu, target_ulong pc, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_mkdirat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_mkdirat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t pathname, int32_t mode);
+typedef void (*on_x64_sys_mknod_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t mode, uint32_t dev);
+typedef void (*on_x64_sys_mknod_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t mode, uint32_t dev);
+typedef void (*on_x64_sys_mknodat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t mode, uint32_t dev);
+typedef void (*on_x64_sys_mknodat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t mode, uint32_t dev);
+typedef void (*on_x64_sys_mlock_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len);
+typedef void (*on_x64_sys_mlock_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len);
+typedef void (*on_x64_sys_mlock2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t flags);
+typedef void (*on_x64_sys_mlock2_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t flags);
+typedef void (*on_x64_sys_mlockall_enter_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_mlockall_return_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_mmap_enter_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t len, uint64_t prot, uint64_t flags, uint64_t fd, uint64_t off);
+typedef void (*on_x64_sys_mmap_return_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t len, uint64_t prot, uint64_t flags, uint64_t fd, uint64_t off);
+typedef void (*on_x64_sys_modify_ldt_enter_t)(CPUState* cpu, target_ulong pc, int32_t func, uint64_t ptr, uint64_t bytecount);
+typedef void (*on_x64_sys_modify_ldt_return_t)(CPUState* cpu, target_ulong pc, int32_t func, uint64_t ptr, uint64_t bytecount);
+typedef void (*on_x64_sys_mount_enter_t)(CPUState* cpu, target_ulong pc, uint64_t dev_name, uint64_t dir_name, uint64_t type, uint64_t flags, uint64_t _data);
+typedef void (*on_x64_sys_mount_return_t)(CPUState* cpu, target_ulong pc, uint64_t dev_name, uint64_t dir_name, uint64_t type, uint64_t flags, uint64_t _data);
+typedef void (*on_x64_sys_move_pages_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t nr_pages, uint64_t pages, uint64_t nodes, uint64_t status, int32_t flags);
+typedef void (*on_x64_sys_move_pages_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t nr_pages, uint64_t pages, uint64_t nodes, uint64_t status, int32_t flags);
+typedef void (*on_x64_sys_mprotect_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t prot);
+typedef void (*on_x64_sys_mprotect_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t prot);
+typedef void (*on_x64_sys_mq_getsetattr_enter_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t mqstat, uint64_t omqstat);
+typedef void (*on_x64_sys_mq_getsetattr_return_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t mqstat, uint64_t omqstat);
+typedef void (*on_x64_sys_mq_notify_enter_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t notification);
+typedef void (*on_x64_sys_mq_notify_return_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t notification);
+typedef void (*on_x64_sys_mq_open_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t oflag, uint32_t mode, uint64_t attr);
+typedef void (*on_x64_sys_mq_open_return_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t oflag, uint32_t mode, uint64_t attr);
+typedef void (*on_x64_sys_mq_timedreceive_enter_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t msg_ptr, uint64_t msg_len, uint64_t msg_prio, uint64_t abs_timeout);
+typedef void (*on_x64_sys_mq_timedreceive_return_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t msg_ptr, uint64_t msg_len, uint64_t msg_prio, uint64_t abs_timeout);
+typedef void (*on_x64_sys_mq_timedsend_enter_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t msg_ptr, uint64_t msg_len, uint32_t msg_prio, uint64_t abs_timeout);
+typedef void (*on_x64_sys_mq_timedsend_return_t)(CPUState* cpu, target_ulong pc, uint32_t mqdes, uint64_t msg_ptr, uint64_t msg_len, uint32_t msg_prio, uint64_t abs_timeout);
+typedef void (*on_x64_sys_mq_unlink_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_mq_unlink_return_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_mremap_enter_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t old_len, uint64_t new_len, uint64_t flags, uint64_t new_addr);
+typedef void (*on_x64_sys_mremap_return_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t old_len, uint64_t new_len, uint64_t flags, uint64_t new_addr);
+typedef void (*on_x64_sys_msgctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t msqid, int32_t cmd, uint64_t buf);
+typedef void (*on_x64_sys_msgctl_return_t)(CPUState* cpu, target_ulong pc, int32_t msqid, int32_t cmd, uint64_t buf);
+typedef void (*on_x64_sys_msgget_enter_t)(CPUState* cpu, target_ulong pc, uint32_t key, int32_t msgflg);
+typedef void (*on_x64_sys_msgget_return_t)(CPUState* cpu, target_ulong pc, uint32_t key, int32_t msgflg);
+typedef void (*on_x64_sys_msgrcv_enter_t)(CPUState* cpu, target_ulong pc, int32_t msqid, uint64_t msgp, uint64_t msgsz, uint64_t msgtyp, int32_t msgflg);
+typedef void (*on_x64_sys_msgrcv_return_t)(CPUState* cpu, target_ulong pc, int32_t msqid, uint64_t msgp, uint64_t msgsz, uint64_t msgtyp, int32_t msgflg);
+typedef void (*on_x64_sys_msgsnd_enter_t)(CPUState* cpu, target_ulong pc, int32_t msqid, uint64_t msgp, uint64_t msgsz, int32_t msgflg);
+typedef void (*on_x64_sys_msgsnd_return_t)(CPUState* cpu, target_ulong pc, int32_t msqid, uint64_t msgp, uint64_t msgsz, int32_t msgflg);
+typedef void (*on_x64_sys_msync_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t flags);
+typedef void (*on_x64_sys_msync_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, int32_t flags);
+typedef void (*on_x64_sys_munlock_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len);
+typedef void (*on_x64_sys_munlock_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len);
+typedef void (*on_x64_sys_munlockall_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_munlockall_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_munmap_enter_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t len);
+typedef void (*on_x64_sys_munmap_return_t)(CPUState* cpu, target_ulong pc, uint64_t addr, uint64_t len);
+typedef void (*on_x64_sys_name_to_handle_at_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t name, uint64_t handle, uint64_t mnt_id, int32_t flag);
+typedef void (*on_x64_sys_name_to_handle_at_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t name, uint64_t handle, uint64_t mnt_id, int32_t flag);
+typedef void (*on_x64_sys_nanosleep_enter_t)(CPUState* cpu, target_ulong pc, uint64_t rqtp, uint64_t rmtp);
+typedef void (*on_x64_sys_nanosleep_return_t)(CPUState* cpu, target_ulong pc, uint64_t rqtp, uint64_t rmtp);
+typedef void (*on_x64_sys_newfstat_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t statbuf);
+typedef void (*on_x64_sys_newfstat_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t statbuf);
+typedef void (*on_x64_sys_newfstatat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t statbuf, int32_t flag);
+typedef void (*on_x64_sys_newfstatat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t statbuf, int32_t flag);
+typedef void (*on_x64_sys_newlstat_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t statbuf);
+typedef void (*on_x64_sys_newlstat_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t statbuf);
+typedef void (*on_x64_sys_newstat_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t statbuf);
+typedef void (*on_x64_sys_newstat_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t statbuf);
+typedef void (*on_x64_sys_newuname_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_newuname_return_t)(CPUState* cpu, target_ulong pc, uint64_t name);
+typedef void (*on_x64_sys_open_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t flags, int32_t mode);
+typedef void (*on_x64_sys_open_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, int32_t flags, int32_t mode);
+typedef void (*on_x64_sys_open_by_handle_at_enter_t)(CPUState* cpu, target_ulong pc, int32_t mountdirfd, uint64_t handle, int32_t flags);
+typedef void (*on_x64_sys_open_by_handle_at_return_t)(CPUState* cpu, target_ulong pc, int32_t mountdirfd, uint64_t handle, int32_t flags);
+typedef void (*on_x64_sys_openat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t flags, int32_t mode);
+typedef void (*on_x64_sys_openat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, int32_t flags, int32_t mode);
+typedef void (*on_x64_sys_pause_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_pause_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_perf_event_open_enter_t)(CPUState* cpu, target_ulong pc, uint64_t attr_uptr, uint32_t pid, int32_t _cpu, int32_t group_fd, uint64_t flags);
+typedef void (*on_x64_sys_perf_event_open_return_t)(CPUState* cpu, target_ulong pc, uint64_t attr_uptr, uint32_t pid, int32_t _cpu, int32_t group_fd, uint64_t flags);
+typedef void (*on_x64_sys_personality_enter_t)(CPUState* cpu, target_ulong pc, uint32_t personality);
+typedef void (*on_x64_sys_personality_return_t)(CPUState* cpu, target_ulong pc, uint32_t personality);
+typedef void (*on_x64_sys_pipe_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fildes);
+typedef void (*on_x64_sys_pipe_return_t)(CPUState* cpu, target_ulong pc, uint64_t fildes);
+typedef void (*on_x64_sys_pipe2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fildes, int32_t flags);
+typedef void (*on_x64_sys_pipe2_return_t)(CPUState* cpu, target_ulong pc, uint64_t fildes, int32_t flags);
+typedef void (*on_x64_sys_pivot_root_enter_t)(CPUState* cpu, target_ulong pc, uint64_t new_root, uint64_t put_old);
+typedef void (*on_x64_sys_pivot_root_return_t)(CPUState* cpu, target_ulong pc, uint64_t new_root, uint64_t put_old);
+typedef void (*on_x64_sys_pkey_alloc_enter_t)(CPUState* cpu, target_ulong pc, uint64_t flags, uint64_t init_val);
+typedef void (*on_x64_sys_pkey_alloc_return_t)(CPUState* cpu, target_ulong pc, uint64_t flags, uint64_t init_val);
+typedef void (*on_x64_sys_pkey_free_enter_t)(CPUState* cpu, target_ulong pc, int32_t pkey);
+typedef void (*on_x64_sys_pkey_free_return_t)(CPUState* cpu, target_ulong pc, int32_t pkey);
+typedef void (*on_x64_sys_pkey_mprotect_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t prot, int32_t pkey);
+typedef void (*on_x64_sys_pkey_mprotect_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t len, uint64_t prot, int32_t pkey);
+typedef void (*on_x64_sys_poll_enter_t)(CPUState* cpu, target_ulong pc, uint64_t ufds, uint32_t nfds, uint64_t timeout);
+typedef void (*on_x64_sys_poll_return_t)(CPUState* cpu, target_ulong pc, uint64_t ufds, uint32_t nfds, uint64_t timeout);
+typedef void (*on_x64_sys_ppoll_enter_t)(CPUState* cpu, target_ulong pc, uint64_t arg0, uint32_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4);
+typedef void (*on_x64_sys_ppoll_return_t)(CPUState* cpu, target_ulong pc, uint64_t arg0, uint32_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4);
+typedef void (*on_x64_sys_prctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_prctl_return_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_pread64_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos);
+typedef void (*on_x64_sys_pread64_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos);
+typedef void (*on_x64_sys_preadv_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h);
+typedef void (*on_x64_sys_preadv_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h);
+typedef void (*on_x64_sys_preadv2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h, int32_t flags);
+typedef void (*on_x64_sys_preadv2_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h, int32_t flags);
+typedef void (*on_x64_sys_prlimit64_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t resource, uint64_t new_rlim, uint64_t old_rlim);
+typedef void (*on_x64_sys_prlimit64_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t resource, uint64_t new_rlim, uint64_t old_rlim);
+typedef void (*on_x64_sys_process_vm_readv_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t lvec, uint64_t liovcnt, uint64_t rvec, uint64_t riovcnt, uint64_t flags);
+typedef void (*on_x64_sys_process_vm_readv_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t lvec, uint64_t liovcnt, uint64_t rvec, uint64_t riovcnt, uint64_t flags);
+typedef void (*on_x64_sys_process_vm_writev_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t lvec, uint64_t liovcnt, uint64_t rvec, uint64_t riovcnt, uint64_t flags);
+typedef void (*on_x64_sys_process_vm_writev_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t lvec, uint64_t liovcnt, uint64_t rvec, uint64_t riovcnt, uint64_t flags);
+typedef void (*on_x64_sys_pselect6_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_pselect6_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_ptrace_enter_t)(CPUState* cpu, target_ulong pc, uint64_t request, uint64_t pid, uint64_t addr, uint64_t _data);
+typedef void (*on_x64_sys_ptrace_return_t)(CPUState* cpu, target_ulong pc, uint64_t request, uint64_t pid, uint64_t addr, uint64_t _data);
+typedef void (*on_x64_sys_pwrite64_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos);
+typedef void (*on_x64_sys_pwrite64_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count, uint64_t pos);
+typedef void (*on_x64_sys_pwritev_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h);
+typedef void (*on_x64_sys_pwritev_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h);
+typedef void (*on_x64_sys_pwritev2_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h, int32_t flags);
+typedef void (*on_x64_sys_pwritev2_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen, uint64_t pos_l, uint64_t pos_h, int32_t flags);
+typedef void (*on_x64_sys_quotactl_enter_t)(CPUState* cpu, target_ulong pc, uint32_t cmd, uint64_t special, uint32_t id, uint64_t addr);
+typedef void (*on_x64_sys_quotactl_return_t)(CPUState* cpu, target_ulong pc, uint32_t cmd, uint64_t special, uint32_t id, uint64_t addr);
+typedef void (*on_x64_sys_read_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count);
+typedef void (*on_x64_sys_read_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count);
+typedef void (*on_x64_sys_readahead_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t count);
+typedef void (*on_x64_sys_readahead_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t count);
+typedef void (*on_x64_sys_readlink_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t buf, int32_t bufsiz);
+typedef void (*on_x64_sys_readlink_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t buf, int32_t bufsiz);
+typedef void (*on_x64_sys_readlinkat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t path, uint64_t buf, int32_t bufsiz);
+typedef void (*on_x64_sys_readlinkat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t path, uint64_t buf, int32_t bufsiz);
+typedef void (*on_x64_sys_readv_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen);
+typedef void (*on_x64_sys_readv_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen);
+typedef void (*on_x64_sys_reboot_enter_t)(CPUState* cpu, target_ulong pc, int32_t magic1, int32_t magic2, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_reboot_return_t)(CPUState* cpu, target_ulong pc, int32_t magic1, int32_t magic2, uint32_t cmd, uint64_t arg);
+typedef void (*on_x64_sys_recvfrom_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint32_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_recvfrom_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint32_t arg3, uint64_t arg4, uint64_t arg5);
+typedef void (*on_x64_sys_recvmmsg_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t vlen, uint32_t flags, uint64_t timeout);
+typedef void (*on_x64_sys_recvmmsg_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t vlen, uint32_t flags, uint64_t timeout);
+typedef void (*on_x64_sys_recvmsg_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t flags);
+typedef void (*on_x64_sys_recvmsg_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t flags);
+typedef void (*on_x64_sys_remap_file_pages_enter_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t size, uint64_t prot, uint64_t pgoff, uint64_t flags);
+typedef void (*on_x64_sys_remap_file_pages_return_t)(CPUState* cpu, target_ulong pc, uint64_t start, uint64_t size, uint64_t prot, uint64_t pgoff, uint64_t flags);
+typedef void (*on_x64_sys_removexattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name);
+typedef void (*on_x64_sys_removexattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name);
+typedef void (*on_x64_sys_rename_enter_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, uint64_t newname);
+typedef void (*on_x64_sys_rename_return_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, uint64_t newname);
+typedef void (*on_x64_sys_renameat_enter_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname);
+typedef void (*on_x64_sys_renameat_return_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname);
+typedef void (*on_x64_sys_renameat2_enter_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname, uint32_t flags);
+typedef void (*on_x64_sys_renameat2_return_t)(CPUState* cpu, target_ulong pc, int32_t olddfd, uint64_t oldname, int32_t newdfd, uint64_t newname, uint32_t flags);
+typedef void (*on_x64_sys_request_key_enter_t)(CPUState* cpu, target_ulong pc, uint64_t _type, uint64_t _description, uint64_t _callout_info, uint32_t destringid);
+typedef void (*on_x64_sys_request_key_return_t)(CPUState* cpu, target_ulong pc, uint64_t _type, uint64_t _description, uint64_t _callout_info, uint32_t destringid);
+typedef void (*on_x64_sys_restart_syscall_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_restart_syscall_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_rmdir_enter_t)(CPUState* cpu, target_ulong pc, uint64_t pathname);
+typedef void (*on_x64_sys_rmdir_return_t)(CPUState* cpu, target_ulong pc, uint64_t pathname);
+typedef void (*on_x64_sys_rt_sigpending_enter_t)(CPUState* cpu, target_ulong pc, uint64_t set, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigpending_return_t)(CPUState* cpu, target_ulong pc, uint64_t set, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigprocmask_enter_t)(CPUState* cpu, target_ulong pc, int32_t how, uint64_t set, uint64_t oset, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigprocmask_return_t)(CPUState* cpu, target_ulong pc, int32_t how, uint64_t set, uint64_t oset, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigqueueinfo_enter_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig, uint64_t uinfo);
+typedef void (*on_x64_sys_rt_sigqueueinfo_return_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig, uint64_t uinfo);
+typedef void (*on_x64_sys_rt_sigreturn_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_rt_sigreturn_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_rt_sigsuspend_enter_t)(CPUState* cpu, target_ulong pc, uint64_t unewset, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigsuspend_return_t)(CPUState* cpu, target_ulong pc, uint64_t unewset, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigtimedwait_enter_t)(CPUState* cpu, target_ulong pc, uint64_t uthese, uint64_t uinfo, uint64_t uts, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_sigtimedwait_return_t)(CPUState* cpu, target_ulong pc, uint64_t uthese, uint64_t uinfo, uint64_t uts, uint64_t sigsetsize);
+typedef void (*on_x64_sys_rt_tgsigqueueinfo_enter_t)(CPUState* cpu, target_ulong pc, uint32_t tgid, uint32_t pid, int32_t sig, uint64_t uinfo);
+typedef void (*on_x64_sys_rt_tgsigqueueinfo_return_t)(CPUState* cpu, target_ulong pc, uint32_t tgid, uint32_t pid, int32_t sig, uint64_t uinfo);
+typedef void (*on_x64_sys_sched_get_priority_max_enter_t)(CPUState* cpu, target_ulong pc, int32_t policy);
+typedef void (*on_x64_sys_sched_get_priority_max_return_t)(CPUState* cpu, target_ulong pc, int32_t policy);
+typedef void (*on_x64_sys_sched_get_priority_min_enter_t)(CPUState* cpu, target_ulong pc, int32_t policy);
+typedef void (*on_x64_sys_sched_get_priority_min_return_t)(CPUState* cpu, target_ulong pc, int32_t policy);
+typedef void (*on_x64_sys_sched_getaffinity_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t len, uint64_t user_mask_ptr);
+typedef void (*on_x64_sys_sched_getaffinity_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t len, uint64_t user_mask_ptr);
+typedef void (*on_x64_sys_sched_getattr_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t attr, uint32_t size, uint32_t flags);
+typedef void (*on_x64_sys_sched_getattr_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t attr, uint32_t size, uint32_t flags);
+typedef void (*on_x64_sys_sched_getparam_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t param);
+typedef void (*on_x64_sys_sched_getparam_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t param);
+typedef void (*on_x64_sys_sched_getscheduler_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_sched_getscheduler_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid);
+typedef void (*on_x64_sys_sched_rr_get_interval_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t interval);
+typedef void (*on_x64_sys_sched_rr_get_interval_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t interval);
+typedef void (*on_x64_sys_sched_setaffinity_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t len, uint64_t user_mask_ptr);
+typedef void (*on_x64_sys_sched_setaffinity_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t len, uint64_t user_mask_ptr);
+typedef void (*on_x64_sys_sched_setattr_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t attr, uint32_t flags);
+typedef void (*on_x64_sys_sched_setattr_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t attr, uint32_t flags);
+typedef void (*on_x64_sys_sched_setparam_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t param);
+typedef void (*on_x64_sys_sched_setparam_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t param);
+typedef void (*on_x64_sys_sched_setscheduler_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, int32_t policy, uint64_t param);
+typedef void (*on_x64_sys_sched_setscheduler_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, int32_t policy, uint64_t param);
+typedef void (*on_x64_sys_sched_yield_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_sched_yield_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_seccomp_enter_t)(CPUState* cpu, target_ulong pc, uint32_t op, uint32_t flags, uint64_t uargs);
+typedef void (*on_x64_sys_seccomp_return_t)(CPUState* cpu, target_ulong pc, uint32_t op, uint32_t flags, uint64_t uargs);
+typedef void (*on_x64_sys_select_enter_t)(CPUState* cpu, target_ulong pc, int32_t n, uint64_t inp, uint64_t outp, uint64_t exp, uint64_t tvp);
+typedef void (*on_x64_sys_select_return_t)(CPUState* cpu, target_ulong pc, int32_t n, uint64_t inp, uint64_t outp, uint64_t exp, uint64_t tvp);
+typedef void (*on_x64_sys_semctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t semid, int32_t semnum, int32_t cmd, uint32_t arg);
+typedef void (*on_x64_sys_semctl_return_t)(CPUState* cpu, target_ulong pc, int32_t semid, int32_t semnum, int32_t cmd, uint32_t arg);
+typedef void (*on_x64_sys_semget_enter_t)(CPUState* cpu, target_ulong pc, uint32_t key, int32_t nsems, int32_t semflg);
+typedef void (*on_x64_sys_semget_return_t)(CPUState* cpu, target_ulong pc, uint32_t key, int32_t nsems, int32_t semflg);
+typedef void (*on_x64_sys_semop_enter_t)(CPUState* cpu, target_ulong pc, int32_t semid, uint64_t sops, uint32_t nsops);
+typedef void (*on_x64_sys_semop_return_t)(CPUState* cpu, target_ulong pc, int32_t semid, uint64_t sops, uint32_t nsops);
+typedef void (*on_x64_sys_semtimedop_enter_t)(CPUState* cpu, target_ulong pc, int32_t semid, uint64_t sops, uint32_t nsops, uint64_t timeout);
+typedef void (*on_x64_sys_semtimedop_return_t)(CPUState* cpu, target_ulong pc, int32_t semid, uint64_t sops, uint32_t nsops, uint64_t timeout);
+typedef void (*on_x64_sys_sendfile_enter_t)(CPUState* cpu, target_ulong pc, int32_t out_fd, int32_t in_fd, uint64_t offset, uint64_t count);
+typedef void (*on_x64_sys_sendfile_return_t)(CPUState* cpu, target_ulong pc, int32_t out_fd, int32_t in_fd, uint64_t offset, uint64_t count);
+typedef void (*on_x64_sys_sendmmsg_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t vlen, uint32_t flags);
+typedef void (*on_x64_sys_sendmmsg_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t vlen, uint32_t flags);
+typedef void (*on_x64_sys_sendmsg_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t flags);
+typedef void (*on_x64_sys_sendmsg_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t msg, uint32_t flags);
+typedef void (*on_x64_sys_sendto_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint32_t arg3, uint64_t arg4, int32_t arg5);
+typedef void (*on_x64_sys_sendto_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, uint64_t arg1, uint64_t arg2, uint32_t arg3, uint64_t arg4, int32_t arg5);
+typedef void (*on_x64_sys_set_mempolicy_enter_t)(CPUState* cpu, target_ulong pc, int32_t mode, uint64_t nmask, uint64_t maxnode);
+typedef void (*on_x64_sys_set_mempolicy_return_t)(CPUState* cpu, target_ulong pc, int32_t mode, uint64_t nmask, uint64_t maxnode);
+typedef void (*on_x64_sys_set_robust_list_enter_t)(CPUState* cpu, target_ulong pc, uint64_t head, uint64_t len);
+typedef void (*on_x64_sys_set_robust_list_return_t)(CPUState* cpu, target_ulong pc, uint64_t head, uint64_t len);
+typedef void (*on_x64_sys_set_tid_address_enter_t)(CPUState* cpu, target_ulong pc, uint64_t tidptr);
+typedef void (*on_x64_sys_set_tid_address_return_t)(CPUState* cpu, target_ulong pc, uint64_t tidptr);
+typedef void (*on_x64_sys_setdomainname_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t len);
+typedef void (*on_x64_sys_setdomainname_return_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t len);
+typedef void (*on_x64_sys_setfsgid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t gid);
+typedef void (*on_x64_sys_setfsgid_return_t)(CPUState* cpu, target_ulong pc, uint32_t gid);
+typedef void (*on_x64_sys_setfsuid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t uid);
+typedef void (*on_x64_sys_setfsuid_return_t)(CPUState* cpu, target_ulong pc, uint32_t uid);
+typedef void (*on_x64_sys_setgid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t gid);
+typedef void (*on_x64_sys_setgid_return_t)(CPUState* cpu, target_ulong pc, uint32_t gid);
+typedef void (*on_x64_sys_setgroups_enter_t)(CPUState* cpu, target_ulong pc, int32_t gidsetsize, uint64_t grouplist);
+typedef void (*on_x64_sys_setgroups_return_t)(CPUState* cpu, target_ulong pc, int32_t gidsetsize, uint64_t grouplist);
+typedef void (*on_x64_sys_sethostname_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t len);
+typedef void (*on_x64_sys_sethostname_return_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t len);
+typedef void (*on_x64_sys_setitimer_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, uint64_t value, uint64_t ovalue);
+typedef void (*on_x64_sys_setitimer_return_t)(CPUState* cpu, target_ulong pc, int32_t which, uint64_t value, uint64_t ovalue);
+typedef void (*on_x64_sys_setns_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t nstype);
+typedef void (*on_x64_sys_setns_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t nstype);
+typedef void (*on_x64_sys_setpgid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t pgid);
+typedef void (*on_x64_sys_setpgid_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint32_t pgid);
+typedef void (*on_x64_sys_setpriority_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who, int32_t niceval);
+typedef void (*on_x64_sys_setpriority_return_t)(CPUState* cpu, target_ulong pc, int32_t which, int32_t who, int32_t niceval);
+typedef void (*on_x64_sys_setregid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t rgid, uint32_t egid);
+typedef void (*on_x64_sys_setregid_return_t)(CPUState* cpu, target_ulong pc, uint32_t rgid, uint32_t egid);
+typedef void (*on_x64_sys_setresgid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t rgid, uint32_t egid, uint32_t sgid);
+typedef void (*on_x64_sys_setresgid_return_t)(CPUState* cpu, target_ulong pc, uint32_t rgid, uint32_t egid, uint32_t sgid);
+typedef void (*on_x64_sys_setresuid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ruid, uint32_t euid, uint32_t suid);
+typedef void (*on_x64_sys_setresuid_return_t)(CPUState* cpu, target_ulong pc, uint32_t ruid, uint32_t euid, uint32_t suid);
+typedef void (*on_x64_sys_setreuid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t ruid, uint32_t euid);
+typedef void (*on_x64_sys_setreuid_return_t)(CPUState* cpu, target_ulong pc, uint32_t ruid, uint32_t euid);
+typedef void (*on_x64_sys_setrlimit_enter_t)(CPUState* cpu, target_ulong pc, uint32_t resource, uint64_t rlim);
+typedef void (*on_x64_sys_setrlimit_return_t)(CPUState* cpu, target_ulong pc, uint32_t resource, uint64_t rlim);
+typedef void (*on_x64_sys_setsid_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_setsid_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_setsockopt_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t level, int32_t optname, uint64_t optval, int32_t optlen);
+typedef void (*on_x64_sys_setsockopt_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, int32_t level, int32_t optname, uint64_t optval, int32_t optlen);
+typedef void (*on_x64_sys_settimeofday_enter_t)(CPUState* cpu, target_ulong pc, uint64_t tv, uint64_t tz);
+typedef void (*on_x64_sys_settimeofday_return_t)(CPUState* cpu, target_ulong pc, uint64_t tv, uint64_t tz);
+typedef void (*on_x64_sys_setuid_enter_t)(CPUState* cpu, target_ulong pc, uint32_t uid);
+typedef void (*on_x64_sys_setuid_return_t)(CPUState* cpu, target_ulong pc, uint32_t uid);
+typedef void (*on_x64_sys_setxattr_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_setxattr_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t name, uint64_t value, uint64_t size, int32_t flags);
+typedef void (*on_x64_sys_shmat_enter_t)(CPUState* cpu, target_ulong pc, int32_t shmid, uint64_t shmaddr, int32_t shmflg);
+typedef void (*on_x64_sys_shmat_return_t)(CPUState* cpu, target_ulong pc, int32_t shmid, uint64_t shmaddr, int32_t shmflg);
+typedef void (*on_x64_sys_shmctl_enter_t)(CPUState* cpu, target_ulong pc, int32_t shmid, int32_t cmd, uint64_t buf);
+typedef void (*on_x64_sys_shmctl_return_t)(CPUState* cpu, target_ulong pc, int32_t shmid, int32_t cmd, uint64_t buf);
+typedef void (*on_x64_sys_shmdt_enter_t)(CPUState* cpu, target_ulong pc, uint64_t shmaddr);
+typedef void (*on_x64_sys_shmdt_return_t)(CPUState* cpu, target_ulong pc, uint64_t shmaddr);
+typedef void (*on_x64_sys_shmget_enter_t)(CPUState* cpu, target_ulong pc, uint32_t key, uint64_t size, int32_t flag);
+typedef void (*on_x64_sys_shmget_return_t)(CPUState* cpu, target_ulong pc, uint32_t key, uint64_t size, int32_t flag);
+typedef void (*on_x64_sys_shutdown_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1);
+typedef void (*on_x64_sys_shutdown_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1);
+typedef void (*on_x64_sys_sigaltstack_enter_t)(CPUState* cpu, target_ulong pc, uint64_t uss, uint64_t uoss);
+typedef void (*on_x64_sys_sigaltstack_return_t)(CPUState* cpu, target_ulong pc, uint64_t uss, uint64_t uoss);
+typedef void (*on_x64_sys_signalfd_enter_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t user_mask, uint64_t sizemask);
+typedef void (*on_x64_sys_signalfd_return_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t user_mask, uint64_t sizemask);
+typedef void (*on_x64_sys_signalfd4_enter_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t user_mask, uint64_t sizemask, int32_t flags);
+typedef void (*on_x64_sys_signalfd4_return_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t user_mask, uint64_t sizemask, int32_t flags);
+typedef void (*on_x64_sys_socket_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_socket_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1, int32_t arg2);
+typedef void (*on_x64_sys_socketpair_enter_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1, int32_t arg2, uint64_t arg3);
+typedef void (*on_x64_sys_socketpair_return_t)(CPUState* cpu, target_ulong pc, int32_t arg0, int32_t arg1, int32_t arg2, uint64_t arg3);
+typedef void (*on_x64_sys_splice_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd_in, uint64_t off_in, int32_t fd_out, uint64_t off_out, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_splice_return_t)(CPUState* cpu, target_ulong pc, int32_t fd_in, uint64_t off_in, int32_t fd_out, uint64_t off_out, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_statfs_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t buf);
+typedef void (*on_x64_sys_statfs_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t buf);
+typedef void (*on_x64_sys_swapoff_enter_t)(CPUState* cpu, target_ulong pc, uint64_t specialfile);
+typedef void (*on_x64_sys_swapoff_return_t)(CPUState* cpu, target_ulong pc, uint64_t specialfile);
+typedef void (*on_x64_sys_swapon_enter_t)(CPUState* cpu, target_ulong pc, uint64_t specialfile, int32_t swap_flags);
+typedef void (*on_x64_sys_swapon_return_t)(CPUState* cpu, target_ulong pc, uint64_t specialfile, int32_t swap_flags);
+typedef void (*on_x64_sys_symlink_enter_t)(CPUState* cpu, target_ulong pc, uint64_t old, uint64_t _new);
+typedef void (*on_x64_sys_symlink_return_t)(CPUState* cpu, target_ulong pc, uint64_t old, uint64_t _new);
+typedef void (*on_x64_sys_symlinkat_enter_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, int32_t newdfd, uint64_t newname);
+typedef void (*on_x64_sys_symlinkat_return_t)(CPUState* cpu, target_ulong pc, uint64_t oldname, int32_t newdfd, uint64_t newname);
+typedef void (*on_x64_sys_sync_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_sync_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_sync_file_range_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t nbytes, uint32_t flags);
+typedef void (*on_x64_sys_sync_file_range_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t offset, uint64_t nbytes, uint32_t flags);
+typedef void (*on_x64_sys_syncfs_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd);
+typedef void (*on_x64_sys_syncfs_return_t)(CPUState* cpu, target_ulong pc, int32_t fd);
+typedef void (*on_x64_sys_sysctl_enter_t)(CPUState* cpu, target_ulong pc, uint64_t args);
+typedef void (*on_x64_sys_sysctl_return_t)(CPUState* cpu, target_ulong pc, uint64_t args);
+typedef void (*on_x64_sys_sysfs_enter_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_sysfs_return_t)(CPUState* cpu, target_ulong pc, int32_t option, uint64_t arg1, uint64_t arg2);
+typedef void (*on_x64_sys_sysinfo_enter_t)(CPUState* cpu, target_ulong pc, uint64_t info);
+typedef void (*on_x64_sys_sysinfo_return_t)(CPUState* cpu, target_ulong pc, uint64_t info);
+typedef void (*on_x64_sys_syslog_enter_t)(CPUState* cpu, target_ulong pc, int32_t type, uint64_t buf, int32_t len);
+typedef void (*on_x64_sys_syslog_return_t)(CPUState* cpu, target_ulong pc, int32_t type, uint64_t buf, int32_t len);
+typedef void (*on_x64_sys_tee_enter_t)(CPUState* cpu, target_ulong pc, int32_t fdin, int32_t fdout, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_tee_return_t)(CPUState* cpu, target_ulong pc, int32_t fdin, int32_t fdout, uint64_t len, uint32_t flags);
+typedef void (*on_x64_sys_tgkill_enter_t)(CPUState* cpu, target_ulong pc, int32_t tgid, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_tgkill_return_t)(CPUState* cpu, target_ulong pc, int32_t tgid, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_time_enter_t)(CPUState* cpu, target_ulong pc, uint64_t tloc);
+typedef void (*on_x64_sys_time_return_t)(CPUState* cpu, target_ulong pc, uint64_t tloc);
+typedef void (*on_x64_sys_timer_create_enter_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t timer_event_spec, uint64_t created_timer_id);
+typedef void (*on_x64_sys_timer_create_return_t)(CPUState* cpu, target_ulong pc, uint32_t which_clock, uint64_t timer_event_spec, uint64_t created_timer_id);
+typedef void (*on_x64_sys_timer_delete_enter_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id);
+typedef void (*on_x64_sys_timer_delete_return_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id);
+typedef void (*on_x64_sys_timer_getoverrun_enter_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id);
+typedef void (*on_x64_sys_timer_getoverrun_return_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id);
+typedef void (*on_x64_sys_timer_gettime_enter_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id, uint64_t setting);
+typedef void (*on_x64_sys_timer_gettime_return_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id, uint64_t setting);
+typedef void (*on_x64_sys_timer_settime_enter_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id, int32_t flags, uint64_t new_setting, uint64_t old_setting);
+typedef void (*on_x64_sys_timer_settime_return_t)(CPUState* cpu, target_ulong pc, uint32_t timer_id, int32_t flags, uint64_t new_setting, uint64_t old_setting);
+typedef void (*on_x64_sys_timerfd_create_enter_t)(CPUState* cpu, target_ulong pc, int32_t clockid, int32_t flags);
+typedef void (*on_x64_sys_timerfd_create_return_t)(CPUState* cpu, target_ulong pc, int32_t clockid, int32_t flags);
+typedef void (*on_x64_sys_timerfd_gettime_enter_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t otmr);
+typedef void (*on_x64_sys_timerfd_gettime_return_t)(CPUState* cpu, target_ulong pc, int32_t ufd, uint64_t otmr);
+typedef void (*on_x64_sys_timerfd_settime_enter_t)(CPUState* cpu, target_ulong pc, int32_t ufd, int32_t flags, uint64_t utmr, uint64_t otmr);
+typedef void (*on_x64_sys_timerfd_settime_return_t)(CPUState* cpu, target_ulong pc, int32_t ufd, int32_t flags, uint64_t utmr, uint64_t otmr);
+typedef void (*on_x64_sys_times_enter_t)(CPUState* cpu, target_ulong pc, uint64_t tbuf);
+typedef void (*on_x64_sys_times_return_t)(CPUState* cpu, target_ulong pc, uint64_t tbuf);
+typedef void (*on_x64_sys_tkill_enter_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_tkill_return_t)(CPUState* cpu, target_ulong pc, int32_t pid, int32_t sig);
+typedef void (*on_x64_sys_truncate_enter_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t length);
+typedef void (*on_x64_sys_truncate_return_t)(CPUState* cpu, target_ulong pc, uint64_t path, uint64_t length);
+typedef void (*on_x64_sys_umask_enter_t)(CPUState* cpu, target_ulong pc, int32_t mask);
+typedef void (*on_x64_sys_umask_return_t)(CPUState* cpu, target_ulong pc, int32_t mask);
+typedef void (*on_x64_sys_umount_enter_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t flags);
+typedef void (*on_x64_sys_umount_return_t)(CPUState* cpu, target_ulong pc, uint64_t name, int32_t flags);
+typedef void (*on_x64_sys_unlink_enter_t)(CPUState* cpu, target_ulong pc, uint64_t pathname);
+typedef void (*on_x64_sys_unlink_return_t)(CPUState* cpu, target_ulong pc, uint64_t pathname);
+typedef void (*on_x64_sys_unlinkat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t pathname, int32_t flag);
+typedef void (*on_x64_sys_unlinkat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t pathname, int32_t flag);
+typedef void (*on_x64_sys_unshare_enter_t)(CPUState* cpu, target_ulong pc, uint64_t unshare_flags);
+typedef void (*on_x64_sys_unshare_return_t)(CPUState* cpu, target_ulong pc, uint64_t unshare_flags);
+typedef void (*on_x64_sys_uselib_enter_t)(CPUState* cpu, target_ulong pc, uint64_t library);
+typedef void (*on_x64_sys_uselib_return_t)(CPUState* cpu, target_ulong pc, uint64_t library);
+typedef void (*on_x64_sys_userfaultfd_enter_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_userfaultfd_return_t)(CPUState* cpu, target_ulong pc, int32_t flags);
+typedef void (*on_x64_sys_ustat_enter_t)(CPUState* cpu, target_ulong pc, uint32_t dev, uint64_t ubuf);
+typedef void (*on_x64_sys_ustat_return_t)(CPUState* cpu, target_ulong pc, uint32_t dev, uint64_t ubuf);
+typedef void (*on_x64_sys_utime_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t times);
+typedef void (*on_x64_sys_utime_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t times);
+typedef void (*on_x64_sys_utimensat_enter_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t utimes, int32_t flags);
+typedef void (*on_x64_sys_utimensat_return_t)(CPUState* cpu, target_ulong pc, int32_t dfd, uint64_t filename, uint64_t utimes, int32_t flags);
+typedef void (*on_x64_sys_utimes_enter_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t utimes);
+typedef void (*on_x64_sys_utimes_return_t)(CPUState* cpu, target_ulong pc, uint64_t filename, uint64_t utimes);
+typedef void (*on_x64_sys_vfork_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_vfork_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_vhangup_enter_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_vhangup_return_t)(CPUState* cpu, target_ulong pc);
+typedef void (*on_x64_sys_vmsplice_enter_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t iov, uint64_t nr_segs, uint32_t flags);
+typedef void (*on_x64_sys_vmsplice_return_t)(CPUState* cpu, target_ulong pc, int32_t fd, uint64_t iov, uint64_t nr_segs, uint32_t flags);
+typedef void (*on_x64_sys_wait4_enter_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t stat_addr, int32_t options, uint64_t ru);
+typedef void (*on_x64_sys_wait4_return_t)(CPUState* cpu, target_ulong pc, uint32_t pid, uint64_t stat_addr, int32_t options, uint64_t ru);
+typedef void (*on_x64_sys_waitid_enter_t)(CPUState* cpu, target_ulong pc, int32_t which, uint32_t pid, uint64_t infop, int32_t options, uint64_t ru);
+typedef void (*on_x64_sys_waitid_return_t)(CPUState* cpu, target_ulong pc, int32_t which, uint32_t pid, uint64_t infop, int32_t options, uint64_t ru);
+typedef void (*on_x64_sys_write_enter_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count);
+typedef void (*on_x64_sys_write_return_t)(CPUState* cpu, target_ulong pc, uint32_t fd, uint64_t buf, uint64_t count);
+typedef void (*on_x64_sys_writev_enter_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen);
+typedef void (*on_x64_sys_writev_return_t)(CPUState* cpu, target_ulong pc, uint64_t fd, uint64_t vec, uint64_t vlen);
+#endif
+#if defined(TARGET_I386)
 typedef void (*on_get_thread_area_enter_t)(CPUState* cpu, target_ulong pc, uint32_t u_info);
 typedef void (*on_get_thread_area_return_t)(CPUState* cpu, target_ulong pc, uint32_t u_info);
 typedef void (*on_NtAcceptConnectPort_enter_t)(CPUState* cpu, target_ulong pc, uint32_t PortHandle, uint32_t PortContext, uint32_t ConnectionRequest, uint32_t AcceptConnection, uint32_t ServerView, uint32_t ClientView);
@@ -0,0 +1,144 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __RETURN_POINTS_H
+#define __RETURN_POINTS_H
+
+// Pending system call returns, keyed by (return address, asid).
+//
+// Every basic block has to be checked against this set, and nearly all of
+// them miss, so a counting filter over the return address alone answers most
+// checks with one load. Only blocks whose pc hits the filter do the full
+// lookup in an open addressing table. The return points themselves are kept
+// in a dense array, and the table only holds (key, index) slots.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "syscalls_common.h"
+
+class return_point_table {
+public:
+    return_point_table() : filter(1 << FILTER_BITS, 0), mask(0) {}
+
+    // Cheap test on the pc alone. False means there is no return point at pc
+    // in any address space.
+    bool maybe_at(target_ulong pc) const {
+        return filter[filter_index(pc)] != 0;
+    }
+
+    // Returns the return point for (pc, asid), or NULL if there is none.
+    ReturnPoint *find(target_ulong pc, target_ulong asid) {
+        if (!maybe_at(pc) || table.empty()) return NULL;
+        uint32_t idx = table[lookup(pc, asid)].idx;
+        return idx ? &points[idx - 1] : NULL;
+    }
+
+    // Adds rp, replacing any return point with the same key.
+    void insert(const ReturnPoint &rp) {
+        if ((points.size() + 1) * 2 > table.size()) grow();
+        slot &s = table[lookup(rp.retaddr, rp.proc_id)];
+        if (s.idx) {
+            points[s.idx - 1] = rp;
+            return;
+        }
+        points.push_back(rp);
+        s.retaddr = rp.retaddr;
+        s.asid = rp.proc_id;
+        s.idx = points.size();
+        filter[filter_index(rp.retaddr)]++;
+    }
+
+    void erase(target_ulong pc, target_ulong asid) {
+        if (table.empty()) return;
+        size_t i = lookup(pc, asid);
+        uint32_t idx = table[i].idx;
+        if (!idx) return;
+        filter[filter_index(pc)]--;
+        remove_slot(i);
+
+        // move the last return point into the hole
+        if (idx != points.size()) {
+            points[idx - 1] = points.back();
+            table[lookup(points[idx - 1].retaddr, points[idx - 1].proc_id)].idx = idx;
+        }
+        points.pop_back();
+    }
+
+    size_t size() const { return points.size(); }
+
+private:
+    static const int FILTER_BITS = 12;
+
+    struct slot {
+        target_ulong retaddr;
+        target_ulong asid;
+        uint32_t idx;   // index + 1 into points, 0 for an empty slot
+    };
+
+    std::vector<uint32_t> filter;
+    std::vector<slot> table;
+    std::vector<ReturnPoint> points;
+    size_t mask;
+
+    static size_t filter_index(target_ulong pc) {
+        uint64_t h = (uint64_t) pc * 0x9e3779b97f4a7c15ULL;
+        return h >> (64 - FILTER_BITS);
+    }
+
+    static uint64_t hash(target_ulong pc, target_ulong asid) {
+        uint64_t h = (uint64_t) pc * 0x9e3779b97f4a7c15ULL;
+        h ^= (uint64_t) asid + 0x7f4a7c159e3779b9ULL + (h << 6) + (h >> 2);
+        // finalizer from murmur3, so the low bits depend on all of the key
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Returns the index of the slot holding (pc, asid), or of the empty slot
+    // where it belongs.
+    size_t lookup(target_ulong pc, target_ulong asid) const {
+        size_t i = hash(pc, asid) & mask;
+        while (table[i].idx != 0 &&
+               !(table[i].retaddr == pc && table[i].asid == asid)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    // Empties slot i, shifting later slots of the probe sequence back so no
+    // tombstones are needed.
+    void remove_slot(size_t i) {
+        size_t j = i;
+        while (true) {
+            table[i].idx = 0;
+            size_t home;
+            do {
+                j = (j + 1) & mask;
+                if (table[j].idx == 0) return;
+                home = hash(table[j].retaddr, table[j].asid) & mask;
+                // slot j can move to i only if its home isn't in (i, j]
+            } while (i <= j ? (i < home && home <= j) : (i < home || home <= j));
+            table[i] = table[j];
+            i = j;
+        }
+    }
+
+    void grow() {
+        size_t n = table.empty() ? 64 : table.size() * 2;
+        table.assign(n, slot());
+        mask = n - 1;
+        for (uint32_t j = 0; j < points.size(); j++) {
+            slot &s = table[lookup(points[j].retaddr, points[j].proc_id)];
+            s.retaddr = points[j].retaddr;
+            s.asid = points[j].proc_id;
+            s.idx = j + 1;
+        }
+    }
+};
+
+#endif
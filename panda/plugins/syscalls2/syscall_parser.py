@@ -42,13 +42,22 @@ KNOWN_ARCH = {
         'bits': 32,
         'rt_callno_reg': 'env->regs[R_EAX]',    # register holding syscall number at runtime
         'rt_sp_reg': 'env->regs[R_ESP]',        # register holding stack pointer at runtime
-        'qemu_target': 'TARGET_I386',           # qemu target name for this arch - used in guards
+        'qemu_target': 'defined(TARGET_I386)',  # qemu target condition for this arch - used in guards
+        'cb_prefix': '',                        # prefix of the PPP callback names for this arch
+    },
+    'x64': {
+        'bits': 64,
+        'rt_callno_reg': 'env->regs[R_EAX]',    # register holding syscall number at runtime
+        'rt_sp_reg': 'env->regs[R_ESP]',        # register holding stack pointer at runtime
+        'qemu_target': 'defined(TARGET_X86_64)',  # qemu target condition for this arch - used in guards
+        'cb_prefix': 'x64_',                    # x86 callbacks are also built for x86_64, so these need their own names
     },
     'arm': {
         'bits': 32,
         'rt_callno_reg': 'env->regs[7]',        # register holding syscall number at runtime
         'rt_sp_reg': 'env->regs[13]',           # register holding stack pointer at runtime
-        'qemu_target': 'TARGET_ARM',            # qemu target name for this arch - used in guards
+        'qemu_target': 'defined(TARGET_ARM)',   # qemu target condition for this arch - used in guards
+        'cb_prefix': '',                        # prefix of the PPP callback names for this arch
     },
 }
 
@@ -103,7 +112,11 @@ class Argument(object):
         's32': ['int', 'long', '__s32', 'LONG'],
         'u16': ['old_uid_t', 'uid_t', 'mode_t', 'gid_t', 'pid_t', 'USHORT'],
         'ptr': ['cap_user_data_t', 'cap_user_header_t', '__sighandler_t', '...'],
+        # as wide as a register on 64-bit targets (LP64 for linux, LLP64 for windows)
+        'word': ['long', 'size_t', 'ssize_t', 'off_t', 'SIZE_T', 'ULONG_PTR', 'LONG_PTR', 'KAFFINITY'],
+        'ptr64': ['HANDLE', 'ALPC_HANDLE'],
     }
+    winptrre = re.compile("^L?P[A-Z0-9_]+$")
 
     def __init__(self, arg, argno=-1, arch_bits=32):
         self.no = argno
@@ -132,6 +145,10 @@ class Argument(object):
             self.type = 'CHAR_STAR'
         elif any(['*' in self.raw, '[]' in self.raw, any([x in self.raw for x in Argument.types['ptr']])]):
             self.type = 'POINTER'
+        elif self.arch_bits == 64 and any([x in Argument.types['ptr64'] or Argument.winptrre.match(x) for x in self.typewords]):
+            self.type = 'POINTER'
+        elif self.arch_bits == 64 and any([x in Argument.types['word'] for x in self.typewords]):
+            self.type = '8BYTE'
         elif any([x in self.raw for x in Argument.types['u64']]):
             self.type = '8BYTE'
         elif any([x in self.raw for x in Argument.types['u32']]) or any([x in self.raw for x in Argument.types['u16']]):
@@ -148,6 +165,15 @@ class Argument(object):
             logging.debug("%s not of known type, assuming 32-bit", self.raw)
             self.type = '4BYTE'
 
+    @property
+    def typewords(self):
+        ''' Returns the words naming the type of the argument.
+        '''
+        words = self.raw.replace('*', ' ').split()
+        if self.name != 'arg{0}'.format(self.no) and len(words) > 1:
+            words = words[:-1]
+        return words
+
     @property
     def ctype(self):
         if self.type in ['CHAR_STAR', 'POINTER'] and self.arch_bits == 32:
@@ -213,7 +239,7 @@ class SysCall(object):
     # Fields: <no> <return-type> <name><signature with spaces>
     linere = re.compile("(\d+) (.+) (\w+) ?\((.*)\);")
 
-    def __init__(self, line, arch_bits=32):
+    def __init__(self, line, arch_bits=32, cb_prefix=''):
         fields = SysCall.linere.match(line)
         if fields is None:
             raise SysCallDefError()
@@ -222,6 +248,7 @@ class SysCall(object):
         self.generic = False if self.no > MAX_GENERIC_SYSCALL else True
         self.rettype = fields.group(2)
         self.name = fields.group(3)
+        self.cbname = cb_prefix + self.name     # used in the PPP callback names
         self.args_raw = fields.group(4).split(',')
         self.arch_bits = arch_bits
 
@@ -312,7 +339,7 @@ if __name__ == '__main__':
         with open(protofile_name) as protofile:
             for lineno, line in enumerate(protofile, 1):
                 try:
-                    syscall = SysCall(line, arch_bits=KNOWN_ARCH[_arch]['bits'])
+                    syscall = SysCall(line, arch_bits=KNOWN_ARCH[_arch]['bits'], cb_prefix=KNOWN_ARCH[_arch]['cb_prefix'])
                     syscalls.append(syscall)
                     syscalls_arch[syscall.name] = syscall
                 except SysCallDefError:
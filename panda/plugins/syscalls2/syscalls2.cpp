@@ -31,6 +31,7 @@ PANDAENDCOMMENT */
 #include "syscalls2.h"
 #include "syscalls_common.h"
 #include "syscalls2_info.h"
+#include "return_points.h"
 
 bool translate_callback(CPUState *cpu, target_ulong pc);
 int exec_callback(CPUState *cpu, target_ulong pc);
@@ -40,6 +41,7 @@ bool init_plugin(void *);
 void uninit_plugin(void *);
 
 void registerExecPreCallback(void (*callback)(CPUState*, target_ulong));
+void syscalls2_subscribers_changed(void);
 
 // PPP code
 #include "gen_syscalls_ext_typedefs.h"
@@ -67,6 +69,13 @@ uint32_t get_32_windows_x86 (CPUState *cpu, uint32_t argnum);
 target_ulong calc_retaddr_windows_x86(CPUState* cpu, target_ulong pc);
 target_ulong calc_retaddr_linux_x86(CPUState* cpu, target_ulong pc);
 target_ulong calc_retaddr_linux_arm(CPUState* cpu, target_ulong pc);
+uint32_t get_32_linux_x64(CPUState *cpu, uint32_t argnum);
+uint64_t get_64_linux_x64(CPUState *cpu, uint32_t argnum);
+uint32_t get_32_windows_x64(CPUState *cpu, uint32_t argnum);
+uint64_t get_64_windows_x64(CPUState *cpu, uint32_t argnum);
+uint32_t get_return_32_windows_x64(CPUState *cpu, uint32_t argnum);
+uint64_t get_return_64_windows_x64(CPUState *cpu, uint32_t argnum);
+target_ulong calc_retaddr_x64(CPUState* cpu, target_ulong pc);
 
 enum ProfileType {
     PROFILE_LINUX_X86,
@@ -75,12 +84,16 @@ enum ProfileType {
     PROFILE_WINDOWS_XPSP2_X86,
     PROFILE_WINDOWS_XPSP3_X86,
     PROFILE_WINDOWS_7_X86,
+    PROFILE_LINUX_X64,
+    PROFILE_WINDOWS_7_X64,
     PROFILE_LAST
 };
 
 struct Profile {
     void         (*enter_switch)(CPUState *, target_ulong);
     void         (*return_switch)(CPUState *, target_ulong, target_ulong, ReturnPoint &);
+    target_ulong (*get_callno)(CPUState *);
+    void         (*get_subscribers)(std::vector<uint64_t> &);
     target_long  (*get_return_val )(CPUState *);
     target_ulong (*calc_retaddr )(CPUState *, target_ulong);
     uint32_t     (*get_32 )(CPUState *, uint32_t);
@@ -100,6 +113,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_linux_x86,
         .return_switch = syscall_return_switch_linux_x86,
+        .get_callno = syscall_callno_linux_x86,
+        .get_subscribers = syscall_subscribers_linux_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_linux_x86,
         .get_32 = get_32_linux_x86,
@@ -117,6 +132,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_linux_arm,
         .return_switch = syscall_return_switch_linux_arm,
+        .get_callno = syscall_callno_linux_arm,
+        .get_subscribers = syscall_subscribers_linux_arm,
         .get_return_val = get_return_val_arm,
         .calc_retaddr = calc_retaddr_linux_arm,
         .get_32 = get_32_linux_arm,
@@ -134,6 +151,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_2000_x86,
         .return_switch = syscall_return_switch_windows_2000_x86,
+        .get_callno = syscall_callno_windows_2000_x86,
+        .get_subscribers = syscall_subscribers_windows_2000_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -155,6 +174,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_xpsp2_x86,
         .return_switch = syscall_return_switch_windows_xpsp2_x86,
+        .get_callno = syscall_callno_windows_xpsp2_x86,
+        .get_subscribers = syscall_subscribers_windows_xpsp2_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -176,6 +197,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_xpsp3_x86,
         .return_switch = syscall_return_switch_windows_xpsp3_x86,
+        .get_callno = syscall_callno_windows_xpsp3_x86,
+        .get_subscribers = syscall_subscribers_windows_xpsp3_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -197,6 +220,8 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_7_x86,
         .return_switch = syscall_return_switch_windows_7_x86,
+        .get_callno = syscall_callno_windows_7_x86,
+        .get_subscribers = syscall_subscribers_windows_7_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -214,6 +239,44 @@ Profile profiles[PROFILE_LAST] = {
 #endif
         .windows_arg_offset = 8,
         .syscall_interrupt_number = 0x80,
+    },
+    {
+        .enter_switch = syscall_enter_switch_linux_x64,
+        .return_switch = syscall_return_switch_linux_x64,
+        .get_callno = syscall_callno_linux_x64,
+        .get_subscribers = syscall_subscribers_linux_x64,
+        .get_return_val = get_return_val_x86,
+        .calc_retaddr = calc_retaddr_x64,
+        .get_32 = get_32_linux_x64,
+        .get_s32 = get_s32_generic,
+        .get_64 = get_64_linux_x64,
+        .get_s64 = get_s64_generic,
+        .get_return_32 = get_32_linux_x64,
+        .get_return_s32 = get_return_s32_generic,
+        .get_return_64 = get_64_linux_x64,
+        .get_return_s64 = get_return_s64_generic,
+        .windows_return_addr_register = -1,
+        .windows_arg_offset = -1,
+        .syscall_interrupt_number = -1,
+    },
+    {
+        .enter_switch = syscall_enter_switch_windows_7_x64,
+        .return_switch = syscall_return_switch_windows_7_x64,
+        .get_callno = syscall_callno_windows_7_x64,
+        .get_subscribers = syscall_subscribers_windows_7_x64,
+        .get_return_val = get_return_val_x86,
+        .calc_retaddr = calc_retaddr_x64,
+        .get_32 = get_32_windows_x64,
+        .get_s32 = get_s32_generic,
+        .get_64 = get_64_windows_x64,
+        .get_s64 = get_s64_generic,
+        .get_return_32 = get_return_32_windows_x64,
+        .get_return_s32 = get_return_s32_generic,
+        .get_return_64 = get_return_64_windows_x64,
+        .get_return_s64 = get_return_s64_generic,
+        .windows_return_addr_register = -1,
+        .windows_arg_offset = -1,
+        .syscall_interrupt_number = -1,
     }
 };
 
@@ -300,6 +363,16 @@ target_ulong calc_retaddr_linux_arm(CPUState* cpu, target_ulong pc) {
 #endif
 }
 
+target_ulong calc_retaddr_x64(CPUState* cpu, target_ulong pc) {
+#if defined(TARGET_X86_64)
+    // sysret returns to the instruction after syscall (0F 05)
+    return pc + 2;
+#else
+    // shouldn't happen
+    assert (1==0);
+#endif
+}
+
 // Argument getting (at syscall entry)
 uint32_t get_linux_x86_argnum(CPUState *cpu, uint32_t argnum) {
 #if defined(TARGET_I386)
@@ -380,6 +453,63 @@ uint64_t get_64_windows_x86(CPUState *cpu, uint32_t argnum) {
     return 0;
 }
 
+// x86_64 syscall ABI: the first arguments are passed in registers
+uint64_t get_64_linux_x64(CPUState *cpu, uint32_t argnum) {
+#if defined(TARGET_X86_64)
+    CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    static const int regs[] = { R_EDI, R_ESI, R_EDX, 10, 8, 9 };
+    assert (argnum < 6);
+    return env->regs[regs[argnum]];
+#else
+    return 0;
+#endif
+}
+
+uint32_t get_32_linux_x64(CPUState *cpu, uint32_t argnum) {
+    return (uint32_t) get_64_linux_x64(cpu, argnum);
+}
+
+// The return point whose return callbacks are running, NULL otherwise
+static const ReturnPoint *returning_rp = NULL;
+
+// Windows x64 passes the first four arguments in r10 (rcx before the
+// syscall stub), rdx, r8 and r9, and the rest on the stack above the
+// return address and the 0x20 byte home space.
+static uint64_t get_win64_syscall_arg(CPUState *cpu, uint32_t nr, size_t size, bool at_return) {
+#if defined(TARGET_X86_64)
+    CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    static const int regs[] = { 10, R_EDX, 8, 9 };
+    uint64_t arg = 0;
+    if (nr < 4 && !at_return) {
+        return env->regs[regs[nr]];
+    }
+    if (nr < 4) {
+        // these are volatile, the kernel doesn't preserve them, so use
+        // the copy made at entry
+        if (returning_rp == NULL) {
+            std::cerr << PANDA_MSG "argument " << nr << " can only be read "
+                "in a return callback on windows x64" << std::endl;
+            return 0;
+        }
+        memcpy(&arg, returning_rp->params[nr], size);
+        return arg;
+    }
+    panda_virtual_memory_rw(cpu, env->regs[R_ESP] + 0x28 + 8 * (nr - 4),
+                            (uint8_t *) &arg, size, false);
+    return arg;
+#else
+    return 0;
+#endif
+}
+
+uint64_t get_64_windows_x64(CPUState *cpu, uint32_t argnum) {
+    return get_win64_syscall_arg(cpu, argnum, 8, false);
+}
+
+uint32_t get_32_windows_x64(CPUState *cpu, uint32_t argnum) {
+    return (uint32_t) get_win64_syscall_arg(cpu, argnum, 4, false);
+}
+
 // Argument getting (at syscall return)
 static uint32_t get_win_syscall_return_arg(CPUState* cpu, int nr) {
 #if defined(TARGET_I386)
@@ -402,6 +532,14 @@ uint64_t get_return_64_windows_x86(CPUState *cpu, uint32_t argnum) {
     assert (false && "64-bit arguments not supported on Windows 7 x86");
 }
 
+uint32_t get_return_32_windows_x64(CPUState *cpu, uint32_t argnum) {
+    return (uint32_t) get_win64_syscall_arg(cpu, argnum, 4, true);
+}
+
+uint64_t get_return_64_windows_x64(CPUState *cpu, uint32_t argnum) {
+    return get_win64_syscall_arg(cpu, argnum, 8, true);
+}
+
 // Wrappers
 target_long  get_return_val (CPUState *cpu) {
     return syscalls_profile->get_return_val(cpu);
@@ -452,15 +590,35 @@ int64_t get_return_s64_generic(CPUState *cpu, uint32_t argnum) {
 
 static std::vector<void (*)(CPUState*, target_ulong)> preExecCallbacks;
 
+// Bit n is set when syscall number n has enter or return callbacks. When
+// nothing asks for every syscall, exec_callback skips the others before even
+// reading the instruction.
+static std::vector<uint64_t> subscribers;
+static bool dispatch_all = true;
+
+void syscalls2_subscribers_changed(void) {
+    if (!syscalls_profile) return;
+    syscalls_profile->get_subscribers(subscribers);
+    dispatch_all = PPP_CHECK_CB(on_all_sys_enter) || PPP_CHECK_CB(on_all_sys_return) ||
+        PPP_CHECK_CB(on_unknown_sys_enter) || PPP_CHECK_CB(on_unknown_sys_return) ||
+        !preExecCallbacks.empty();
+}
+
+static inline bool is_subscribed(target_ulong callno) {
+    return dispatch_all || (callno / 64 < subscribers.size() &&
+                            (subscribers[callno / 64] >> (callno % 64)) & 1);
+}
+
 void registerExecPreCallback(void (*callback)(CPUState*, target_ulong)){
     preExecCallbacks.push_back(callback);
+    syscalls2_subscribers_changed();
 }
 
 // always return to same process
-static std::map < std::pair < target_ulong, target_ulong >, ReturnPoint > returns;
+static return_point_table returns;
 
 void appendReturnPoint(ReturnPoint &rp){
-    returns[std::make_pair(rp.retaddr,rp.proc_id)] = rp;
+    returns.insert(rp);
 }
 
 
@@ -469,14 +627,16 @@ void appendReturnPoint(ReturnPoint &rp){
 static int returned_check_callback(CPUState *cpu, TranslationBlock* tb){
     // check if any of the internally tracked syscalls has returned
     // only one should be at its return point for any given basic block
-    std::pair < target_ulong, target_ulong > ret_key = std::make_pair(tb->pc, panda_current_asid(cpu));
-    if (returns.count(ret_key) != 0) {
-        ReturnPoint &retVal = returns[ret_key];
+    if (!returns.maybe_at(tb->pc)) return false;
+    target_ulong asid = panda_current_asid(cpu);
+    ReturnPoint *rp = returns.find(tb->pc, asid);
+    if (rp) {
+        // return callbacks may start new syscalls, so work on a copy
+        ReturnPoint retVal = *rp;
+        returns.erase(tb->pc, asid);
+        returning_rp = &retVal;
         syscalls_profile->return_switch(cpu, tb->pc, retVal.ordinal, retVal);
-        // used by remove_if to delete from returns list those values
-        // that have been processed
-        //        retVal.retaddr = retVal.proc_id = 0;
-        returns.erase(ret_key);
+        returning_rp = NULL;
     }
 
     return false;
@@ -499,6 +659,15 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
         return -1;
     }
 
+#if defined(TARGET_X86_64)
+    // The 64-bit profiles only decode the syscall instruction in 64-bit
+    // code. 32-bit processes use the compat syscall tables.
+    if (panda_os_bits == 64) {
+        CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+        return (env->hflags & HF_CS64_MASK) && buf[0] == 0x0F && buf[1] == 0x05;
+    }
+#endif
+
     // Check if the instruction is syscall (0F 05)
     if (buf[0]== 0x0F && buf[1] == 0x05) {
         return true;
@@ -547,6 +716,7 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 // This will only be called for instructions where the
 // translate_callback returned true
 int exec_callback(CPUState *cpu, target_ulong pc) {
+    if (!is_subscribed(syscalls_profile->get_callno(cpu))) return 0;
     int res = isCurrentInstructionASyscall(cpu,pc);
 #ifdef DEBUG
     if(res < 0){
@@ -579,42 +749,66 @@ bool init_plugin(void *self) {
         return false;
     }
     else if (panda_os_familyno == OS_LINUX) {
-        if (panda_os_bits != 32) {
-            std::cerr << PANDA_MSG "no support for 64-bit linux" << std::endl;
+        if (panda_os_bits == 64) {
+#if defined(TARGET_X86_64)
+            std::cerr << PANDA_MSG "using profile for linux x86 64-bit" << std::endl;
+            syscalls_profile = &profiles[PROFILE_LINUX_X64];
+#else
+            std::cerr << PANDA_MSG "no support for 64-bit linux on this target" << std::endl;
             return false;
+#endif
         }
+        else if (panda_os_bits != 32) {
+            std::cerr << PANDA_MSG "no support for " << panda_os_bits << "-bit linux" << std::endl;
+            return false;
+        }
+        else {
 #if defined(TARGET_I386)
-        std::cerr << PANDA_MSG "using profile for linux x86 32-bit" << std::endl;
-        syscalls_profile = &profiles[PROFILE_LINUX_X86];
+            std::cerr << PANDA_MSG "using profile for linux x86 32-bit" << std::endl;
+            syscalls_profile = &profiles[PROFILE_LINUX_X86];
 #endif
 #if defined(TARGET_ARM)
-        std::cerr << PANDA_MSG "using profile for linux arm" << std::endl;
-        syscalls_profile = &profiles[PROFILE_LINUX_ARM];
+            std::cerr << PANDA_MSG "using profile for linux arm" << std::endl;
+            syscalls_profile = &profiles[PROFILE_LINUX_ARM];
 #endif
+        }
     }
     else if (panda_os_familyno == OS_WINDOWS) {
-        if (panda_os_bits != 32) {
-            std::cerr << PANDA_MSG "no support for 64-bit windows" << std::endl;
+        if (panda_os_bits == 64) {
+#if defined(TARGET_X86_64)
+            if (0 == strcmp(panda_os_variant, "7")) {
+                std::cerr << PANDA_MSG "using profile for windows 7 x86 64-bit" << std::endl;
+                syscalls_profile = &profiles[PROFILE_WINDOWS_7_X64];
+            }
+#else
+            std::cerr << PANDA_MSG "no support for 64-bit windows on this target" << std::endl;
             return false;
+#endif
         }
-#if defined(TARGET_I386)
-        if (0 == strcmp(panda_os_variant, "xpsp2")) {
-            std::cerr << PANDA_MSG "using profile for windows sp2 x86 32-bit" << std::endl;
-            syscalls_profile = &profiles[PROFILE_WINDOWS_XPSP2_X86];
-        }
-        if (0 == strcmp(panda_os_variant, "xpsp3")) {
-            std::cerr << PANDA_MSG "using profile for windows sp3 x86 32-bit" << std::endl;
-            syscalls_profile = &profiles[PROFILE_WINDOWS_XPSP3_X86];
-        }
-        if (0 == strcmp(panda_os_variant, "7")) {
-            std::cerr << PANDA_MSG "using profile for windows 7 x86 32-bit" << std::endl;
-            syscalls_profile = &profiles[PROFILE_WINDOWS_7_X86];
-        }
-        if (0 == strcmp(panda_os_variant, "2000")) {
-            std::cerr << PANDA_MSG "using profile for windows 2000 x86 32-bit" << std::endl;
-            syscalls_profile = &profiles[PROFILE_WINDOWS_2000_X86];
+        else if (panda_os_bits != 32) {
+            std::cerr << PANDA_MSG "no support for " << panda_os_bits << "-bit windows" << std::endl;
+            return false;
         }
+        else {
+#if defined(TARGET_I386)
+            if (0 == strcmp(panda_os_variant, "xpsp2")) {
+                std::cerr << PANDA_MSG "using profile for windows sp2 x86 32-bit" << std::endl;
+                syscalls_profile = &profiles[PROFILE_WINDOWS_XPSP2_X86];
+            }
+            if (0 == strcmp(panda_os_variant, "xpsp3")) {
+                std::cerr << PANDA_MSG "using profile for windows sp3 x86 32-bit" << std::endl;
+                syscalls_profile = &profiles[PROFILE_WINDOWS_XPSP3_X86];
+            }
+            if (0 == strcmp(panda_os_variant, "7")) {
+                std::cerr << PANDA_MSG "using profile for windows 7 x86 32-bit" << std::endl;
+                syscalls_profile = &profiles[PROFILE_WINDOWS_7_X86];
+            }
+            if (0 == strcmp(panda_os_variant, "2000")) {
+                std::cerr << PANDA_MSG "using profile for windows 2000 x86 32-bit" << std::endl;
+                syscalls_profile = &profiles[PROFILE_WINDOWS_2000_X86];
+            }
 #endif
+        }
     }
 
     // make sure a system calls profile has been loaded
@@ -641,6 +835,9 @@ bool init_plugin(void *self) {
 
     // done parsing arguments
     panda_free_args(plugin_args);
+
+    // plugins loaded before us may have registered callbacks already
+    syscalls2_subscribers_changed();
 #else //not x86 or arm
     fprintf(stderr,"The syscalls plugin is not currently supported on this platform.\n");
     return false;
@@ -3,12 +3,16 @@
 typedef struct CPUState CPUState;
 typedef struct ReturnPoint ReturnPoint;
 
+#include <vector>
+
 void syscall_return_switch_linux_arm ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 void syscall_return_switch_linux_x86 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 void syscall_return_switch_windows_xpsp2_x86 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 void syscall_return_switch_windows_xpsp3_x86 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 void syscall_return_switch_windows_7_x86 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 void syscall_return_switch_windows_2000_x86 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
+void syscall_return_switch_linux_x64 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
+void syscall_return_switch_windows_7_x64 ( CPUState *env, target_ulong pc, target_ulong ordinal, ReturnPoint &rp);
 
 void syscall_enter_switch_linux_arm ( CPUState *env, target_ulong pc );
 void syscall_enter_switch_linux_x86 ( CPUState *env, target_ulong pc );
@@ -16,6 +20,33 @@ void syscall_enter_switch_windows_xpsp2_x86 ( CPUState *env, target_ulong pc ) ;
 void syscall_enter_switch_windows_xpsp3_x86 ( CPUState *env, target_ulong pc ) ;
 void syscall_enter_switch_windows_7_x86 ( CPUState *env, target_ulong pc ) ;
 void syscall_enter_switch_windows_2000_x86 ( CPUState *env, target_ulong pc ) ;
+void syscall_enter_switch_linux_x64 ( CPUState *env, target_ulong pc );
+void syscall_enter_switch_windows_7_x64 ( CPUState *env, target_ulong pc );
+
+target_ulong syscall_callno_linux_arm ( CPUState *env );
+target_ulong syscall_callno_linux_x86 ( CPUState *env );
+target_ulong syscall_callno_windows_xpsp2_x86 ( CPUState *env );
+target_ulong syscall_callno_windows_xpsp3_x86 ( CPUState *env );
+target_ulong syscall_callno_windows_7_x86 ( CPUState *env );
+target_ulong syscall_callno_windows_2000_x86 ( CPUState *env );
+target_ulong syscall_callno_linux_x64 ( CPUState *env );
+target_ulong syscall_callno_windows_7_x64 ( CPUState *env );
+
+void syscall_subscribers_linux_arm ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_linux_x86 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_windows_xpsp2_x86 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_windows_xpsp3_x86 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_windows_7_x86 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_windows_2000_x86 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_linux_x64 ( std::vector<uint64_t> &bitmap );
+void syscall_subscribers_windows_7_x64 ( std::vector<uint64_t> &bitmap );
+
+// Sets bit callno in a subscriber bitmap, growing it as needed, so it only
+// spans up to the highest subscribed syscall number.
+static inline void syscall_subscribe(std::vector<uint64_t> &bitmap, uint64_t callno) {
+    if (callno / 64 >= bitmap.size()) bitmap.resize(callno / 64 + 1, 0);
+    bitmap[callno / 64] |= 1ULL << (callno % 64);
+}
 
 void appendReturnPoint(ReturnPoint& rp);
 #endif
@@ -12,7 +12,8 @@ syscall_info_t *syscall_info;
 int load_syscall_info(void) {
     gchar *syscall_info_dlname = NULL;
 #if defined(TARGET_I386)
-    const gchar *arch = "x86";
+    // 32-bit guests can also be replayed on x86_64
+    const gchar *arch = (panda_os_bits == 64) ? "x64" : "x86";
 #elif defined(TARGET_ARM)
     const gchar *arch = "arm";
 #else
@@ -29,9 +30,7 @@ int load_syscall_info(void) {
         syscall_info_dlname = g_strdup_printf("dso_%s_gen_syscall_info_%s_%s" HOST_DSOSUF, PLUGIN_NAME, panda_os_family, arch);
     }
 
-    // panda_os_bits will be useful when support for 64bit operating systems is added
-    // for now, just use it in this assertion to make the compiler happy
-    assert(panda_os_bits == 32);
+    assert(panda_os_bits == 32 || panda_os_bits == 64);
 
     dlerror();  // clear errors
     void *syscall_info_dl = dlopen(syscall_info_dlname, RTLD_NOW|RTLD_NODELETE);
@@ -1,11 +1,11 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
-#ifdef {{architectures[arch].qemu_target}}
+#if {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-PPP_CB_BOILERPLATE(on_{{syscall.name}}_enter)
+PPP_CB_BOILERPLATE_NOTIFY(on_{{syscall.cbname}}_enter, syscalls2_subscribers_changed)
 {%- endfor %}
 #endif
 {% endfor %}
-PPP_CB_BOILERPLATE(on_unknown_sys_enter)
-PPP_CB_BOILERPLATE(on_all_sys_enter)
+PPP_CB_BOILERPLATE_NOTIFY(on_unknown_sys_enter, syscalls2_subscribers_changed)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_enter, syscalls2_subscribers_changed)
 
 /* vim: set tabstop=4 softtabstop=4 noexpandtab ft=cpp: */
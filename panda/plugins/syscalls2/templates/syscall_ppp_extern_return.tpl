@@ -1,7 +1,7 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
-#ifdef {{architectures[arch].qemu_target}}
+#if {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-PPP_CB_EXTERN(on_{{syscall.name}}_return)
+PPP_CB_EXTERN(on_{{syscall.cbname}}_return)
 {%- endfor %}
 #endif
 {% endfor %}
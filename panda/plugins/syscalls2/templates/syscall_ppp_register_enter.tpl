@@ -1,7 +1,7 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
-#ifdef {{architectures[arch].qemu_target}}
+#if {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-PPP_PROT_REG_CB(on_{{syscall.name}}_enter)
+PPP_PROT_REG_CB(on_{{syscall.cbname}}_enter)
 {%- endfor %}
 #endif
 {% endfor %}
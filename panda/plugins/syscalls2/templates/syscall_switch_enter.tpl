@@ -10,13 +10,31 @@ extern "C" {
 #include "gen_syscall_ppp_extern_return.h"
 }
 
+target_ulong syscall_callno_{{os}}_{{arch}}(CPUState *cpu) {
+#if {{arch_conf.qemu_target}}
+	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+	return {{arch_conf.rt_callno_reg}};
+#else
+	return 0;
+#endif
+}
+
+void syscall_subscribers_{{os}}_{{arch}}(std::vector<uint64_t> &bitmap) {
+	bitmap.clear();
+#if {{arch_conf.qemu_target}}
+	{%- for syscall in syscalls %}
+	if (PPP_CHECK_CB(on_{{syscall.cbname}}_enter) || PPP_CHECK_CB(on_{{syscall.cbname}}_return)) syscall_subscribe(bitmap, {{syscall.no}});
+	{%- endfor %}
+#endif
+}
+
 void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ulong pc) {
-#ifdef {{arch_conf.qemu_target}}
+#if {{arch_conf.qemu_target}}
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	ReturnPoint rp;
+	bool track_return = PPP_CHECK_CB(on_all_sys_return);
 	rp.ordinal = {{arch_conf.rt_callno_reg}};
 	rp.proc_id = panda_current_asid(cpu);
-	rp.retaddr = calc_retaddr(cpu, pc);
 	switch({{arch_conf.rt_callno_reg}}) {
 		{%- for syscall in syscalls %}
 		// {{syscall.no}} {{syscall.rettype}} {{syscall.name}} {{syscall.args_raw}}
@@ -24,19 +42,27 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ulong pc) {
 			{%- for arg in syscall.args %}
 			{{arg.temp_assg_code}}
 			{%- endfor %}
-			if (PPP_CHECK_CB(on_{{syscall.name}}_return)) {
+			if (PPP_CHECK_CB(on_{{syscall.cbname}}_return)) track_return = true;
+			{%- if syscall.args %}
+			if (track_return) {
 				{%- for arg in syscall.args %}
 				{{arg.memcpy_temp2rp_code}}
 				{%- endfor %}
 			}
-			PPP_RUN_CB(on_{{syscall.name}}_enter, {{syscall.cargs}});
+			{%- endif %}
+			PPP_RUN_CB(on_{{syscall.cbname}}_enter, {{syscall.cargs}});
 		}; break;
 		{% endfor %}
 		default:
+			if (PPP_CHECK_CB(on_unknown_sys_return)) track_return = true;
 			PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, {{arch_conf.rt_callno_reg}});
 	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, {{arch_conf.rt_callno_reg}});
-	appendReturnPoint(rp);
+	// Only track returns that someone will be told about
+	if (track_return) {
+		rp.retaddr = calc_retaddr(cpu, pc);
+		appendReturnPoint(rp);
+	}
 #endif
 }
 
@@ -10,7 +10,7 @@ extern "C" {
 }
 
 void syscall_return_switch_{{os}}_{{arch}}(CPUState *cpu, target_ulong pc, target_ulong ordinal, ReturnPoint &rp) {
-#ifdef {{arch_conf.qemu_target}}
+#if {{arch_conf.qemu_target}}
 	switch(ordinal) {
 		{%- for syscall in syscalls %}
 		// {{syscall.no}} {{syscall.rettype}} {{syscall.name}} {{syscall.args_raw}}
@@ -18,12 +18,12 @@ void syscall_return_switch_{{os}}_{{arch}}(CPUState *cpu, target_ulong pc, targe
 			{%- for arg in syscall.args %}
 			{{arg.temp_decl_code}}
 			{%- endfor %}
-			if (PPP_CHECK_CB(on_{{syscall.name}}_return)) {
+			if (PPP_CHECK_CB(on_{{syscall.cbname}}_return)) {
 				{%- for arg in syscall.args %}
 				{{arg.memcpy_rp2temp_code}}
 				{%- endfor %}
 			}
-			PPP_RUN_CB(on_{{syscall.name}}_return, {{syscall.cargs}}) ;
+			PPP_RUN_CB(on_{{syscall.cbname}}_return, {{syscall.cargs}}) ;
 		}; break;
 		{%- endfor %}
 		default:
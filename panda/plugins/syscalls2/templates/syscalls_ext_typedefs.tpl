@@ -1,8 +1,8 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
-#ifdef {{architectures[arch].qemu_target}}
+#if {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-typedef void (*on_{{syscall.name}}_enter_t)({{syscall.cargs_signature}});
-typedef void (*on_{{syscall.name}}_return_t)({{syscall.cargs_signature}});
+typedef void (*on_{{syscall.cbname}}_enter_t)({{syscall.cargs_signature}});
+typedef void (*on_{{syscall.cbname}}_return_t)({{syscall.cargs_signature}});
 {%- endfor %}
 #endif
 {% endfor %}
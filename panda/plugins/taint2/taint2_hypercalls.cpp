@@ -90,8 +90,8 @@ void taint_query_hypercall(PandaHypercallStruct phs) {
         if (num_tainted) {
             // ok at least one byte in the extent is tainted
             // 1. write the pandalog entry that tells us something was tainted on this extent
-            Panda__TaintQueryHypercall *tqh = (Panda__TaintQueryHypercall *) malloc (sizeof (Panda__TaintQueryHypercall));
-            *tqh = PANDA__TAINT_QUERY_HYPERCALL__INIT;
+            Panda__TaintQueryHypercall *tqh = pandalog_new(Panda__TaintQueryHypercall,
+                                                           PANDA__TAINT_QUERY_HYPERCALL__INIT);
             tqh->buf = phs.buf;
             tqh->len = len;
             tqh->num_tainted = num_tainted;
@@ -128,19 +128,15 @@ void taint_query_hypercall(PandaHypercallStruct phs) {
                 }
             }
             tqh->n_taint_query = tq.size();
-            tqh->taint_query = (Panda__TaintQuery **) malloc(sizeof(Panda__TaintQuery *) * tqh->n_taint_query);
+            tqh->taint_query = pandalog_new_array(Panda__TaintQuery *, tqh->n_taint_query);
             for (uint32_t i=0; i<tqh->n_taint_query; i++) {
                 tqh->taint_query[i] = tq[i];
             }
             Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
             ple.taint_query_hypercall = tqh;
+            // tqh lives in the pandalog arena, released by the write
             pandalog_write_entry(&ple);
-            free(tqh->src_info);
-            pandalog_callstack_free(tqh->call_stack);
-            for (uint32_t i=0; i<tqh->n_taint_query; i++) {
-                pandalog_taint_query_free(tqh->taint_query[i]);
-            }
-            free(tqh);
+            free(si);
         }
     }
 }
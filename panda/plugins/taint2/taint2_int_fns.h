@@ -100,9 +100,10 @@ void taint2_track_taint_state(void);
 // writes an entry to pandalog with lots of stuff like
 // label set, taint compute #, call stack
 // offset is needed since this is likely a query in the middle of an extent (of 4, 8, or more bytes)
+// the result lives in the pandalog entry arena until the next pandalog_write_entry
 Panda__TaintQuery *taint2_query_pandalog (Addr addr, uint32_t offset);
 
-// used to free memory associated with that struct
+// no-op, the query is released by pandalog_write_entry
 void pandalog_taint_query_free(Panda__TaintQuery *tq);
 
 #endif
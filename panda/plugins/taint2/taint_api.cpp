@@ -418,6 +418,9 @@ static int collect_query_labels_pandalog(uint32_t el, void *stuff) {
 
   if there is no taint set associated with that address, return nullptr.
 
+  The query is allocated in the pandalog entry arena, so it is only
+  valid until the next pandalog_write_entry.
+
   NOTE: offset is offset into the thing that was queried.
   so, e.g., if that thing was a buffer and the query came
   from guest source code, then offset is where we are in the buffer.
@@ -435,8 +438,7 @@ Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
 
     LabelSetP ls = tp_labelset_get(a);
     if (ls) {
-        Panda__TaintQuery *tq = (Panda__TaintQuery *) malloc(sizeof(Panda__TaintQuery));
-        *tq = PANDA__TAINT_QUERY__INIT;
+        Panda__TaintQuery *tq = pandalog_new(Panda__TaintQuery, PANDA__TAINT_QUERY__INIT);
 
         // Returns true if insertion took place, i.e. we should plog this LS.
         if (ls_returned.insert(ls).second) {
@@ -445,12 +447,11 @@ Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
             // write out mapping from ls pointer to labelset contents
             // as its own separate log entry
             Panda__TaintQueryUniqueLabelSet *tquls =
-                (Panda__TaintQueryUniqueLabelSet *)
-                malloc (sizeof (Panda__TaintQueryUniqueLabelSet));
-            *tquls = PANDA__TAINT_QUERY_UNIQUE_LABEL_SET__INIT;
+                pandalog_new(Panda__TaintQueryUniqueLabelSet,
+                             PANDA__TAINT_QUERY_UNIQUE_LABEL_SET__INIT);
             tquls->ptr = (uint64_t) ls;
             tquls->n_label = ls ? ls->size() : 0;
-            tquls->label = (uint32_t *) malloc (sizeof(uint32_t) * tquls->n_label);
+            tquls->label = pandalog_new_array(uint32_t, tquls->n_label);
             el_arr_ind = 0;
             tp_ls_iter(ls, collect_query_labels_pandalog, (void *) tquls->label);
             tq->unique_label_set = tquls;
@@ -464,13 +465,9 @@ Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
     return nullptr;
 }
 
+// Queries live in the pandalog entry arena, nothing to free. Kept for
+// plugins written against the malloc'ing version.
 void pandalog_taint_query_free(Panda__TaintQuery *tq) {
-    if (tq->unique_label_set) {
-        if (tq->unique_label_set->label) {
-            free(tq->unique_label_set->label);
-        }
-        free(tq->unique_label_set);
-    }
 }
 
 extern bool taintEnabled;
@@ -35,6 +35,7 @@ PANDAENDCOMMENT */
 
 #include "panda/plugin.h"
 #include "panda/plugin_plugin.h"
+#include "panda/profile.h"
 
 #include "shad.h"
 #include "label_set.h"
@@ -131,6 +132,7 @@ static inline void write_cb_masks(Shad *shad, uint64_t addr, uint64_t size,
 void taint_copy(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
                 uint64_t size, llvm::Instruction *I)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     if (unlikely(src >= shad_src->get_size() || dest >= shad_dest->get_size())) {
         taint_log("  Ignoring IO RW\n");
         return;
@@ -149,6 +151,7 @@ void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
                             uint64_t src1, uint64_t src2, uint64_t src_size,
                             llvm::Instruction *I)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     uint64_t shad_size = shad->get_size();
     if (unlikely(dest >= shad_size || src1 >= shad_size || src2 >= shad_size)) {
         taint_log("  Ignoring IO RW\n");
@@ -224,6 +227,7 @@ void taint_mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
                        uint64_t src1, uint64_t src2, uint64_t src_size,
                        llvm::Instruction *ignored)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     TaintData td = TaintData::make_union(
             mixed_labels(shad, src1, src_size, false),
             mixed_labels(shad, src2, src_size, false),
@@ -238,6 +242,7 @@ void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
                        uint64_t src1, uint64_t src2, uint64_t src_size,
                        llvm::Instruction *inst, uint64_t arg1, uint64_t arg2)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     bool isTainted1 = false;
     bool isTainted2 = false;
     for (int i = 0; i < src_size; ++i) {
@@ -262,6 +267,7 @@ void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
 
 void taint_delete(Shad *shad, uint64_t dest, uint64_t size)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     taint_log("remove: %s[%lx+%lx]\n", shad->name(), dest, size);
     if (unlikely(dest >= shad->get_size())) {
         taint_log("Ignoring IO RW\n");
@@ -273,12 +279,14 @@ void taint_delete(Shad *shad, uint64_t dest, uint64_t size)
 void taint_set(Shad *shad_dest, uint64_t dest, uint64_t dest_size,
                Shad *shad_src, uint64_t src)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     bulk_set(shad_dest, dest, dest_size, shad_src->query_full(src));
 }
 
 void taint_mix(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
                uint64_t src_size, llvm::Instruction *I)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     TaintData td = mixed_labels(shad, src, src_size, true);
     bulk_set(shad, dest, dest_size, td);
     taint_log("mix: %s[%lx+%lx] <- %lx+%lx ",
@@ -300,6 +308,7 @@ void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
                    uint64_t ptr_size, Shad *shad_src, uint64_t src,
                    uint64_t size, uint64_t is_store)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     taint_log("ptr: %s[%lx+%lx] <- %s[%lx] @ %s[%lx+%lx]\n",
             shad_dest->name(), dest, size,
             shad_src->name(), src, shad_ptr->name(), ptr, ptr_size);
@@ -347,6 +356,7 @@ void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
 void taint_sext(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
                 uint64_t src_size)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     taint_log("taint_sext\n");
     Shad::copy(shad, dest, shad, src, src_size);
     bulk_set(shad, dest + src_size, dest_size - src_size,
@@ -357,6 +367,7 @@ void taint_sext(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
 void taint_select(Shad *shad, uint64_t dest, uint64_t size, uint64_t selector,
                   ...)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     va_list argp;
     uint64_t src, srcsel;
 
@@ -424,6 +435,7 @@ void taint_host_copy(uint64_t env_ptr, uint64_t addr, Shad *llv,
                      uint64_t llv_offset, Shad *greg, Shad *gspec,
                      uint64_t size, uint64_t labels_per_reg, bool is_store)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     int64_t offset = addr - env_ptr;
     if (is_irrelevant(offset)) {
         // Irrelevant
@@ -455,6 +467,7 @@ void taint_host_memcpy(uint64_t env_ptr, uint64_t dest, uint64_t src,
                        Shad *greg, Shad *gspec, uint64_t size,
                        uint64_t labels_per_reg)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     int64_t dest_offset = dest - env_ptr, src_offset = src - env_ptr;
     if (dest_offset < 0 || (size_t)dest_offset >= sizeof(CPUArchState) ||
             src_offset < 0 || (size_t)src_offset >= sizeof(CPUArchState)) {
@@ -480,6 +493,7 @@ void taint_host_memcpy(uint64_t env_ptr, uint64_t dest, uint64_t src,
 void taint_host_delete(uint64_t env_ptr, uint64_t dest_addr, Shad *greg,
                        Shad *gspec, uint64_t size, uint64_t labels_per_reg)
 {
+    panda::ProfileScope prof(PANDA_PROF_TAINT);
     int64_t offset = dest_addr - env_ptr;
 
     if (offset < 0 || (size_t)offset >= sizeof(CPUArchState)) {
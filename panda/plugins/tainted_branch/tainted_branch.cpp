@@ -108,11 +108,10 @@ void tbranch_on_branch_taint2(Addr a, uint64_t size) {
                 tainted_branch[asid].insert(panda_current_pc(cpu));
             }
             else {
-                Panda__TaintedBranch *tb = (Panda__TaintedBranch *) malloc(sizeof(Panda__TaintedBranch));
-                *tb = PANDA__TAINTED_BRANCH__INIT;
+                Panda__TaintedBranch *tb = pandalog_new(Panda__TaintedBranch, PANDA__TAINTED_BRANCH__INIT);
                 tb->call_stack = pandalog_callstack_create();
                 tb->n_taint_query = num_tainted;
-                tb->taint_query = (Panda__TaintQuery **) malloc (sizeof (Panda__TaintQuery *) * num_tainted);
+                tb->taint_query = pandalog_new_array(Panda__TaintQuery *, num_tainted);
                 uint32_t i=0;
                 for (uint32_t o=0; o<size; o++) {
                     Addr ao = a;
@@ -122,13 +121,10 @@ void tbranch_on_branch_taint2(Addr a, uint64_t size) {
                     }
                 }
                 Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+                ple.has_asid = 1;
+                ple.asid = panda_current_asid(first_cpu);
                 ple.tainted_branch = tb;
                 pandalog_write_entry(&ple);
-                pandalog_callstack_free(tb->call_stack);
-                for (uint32_t i=0; i<num_tainted; i++) {
-                    pandalog_taint_query_free(tb->taint_query[i]);
-                }
-                free(tb);
             }
         }
     }
@@ -169,6 +165,8 @@ void uninit_plugin(void *self) {
                 tbs->asid = asid;
                 tbs->pc = pc;
                 Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+                ple.has_asid = 1;
+                ple.asid = asid;
                 ple.tainted_branch_summary = tbs;
                 pandalog_write_entry(&ple);
             }
@@ -84,11 +84,12 @@ void taint_change(Addr a, uint64_t size) {
         }
         else {
             if (pandalog) {
-                Panda__TaintedInstr *ti = (Panda__TaintedInstr *) malloc(sizeof(Panda__TaintedInstr));
-                *ti = PANDA__TAINTED_INSTR__INIT;
+                // ti, its call stack and the taint queries are built in the
+                // pandalog arena, so nothing needs freeing after the write
+                Panda__TaintedInstr *ti = pandalog_new(Panda__TaintedInstr, PANDA__TAINTED_INSTR__INIT);
                 ti->call_stack = pandalog_callstack_create();
                 ti->n_taint_query = num_tainted;
-                ti->taint_query = (Panda__TaintQuery **) malloc (sizeof(Panda__TaintQuery *) * num_tainted);
+                ti->taint_query = pandalog_new_array(Panda__TaintQuery *, num_tainted);
                 uint32_t j = 0;
                 for (uint32_t i=0; i<size; i++) {
                     a.off = i;
@@ -97,15 +98,12 @@ void taint_change(Addr a, uint64_t size) {
                     }
                 }
                 Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+                ple.has_asid = 1;
+                ple.asid = asid;
                 ple.tainted_instr = ti;
                 if (pandalog) {
                     pandalog_write_entry(&ple);
                 }
-                pandalog_callstack_free(ti->call_stack);
-                for (uint32_t i=0; i<num_tainted; i++) {
-                    pandalog_taint_query_free(ti->taint_query[i]);
-                }
-                free(ti);
             }
             else {
                 printf ("  pc = 0x%" PRIx64 "\n", (uint64_t) pc);
@@ -162,6 +160,8 @@ void uninit_plugin(void *self) {
                     tis->asid = asid;
                     tis->pc = pc;
                     Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+                    ple.has_asid = 1;
+                    ple.asid = asid;
                     ple.tainted_instr_summary = tis;
                     pandalog_write_entry(&ple);
                 }
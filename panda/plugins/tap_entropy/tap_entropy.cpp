@@ -0,0 +1,192 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+/*
+  Streaming tap point classifier.
+
+  Keeps a byte histogram per tap point (see callstack_instr) and direction,
+  and computes the entropy and chi-square statistic of every window of
+  `window` bytes seen there. Tap points whose data looks random, i.e. is
+  likely to be encrypted or compressed, are reported to the pandalog with
+  their callstack the first time a window crosses the thresholds. This
+  replaces dumping all histograms with unigrams and sifting through them
+  with find_drm.py.
+
+  Entropy is kept incrementally: with c_b the count of byte b and n the
+  window size so far, H = log2(n) - S/n where S = sum_b c_b * log2(c_b).
+  Incrementing c_b changes S by a table lookup, so the work per byte is a
+  few integer operations.
+*/
+
+// This needs to be defined before anything is included in order to get
+// the PRIx64 macro
+#define __STDC_FORMAT_MACROS
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "panda/plugin.h"
+#include "panda/plog.h"
+
+#include "../callstack_instr/callstack_instr.h"
+#include "../callstack_instr/callstack_instr_ext.h"
+#include "../callstack_instr/prog_point_map.h"
+
+// These need to be extern "C" so that the ABI is compatible with
+// QEMU/PANDA, which is written in C
+extern "C" {
+
+bool init_plugin(void *);
+void uninit_plugin(void *);
+int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf);
+int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf);
+
+}
+
+// S is kept in fixed point with this many fractional bits
+#define S_FRAC_BITS 24
+#define MAX_WINDOW (1 << 20)
+
+struct tap_state {
+    uint32_t hist[256];
+    uint64_t s;         // sum of c * log2(c) over the window, fixed point
+    uint64_t sumsq;     // sum of c * c over the window
+    uint32_t n;         // bytes in the window so far
+    bool reported;
+    uint64_t total;     // bytes seen at the tap point
+};
+
+prog_point_map<tap_state> read_taps;
+prog_point_map<tap_state> write_taps;
+const callstack_instr_state *cs_state = NULL;
+
+uint32_t window;
+double min_entropy;
+double max_chisq;
+// s_delta[c] = (c + 1) * log2(c + 1) - c * log2(c), fixed point
+std::vector<uint32_t> s_delta;
+uint64_t num_reported = 0;
+
+static void report(CPUState *env, const prog_point &p, tap_state &t,
+                   bool is_write, double entropy, double chisq) {
+    t.reported = true;
+    num_reported++;
+    if (pandalog) {
+        Panda__TapEntropy *te = pandalog_new(Panda__TapEntropy, PANDA__TAP_ENTROPY__INIT);
+        te->caller = p.caller;
+        te->pc = p.pc;
+        te->asid = p.cr3;
+        te->is_write = is_write;
+        te->entropy = entropy;
+        te->chi_square = chisq;
+        te->bytes = t.total;
+        te->call_stack = pandalog_callstack_create();
+        Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+        ple.tap_entropy = te;
+        pandalog_write_entry(&ple);
+    } else {
+        printf("tap_entropy: %s " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx
+               " entropy %.3f chi-square %.1f after %" PRIu64 " bytes\n",
+               is_write ? "WRITE" : "READ", p.caller, p.pc, p.cr3,
+               entropy, chisq, t.total);
+    }
+}
+
+// Scores the full window of t and starts the next one.
+static void end_window(CPUState *env, const prog_point &p, tap_state &t,
+                       bool is_write) {
+    double n = t.n;
+    double entropy = log2(n) - ldexp((double) t.s, -S_FRAC_BITS) / n;
+    double chisq = 256.0 * t.sumsq / n - n;
+    if (entropy >= min_entropy && (max_chisq <= 0 || chisq <= max_chisq)) {
+        report(env, p, t, is_write, entropy, chisq);
+    }
+    memset(t.hist, 0, sizeof(t.hist));
+    t.s = 0;
+    t.sumsq = 0;
+    t.n = 0;
+}
+
+static int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                        target_ulong size, void *buf, bool is_write,
+                        prog_point_map<tap_state> &taps) {
+    prog_point p = {};
+    if (!get_prog_point_fast(cs_state, env, &p)) get_prog_point(env, &p);
+
+    tap_state &t = taps[p];
+    if (t.reported) return 1;
+    t.total += size;
+
+    const uint8_t *bytes = (const uint8_t *) buf;
+    for (target_ulong i = 0; i < size; i++) {
+        uint32_t c = t.hist[bytes[i]]++;
+        t.s += s_delta[c];
+        t.sumsq += 2 * c + 1;
+        if (++t.n == window) {
+            end_window(env, p, t, is_write);
+            if (t.reported) break;
+        }
+    }
+
+    return 1;
+}
+
+int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                       target_ulong size, void *buf) {
+    return mem_callback(env, pc, addr, size, buf, true, write_taps);
+}
+
+int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                      target_ulong size, void *buf) {
+    return mem_callback(env, pc, addr, size, buf, false, read_taps);
+}
+
+bool init_plugin(void *self) {
+    panda_cb pcb;
+
+    panda_arg_list *args = panda_get_args("tap_entropy");
+    window = panda_parse_uint32_opt(args, "window", 4096,
+            "bytes per window the statistics are computed over");
+    min_entropy = panda_parse_double_opt(args, "min_entropy", 7.0,
+            "report tap points with at least this entropy (bits per byte)");
+    max_chisq = panda_parse_double_opt(args, "max_chisq", 0,
+            "only report tap points with at most this chi-square statistic (0 for no limit)");
+    panda_free_args(args);
+    if (window < 256 || window > MAX_WINDOW) {
+        fprintf(stderr, "tap_entropy: window must be between 256 and %d\n", MAX_WINDOW);
+        return false;
+    }
+
+    s_delta.resize(window);
+    for (uint32_t c = 0; c < window; c++) {
+        double f0 = c ? c * log2(c) : 0;
+        double f1 = (c + 1) * log2(c + 1);
+        s_delta[c] = lround(ldexp(f1 - f0, S_FRAC_BITS));
+    }
+
+    panda_require("callstack_instr");
+    if (!init_callstack_instr_api()) return false;
+    cs_state = PPP_IMPORT_SHARED("callstack_instr", callstack_instr_state, callstack_instr_state);
+
+    // Need this to get EIP with our callbacks
+    panda_enable_precise_pc();
+    // Enable memory logging
+    panda_enable_memcb();
+
+    pcb.virt_mem_after_read = mem_read_callback;
+    panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_READ, pcb);
+    pcb.virt_mem_after_write = mem_write_callback;
+    panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb);
+
+    return true;
+}
+
+void uninit_plugin(void *self) {
+    printf("tap_entropy: %zu read and %zu write tap points, %" PRIu64 " reported\n",
+           read_taps.size(), write_taps.size(), num_reported);
+}
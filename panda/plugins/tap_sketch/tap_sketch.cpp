@@ -0,0 +1,254 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+/*
+  Byte n-gram statistics per tap point in a fixed amount of memory.
+
+  Instead of exact histograms, each direction (reads and writes) keeps
+  - a count-min sketch of (tap point, n-gram) pairs, giving an estimate of
+    how often an n-gram was seen at a tap point that is never too low, and
+  - a HyperLogLog per tap point, estimating the number of distinct n-grams
+    seen there.
+  Both are sized from the `memory` budget when the plugin loads and never
+  grow. Once the tap point table is full, accesses at new tap points are
+  only counted.
+
+  Sketches are keyed by a hash of the tap point rather than by its position
+  in the table, so reports from several replays (e.g. shards of one long
+  replay run in parallel) with the same parameters can be merged with
+  scripts/sketch_merge.py: the count-min sketches add up and the
+  HyperLogLog registers take the maximum.
+*/
+
+// This needs to be defined before anything is included in order to get
+// the PRIx64 macro
+#define __STDC_FORMAT_MACROS
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "panda/plugin.h"
+
+#include "../callstack_instr/callstack_instr.h"
+#include "../callstack_instr/callstack_instr_ext.h"
+#include "../callstack_instr/prog_point_map.h"
+
+// These need to be extern "C" so that the ABI is compatible with
+// QEMU/PANDA, which is written in C
+extern "C" {
+
+bool init_plugin(void *);
+void uninit_plugin(void *);
+int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf);
+int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf);
+
+}
+
+struct tap_sketch {
+    uint32_t idx;       // index of the tap point's HyperLogLog registers
+    uint32_t seen;      // bytes in gram, up to ngram_len
+    uint64_t hash;      // prog_point_hash of the tap point
+    uint64_t gram;      // last ngram_len bytes seen, most recent lowest
+    uint64_t bytes;     // bytes seen at the tap point
+};
+
+struct tracker {
+    prog_point_map<tap_sketch> taps;
+    std::vector<uint8_t> hll;       // max_taps << hll_bits registers
+    std::vector<uint32_t> cm;       // cm_depth rows of 1 << cm_width_bits
+    uint64_t dropped = 0;           // bytes at tap points past max_taps
+};
+
+tracker read_tracker;
+tracker write_tracker;
+const callstack_instr_state *cs_state = NULL;
+
+uint32_t ngram_len;
+uint32_t cm_depth;
+uint32_t cm_width_bits;
+uint32_t hll_bits;
+uint32_t max_taps;
+
+// fmix64 from murmur3
+static inline uint64_t mix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+// Adds one n-gram of tap point ts to the sketches of t.
+static inline void add_gram(tracker &t, const tap_sketch &ts) {
+    uint64_t h = mix64(ts.hash ^ (ts.gram * 0x9e3779b97f4a7c15ULL));
+
+    // row i uses bucket h1 + i * h2, as in Kirsch and Mitzenmacher
+    uint32_t h1 = h, h2 = (h >> 32) | 1;
+    uint32_t wmask = (1u << cm_width_bits) - 1;
+    for (uint32_t i = 0; i < cm_depth; i++) {
+        uint32_t &c = t.cm[(i << cm_width_bits) | ((h1 + i * h2) & wmask)];
+        if (c != UINT32_MAX) c++;
+    }
+
+    // the top bits pick the register, the rank of the rest goes in it
+    uint8_t &reg = t.hll[((size_t) ts.idx << hll_bits) | (h >> (64 - hll_bits))];
+    uint8_t rank = __builtin_clzll((h << hll_bits) | (1ULL << (hll_bits - 1))) + 1;
+    if (rank > reg) reg = rank;
+}
+
+static int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                        target_ulong size, void *buf, tracker &t) {
+    prog_point p = {};
+    if (!get_prog_point_fast(cs_state, env, &p)) get_prog_point(env, &p);
+
+    tap_sketch *ts = t.taps.find(p);
+    if (!ts) {
+        if (t.taps.size() >= max_taps) {
+            t.dropped += size;
+            return 1;
+        }
+        ts = &t.taps[p];
+        ts->idx = t.taps.size() - 1;
+        ts->hash = prog_point_hash(p);
+    }
+    ts->bytes += size;
+
+    // n-grams carry over from the previous access at this tap point
+    uint64_t gram_mask = ngram_len == 8 ? ~0ULL : (1ULL << (8 * ngram_len)) - 1;
+    const uint8_t *bytes = (const uint8_t *) buf;
+    for (target_ulong i = 0; i < size; i++) {
+        ts->gram = ((ts->gram << 8) | bytes[i]) & gram_mask;
+        if (ts->seen < ngram_len && ++ts->seen < ngram_len) continue;
+        add_gram(t, *ts);
+    }
+
+    return 1;
+}
+
+int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                       target_ulong size, void *buf) {
+    return mem_callback(env, pc, addr, size, buf, write_tracker);
+}
+
+int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
+                      target_ulong size, void *buf) {
+    return mem_callback(env, pc, addr, size, buf, read_tracker);
+}
+
+bool init_plugin(void *self) {
+    panda_cb pcb;
+
+    panda_arg_list *args = panda_get_args("tap_sketch");
+    uint64_t memory = panda_parse_uint64_opt(args, "memory", 256,
+            "memory budget in MB for the sketches of reads and writes together");
+    ngram_len = panda_parse_uint32_opt(args, "n", 2, "n-gram length in bytes (1-8)");
+    cm_depth = panda_parse_uint32_opt(args, "depth", 4,
+            "rows in the count-min sketch (1-16)");
+    hll_bits = panda_parse_uint32_opt(args, "hll_bits", 10,
+            "log2 of the number of HyperLogLog registers per tap point (4-16)");
+    panda_free_args(args);
+    if (ngram_len < 1 || ngram_len > 8 || cm_depth < 1 || cm_depth > 16 ||
+        hll_bits < 4 || hll_bits > 16) {
+        fprintf(stderr, "tap_sketch: n, depth or hll_bits out of range\n");
+        return false;
+    }
+
+    // Each direction gets half of the budget, split evenly between the
+    // count-min sketch and the tap points. A tap point costs its registers,
+    // its map entry and up to four table slots.
+    uint64_t quarter = (memory << 20) / 4;
+    cm_width_bits = 0;
+    while (((uint64_t) cm_depth * sizeof(uint32_t) << (cm_width_bits + 1)) <= quarter &&
+           cm_width_bits < 31) {
+        cm_width_bits++;
+    }
+    uint64_t tap_cost = (1ULL << hll_bits) +
+        sizeof(prog_point_map<tap_sketch>::entry) + 4 * sizeof(uint32_t);
+    uint64_t taps = quarter / tap_cost;
+    max_taps = taps > UINT32_MAX / 2 ? UINT32_MAX / 2 : taps;
+    if (cm_width_bits < 8 || max_taps < 1) {
+        fprintf(stderr, "tap_sketch: memory budget too small\n");
+        return false;
+    }
+    printf("tap_sketch: %u x %u count-min sketch, up to %u tap points per direction\n",
+           cm_depth, 1u << cm_width_bits, max_taps);
+
+    for (tracker *t : { &read_tracker, &write_tracker }) {
+        t->cm.assign((size_t) cm_depth << cm_width_bits, 0);
+        t->hll.assign((size_t) max_taps << hll_bits, 0);
+    }
+
+    panda_require("callstack_instr");
+    if (!init_callstack_instr_api()) return false;
+    cs_state = PPP_IMPORT_SHARED("callstack_instr", callstack_instr_state, callstack_instr_state);
+
+    // Need this to get EIP with our callbacks
+    panda_enable_precise_pc();
+    // Enable memory logging
+    panda_enable_memcb();
+
+    pcb.virt_mem_after_read = mem_read_callback;
+    panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_READ, pcb);
+    pcb.virt_mem_after_write = mem_write_callback;
+    panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb);
+
+    return true;
+}
+
+/*
+  Report, fixed size records so it can be memory mapped:
+
+  header (sketch_header)
+  per tap point: prog_point, u64 hash, u64 bytes, u8 registers[1 << hll_bits]
+  count-min sketch: u32 counters[depth << width_bits], row by row
+*/
+#pragma pack(push, 1)
+struct sketch_header {
+    char magic[4];          // "PSKT"
+    uint32_t version;
+    uint32_t ulong_size;
+    uint32_t n;
+    uint32_t depth;
+    uint32_t width_bits;
+    uint32_t hll_bits;
+    uint32_t num_taps;
+    uint64_t dropped;
+};
+#pragma pack(pop)
+
+static void write_report(const char *name, tracker &t) {
+    FILE *report = fopen(name, "w");
+    if (!report) {
+        printf("Couldn't write report:\n");
+        perror("fopen");
+        return;
+    }
+
+    sketch_header h = { {'P', 'S', 'K', 'T'}, 1, sizeof(target_ulong), ngram_len,
+                        cm_depth, cm_width_bits, hll_bits,
+                        (uint32_t) t.taps.size(), t.dropped };
+    fwrite(&h, sizeof(h), 1, report);
+    for (auto &e : t.taps) {
+        fwrite(&e.first, sizeof(prog_point), 1, report);
+        fwrite(&e.second.hash, sizeof(uint64_t), 1, report);
+        fwrite(&e.second.bytes, sizeof(uint64_t), 1, report);
+        fwrite(&t.hll[(size_t) e.second.idx << hll_bits], 1, 1u << hll_bits, report);
+    }
+    fwrite(t.cm.data(), sizeof(uint32_t), t.cm.size(), report);
+    fclose(report);
+
+    if (t.dropped) {
+        printf("tap_sketch: tap point limit reached, %" PRIu64 " bytes not sketched in %s\n",
+               t.dropped, name);
+    }
+}
+
+void uninit_plugin(void *self) {
+    write_report("sketch_mem_read_report.bin", read_tracker);
+    write_report("sketch_mem_write_report.bin", write_tracker);
+}
@@ -32,7 +32,9 @@ PANDAENDCOMMENT */
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <set>
+#include <string.h>
+#include <string>
+#include <vector>
 #include <iostream>
 #include <fstream>
 
@@ -40,6 +42,7 @@ PANDAENDCOMMENT */
 
 #include "../callstack_instr/callstack_instr.h"
 #include "../callstack_instr/callstack_instr_ext.h"
+#include "../callstack_instr/prog_point_map.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -54,24 +57,129 @@ int write_mem_callback(CPUState *env, target_ulong pc, target_ulong addr, target
 
 uint64_t mem_counter;
 
-std::set<prog_point> tap_points;
-gzFile read_tap_buffers;
-gzFile write_tap_buffers;
+/*
+  Tap point filter.
+
+  Most memory accesses don't come from a tap point, so they are rejected by
+  a bloom filter over the (caller, pc, asid) hash before the exact lookup.
+  With 16 bits and 3 probes per tap point, about 0.3% of the other accesses
+  get through to the lookup.
+*/
+#define TAP_BLOOM_BITS_PER_TAP 16
+#define TAP_BLOOM_PROBES 3
+
+std::vector<uint64_t> tap_bloom;
+uint64_t tap_bloom_mask;
+
+static void tap_bloom_add(const prog_point &p) {
+    uint64_t h = prog_point_hash(p);
+    uint64_t step = (h >> 32) | 1;
+    for (int i = 0; i < TAP_BLOOM_PROBES; i++, h += step) {
+        uint64_t bit = h & tap_bloom_mask;
+        tap_bloom[bit / 64] |= 1ULL << (bit % 64);
+    }
+}
+
+static inline bool tap_bloom_may_contain(const prog_point &p) {
+    uint64_t h = prog_point_hash(p);
+    uint64_t step = (h >> 32) | 1;
+    for (int i = 0; i < TAP_BLOOM_PROBES; i++, h += step) {
+        uint64_t bit = h & tap_bloom_mask;
+        if (!(tap_bloom[bit / 64] & (1ULL << (bit % 64)))) return false;
+    }
+    return true;
+}
+
+/*
+  Output.
+
+  The text format is one line per byte, as before. The binary format starts
+  with a header listing the tap points:
+
+    "PTAP", u32 version, u32 sizeof(target_ulong), u32 number of tap points,
+    (caller, pc, asid) of each tap point
+
+  followed by blocks of data of a single tap point, buffered per tap point:
+
+    u32 tap point index, u32 size of the records
+    records: u64 access count, target_ulong addr, u32 size,
+             u32 number of callers, callers (outermost first), data
+*/
+#define TAP_BIN_MAGIC "PTAP"
+#define TAP_BIN_VERSION 1
+#define TAP_OUT_BUFFER (1 << 16)
+
+struct tap_output {
+    gzFile f;
+    std::string text;                       // text format buffer
+    std::vector<std::vector<uint8_t>> taps; // binary format buffers, per tap point
+};
+
+std::vector<prog_point> tap_list;
+prog_point_map<uint32_t> tap_points;        // index into tap_list
+tap_output read_out;
+tap_output write_out;
+bool binary = false;
+uint32_t tap_buffer_size;
+const callstack_instr_state *cs_state = NULL;
+
+static void flush_tap(tap_output &out, uint32_t tap) {
+    std::vector<uint8_t> &buf = out.taps[tap];
+    if (buf.empty()) return;
+    uint32_t hdr[2] = { tap, (uint32_t) buf.size() };
+    gzwrite(out.f, hdr, sizeof(hdr));
+    gzwrite(out.f, buf.data(), buf.size());
+    buf.clear();
+}
+
+static void flush_output(tap_output &out) {
+    if (binary) {
+        for (uint32_t tap = 0; tap < out.taps.size(); tap++) flush_tap(out, tap);
+    } else if (!out.text.empty()) {
+        gzwrite(out.f, out.text.data(), out.text.size());
+        out.text.clear();
+    }
+}
+
+template <typename T>
+static inline void put(std::vector<uint8_t> &buf, const T &v) {
+    const uint8_t *b = (const uint8_t *) &v;
+    buf.insert(buf.end(), b, b + sizeof(T));
+}
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, gzFile f) {
+                       target_ulong size, void *buf, tap_output &out) {
     prog_point p = {};
-    get_prog_point(env, &p);
+    if (!get_prog_point_fast(cs_state, env, &p)) get_prog_point(env, &p);
 
-    if (tap_points.find(p) != tap_points.end()) {
+    uint32_t *tap;
+    if (tap_bloom_may_contain(p) && (tap = tap_points.find(p)) != NULL) {
         target_ulong callers[16] = {0};
         int nret = get_callers(callers, 16, env);
-        for (unsigned int i = 0; i < size; i++) {
+        if (binary) {
+            std::vector<uint8_t> &b = out.taps[*tap];
+            put(b, mem_counter);
+            put(b, addr);
+            put(b, (uint32_t) size);
+            put(b, (uint32_t) (nret > 1 ? nret - 1 : 0));
             for (int j = nret-1; j > 0; j--) {
-                gzprintf(f, TARGET_FMT_lx " ", callers[j]);
+                put(b, callers[j]);
+            }
+            b.insert(b.end(), (uint8_t *) buf, (uint8_t *) buf + size);
+            if (b.size() >= tap_buffer_size) flush_tap(out, *tap);
+        } else {
+            char line[32 * 20];
+            for (unsigned int i = 0; i < size; i++) {
+                int n = 0;
+                for (int j = nret-1; j > 0; j--) {
+                    n += snprintf(line + n, sizeof(line) - n, TARGET_FMT_lx " ", callers[j]);
+                }
+                n += snprintf(line + n, sizeof(line) - n,
+                        TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %ld %02x\n",
+                        p.caller, p.pc, p.cr3, addr+i, mem_counter, ((unsigned char *)buf)[i]);
+                out.text.append(line, n);
             }
-            gzprintf(f, TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %ld %02x\n",
-                    p.caller, p.pc, p.cr3, addr+i, mem_counter, ((unsigned char *)buf)[i]);
+            if (out.text.size() >= TAP_OUT_BUFFER) flush_output(out);
         }
     }
     mem_counter++;
@@ -80,16 +188,51 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
 }
 
 int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
-    return mem_callback(env, pc, addr, size, buf, read_tap_buffers);
+    return mem_callback(env, pc, addr, size, buf, read_out);
 }
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf ) {
-    return mem_callback(env, pc, addr, size, buf, write_tap_buffers);
+    return mem_callback(env, pc, addr, size, buf, write_out);
+}
+
+static bool open_output(tap_output &out, const char *name, bool compress) {
+    std::string fname = std::string(name) + (binary ? ".bin" : ".txt");
+    if (compress) fname += ".gz";
+    // "T" writes without compression
+    out.f = gzopen(fname.c_str(), compress ? "wb" : "wbT");
+    if (!out.f) {
+        printf("Couldn't open %s for writing. Exiting.\n", fname.c_str());
+        return false;
+    }
+    gzbuffer(out.f, TAP_OUT_BUFFER);
+    if (binary) {
+        uint32_t hdr[3] = { TAP_BIN_VERSION, sizeof(target_ulong), (uint32_t) tap_list.size() };
+        gzwrite(out.f, TAP_BIN_MAGIC, 4);
+        gzwrite(out.f, hdr, sizeof(hdr));
+        for (auto &p : tap_list) {
+            target_ulong t[3] = { p.caller, p.pc, p.cr3 };
+            gzwrite(out.f, t, sizeof(t));
+        }
+        out.taps.resize(tap_list.size());
+    }
+    return true;
 }
 
 bool init_plugin(void *self) {
     panda_cb pcb;
 
     printf("Initializing plugin textprinter\n");
+
+    panda_arg_list *args = panda_get_args("textprinter");
+    const char *format = panda_parse_string_opt(args, "format", "text",
+            "output format, text or binary");
+    binary = strcmp(format, "binary") == 0;
+    bool compress = panda_parse_bool_opt(args, "compress",
+            "compress binary output with zlib");
+    // text output has always been compressed
+    if (!binary) compress = true;
+    tap_buffer_size = panda_parse_uint32_opt(args, "buffer", 4096,
+            "bytes of binary output buffered per tap point");
+    panda_free_args(args);
     
     std::ifstream taps("tap_points.txt");
     if (!taps) {
@@ -102,25 +245,25 @@ bool init_plugin(void *self) {
         taps >> std::hex >> p.pc;
         taps >> std::hex >> p.cr3;
 
-        printf("Adding tap point (" TARGET_FMT_lx "," TARGET_FMT_lx "," TARGET_FMT_lx ")\n",
-               p.caller, p.pc, p.cr3);
-        tap_points.insert(p);
+        if (tap_points.find(p)) continue;
+        tap_points[p] = tap_list.size();
+        tap_list.push_back(p);
     }
     taps.close();
+    printf("textprinter: %zu tap points\n", tap_list.size());
 
-    write_tap_buffers = gzopen("write_tap_buffers.txt.gz", "w");
-    if(!write_tap_buffers) {
-        printf("Couldn't open write_tap_buffers.txt for writing. Exiting.\n");
-        return false;
-    }
-    read_tap_buffers = gzopen("read_tap_buffers.txt.gz", "w");
-    if(!read_tap_buffers) {
-        printf("Couldn't open read_tap_buffers.txt for writing. Exiting.\n");
-        return false;
-    }
+    size_t bits = 1024;
+    while (bits < tap_list.size() * TAP_BLOOM_BITS_PER_TAP) bits *= 2;
+    tap_bloom.assign(bits / 64, 0);
+    tap_bloom_mask = bits - 1;
+    for (auto &t : tap_list) tap_bloom_add(t);
+
+    if (!open_output(write_out, "write_tap_buffers", compress)) return false;
+    if (!open_output(read_out, "read_tap_buffers", compress)) return false;
 
     panda_require("callstack_instr");
     if(!init_callstack_instr_api()) return false;
+    cs_state = PPP_IMPORT_SHARED("callstack_instr", callstack_instr_state, callstack_instr_state);
 
     panda_enable_precise_pc();
     panda_enable_memcb();    
@@ -134,6 +277,8 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    gzclose(read_tap_buffers);
-    gzclose(write_tap_buffers);
+    flush_output(read_out);
+    flush_output(write_out);
+    gzclose(read_out.f);
+    gzclose(write_out.f);
 }
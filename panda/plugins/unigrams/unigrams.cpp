@@ -19,12 +19,15 @@ PANDAENDCOMMENT */
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
-#include <map>
+#include <string.h>
+#include <algorithm>
+#include <vector>
 
 #include "panda/plugin.h"
 
 #include "../callstack_instr/callstack_instr.h"
 #include "../callstack_instr/callstack_instr_ext.h"
+#include "../callstack_instr/prog_point_map.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -38,22 +41,136 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 }
 
 struct text_counter {
-    std::map<uint8_t,unsigned int> hist;
+    uint32_t hist[256];
+    uint32_t id;        // 1-based, for the bigram table
+    int32_t last;       // last byte seen at this tap point, -1 before the first
 };
 
-std::map<prog_point,text_counter> read_tracker;
-std::map<prog_point,text_counter> write_tracker;
+/*
+  Bigram counts of all tap points, in one open addressing table keyed by
+  (tap point id << 16 | first byte << 8 | second byte). Most tap points only
+  ever see a few hundred of the 65536 bigrams, so this is much smaller than
+  a dense table per tap point.
+*/
+class bigram_table {
+public:
+    bigram_table() : count(0), mask(0) {}
+
+    void add(uint32_t id, uint32_t bigram) {
+        if ((count + 1) * 2 > slots.size()) grow();
+        slot *s = lookup(((uint64_t) id << 16) | bigram);
+        if (s->n++ == 0) count++;
+    }
+
+    // (key, count) pairs sorted by key, i.e. by tap point then bigram
+    std::vector<std::pair<uint64_t,uint32_t>> sorted() const {
+        std::vector<std::pair<uint64_t,uint32_t>> v;
+        v.reserve(count);
+        for (auto &s : slots) {
+            if (s.n) v.push_back(std::make_pair(s.key, s.n));
+        }
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+private:
+    struct slot {
+        uint64_t key;
+        uint32_t n;     // 0 for an empty slot
+    };
+    std::vector<slot> slots;
+    size_t count;
+    size_t mask;
+
+    slot *lookup(uint64_t key) {
+        size_t i = (key * 0x9e3779b97f4a7c15ULL) >> 20 & mask;
+        while (slots[i].n && slots[i].key != key) i = (i + 1) & mask;
+        slots[i].key = key;
+        return &slots[i];
+    }
+
+    void grow() {
+        std::vector<slot> old;
+        old.swap(slots);
+        slots.assign(old.empty() ? 1 << 16 : old.size() * 2, slot());
+        mask = slots.size() - 1;
+        for (auto &s : old) {
+            if (s.n) lookup(s.key)->n = s.n;
+        }
+    }
+};
+
+struct tracker {
+    prog_point_map<text_counter> taps;
+    bigram_table bigrams;
+    uint32_t num_ids = 0;
+};
+
+tracker read_tracker;
+tracker write_tracker;
+bool collect_bigrams = false;
+const callstack_instr_state *cs_state = NULL;
+
+// Adds the n bytes of buf to hist. Short buffers are read a word at a time,
+// long ones are spread over four histograms so that runs of the same byte
+// don't serialize on a single counter.
+static inline void count_bytes(uint32_t *hist, const uint8_t *buf, size_t n) {
+    size_t i = 0;
+    if (n >= 1024) {
+        uint32_t part[3][256] = {};
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w;
+            memcpy(&w, buf + i, 8);
+            hist[w & 0xff]++;
+            part[0][(w >> 8) & 0xff]++;
+            part[1][(w >> 16) & 0xff]++;
+            part[2][(w >> 24) & 0xff]++;
+            hist[(w >> 32) & 0xff]++;
+            part[0][(w >> 40) & 0xff]++;
+            part[1][(w >> 48) & 0xff]++;
+            part[2][w >> 56]++;
+        }
+        for (int b = 0; b < 256; b++) {
+            hist[b] += part[0][b] + part[1][b] + part[2][b];
+        }
+    } else {
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w;
+            memcpy(&w, buf + i, 8);
+            hist[w & 0xff]++;
+            hist[(w >> 8) & 0xff]++;
+            hist[(w >> 16) & 0xff]++;
+            hist[(w >> 24) & 0xff]++;
+            hist[(w >> 32) & 0xff]++;
+            hist[(w >> 40) & 0xff]++;
+            hist[(w >> 48) & 0xff]++;
+            hist[w >> 56]++;
+        }
+    }
+    for (; i < n; i++) hist[buf[i]]++;
+}
 
 static int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, std::map<prog_point,text_counter> &tracker) {
+                       target_ulong size, void *buf, tracker &t) {
     prog_point p = {};
+    if (!get_prog_point_fast(cs_state, env, &p)) get_prog_point(env, &p);
 
-    get_prog_point(env, &p);
+    text_counter &tc = t.taps[p];
+    const uint8_t *bytes = (const uint8_t *) buf;
+    count_bytes(tc.hist, bytes, size);
 
-    text_counter &tc = tracker[p];
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        tc.hist[val]++;
+    if (collect_bigrams && size > 0) {
+        if (tc.id == 0) {
+            tc.id = ++t.num_ids;
+            tc.last = -1;
+        }
+        // bigrams carry over from the previous access at this tap point
+        int32_t prev = tc.last;
+        for (unsigned int i = 0; i < size; i++) {
+            if (prev >= 0) t.bigrams.add(tc.id, prev << 8 | bytes[i]);
+            prev = bytes[i];
+        }
+        tc.last = prev;
     }
  
     return 1;
@@ -74,8 +191,13 @@ bool init_plugin(void *self) {
 
     printf("Initializing plugin unigrams\n");
 
+    panda_arg_list *args = panda_get_args("unigrams");
+    collect_bigrams = panda_parse_bool_opt(args, "bigrams", "also collect bigram histograms");
+    panda_free_args(args);
+
     panda_require("callstack_instr");
     if (!init_callstack_instr_api()) return false;
+    cs_state = PPP_IMPORT_SHARED("callstack_instr", callstack_instr_state, callstack_instr_state);
 
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
@@ -90,43 +212,80 @@ bool init_plugin(void *self) {
     return true;
 }
 
-void write_report(FILE *report, std::map<prog_point,text_counter> &tracker) {
+void write_report(FILE *report, tracker &t) {
     // Cross platform support: need to know how big a target_ulong is
     uint32_t target_ulong_size = sizeof(target_ulong);
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, report);
 
-    std::map<prog_point,text_counter>::iterator it;
-    for(it = tracker.begin(); it != tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, report);
-        unsigned int hist[256] = {};
-        for(int i = 0; i < 256; i++) {
-            if (it->second.hist.find(i) != it->second.hist.end())
-                hist[i] = it->second.hist[i];
-        }
-        fwrite(hist, sizeof(hist), 1, report);
+    // Fixed size records, so the report can be memory mapped
+    for (auto &e : t.taps) {
+        fwrite(&e.first, sizeof(prog_point), 1, report);
+        fwrite(e.second.hist, sizeof(e.second.hist), 1, report);
     }
 }
 
-void uninit_plugin(void *self) {
-    FILE *mem_report;
+/*
+  Bigram report, sparse:
 
-    // Reads
-    mem_report = fopen("unigram_mem_read_report.bin", "w");
-    if(!mem_report) {
-        printf("Couldn't write report:\n");
-        perror("fopen");
-        return;
+  u32 target_ulong size
+  u32 number of tap points
+  u64 number of bigrams
+  per tap point: prog_point, u64 index of its first bigram, u64 number of bigrams
+  per bigram, grouped by tap point: u16 (first byte << 8 | second byte), u32 count
+*/
+#pragma pack(push, 1)
+struct bigram_tap_record {
+    prog_point p;
+    uint64_t first;
+    uint64_t n;
+};
+struct bigram_record {
+    uint16_t bigram;
+    uint32_t count;
+};
+#pragma pack(pop)
+
+void write_bigram_report(FILE *report, tracker &t) {
+    std::vector<std::pair<uint64_t,uint32_t>> counts = t.bigrams.sorted();
+    std::vector<bigram_tap_record> taps(t.num_ids);
+    for (auto &e : t.taps) {
+        if (e.second.id) taps[e.second.id - 1].p = e.first;
     }
-    write_report(mem_report, read_tracker);
-    fclose(mem_report);
+    for (uint64_t i = 0; i < counts.size(); i++) {
+        bigram_tap_record &r = taps[(counts[i].first >> 16) - 1];
+        if (r.n++ == 0) r.first = i;
+    }
+
+    uint32_t target_ulong_size = sizeof(target_ulong);
+    uint32_t num_taps = taps.size();
+    uint64_t num_bigrams = counts.size();
+    fwrite(&target_ulong_size, sizeof(uint32_t), 1, report);
+    fwrite(&num_taps, sizeof(uint32_t), 1, report);
+    fwrite(&num_bigrams, sizeof(uint64_t), 1, report);
+    fwrite(taps.data(), sizeof(bigram_tap_record), taps.size(), report);
+    for (auto &c : counts) {
+        bigram_record r = { (uint16_t) (c.first & 0xffff), c.second };
+        fwrite(&r, sizeof(r), 1, report);
+    }
+}
 
-    // Writes
-    mem_report = fopen("unigram_mem_write_report.bin", "w");
+static void write_report_file(const char *name, tracker &t,
+                              void (*write)(FILE *, tracker &)) {
+    FILE *mem_report = fopen(name, "w");
     if(!mem_report) {
         printf("Couldn't write report:\n");
         perror("fopen");
         return;
-    }    
-    write_report(mem_report, write_tracker);
+    }
+    write(mem_report, t);
     fclose(mem_report);
 }
+
+void uninit_plugin(void *self) {
+    write_report_file("unigram_mem_read_report.bin", read_tracker, write_report);
+    write_report_file("unigram_mem_write_report.bin", write_tracker, write_report);
+    if (collect_bigrams) {
+        write_report_file("bigram_mem_read_report.bin", read_tracker, write_bigram_report);
+        write_report_file("bigram_mem_write_report.bin", write_tracker, write_bigram_report);
+    }
+}
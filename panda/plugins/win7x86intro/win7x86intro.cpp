@@ -129,8 +129,7 @@ void on_get_libraries(CPUState *cpu, OsiProc *p, OsiModules **out_ms) {
     // We want while loop here -- we are starting at the head,
     // which is not a valid module
     while (current_mod != first_mod) {                     
-        add_mod(cpu, ms, current_mod, false);
-        current_mod = get_next_mod(cpu, current_mod);
+        current_mod = add_mod(cpu, ms, current_mod, false);
         if (!current_mod) break;
     }
 
@@ -157,8 +156,7 @@ void on_get_modules(CPUState *cpu, OsiModules **out_ms) {
     // We want while loop here -- we are starting at the head,
     // which is not a valid module
     while (current_mod != PsLoadedModuleList) {
-        add_mod(cpu, ms, current_mod, false);
-        current_mod = get_next_mod(cpu, current_mod);
+        current_mod = add_mod(cpu, ms, current_mod, false);
         if (!current_mod) break;
     }
 
@@ -65,6 +65,11 @@ void on_free_osimodules(OsiModules *ms);
 #define FILE_OBJECT_NAME_OFF 0x030
 #define FILE_OBJECT_POS_OFF  0x038
 
+// The leading part of _LDR_DATA_TABLE_ENTRY holding all the fields above
+#define LDR_SPAN             (LDR_BASENAME_OFF + 8)
+// Upper bound for eproc_span
+#define EPROC_SPAN_MAX       0x400
+
 
 // "Constants" specific to the guest operating system.
 // These are initialized in the init_plugin function.
@@ -80,6 +85,7 @@ static uint32_t obj_type_key;       // KEY object type
 static uint32_t obj_type_process;   // PROCESS object type
 static uint32_t obj_type_offset;    // XXX_OBJECT.Type (offset from start of OBJECT_TYPE_HEADER)
 static uint32_t ntreadfile_esp_off; // Number of bytes left on stack when NtReadFile returns
+static uint32_t eproc_span;         // Leading part of _EPROCESS holding all the fields above
 
 // Function pointer, returns location of KPCR structure.  OS-specific.
 static PTR(*get_kpcr)(CPUState *cpu);
@@ -94,20 +100,29 @@ char *make_pagedstr(void) {
     return m;
 }
 
-// Gets a unicode string. Does its own mem allocation.
-// Output is a null-terminated UTF8 string
-char *get_unicode_str(CPUState *cpu, PTR ustr) {
-    uint16_t size = 0;
-    PTR str_ptr = 0;
-    if (-1 == panda_virtual_memory_rw(cpu, ustr, (uint8_t *)&size, 2, false)) {
-        return make_pagedstr();
-    }
-
-    // Clamp size
+/*
+ * OSI walks read many fields of the same structure, and every guest read
+ * walks the page tables. Walks read the leading part of each _EPROCESS or
+ * _LDR_DATA_TABLE_ENTRY that holds all the fields they need at once, and
+ * decode the fields (including the link to the next entry) from that copy.
+ * If the copy can't be read, e.g. because it crosses into a page that isn't
+ * mapped, they fall back to reading field by field.
+ */
+static inline uint16_t buf_u16(const uint8_t *buf, uint32_t off) {
+    uint16_t v;
+    memcpy(&v, buf + off, sizeof(v));
+    return v;
+}
+
+static inline uint32_t buf_u32(const uint8_t *buf, uint32_t off) {
+    uint32_t v;
+    memcpy(&v, buf + off, sizeof(v));
+    return v;
+}
+
+// Converts the UTF-16 string of size bytes at str_ptr. Clamps the size.
+static char *read_unicode_buffer(CPUState *cpu, uint16_t size, PTR str_ptr) {
     if (size > 1024) size = 1024;
-    if (-1 == panda_virtual_memory_rw(cpu, ustr+4, (uint8_t *)&str_ptr, 4, false)) {
-        return make_pagedstr();
-    }
 
     gchar *in_str = (gchar *)g_malloc0(size);
     if (-1 == panda_virtual_memory_rw(cpu, str_ptr, (uint8_t *)in_str, size, false)) {
@@ -129,28 +144,76 @@ char *get_unicode_str(CPUState *cpu, PTR ustr) {
     return ret;
 }
 
+// Gets a unicode string. Does its own mem allocation.
+// Output is a null-terminated UTF8 string
+char *get_unicode_str(CPUState *cpu, PTR ustr) {
+    uint8_t us[8];
+    if (-1 == panda_virtual_memory_rw(cpu, ustr, us, sizeof(us), false)) {
+        return make_pagedstr();
+    }
+    return read_unicode_buffer(cpu, buf_u16(us, 0), buf_u32(us, 4));
+}
 
-void add_proc(CPUState *cpu, OsiProcs *ps, PTR eproc) {
+// Reads the leading part of an _EPROCESS.
+static bool read_eproc(CPUState *cpu, PTR eproc, uint8_t *buf) {
+    return eproc != 0 && -1 != panda_virtual_memory_rw(cpu, eproc, buf, eproc_span, false);
+}
 
+// Same checks as is_valid_process, on a copy made by read_eproc.
+static bool is_valid_process_buf(const uint8_t *buf) {
+    return buf[EPROC_TYPE_OFF] == EPROC_TYPE && buf[EPROC_SIZE_OFF] == eproc_size &&
+        buf_u32(buf, eproc_links_off) - eproc_links_off != 0;
+}
+
+static void fill_osiproc_buf(OsiProc *p, PTR eproc, const uint8_t *buf) {
+    p->offset = eproc;
+    p->name = (char *) malloc(17);
+    assert(p->name);
+    memcpy(p->name, buf + eproc_name_off, 16);
+    p->name[16] = '\0';
+    p->asid = buf_u32(buf, EPROC_DTB_OFF);
+    assert(p->asid);
+    p->pages = NULL;
+    p->pid = buf_u32(buf, eproc_pid_off);
+    p->ppid = buf_u32(buf, eproc_ppid_off);
+}
+
+
+static OsiProc *new_proc(OsiProcs *ps) {
     if ((ps->proc == NULL) || (ps->num == ps->capacity)) {
         ps->capacity *= 2;
         ps->proc = (OsiProc *)realloc(ps->proc, sizeof(OsiProc) * ps->capacity);
         assert(ps->proc);
     }
+    return &ps->proc[ps->num++];
+}
 
-    OsiProc *p = &ps->proc[ps->num++];
-    fill_osiproc(cpu, p, eproc);
+void add_proc(CPUState *cpu, OsiProcs *ps, PTR eproc) {
+    fill_osiproc(cpu, new_proc(ps), eproc);
 }
 
-void add_mod(CPUState *cpu, OsiModules *ms, PTR mod, bool ignore_basename) {
+PTR add_mod(CPUState *cpu, OsiModules *ms, PTR mod, bool ignore_basename) {
     if ((ms->module == NULL ) || (ms->num == ms->capacity)) {
         ms->capacity *= 2;
         ms->module = (OsiModule *)realloc(ms->module, sizeof(OsiModule) * ms->capacity);
         assert(ms->module);
     }
 
-    OsiModule *p = &ms->module [ms->num++];
-    fill_osimod(cpu, p, mod, ignore_basename);
+    OsiModule *m = &ms->module [ms->num++];
+    uint8_t buf[LDR_SPAN];
+    if (-1 == panda_virtual_memory_rw(cpu, mod, buf, sizeof(buf), false)) {
+        fill_osimod(cpu, m, mod, ignore_basename);
+        return get_next_mod(cpu, mod);
+    }
+
+    m->offset = mod;
+    m->file = read_unicode_buffer(cpu, buf_u16(buf, LDR_FILENAME_OFF), buf_u32(buf, LDR_FILENAME_OFF + 4));
+    m->base = buf_u32(buf, LDR_BASE_OFF);
+    m->size = buf_u32(buf, LDR_SIZE_OFF);
+    m->name = ignore_basename ? g_strdup("-") :
+        read_unicode_buffer(cpu, buf_u16(buf, LDR_BASENAME_OFF), buf_u32(buf, LDR_BASENAME_OFF + 4));
+    assert(m->name);
+    return buf_u32(buf, LDR_LOAD_LINKS_OFF) - LDR_LOAD_LINKS_OFF;
 }
 
 void on_get_current_process(CPUState *cpu, OsiProc **out_p) {
@@ -183,14 +246,21 @@ void on_get_processes(CPUState *cpu, OsiProcs **out_ps) {
     ps->capacity = 1;
     ps->proc = NULL;
 
+    uint8_t buf[EPROC_SPAN_MAX];
     do {
         // One of these will be the loop head,
         // which we don't want to include
-        if (is_valid_process(cpu, current)) {
-            add_proc(cpu, ps, current);
+        if (read_eproc(cpu, current, buf)) {
+            if (is_valid_process_buf(buf)) {
+                fill_osiproc_buf(new_proc(ps), current, buf);
+            }
+            current = buf_u32(buf, eproc_links_off) - eproc_links_off;
+        } else {
+            if (is_valid_process(cpu, current)) {
+                add_proc(cpu, ps, current);
+            }
+            current = get_next_proc(cpu, current);
         }
-
-        current = get_next_proc(cpu, current);
         if (!current) break;
     } while (current != first);
 
@@ -464,6 +534,12 @@ int64_t get_file_handle_pos(CPUState *cpu, uint32_t eproc, uint32_t handle) {
 }
 
 void fill_osiproc(CPUState *cpu, OsiProc *p, PTR eproc) {
+    uint8_t buf[EPROC_SPAN_MAX];
+    if (read_eproc(cpu, eproc, buf)) {
+        fill_osiproc_buf(p, eproc, buf);
+        return;
+    }
+
     p->offset = eproc;
     get_procname(cpu, eproc, &p->name);
     p->asid = get_dtb(cpu, eproc);
@@ -562,6 +638,10 @@ bool init_plugin(void *self) {
             "version (%s).\n", panda_os_variant);
     }
 
+    eproc_span = MAX(MAX(eproc_pid_off, eproc_ppid_off), MAX(eproc_links_off, EPROC_DTB_OFF)) + sizeof(PTR);
+    eproc_span = MAX(eproc_span, eproc_name_off + 16);
+    assert(eproc_span <= EPROC_SPAN_MAX);
+
     PPP_REG_CB("osi", on_get_current_process, on_get_current_process);
     PPP_REG_CB("osi", on_get_processes, on_get_processes);
     PPP_REG_CB("osi", on_free_osiproc, on_free_osiproc);
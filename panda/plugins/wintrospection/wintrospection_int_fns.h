@@ -53,7 +53,8 @@ void fill_osiproc(CPUState *cpu, OsiProc *p, PTR eproc);
 
 void fill_osimod(CPUState *cpu, OsiModule *m, PTR mod, bool ignore_basename);
 
-void add_mod(CPUState *cpu, OsiModules *ms, PTR mod, bool ignore_basename);
+// adds the module and returns the next one in its list
+PTR add_mod(CPUState *cpu, OsiModules *ms, PTR mod, bool ignore_basename);
 
 void on_get_current_process(CPUState *cpu, OsiProc **out_p);
 
@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+
+# Draws the asidstory table and graph from asidstory.bin, which the
+# asidstory plugin appends to as a replay runs. Works on a partial file,
+# e.g. while the replay is still going:
+#
+#   watch asidstory.py asidstory.bin
+#   asidstory.py -w 180 asidstory.bin
+
+import sys
+from struct import unpack, calcsize
+
+HEADER_FMT = "<4sIIQ"
+PROCESS_FMT = "<IIQI"
+RUN_FMT = "<IQQ"
+NAMELEN = 20
+
+class Process(object):
+    def __init__(self, name, pid, asid):
+        self.name = name
+        self.pid = pid
+        self.asid = asid
+        self.shortname = name
+        self.count = 0
+        self.first = None
+        self.last = 0
+        self.runs = []
+
+def _read(f, fmt):
+    size = calcsize(fmt)
+    data = f.read(size)
+    if len(data) < size:
+        return None
+    return unpack(fmt, data)
+
+# Returns (ulong_size, max_instr, processes) from an asidstory.bin. A record
+# cut short at the end of the file is ignored.
+def load_story(f):
+    if isinstance(f, str):
+        f = open(f, 'rb')
+    magic, version, ulong_size, max_instr = unpack(HEADER_FMT, f.read(calcsize(HEADER_FMT)))
+    if magic != b"PASD" or version != 1:
+        raise ValueError("not an asidstory.bin")
+    procs = []
+    while True:
+        t = f.read(1)
+        if t == b'P':
+            rec = _read(f, PROCESS_FMT)
+            if rec is None: break
+            idx, pid, asid, name_len = rec
+            name = f.read(name_len)
+            if len(name) < name_len: break
+            procs.append(Process(name.decode('utf-8', 'replace'), pid, asid))
+        elif t == b'R':
+            rec = _read(f, RUN_FMT)
+            if rec is None: break
+            idx, first, last = rec
+            p = procs[idx]
+            p.count += 1
+            if p.first is None: p.first = first
+            p.last = max(p.last, last)
+            p.runs.append((first, last))
+        else:
+            break
+
+    # shortnames as in the plugin: no .exe, and a number for repeated names
+    name_count = {}
+    for p in procs:
+        count = name_count[p.name] = name_count.get(p.name, 0) + 1
+        shortname = p.name[:-4] if p.name.endswith(".exe") else p.name
+        if count > 1:
+            shortname = shortname[:NAMELEN - len(str(count))] + str(count)
+        p.shortname = shortname[:NAMELEN]
+    return ulong_size, max_instr, [p for p in procs if p.count]
+
+def draw(ulong_size, max_instr, procs, width=100, out=sys.stdout):
+    num_cells = max(width, 80) - NAMELEN - 5
+    scale = float(num_cells) / max_instr if max_instr else 0
+    d = len(str(max_instr))
+
+    out.write("%*s%6s  %*s  %*s  %*s      %*s\n" %
+              (d, "Count", "Pid", NAMELEN, "Name", 2 * ulong_size, "Asid", d, "First", d, "Last"))
+    for p in sorted(procs, key=lambda p: p.count, reverse=True):
+        out.write("%*d%6d  %*s  %*x  %*d  ->  %*d\n" %
+                  (d, p.count, p.pid, NAMELEN, p.shortname, 2 * ulong_size, p.asid,
+                   d, p.first, d, p.last))
+    out.write("\n")
+
+    for p in sorted(procs, key=lambda p: p.first):
+        cells = [' '] * num_cells
+        for first, last in p.runs:
+            c1 = min(int(first * scale), num_cells - 1)
+            c2 = min(int(last * scale), num_cells - 1)
+            cells[c1:c2 + 1] = '#' * (c2 - c1 + 1)
+        out.write("%*s : [%s]\n" % (NAMELEN, p.shortname, "".join(cells)))
+
+if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(description='Draw the asidstory of a replay from asidstory.bin.')
+    parser.add_argument('story', help='asidstory.bin written by the asidstory plugin')
+    parser.add_argument('-w', '--width', type=int, default=100,
+            help='width of the graph (minimum 80)')
+    args = parser.parse_args()
+    ulong_size, max_instr, procs = load_story(args.story)
+    draw(ulong_size, max_instr, procs, args.width)
@@ -30,10 +30,36 @@ for dc in itertools.product(top_dirs, build_dirs, arch_dirs):
 
 assert 'plog_pb2' in sys.modules, "Couldn't load module plog_pb2. Searched paths:\n\t%s" % "\n\t".join(searched_paths)
 
+# chunk codecs, see PlCodec in plog-cc.hpp
+PL_CODEC_ZLIB, PL_CODEC_ZSTD, PL_CODEC_LZ4 = range(3)
+
+def decompress_zstd(data, size_hint):
+    import zstandard
+    return zstandard.ZstdDecompressor().decompress(data, max_output_size=size_hint)
+
+def decompress_lz4(data, size_hint):
+    import lz4.block
+    # raw lz4 blocks don't store their size, grow the guess until it fits
+    while True:
+        try:
+            return lz4.block.decompress(data, uncompressed_size=size_hint)
+        except lz4.block.LZ4BlockError:
+            size_hint *= 2
+
+decompressors = {
+    PL_CODEC_ZLIB: lambda data, size_hint: zlib.decompress(data, 15, size_hint),
+    PL_CODEC_ZSTD: decompress_zstd,
+    PL_CODEC_LZ4: decompress_lz4,
+}
+
 class PLogReader:
     def __init__(self, fn):
         self.f = open(fn)
-        self.version, _, self.dir_pos, _, self.chunk_gsize = struct.unpack('<IIQII', self.f.read(24))
+        # version 2 headers end after chunk_size, the rest of the header area is zero
+        self.version, _, self.dir_pos, self.chunk_gsize, self.codec, self.level, _ = struct.unpack('<IIQIIiI', self.f.read(32))
+        if self.version < 3:
+            self.codec = PL_CODEC_ZLIB
+        self.decompress = decompressors[self.codec]
 
         self.f.seek(self.dir_pos)
         self.nchunks, = struct.unpack('<I', self.f.read(4)) # number of chunks
@@ -65,13 +91,12 @@ class PLogReader:
                 nxt = struct.unpack_from('<QQQ', self.chunks, 24*(self.chunk_idx+1))
                 zchunk_size = nxt[1] - cur[1]
             else:
-                # setting the compressed chunk size to -1 will
-                # result in reading the remaining of the file
-                zchunk_size = -1
+                # the last chunk ends where the directory starts
+                zchunk_size = self.dir_pos - cur[1]
 
             # read and decompress chunk data
             self.f.seek(cur[1])
-            self.chunk_data = zlib.decompress(self.f.read(zchunk_size), 15, self.chunk_gsize)
+            self.chunk_data = self.decompress(self.f.read(zchunk_size), self.chunk_gsize)
             self.chunk_size = len(self.chunk_data)
             self.chunk_data_idx = 0
 
@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+
+# Reads, queries and merges tap_sketch reports (sketch_mem_*_report.bin).
+#
+#   sketch_merge.py merge out.bin shard1.bin shard2.bin ...
+#   sketch_merge.py summary report.bin
+
+import sys
+import math
+import numpy as np
+from struct import pack, unpack
+
+HEADER_FMT = "<4s7IQ"
+HEADER_SIZE = 40
+MASK64 = (1 << 64) - 1
+
+class Sketch(object):
+    pass
+
+# Memory maps a report. The result has the header fields (n, depth,
+# width_bits, hll_bits, dropped, ...), taps, one record per tap point with
+# caller, pc, cr3, hash, bytes and regs (the HyperLogLog registers), and cm,
+# the count-min sketch as a depth x width array.
+def load_sketch(f):
+    if isinstance(f, str):
+        f = open(f, 'rb')
+    s = Sketch()
+    (magic, s.version, s.ulong_size, s.n, s.depth, s.width_bits, s.hll_bits,
+     num_taps, s.dropped) = unpack(HEADER_FMT, f.read(HEADER_SIZE))
+    if magic != b"PSKT" or s.version != 1:
+        raise ValueError("not a tap_sketch report")
+    ulong_fmt = '<u%d' % s.ulong_size
+    s.taptype = np.dtype( [ ('caller', ulong_fmt), ('pc', ulong_fmt), ('cr3', ulong_fmt),
+                            ('hash', '<u8'), ('bytes', '<u8'), ('regs', 'u1', 1 << s.hll_bits) ] )
+    s.taps = np.memmap(f, dtype=s.taptype, mode='r', offset=HEADER_SIZE, shape=(num_taps,))
+    s.cm = np.memmap(f, dtype='<u4', mode='r', offset=HEADER_SIZE + num_taps * s.taptype.itemsize,
+                     shape=(s.depth, 1 << s.width_bits))
+    return s
+
+def _params(s):
+    return (s.ulong_size, s.n, s.depth, s.width_bits, s.hll_bits)
+
+# fmix64 from murmur3, as in tap_sketch
+def _mix64(k):
+    k ^= k >> 33
+    k = (k * 0xff51afd7ed558ccd) & MASK64
+    k ^= k >> 33
+    k = (k * 0xc4ceb9fe1a85ec53) & MASK64
+    k ^= k >> 33
+    return k
+
+# Estimated number of times the n-gram gram (a byte string of length n) was
+# seen at tap point i. Never lower than the true count.
+def ngram_count(s, i, gram):
+    g = 0
+    for b in bytearray(gram):
+        g = (g << 8) | b
+    h = _mix64(int(s.taps[i]['hash']) ^ ((g * 0x9e3779b97f4a7c15) & MASK64))
+    h1, h2 = h & 0xffffffff, (h >> 32) | 1
+    wmask = (1 << s.width_bits) - 1
+    return min(int(s.cm[row, (h1 + row * h2) & wmask]) for row in range(s.depth))
+
+# Estimated number of distinct n-grams seen at tap point i
+def distinct_ngrams(s, i):
+    regs = s.taps[i]['regs'].astype(np.float64)
+    m = len(regs)
+    alpha = {16: 0.673, 32: 0.697, 64: 0.709}.get(m, 0.7213 / (1 + 1.079 / m))
+    est = alpha * m * m / np.sum(2.0 ** -regs)
+    zeros = np.count_nonzero(regs == 0)
+    if est <= 2.5 * m and zeros:
+        est = m * math.log(float(m) / zeros)
+    return est
+
+# Merges reports with the same parameters, e.g. from shards of one replay,
+# into out.
+def merge(out, files):
+    sketches = [load_sketch(f) for f in files]
+    s0 = sketches[0]
+    for s in sketches[1:]:
+        if _params(s) != _params(s0):
+            raise ValueError("reports were made with different parameters")
+
+    index = {}
+    taps = []
+    for s in sketches:
+        for t in s.taps:
+            key = (int(t['caller']), int(t['pc']), int(t['cr3']))
+            if key in index:
+                m = taps[index[key]]
+                m['bytes'] += t['bytes']
+                np.maximum(m['regs'], t['regs'], out=m['regs'])
+            else:
+                index[key] = len(taps)
+                taps.append(np.array(t, dtype=s0.taptype))
+    cm = np.zeros(s0.cm.shape, dtype=np.uint64)
+    for s in sketches:
+        cm += s.cm
+    np.minimum(cm, 0xffffffff, out=cm)
+    dropped = sum(s.dropped for s in sketches)
+
+    with open(out, 'wb') as f:
+        f.write(pack(HEADER_FMT, b"PSKT", 1, s0.ulong_size, s0.n, s0.depth,
+                     s0.width_bits, s0.hll_bits, len(taps), dropped))
+        for t in taps:
+            f.write(t.tobytes())
+        f.write(cm.astype('<u4').tobytes())
+
+def summary(f):
+    s = load_sketch(f)
+    print("%d tap points, %d-grams, %d bytes at tap points not sketched" %
+          (len(s.taps), s.n, s.dropped))
+    for i, t in enumerate(s.taps):
+        print("%x %x %x %d bytes, ~%d distinct" %
+              (t['caller'], t['pc'], t['cr3'], t['bytes'], distinct_ngrams(s, i)))
+
+if __name__ == "__main__":
+    if len(sys.argv) >= 4 and sys.argv[1] == 'merge':
+        merge(sys.argv[2], sys.argv[3:])
+    elif len(sys.argv) == 3 and sys.argv[1] == 'summary':
+        summary(sys.argv[2])
+    else:
+        print("usage: %s merge out.bin in.bin [in.bin ...] | summary report.bin" % sys.argv[0])
+        sys.exit(1)
@@ -1,13 +1,53 @@
 #!/usr/bin/env python2.7
 
 import gzip
+import struct
 import time
 
+def tap_fname(prefix, callers, pc, cr3, num_callers):
+    return prefix + "." + ".".join( callers[-num_callers:] + [pc, cr3] ) + ".dat"
+
+# Binary textprinter output (textprinter:format=binary)
+def split_binary(f, prefix, num_callers):
+    version, ulong_size, num_taps = struct.unpack("<III", f.read(12))
+    ulong = '<Q' if ulong_size == 8 else '<I'
+    hexfmt = "%%0%dx" % (2 * ulong_size)
+    taps = [struct.unpack("<3" + ulong[1], f.read(3 * ulong_size)) for i in range(num_taps)]
+    filemap = {}
+    while True:
+        hdr = f.read(8)
+        if len(hdr) < 8: break
+        tap, size = struct.unpack("<II", hdr)
+        block = f.read(size)
+        caller, pc, cr3 = taps[tap]
+        pos = 0
+        while pos < size:
+            n, ncallers = struct.unpack_from("<II", block, pos + 8 + ulong_size)
+            pos += 16 + ulong_size
+            callers = list(struct.unpack_from("<%d%s" % (ncallers, ulong[1]), block, pos))
+            pos += ncallers * ulong_size
+            data = block[pos:pos + n]
+            pos += n
+            fname = tap_fname(prefix, [hexfmt % c for c in callers + [caller]],
+                              hexfmt % pc, hexfmt % cr3, num_callers)
+            if fname not in filemap:
+                # Avoid "too many open files" -- flush the file descriptor map
+                if len(filemap) > 1000:
+                    for o in filemap.values(): o.close()
+                    filemap = {}
+                filemap[fname] = open(fname,'ab')
+            filemap[fname].write(data)
+
 def main(logfile, prefix, num_callers=1):
     if logfile.endswith('.gz'):
         f = gzip.GzipFile(logfile)
     else:
-        f = open(logfile)
+        f = open(logfile, 'rb')
+
+    if f.read(4) == b"PTAP":
+        split_binary(f, prefix, num_callers)
+        return
+    f.seek(0)
 
     filemap = {}
 
@@ -19,7 +59,7 @@ def main(logfile, prefix, num_callers=1):
 
         callers, pc, cr3, addr, n, val = line.strip().rsplit(" ", 5)
         callers = callers.split()
-        fname = prefix + "." + ".".join( callers[-num_callers:] + [pc, cr3] ) + ".dat"
+        fname = tap_fname(prefix, callers, pc, cr3, num_callers)
         if fname not in filemap:
             filemap[fname] = open(fname,'a')
 
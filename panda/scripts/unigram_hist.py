@@ -6,9 +6,39 @@ import os,sys
 import numpy as np
 from struct import unpack
 
-def load_hist(f):
+def _ulong_fmt(f):
     ulong_size = unpack("<i", f.read(4))[0]
-    ulong_fmt = '<u%d' % ulong_size
-    rectype = np.dtype( [ ('caller', ulong_fmt), ('pc', ulong_fmt), ('cr3', ulong_fmt), ('hist', '<i4', 256) ] )
-    data = np.fromfile(f, dtype=rectype)
+    return '<u%d' % ulong_size
+
+# Histograms of a unigrams report, memory mapped: one record per tap point
+# with caller, pc, cr3 and hist (256 counts).
+def load_hist(f):
+    if isinstance(f, str):
+        f = open(f, 'rb')
+    ulong_fmt = _ulong_fmt(f)
+    rectype = np.dtype( [ ('caller', ulong_fmt), ('pc', ulong_fmt), ('cr3', ulong_fmt), ('hist', '<u4', 256) ] )
+    data = np.memmap(f, dtype=rectype, mode='r', offset=4)
     return data
+
+# Sparse bigram report of unigrams (bigrams=true), memory mapped. Returns
+# (taps, bigrams): taps has caller, pc, cr3 and the range [first, first + n)
+# of its records in bigrams, which have bigram (first byte << 8 | second
+# byte) and count.
+def load_bigrams(f):
+    if isinstance(f, str):
+        f = open(f, 'rb')
+    ulong_fmt = _ulong_fmt(f)
+    num_taps, num_bigrams = unpack("<IQ", f.read(12))
+    taptype = np.dtype( [ ('caller', ulong_fmt), ('pc', ulong_fmt), ('cr3', ulong_fmt), ('first', '<u8'), ('n', '<u8') ] )
+    bigramtype = np.dtype( [ ('bigram', '<u2'), ('count', '<u4') ] )
+    taps = np.memmap(f, dtype=taptype, mode='r', offset=16, shape=(num_taps,))
+    bigrams = np.memmap(f, dtype=bigramtype, mode='r',
+                        offset=16 + num_taps * taptype.itemsize, shape=(num_bigrams,))
+    return taps, bigrams
+
+# Dense 256x256 bigram histogram of one tap point from load_bigrams
+def bigram_hist(taps, bigrams, i):
+    recs = bigrams[taps[i]['first'] : taps[i]['first'] + taps[i]['n']]
+    hist = np.zeros(65536, dtype='<u4')
+    hist[recs['bigram']] = recs['count']
+    return hist.reshape(256, 256)
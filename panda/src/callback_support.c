@@ -5,8 +5,11 @@
 #include "panda/plugin.h"
 #include "panda/callback_support.h"
 #include "panda/common.h"
+#include "panda/profile.h"
+#include "qemu/timer.h"
 
 #include "panda/rr/rr_log.h"
+#include "qemu/rcu.h"
 #include "exec/cpu-common.h"
 #include "exec/ram_addr.h"
 
@@ -14,32 +17,38 @@ void panda_callbacks_hd_transfer(CPUState *cpu, Hd_transfer_type type, uint64_t
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_HD_TRANSFER];
+        rcu_read_lock();
+        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_HD_TRANSFER);
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_hd_transfer(cpu, type, src_addr, dest_addr, num_bytes);
+                 PANDA_CB_INVOKE(plist, plist->entry.replay_hd_transfer(cpu, type, src_addr, dest_addr, num_bytes));
         }
+        rcu_read_unlock();
     }
 }
 
 void panda_callbacks_handle_packet(CPUState *cpu, uint8_t *buf, size_t size, uint8_t direction, uint64_t old_buf_addr) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_HANDLE_PACKET];
+        rcu_read_lock();
+        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_HANDLE_PACKET);
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_handle_packet(cpu, buf, size, direction, old_buf_addr);
+                 PANDA_CB_INVOKE(plist, plist->entry.replay_handle_packet(cpu, buf, size, direction, old_buf_addr));
         }
+        rcu_read_unlock();
     }
 }
 void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_t src_addr, uint64_t dst_addr, uint32_t num_bytes) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_NET_TRANSFER];
+        rcu_read_lock();
+        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_NET_TRANSFER);
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_net_transfer(cpu, type, src_addr, dst_addr, num_bytes);
+                 PANDA_CB_INVOKE(plist, plist->entry.replay_net_transfer(cpu, type, src_addr, dst_addr, num_bytes));
         }
+        rcu_read_unlock();
     }
 }
 
@@ -47,64 +56,82 @@ void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_
 void panda_callbacks_before_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_BEFORE_DMA];
+        rcu_read_lock();
+        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_BEFORE_DMA);
              plist != NULL; plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_before_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
+            PANDA_CB_INVOKE(plist, plist->entry.replay_before_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l));
         }
+        rcu_read_unlock();
     }
 }
 
 void panda_callbacks_after_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
-       for (plist = panda_cbs[PANDA_CB_REPLAY_AFTER_DMA];
+       rcu_read_lock();
+       for (plist = panda_cb_list_first(PANDA_CB_REPLAY_AFTER_DMA);
             plist != NULL; plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_after_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
+            PANDA_CB_INVOKE(plist, plist->entry.replay_after_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l));
         }
+       rcu_read_unlock();
     }
 }
 
 // These are used in cpu-exec.c
 void panda_callbacks_before_block_exec(CPUState *cpu, TranslationBlock *tb) {
     panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
+    for (plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_EXEC);
          plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_block_exec(cpu, tb);
+        PANDA_CB_INVOKE(plist, plist->entry.before_block_exec(cpu, tb));
     }
 }
 
 
 void panda_callbacks_after_block_exec(CPUState *cpu, TranslationBlock *tb) {
     panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC];
+    for (plist = panda_cb_list_first(PANDA_CB_AFTER_BLOCK_EXEC);
          plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_block_exec(cpu, tb);
+        PANDA_CB_INVOKE(plist, plist->entry.after_block_exec(cpu, tb));
     }
 }
 
 
 void panda_callbacks_before_block_translate(CPUState *cpu, target_ulong pc) {
     panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE];
+    for (plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_TRANSLATE);
          plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_block_translate(cpu, pc);
+        PANDA_CB_INVOKE(plist, plist->entry.before_block_translate(cpu, pc));
     }
 }
 
 
 void panda_callbacks_after_block_translate(CPUState *cpu, TranslationBlock *tb) {
     panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE];
+    for (plist = panda_cb_list_first(PANDA_CB_AFTER_BLOCK_TRANSLATE);
          plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_block_translate(cpu, tb);
+        PANDA_CB_INVOKE(plist, plist->entry.after_block_translate(cpu, tb));
     }
 }
 
+// Tags accumulated by the TB currently being translated
+static uint64_t panda_tb_translation_tags;
+
+void panda_tb_translate_begin(CPUState *cpu, TranslationBlock *tb) {
+    tb->panda_asid = panda_current_asid(cpu);
+    tb->panda_call_type = 0;
+    panda_tb_translation_tags = panda_active_tb_tags;
+}
+
+void panda_tb_translate_end(CPUState *cpu, TranslationBlock *tb) {
+    tb->panda_tags = panda_tb_translation_tags;
+}
+
 void panda_before_find_fast(void) {
     if (panda_plugin_to_unload){
         panda_plugin_to_unload = false;
         int i;
-        for (i = 0; i < MAX_PANDA_PLUGINS; i++){
+        // Back to front: unloading shifts the plugins that follow down
+        for (i = MAX_PANDA_PLUGINS - 1; i >= 0; i--){
             if (panda_plugins_to_unload[i]){
                 panda_do_unload_plugin(i);
                 panda_plugins_to_unload[i] = false;
@@ -112,7 +139,11 @@ void panda_before_find_fast(void) {
         }
     }
     if (panda_flush_tb()) {
+        // a full flush supersedes any pending selective invalidation
+        panda_do_invalidate_tbs(false);
         tb_flush(first_cpu);
+    } else {
+        panda_do_invalidate_tbs(true);
     }
 }
 
@@ -120,10 +151,9 @@ void panda_before_find_fast(void) {
 bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool bb_invalidate_done, bool *invalidate) {
     panda_cb_list *plist;
     if (!bb_invalidate_done) {
-        for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
+        for(plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT);
             plist != NULL; plist = panda_cb_list_next(plist)) {
-            *invalidate |=
-                plist->entry.before_block_exec_invalidate_opt(cpu, tb);
+            PANDA_CB_INVOKE(plist, *invalidate |= plist->entry.before_block_exec_invalidate_opt(cpu, tb));
         }
         return true;
     }
@@ -135,9 +165,15 @@ bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool b
 bool panda_callbacks_insn_translate(CPUState *env, target_ulong pc) {
     panda_cb_list *plist;
     bool panda_exec_cb = false;
-    for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_INSN_TRANSLATE); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        panda_exec_cb |= plist->entry.insn_translate(env, pc);
+        bool requested;
+        PANDA_CB_INVOKE(plist, requested = plist->entry.insn_translate(env, pc));
+        if (requested) {
+            // the TB now carries instrumentation owned by this plugin
+            panda_tb_translation_tags |= plist->tb_tag;
+            panda_exec_cb = true;
+        }
     }
     return panda_exec_cb;
 }
@@ -145,9 +181,14 @@ bool panda_callbacks_insn_translate(CPUState *env, target_ulong pc) {
 bool panda_callbacks_after_insn_translate(CPUState *env, target_ulong pc) {
     panda_cb_list *plist;
     bool panda_exec_cb = false;
-    for(plist = panda_cbs[PANDA_CB_AFTER_INSN_TRANSLATE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_AFTER_INSN_TRANSLATE); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        panda_exec_cb |= plist->entry.after_insn_translate(env, pc);
+        bool requested;
+        PANDA_CB_INVOKE(plist, requested = plist->entry.after_insn_translate(env, pc));
+        if (requested) {
+            panda_tb_translation_tags |= plist->tb_tag;
+            panda_exec_cb = true;
+        }
     }
     return panda_exec_cb;
 }
@@ -173,17 +214,15 @@ void panda_callbacks_before_mem_read(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      void *ram_ptr) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_BEFORE_READ); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
-                                          data_size);
+        PANDA_CB_INVOKE(plist, plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr, data_size));
     }
     if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]; plist != NULL;
+        for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_BEFORE_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_before_read(env, env->panda_guest_pc, paddr,
-                                              data_size);
+            PANDA_CB_INVOKE(plist, plist->entry.phys_mem_before_read(env, env->panda_guest_pc, paddr, data_size));
         }
     }
 }
@@ -193,17 +232,15 @@ void panda_callbacks_after_mem_read(CPUState *env, target_ulong pc,
                                     target_ulong addr, uint32_t data_size,
                                     uint64_t result, void *ram_ptr) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_AFTER_READ); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
-                                         data_size, &result);
+        PANDA_CB_INVOKE(plist, plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr, data_size, &result));
     }
     if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]; plist != NULL;
+        for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_AFTER_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr,
-                                             data_size, &result);
+            PANDA_CB_INVOKE(plist, plist->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr, data_size, &result));
         }
     }
 }
@@ -213,17 +250,15 @@ void panda_callbacks_before_mem_write(CPUState *env, target_ulong pc,
                                       target_ulong addr, uint32_t data_size,
                                       uint64_t val, void *ram_ptr) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_BEFORE_WRITE); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
-                                           data_size, &val);
+        PANDA_CB_INVOKE(plist, plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr, data_size, &val));
     }
     if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]; plist != NULL;
+        for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_BEFORE_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr,
-                                               data_size, &val);
+            PANDA_CB_INVOKE(plist, plist->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr, data_size, &val));
         }
     }
 }
@@ -233,17 +268,15 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      uint64_t val, void *ram_ptr) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_AFTER_WRITE); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
-                                          data_size, &val);
+        PANDA_CB_INVOKE(plist, plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr, data_size, &val));
     }
     if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]; plist != NULL;
+        for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_AFTER_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr,
-                                              data_size, &val);
+            PANDA_CB_INVOKE(plist, plist->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr, data_size, &val));
         }
     }
 }
@@ -252,43 +285,47 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
 // vl.c
 void panda_callbacks_after_machine_init(void) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_AFTER_MACHINE_INIT]; plist != NULL;
+    rcu_read_lock();
+    for(plist = panda_cb_list_first(PANDA_CB_AFTER_MACHINE_INIT); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.after_machine_init(first_cpu);
+        PANDA_CB_INVOKE(plist, plist->entry.after_machine_init(first_cpu));
     }
+    rcu_read_unlock();
 }
 
 void panda_callbacks_top_loop(void) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_TOP_LOOP]; plist != NULL;
+    rcu_read_lock();
+    for(plist = panda_cb_list_first(PANDA_CB_TOP_LOOP); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.top_loop(first_cpu);
+        PANDA_CB_INVOKE(plist, plist->entry.top_loop(first_cpu));
     }
+    rcu_read_unlock();
 }
 
 
 // target-i386/misc_helpers.c
 void panda_callbacks_cpuid(CPUState *env) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_GUEST_HYPERCALL]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.guest_hypercall(env);
+    for(plist = panda_cb_list_first(PANDA_CB_GUEST_HYPERCALL); plist != NULL; plist = panda_cb_list_next(plist)) {
+        PANDA_CB_INVOKE(plist, plist->entry.guest_hypercall(env));
     }
 }
 
 
 void panda_callbacks_cpu_restore_state(CPUState *env, TranslationBlock *tb) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_CPU_RESTORE_STATE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_CPU_RESTORE_STATE); plist != NULL;
         plist = panda_cb_list_next(plist)) {
-        plist->entry.cb_cpu_restore_state(env, tb);
+        PANDA_CB_INVOKE(plist, plist->entry.cb_cpu_restore_state(env, tb));
     }
 }
 
 
 void panda_callbacks_asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid) {
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_ASID_CHANGED]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.asid_changed(env, old_asid, new_asid);
+    for(plist = panda_cb_list_first(PANDA_CB_ASID_CHANGED); plist != NULL; plist = panda_cb_list_next(plist)) {
+        PANDA_CB_INVOKE(plist, plist->entry.asid_changed(env, old_asid, new_asid));
     }
 }
 
@@ -31,18 +31,57 @@ PANDAENDCOMMENT */
 #endif
 
 #include "panda/common.h"
+#include "panda/profile.h"
+#include "qemu/atomic.h"
+#include "qemu/host-utils.h"
+#include "qemu/rcu.h"
+#include "qemu/thread.h"
+#include "qemu/timer.h"
 
 const gchar *panda_bool_true_strings[] =  {"y", "yes", "true", "1", NULL};
 const gchar *panda_bool_false_strings[] = {"n", "no", "false", "0", NULL};
 
-#if 0
-###########################################################
-WARNING: This is all gloriously thread-unsafe!!!
-###########################################################
-#endif
+/*
+ * The callback lists are walked without locking by every thread that
+ * dispatches callbacks, so they are RCU-protected:
+ *  - readers must be inside an RCU read-side critical section and use
+ *    panda_cb_list_first()/panda_cb_list_next(). cpu_exec() already holds
+ *    the read lock for vCPU threads.
+ *  - writers (registration, enable/disable, unregistration) serialize on
+ *    panda_cb_lock and publish links with atomic_rcu_set().
+ *  - unlinked nodes, and the plugins that own them, are only released
+ *    after a grace period, so a concurrent walk never lands in freed memory
+ *    or unmapped code.
+ */
 
 // Array of pointers to PANDA callback lists, one per callback type
 panda_cb_list *panda_cbs[PANDA_CB_LAST];
+static QemuMutex panda_cb_lock;
+
+// Pending selective TB invalidations, guarded by panda_tb_inv_lock
+typedef enum panda_tb_inv_kind {
+    PANDA_TB_INV_PC_RANGE,
+    PANDA_TB_INV_ASID,
+    PANDA_TB_INV_TAGS,
+} panda_tb_inv_kind;
+
+typedef struct panda_tb_inv {
+    panda_tb_inv_kind kind;
+    target_ulong start;     // pc range start, or asid
+    target_ulong end;
+    uint64_t tags;
+} panda_tb_inv;
+
+#define MAX_PANDA_TB_INVS 32
+
+static QemuMutex panda_tb_inv_lock;
+static panda_tb_inv panda_tb_invs[MAX_PANDA_TB_INVS];
+static int nb_panda_tb_invs = 0;
+
+static void __attribute__((__constructor__)) panda_cb_lock_init(void) {
+    qemu_mutex_init(&panda_cb_lock);
+    qemu_mutex_init(&panda_tb_inv_lock);
+}
 
 // Storage for command line options
 const gchar *panda_argv[MAX_PANDA_PLUGIN_ARGS];
@@ -59,6 +98,8 @@ int nb_panda_plugins_loaded = 0;
 char *panda_plugins_loaded[MAX_PANDA_PLUGINS];
 
 bool panda_please_flush_tb = false;
+uint64_t panda_active_tb_tags = 0;
+static uint64_t panda_used_tb_tags = 0;
 bool panda_update_pc = false;
 bool panda_use_memcb = false;
 bool panda_tb_chaining = true;
@@ -80,6 +121,38 @@ bool panda_add_arg(const char *plugin_name, const char *plugin_arg) {
 // Forward declaration
 static void panda_args_set_help_wanted(const char *);
 
+typedef struct panda_plugin_release {
+    struct rcu_head rcu;
+    void *plugin;
+} panda_plugin_release;
+
+static void panda_plugin_release_rcu(panda_plugin_release *r) {
+    dlclose(r->plugin);
+    g_free(r);
+}
+
+/*
+ * Internal: dlclose a plugin once no thread can still be running its code.
+ *
+ * Unloading is normally done from a vCPU thread, inside the read-side
+ * critical section of cpu_exec(), so we can't wait for the grace period
+ * here with synchronize_rcu(). The RCU thread closes the handle instead,
+ * after freeing the plugin's callback list nodes (call_rcu is FIFO).
+ */
+static void panda_plugin_release_deferred(void *plugin) {
+    panda_plugin_release *r = g_new0(panda_plugin_release, 1);
+    r->plugin = plugin;
+    call_rcu(r, panda_plugin_release_rcu, rcu);
+}
+
+// Internal: remove a plugin from the global array
+static void panda_delete_plugin(int i) {
+    if (i != nb_panda_plugins - 1) { // not the last element
+        memmove(&panda_plugins[i], &panda_plugins[i+1], (nb_panda_plugins - i - 1)*sizeof(panda_plugin));
+    }
+    nb_panda_plugins--;
+}
+
 bool panda_load_plugin(const char *filename, const char *plugin_name) {
     // don't load the same plugin twice
     uint32_t i;
@@ -118,6 +191,7 @@ bool panda_load_plugin(const char *filename, const char *plugin_name) {
         strncpy(panda_plugins[nb_panda_plugins].name, pn, 256);
         g_free(pn);
     }
+    panda_plugins[nb_panda_plugins].tb_tag = panda_alloc_tb_tag();
     nb_panda_plugins++;
 
     // Call init_fn and check status.
@@ -130,7 +204,22 @@ bool panda_load_plugin(const char *filename, const char *plugin_name) {
         fprintf(stderr, "======              ========                ========        ===========\n");
     }
     if(!init_fn(plugin) || panda_plugin_load_failed) {
-        dlclose(plugin);
+        // init_fn may have registered callbacks before failing
+        panda_unregister_callbacks(plugin);
+        // plugins it required while initializing come after it in the array
+        int j;
+        for (j = nb_panda_plugins - 1; j >= 0; j--) {
+            if (panda_plugins[j].plugin == plugin) {
+                uint64_t tb_tag = panda_plugins[j].tb_tag;
+                if (tb_tag) {
+                    panda_invalidate_tbs_tags(tb_tag);
+                    panda_free_tb_tag(tb_tag);
+                }
+                panda_delete_plugin(j);
+                break;
+            }
+        }
+        panda_plugin_release_deferred(plugin);
         return false;
     }
     return true;
@@ -173,14 +262,6 @@ void panda_require(const char *plugin_name) {
 
     
 
-// Internal: remove a plugin from the global array
-static void panda_delete_plugin(int i) {
-    if (i != nb_panda_plugins - 1) { // not the last element
-        memmove(&panda_plugins[i], &panda_plugins[i+1], (nb_panda_plugins - i - 1)*sizeof(panda_plugin));
-    }
-    nb_panda_plugins--;
-}
-
 void panda_do_unload_plugin(int plugin_idx){
     void *plugin = panda_plugins[plugin_idx].plugin;
     void (*uninit_fn)(void *) = dlsym(plugin, "uninit_plugin");
@@ -190,9 +271,21 @@ void panda_do_unload_plugin(int plugin_idx){
     else {
         uninit_fn(plugin);
     }
+    // Counters live in the callback list and go away with it.
+    if (panda_profiling) {
+        fprintf(stderr, PANDA_MSG_FMT "profile for unloaded plugin %s\n",
+                PANDA_CORE_NAME, panda_plugins[plugin_idx].name);
+        panda_profile_dump(stderr, plugin);
+    }
     panda_unregister_callbacks(plugin);
+    // Drop the instrumentation the plugin left in the code cache
+    uint64_t tb_tag = panda_plugins[plugin_idx].tb_tag;
+    if (tb_tag) {
+        panda_invalidate_tbs_tags(tb_tag);
+        panda_free_tb_tag(tb_tag);
+    }
     panda_delete_plugin(plugin_idx);
-    dlclose(plugin);
+    panda_plugin_release_deferred(plugin);
 }
 
 void panda_unload_plugin(void* plugin) {
@@ -245,19 +338,45 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     new_list->entry = cb;
     new_list->owner = plugin;
     new_list->enabled = true;
-
-    if(panda_cbs[type] != NULL) {
-        for(panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
-            // the same plugin can register the same callback function only once
-            assert(!(plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr));
-            plist_last = plist;
+    for (int i = 0; i < nb_panda_plugins; i++) {
+        if (panda_plugins[i].plugin == plugin) {
+            new_list->tb_tag = panda_plugins[i].tb_tag;
+            break;
         }
-        plist_last->next = new_list;
-        new_list->prev = plist_last;
     }
-    else {
-        panda_cbs[type] = new_list;
+
+    qemu_mutex_lock(&panda_cb_lock);
+    for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
+        // the same plugin can register the same callback function only once
+        assert(!(plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr));
+        plist_last = plist;
+    }
+    new_list->prev = plist_last;
+    // new_list is fully initialized before it becomes reachable
+    if (plist_last != NULL) {
+        atomic_rcu_set(&plist_last->next, new_list);
+    } else {
+        atomic_rcu_set(&panda_cbs[type], new_list);
+    }
+    qemu_mutex_unlock(&panda_cb_lock);
+}
+
+// Internal: sets the enabled flag of a registered callback
+static void panda_set_callback_enabled(void *plugin, panda_cb_type type, panda_cb cb, bool enabled) {
+    bool found = false;
+    qemu_mutex_lock(&panda_cb_lock);
+    for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
+        if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
+            found = true;
+            atomic_set(&plist->enabled, enabled);
+
+            // break out of the loop - the same plugin can register the same callback only once
+            break;
+        }
     }
+    qemu_mutex_unlock(&panda_cb_lock);
+    // no callback found to enable/disable
+    assert(found);
 }
 
 /**
@@ -270,20 +389,7 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  * @note Disabling an unregistered callback will trigger an assertion error.
  */
 void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
-    bool found = false;
-    if (panda_cbs[type] != NULL) {
-        for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
-            if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
-                found = true;
-                plist->enabled = false;
-
-                // break out of the loop - the same plugin can register the same callback only once
-                break;
-            }
-        }
-    }
-    // no callback found to disable
-    assert(found);
+    panda_set_callback_enabled(plugin, type, cb, false);
 }
 
 /**
@@ -296,20 +402,7 @@ void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  * @note Enabling an unregistered callback will trigger an assertion error.
  */
 void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
-    bool found = false;
-    if (panda_cbs[type] != NULL) {
-        for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
-            if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
-                found = true;
-                plist->enabled = true;
-
-                // break out of the loop - the same plugin can register the same callback only once
-                break;
-            }
-        }
-    }
-    // no callback found to enable
-    assert(found);
+    panda_set_callback_enabled(plugin, type, cb, true);
 }
 
 /**
@@ -318,39 +411,44 @@ void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  * The register callbacks are removed from their respective callback lists.
  * This means that if they are registered again, their execution order may be
  * different.
+ *
+ * Unlinked entries are freed after an RCU grace period: a thread that is
+ * currently walking the list may still be on one of them, and its next
+ * pointer is left intact so that the walk can continue.
  */
 void panda_unregister_callbacks(void *plugin) {
+    qemu_mutex_lock(&panda_cb_lock);
     for (int i = 0; i < PANDA_CB_LAST; i++) {
-        panda_cb_list *plist;
-        plist = panda_cbs[i];
-        bool done = false;
-        panda_cb_list *plist_head = plist;
-        while (!done && plist != NULL) {
+        panda_cb_list *plist = panda_cbs[i];
+        while (plist != NULL) {
             panda_cb_list *plist_next = plist->next;
             if (plist->owner == plugin) {
-                // delete this entry -- it belongs to our plugin
-                panda_cb_list *del_plist = plist;
-                if (plist->next == NULL && plist->prev == NULL) {
-                    // its the only thing in the list -- list is now empty
-                    plist_head = NULL;
-                }
-                else {
-                    // Unlink this entry
-                    if (plist->prev) plist->prev->next = plist->next;
-                    if (plist->next) plist->next->prev = plist->prev;
-                    // new head
-                    if (plist == plist_head) plist_head = plist->next;
+                // Unlink this entry -- it belongs to our plugin
+                if (plist->prev) {
+                    atomic_rcu_set(&plist->prev->next, plist->next);
+                } else {
+                    atomic_rcu_set(&panda_cbs[i], plist->next);
                 }
-                // Free the entry we just unlinked
-                g_free(del_plist);
-                // there should only be one callback in list for this plugin so done
-                done = true;
+                if (plist->next) plist->next->prev = plist->prev;
+                g_free_rcu(plist, rcu);
             }
             plist = plist_next;
         }
-        // update head
-        panda_cbs[i] = plist_head;
     }
+    qemu_mutex_unlock(&panda_cb_lock);
+}
+
+// Internal: sets the enabled flag of all callbacks owned by a plugin
+static void panda_set_plugin_enabled(void *plugin, bool enabled) {
+    qemu_mutex_lock(&panda_cb_lock);
+    for (int i = 0; i < PANDA_CB_LAST; i++) {
+        for (panda_cb_list *plist = panda_cbs[i]; plist != NULL; plist = plist->next) {
+            if (plist->owner == plugin) {
+                atomic_set(&plist->enabled, enabled);
+            }
+        }
+    }
+    qemu_mutex_unlock(&panda_cb_lock);
 }
 
 /**
@@ -361,16 +459,7 @@ void panda_unregister_callbacks(void *plugin) {
  * is preserved.
  */
 void panda_enable_plugin(void *plugin) {
-    for (int i = 0; i < PANDA_CB_LAST; i++) {
-        panda_cb_list *plist;
-        plist = panda_cbs[i];
-        while(plist != NULL) {
-            if (plist->owner == plugin) {
-                plist->enabled = true;
-            }
-            plist = plist->next;
-        }
-    }
+    panda_set_plugin_enabled(plugin, true);
 }
 
 /**
@@ -381,26 +470,32 @@ void panda_enable_plugin(void *plugin) {
  * is preserved.
  */
 void panda_disable_plugin(void *plugin) {
-    for (int i = 0; i < PANDA_CB_LAST; i++) {
-        panda_cb_list *plist;
-        plist = panda_cbs[i];
-        while(plist != NULL) {
-            if (plist->owner == plugin) {
-                plist->enabled = false;
-            }
-            plist = plist->next;
-        }
+    panda_set_plugin_enabled(plugin, false);
+}
+
+// Internal: first enabled callback at or after node
+static inline panda_cb_list *panda_cb_list_skip_disabled(panda_cb_list *node) {
+    while (node != NULL && !atomic_read(&node->enabled)) {
+        node = atomic_rcu_read(&node->next);
     }
+    return node;
+}
+
+/**
+ * @brief Returns the first enabled callback of the given type, or NULL.
+ *
+ * Must be called inside an RCU read-side critical section, which has to
+ * be held until the walk with panda_cb_list_next() is over.
+ */
+panda_cb_list* panda_cb_list_first(panda_cb_type type) {
+    return panda_cb_list_skip_disabled(atomic_rcu_read(&panda_cbs[type]));
 }
 
 /**
  * @brief Allows to navigate the callback linked list skipping disabled callbacks.
  */
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist) {
-    for (panda_cb_list* node = plist->next; plist != NULL; plist = plist->next) {
-        if (!node || node->enabled) return node;
-    }
-    return NULL;
+    return panda_cb_list_skip_disabled(atomic_rcu_read(&plist->next));
 }
 
 bool panda_flush_tb(void) {
@@ -415,6 +510,120 @@ void panda_do_flush_tb(void) {
     panda_please_flush_tb = true;
 }
 
+// Internal: queue a selective invalidation, falling back to a full flush
+static void panda_queue_tb_inv(panda_tb_inv *inv) {
+    qemu_mutex_lock(&panda_tb_inv_lock);
+    if (nb_panda_tb_invs < MAX_PANDA_TB_INVS) {
+        panda_tb_invs[nb_panda_tb_invs] = *inv;
+        atomic_set(&nb_panda_tb_invs, nb_panda_tb_invs + 1);
+    } else {
+        panda_do_flush_tb();
+    }
+    qemu_mutex_unlock(&panda_tb_inv_lock);
+}
+
+/**
+ * @brief Requests invalidation of the TBs overlapping the guest PC range
+ * [start, end).
+ *
+ * Use this instead of `panda_do_flush_tb` when a change in instrumentation
+ * only affects some code, e.g. a function whose instructions should now be
+ * instrumented.
+ */
+void panda_invalidate_tbs_pc_range(target_ulong start, target_ulong end) {
+    panda_tb_inv inv = { .kind = PANDA_TB_INV_PC_RANGE, .start = start, .end = end };
+    panda_queue_tb_inv(&inv);
+}
+
+/**
+ * @brief Requests invalidation of the TBs translated in the given address space.
+ */
+void panda_invalidate_tbs_asid(target_ulong asid) {
+    panda_tb_inv inv = { .kind = PANDA_TB_INV_ASID, .start = asid };
+    panda_queue_tb_inv(&inv);
+}
+
+/**
+ * @brief Requests invalidation of the TBs carrying any of the given tags.
+ */
+void panda_invalidate_tbs_tags(uint64_t tags) {
+    if (tags == 0) return;
+    panda_tb_inv inv = { .kind = PANDA_TB_INV_TAGS, .tags = tags };
+    panda_queue_tb_inv(&inv);
+}
+
+static bool panda_tb_inv_match(TranslationBlock *tb, void *opaque) {
+    GArray *invs = opaque;
+    for (int i = 0; i < invs->len; i++) {
+        panda_tb_inv *inv = &g_array_index(invs, panda_tb_inv, i);
+        switch (inv->kind) {
+        case PANDA_TB_INV_PC_RANGE:
+            if (tb->pc < inv->end && tb->pc + tb->size > inv->start) return true;
+            break;
+        case PANDA_TB_INV_ASID:
+            if (tb->panda_asid == inv->start) return true;
+            break;
+        case PANDA_TB_INV_TAGS:
+            if (tb->panda_tags & inv->tags) return true;
+            break;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Carries out (or, if apply is false, drops) the pending selective
+ * invalidations. Called before the next TB lookup; must not be called with
+ * tb_lock held.
+ */
+void panda_do_invalidate_tbs(bool apply) {
+    if (likely(atomic_read(&nb_panda_tb_invs) == 0)) return;
+
+    GArray *invs = g_array_new(false, false, sizeof(panda_tb_inv));
+    qemu_mutex_lock(&panda_tb_inv_lock);
+    g_array_append_vals(invs, panda_tb_invs, nb_panda_tb_invs);
+    atomic_set(&nb_panda_tb_invs, 0);
+    qemu_mutex_unlock(&panda_tb_inv_lock);
+
+    if (apply) {
+        tb_lock();
+        tb_invalidate_filtered(panda_tb_inv_match, invs);
+        tb_unlock();
+    }
+    g_array_free(invs, true);
+}
+
+/**
+ * @brief Allocates an unused TB tag (a single bit). Returns 0 if all the
+ * tags are in use.
+ */
+uint64_t panda_alloc_tb_tag(void) {
+    if (panda_used_tb_tags == UINT64_MAX) return 0;
+    uint64_t tag = 1ULL << ctz64(~panda_used_tb_tags);
+    panda_used_tb_tags |= tag;
+    return tag;
+}
+
+void panda_free_tb_tag(uint64_t tag) {
+    panda_active_tb_tags &= ~tag;
+    panda_used_tb_tags &= ~tag;
+}
+
+/**
+ * @brief Tags all TBs translated from now on, until the tags are deactivated.
+ *
+ * A plugin that changes how code is translated (e.g. with an LLVM pass) can
+ * activate a tag while doing so, and later call `panda_invalidate_tbs_tags`
+ * to retranslate only the affected TBs.
+ */
+void panda_activate_tb_tags(uint64_t tags) {
+    panda_active_tb_tags |= tags;
+}
+
+void panda_deactivate_tb_tags(uint64_t tags) {
+    panda_active_tb_tags &= ~tags;
+}
+
 void panda_enable_precise_pc(void) {
     panda_update_pc = true;
 }
@@ -960,9 +1169,11 @@ void hmp_panda_list_plugins(Monitor *mon, const QDict *qdict) {
 void hmp_panda_plugin_cmd(Monitor *mon, const QDict *qdict) {
     panda_cb_list *plist;
     const char *cmd = qdict_get_try_str(qdict, "cmd");
-    for(plist = panda_cbs[PANDA_CB_MONITOR]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.monitor(mon, cmd);
+    rcu_read_lock();
+    for(plist = panda_cb_list_first(PANDA_CB_MONITOR); plist != NULL; plist = panda_cb_list_next(plist)) {
+        PANDA_CB_INVOKE(plist, plist->entry.monitor(mon, cmd));
     }
+    rcu_read_unlock();
 }
 
 #endif // CONFIG_SOFTMMU
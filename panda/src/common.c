@@ -8,6 +8,9 @@
 #include "panda/common.h"
 #include "panda/plog.h"
 #include "panda/plog-cc-bridge.h"
+#include "panda/profile.h"
+
+#include "exec/ram_addr.h"
 
 target_ulong panda_current_pc(CPUState *cpu) {
     target_ulong pc, cs_base;
@@ -240,6 +243,76 @@ int panda_physical_memory_rw(hwaddr addr, uint8_t *buf, int len, int is_write) {
 }
 
 
+/*
+  Generation counter for host pointers handed out by panda_*_memory_ptr().
+  It is bumped whenever the guest physical memory map is recomputed (RAM
+  hotplug, remapping of PCI BARs, etc.) and when RAM pages are discarded
+  by the balloon. The listener is only registered the first time a plugin
+  asks for a host pointer, so plain replays pay nothing for it.
+*/
+static uint64_t panda_ram_map_gen = 1;
+static bool panda_ram_map_listening = false;
+
+static void panda_ram_map_commit(MemoryListener *listener) {
+    atomic_inc(&panda_ram_map_gen);
+}
+
+static MemoryListener panda_ram_map_listener = {
+    .commit = panda_ram_map_commit,
+};
+
+static inline void panda_ram_map_listen(void) {
+    if (unlikely(!panda_ram_map_listening)) {
+        panda_ram_map_listening = true;
+        memory_listener_register(&panda_ram_map_listener, &address_space_memory);
+    }
+}
+
+uint64_t panda_ram_map_generation(void) {
+    panda_ram_map_listen();
+    return atomic_read(&panda_ram_map_gen);
+}
+
+void panda_ram_map_invalidate(void) {
+    atomic_inc(&panda_ram_map_gen);
+}
+
+uint8_t *panda_physical_memory_ptr(hwaddr addr, hwaddr *plen, int is_write) {
+    hwaddr addr1;
+    MemoryRegion *mr;
+    uint8_t *ram_ptr = NULL;
+
+    panda_ram_map_listen();
+    rcu_read_lock();
+    mr = address_space_translate(&address_space_memory, addr, &addr1, plen,
+                                 is_write);
+    // Only RAM can be accessed directly. Never hand out pointers to MMIO.
+    if (memory_access_is_direct(mr, is_write)) {
+        // Clamp the length to the RAMBlock backing the region.
+        *plen = MIN(*plen, mr->ram_block->used_length - addr1);
+        ram_ptr = qemu_map_ram_ptr(mr->ram_block, addr1);
+    } else {
+        *plen = 0;
+    }
+    rcu_read_unlock();
+    return ram_ptr;
+}
+
+uint8_t *panda_virtual_memory_ptr(CPUState *env, target_ulong addr,
+                                  hwaddr *plen, int is_write) {
+    hwaddr phys_addr = panda_virt_to_phys(env, addr);
+    if (phys_addr == -1) {
+        *plen = 0;
+        return NULL;
+    }
+    // Contiguous guest virtual pages need not be contiguous in RAM.
+    hwaddr l = (addr | ~TARGET_PAGE_MASK) - addr + 1;
+    if (*plen > l) {
+        *plen = l;
+    }
+    return panda_physical_memory_ptr(phys_addr, plen, is_write);
+}
+
 hwaddr panda_virt_to_phys(CPUState *env, target_ulong addr){
     target_ulong page;
     hwaddr phys_addr;
@@ -294,6 +367,11 @@ int panda_virtual_memory_write(CPUState *env, target_ulong addr,
 
 
 void panda_cleanup(void) {
+    if (panda_profiling) {
+        fprintf(stderr, PANDA_MSG_FMT "callback profile\n", PANDA_CORE_NAME);
+        panda_profile_dump(stderr, NULL);
+        panda_disable_profiling();
+    }
     // PANDA: unload plugins
     panda_unload_plugins();
     if (pandalog) {
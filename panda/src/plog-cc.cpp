@@ -3,9 +3,20 @@
 #include <math.h>
 #include <fstream>
 #include <memory>
+#include <string>
+#include <sstream>
+#include "config-host.h"
 #include "panda/plog-cc.hpp"
 #include "panda/plog-cc-bridge.h"
 
+#ifdef CONFIG_ZSTD
+#include <zstd.h>
+#endif
+#ifdef CONFIG_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+
 using namespace std; 
 
 extern int panda_in_main_loop;
@@ -17,6 +28,7 @@ void PandaLog::create(uint32_t chunk_size) {
     // the invariant that all log entries for an instruction reside in same
     // chunk.  this should be big enough but don't worry, we'll be monitoring it.
     this->chunk.buf = (unsigned char *) malloc(this->chunk.size);
+    this->chunk.buf_size = this->chunk.size;
     this->chunk.buf_p = this->chunk.buf;
     this->chunk.zbuf = (unsigned char *) malloc(this->chunk.zsize);
     this->chunk.start_pos = PL_HEADER_SIZE;
@@ -28,6 +40,15 @@ void PandaLog::read_dir(){
     PlHeader *plh = read_header();
 
     printf("Header: version: %u dir_pos: %lu chunk_size: %u\n", plh->version, plh->dir_pos, plh->chunk_size);
+
+    if (plh->version < 3) {
+        // codec and level were not recorded, everything was zlib
+        plh->codec = PL_CODEC_ZLIB;
+        plh->level = PL_Z_LEVEL;
+    }
+    this->codec = (PlCodec) plh->codec;
+    this->level = plh->level;
+    printf("Codec: %u level: %d\n", plh->codec, plh->level);
     
     this->chunk.size = plh->chunk_size;
     this->chunk.zsize = plh->chunk_size;
@@ -60,18 +81,47 @@ void PandaLog::read_dir(){
         printf("i: %d dirinstr: %lu dirpos: %lu dir.num_entries: %lu\n", i, dir.instr[i], dir.pos[i], dir.num_entries[i]);
     }
 
-    // a little hack so unmarshall_chunk will work
-    this->dir.pos[num_chunks] = plh->dir_pos;
+    // a little hack so unmarshall_chunk will work: the last chunk ends
+    // where the directory starts
+    this->dir.pos.push_back(plh->dir_pos);
+    delete plh;
 }
 
 PlHeader* PandaLog::read_header(){
     PlHeader *plh = new PlHeader();
+    // NB: version 2 headers are shorter, the rest of the header area is zero
     this->file->read((char *)plh, sizeof(PlHeader));
     assert(this->file->gcount() == sizeof(PlHeader));
     
     return plh;
 }
 
+bool PandaLog::set_compression(PlCodec codec, int level, uint32_t num_threads){
+    if (this->pipe_started) {
+        printf("pandalog compression can't be changed after the first chunk\n");
+        return false;
+    }
+    switch (codec) {
+    case PL_CODEC_ZLIB:
+        break;
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD:
+        break;
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4:
+        break;
+#endif
+    default:
+        printf("pandalog codec %d is not supported by this build\n", codec);
+        return false;
+    }
+    this->codec = codec;
+    this->level = level;
+    this->num_threads = num_threads;
+    return true;
+}
+
 
 void PandaLog::open_read(const char * fname, PlMode mode){
     std::fstream *plog_file = new fstream();
@@ -209,13 +259,16 @@ void PandaLog::write_dir(){
 
     //create header
     PlHeader plh;
+    memset(&plh, 0, sizeof(plh));
     plh.version = PL_CURRENT_VERSION;
     
     plh.dir_pos = this->file->tellp();
     plh.chunk_size = this->chunk.size;
+    plh.codec = this->codec;
+    plh.level = this->level;
 
-    printf("header: version=%d  dir_pos=%lu chunk_size=%d\n",
-            plh.version, plh.dir_pos, plh.chunk_size);
+    printf("header: version=%d  dir_pos=%lu chunk_size=%d codec=%u level=%d\n",
+            plh.version, plh.dir_pos, plh.chunk_size, plh.codec, plh.level);
 
     // now go ahead and write dir where we are in logfile
     this->file->write((char*) &num_chunks, sizeof(num_chunks));
@@ -227,22 +280,31 @@ void PandaLog::write_dir(){
         this->file->write((char*) &this->dir.num_entries[i], sizeof(this->dir.num_entries[i]));
     }
 
+    // chunk index goes right after the directory
+    plh.index_pos = this->file->tellp();
+    this->file->write((char*) &num_chunks, sizeof(num_chunks));
+    this->file->write((char*) this->index.data(), num_chunks * sizeof(PlChunkIndex));
+
     write_header(&plh);
 }
 
+// Called with pipe_lock held once the pipeline is running: the writer
+// thread fills in dir.pos as chunks reach the file.
 void PandaLog::add_dir_entry(){
     // this is start instr and start file position for this chunk
     this->dir.instr.push_back(this->chunk.start_instr);
     this->dir.pos.push_back(this->chunk.start_pos);
     // and this is the number of entries in this chunk
     this->dir.num_entries.push_back(this->chunk.ind_entry);
+    this->index.push_back(PlChunkIndex());
 }
 
 int PandaLog::close(){
 
     if (this->mode == PL_MODE_WRITE){
         write_current_chunk();
-        add_dir_entry();
+        // wait for all chunks to be on disk before the directory goes in
+        stop_pipeline();
         write_dir();
     }
 
@@ -250,42 +312,174 @@ int PandaLog::close(){
     return 0;
 }
 
-// compress current chunk and write it to file,
+void PandaLog::compress_job(PandalogCcJob *job){
+#ifndef PLOG_READER
+    // indexing is done here to keep it off the emulation thread
+    pandalog_index_chunk(job->buf, job->size, &job->index);
+
+    switch (this->codec) {
+    case PL_CODEC_ZLIB: {
+        unsigned long ccs = compressBound(job->size);
+        job->zbuf.resize(ccs);
+        int ret = compress2(job->zbuf.data(), &ccs, job->buf, job->size, this->level);
+        assert(ret == Z_OK);
+        job->zbuf.resize(ccs);
+        break;
+    }
+#ifdef CONFIG_ZSTD
+    case PL_CODEC_ZSTD: {
+        size_t ccs = ZSTD_compressBound(job->size);
+        job->zbuf.resize(ccs);
+        ccs = ZSTD_compress(job->zbuf.data(), ccs, job->buf, job->size, this->level);
+        assert(!ZSTD_isError(ccs));
+        job->zbuf.resize(ccs);
+        break;
+    }
+#endif
+#ifdef CONFIG_LZ4
+    case PL_CODEC_LZ4: {
+        int ccs = LZ4_compressBound(job->size);
+        job->zbuf.resize(ccs);
+        ccs = LZ4_compress_HC((const char *) job->buf, (char *) job->zbuf.data(),
+                              job->size, ccs, this->level);
+        assert(ccs > 0);
+        job->zbuf.resize(ccs);
+        break;
+    }
+#endif
+    default:
+        assert(false && "Unsupported pandalog codec");
+    }
+#endif
+}
+
+void PandaLog::write_job(PandalogCcJob *job){
+    uint64_t pos = this->file->tellp();
+    this->file->write((char *) job->zbuf.data(), job->zbuf.size());
+    printf("writing chunk %u of pandalog, %u / %lu = %.2f compression, %u entries\n",
+            job->chunk_num, job->size, job->zbuf.size(),
+            ((float) job->size) / job->zbuf.size(), job->num_entries);
+    if (job->num_entries == 0) {
+        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
+    }
+    std::lock_guard<std::mutex> lk(this->pipe_lock);
+    this->dir.pos[job->chunk_num] = pos;
+    this->index[job->chunk_num] = job->index;
+}
+
+void PandaLog::compressor_loop(){
+    std::unique_lock<std::mutex> lk(this->pipe_lock);
+    while (true) {
+        this->work_cv.wait(lk, [this]{
+            return !this->work_queue.empty() || this->pipe_stopping;
+        });
+        if (this->work_queue.empty()) break;
+        PandalogCcJob *job = this->work_queue.front();
+        this->work_queue.pop_front();
+        lk.unlock();
+        compress_job(job);
+        lk.lock();
+        job->done = true;
+        this->done_cv.notify_all();
+    }
+}
+
+void PandaLog::writer_loop(){
+    std::unique_lock<std::mutex> lk(this->pipe_lock);
+    while (true) {
+        // chunks may finish compressing out of order, write them in order
+        this->done_cv.wait(lk, [this]{
+            return (!this->write_queue.empty() && this->write_queue.front()->done)
+                || (this->write_queue.empty() && this->pipe_stopping);
+        });
+        if (this->write_queue.empty()) break;
+        PandalogCcJob *job = this->write_queue.front();
+        this->write_queue.pop_front();
+        lk.unlock();
+        write_job(job);
+        lk.lock();
+        this->free_bufs.push_back(std::make_pair(job->buf, job->buf_size));
+        delete job;
+        this->free_cv.notify_one();
+    }
+}
+
+void PandaLog::start_pipeline(){
+    this->pipe_started = true;
+    if (this->num_threads == 0) return;
+    // the chunk being filled
+    this->num_bufs = 1;
+    for (uint32_t i = 0; i < this->num_threads; i++) {
+        this->compressors.push_back(std::thread(&PandaLog::compressor_loop, this));
+    }
+    this->writer = std::thread(&PandaLog::writer_loop, this);
+}
+
+void PandaLog::stop_pipeline(){
+    if (!this->pipe_started || this->num_threads == 0) return;
+    {
+        std::lock_guard<std::mutex> lk(this->pipe_lock);
+        this->pipe_stopping = true;
+    }
+    this->work_cv.notify_all();
+    this->done_cv.notify_all();
+    for (auto &t : this->compressors) t.join();
+    this->writer.join();
+    this->compressors.clear();
+    for (auto &b : this->free_bufs) free(b.first);
+    this->free_bufs.clear();
+    // the spare buffer swapped in by the last write_current_chunk()
+    free(this->chunk.buf);
+    this->chunk.buf = this->chunk.buf_p = NULL;
+    this->chunk.buf_size = 0;
+    this->num_bufs = 0;
+    this->pipe_started = this->pipe_stopping = false;
+}
+
+// hand the current chunk off for compression and writing,
 // also update directory map
 void PandaLog::write_current_chunk(){
 #ifndef PLOG_READER 
-    //uncompressed chunk size
-    unsigned long chunk_sz = this->chunk.buf_p - this->chunk.buf;
-    unsigned long ccs = this->chunk.zsize;
-    int ret;
+    if (!this->pipe_started) {
+        start_pipeline();
+    }
 
-    // loop allows compress2 to fail and resize output buffer as needed
-    uint32_t i;
-    for (i=0; i<10; i++) {
-        ret = compress2(this->chunk.zbuf, &ccs, this->chunk.buf, chunk_sz, Z_BEST_COMPRESSION);
-        
-        if (ret == Z_OK) break;
-        // bigger output buffer needed to perform compression?
-        this->chunk.zsize *= 2;
-        this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.zsize);
-        assert (this->chunk.zbuf != NULL);
-    }
-
-    // ccs is final compressed chunk size
-    assert(ret == Z_OK);
-    printf("writing chunk %u of pandalog, %lu / %lu = %.2f compression, %u entries\n",
-            this->chunk_num, chunk_sz, ccs, ((float)chunk_sz) / ccs,
-            this->chunk.ind_entry);
-    if (this->chunk.ind_entry == 0) {
-        printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
+    PandalogCcJob *job = new PandalogCcJob();
+    job->chunk_num = this->chunk_num;
+    job->buf = this->chunk.buf;
+    job->buf_size = this->chunk.buf_size;
+    job->size = this->chunk.buf_p - this->chunk.buf;
+    job->num_entries = this->chunk.ind_entry;
+    job->done = false;
+
+    if (this->num_threads == 0) {
+        add_dir_entry();
+        compress_job(job);
+        write_job(job);
+        delete job;
+    } else {
+        // double buffering: keep filling a spare buffer while this one is
+        // compressed. Block if all the buffers are still in flight.
+        std::unique_lock<std::mutex> lk(this->pipe_lock);
+        add_dir_entry();
+        this->work_queue.push_back(job);
+        this->write_queue.push_back(job);
+        this->work_cv.notify_one();
+
+        if (this->free_bufs.empty() && this->num_bufs < this->num_threads + 1) {
+            this->num_bufs++;
+            this->free_bufs.push_back(std::make_pair(
+                (unsigned char *) malloc(this->chunk.size), this->chunk.size));
+        }
+        this->free_cv.wait(lk, [this]{ return !this->free_bufs.empty(); });
+        this->chunk.buf = this->free_bufs.back().first;
+        this->chunk.buf_size = this->free_bufs.back().second;
+        this->free_bufs.pop_back();
+        assert(this->chunk.buf != NULL);
     }
 
-    this->file->write((char*)this->chunk.zbuf, ccs);
-    //assert(this->)
-    add_dir_entry();
-    // reset start instr / pos
+    // reset start instr
     this->chunk.start_instr = rr_get_guest_instr_count();
-    this->chunk.start_pos = this->file->tellg();
     // rewind chunk buf and inc chunk #
     this->chunk.buf_p = this->chunk.buf;
     this->chunk_num ++;
@@ -295,87 +489,245 @@ void PandaLog::write_current_chunk(){
 
 uint64_t last_instr_entry = -1;
 
-void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
-#ifndef PLOG_READER 
+// pc and instr recorded for entries written now
+static void pandalog_prog_point(uint64_t *pc, uint64_t *instr){
+#ifndef PLOG_READER
     if (panda_in_main_loop) {
-        entry->set_pc(panda_current_pc(first_cpu));
-        entry->set_instr(rr_get_guest_instr_count());
-    }
-    else {
-        entry->set_pc(-1);
-        entry->set_instr(-1);
+        *pc = panda_current_pc(first_cpu);
+        *instr = rr_get_guest_instr_count();
+        return;
     }
+#endif
+    *pc = -1;
+    *instr = -1;
+}
 
-    size_t n = entry->ByteSize();
-
+unsigned char *PandaLog::reserve_entry(size_t n, uint64_t instr){
+#ifndef PLOG_READER 
     // invariant: all log entries for an instruction belong in a single chunk
     if(last_instr_entry != -1 
-        && (last_instr_entry != entry->instr())
+        && (last_instr_entry != instr)
         && (this->chunk.buf_p + n  >= this->chunk.buf + this->chunk.size)) {
         // if entry won't fit in current chunk
         // and new entry is a different instr from last entry written
             write_current_chunk();
     }
 
-    // create another chunk
+    // grow the chunk buffer if this entry doesn't fit
     if (this->chunk.buf_p + sizeof(uint32_t) + n
-        >= this->chunk.buf + ((int)(floor(this->chunk.size)))) {
+        >= this->chunk.buf + this->chunk.buf_size) {
 
         uint32_t offset = this->chunk.buf_p - this->chunk.buf;
-        uint32_t new_size = offset * 2;
+        uint32_t new_size = (offset + sizeof(uint32_t) + n) * 2;
         this->chunk.buf = (unsigned char *) realloc(this->chunk.buf, new_size);
+        this->chunk.buf_size = new_size;
         this->chunk.buf_p = this->chunk.buf + offset;
         assert (this->chunk.buf != NULL);
     }
 
-    // now write the entry itself to the buffer.  size then entry itself
+    // the entry goes in the buffer as its size, then the entry itself (packed)
     *((uint32_t *) this->chunk.buf_p) = n;
-    this->chunk.buf_p += sizeof(uint32_t);
-    // and then the entry itself (packed)
-    entry->SerializeToArray(this->chunk.buf_p, n);
-    this->chunk.buf_p += n;
+    unsigned char *entry_p = this->chunk.buf_p + sizeof(uint32_t);
+    this->chunk.buf_p = entry_p + n;
     // remember instr for last entry
-    last_instr_entry = entry->instr();
+    last_instr_entry = instr;
     this->chunk.ind_entry ++;
+    return entry_p;
+#else
+    return NULL;
 #endif
 }
 
-void PandaLog::unmarshall_chunk(uint32_t chunk_num){  
-    printf ("unmarshalling chunk %d\n", chunk_num);
-    PandalogCcChunk *chunk = &(this->chunk);
-    // read compressed chunk data off disk
-    this->file->seekg(this->dir.pos[chunk_num]);
+void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
+#ifndef PLOG_READER 
+    uint64_t pc, instr;
+    pandalog_prog_point(&pc, &instr);
+    entry->set_pc(pc);
+    entry->set_instr(instr);
 
-    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num] + 1;
-     this->file->read((char* ) chunk->zbuf, compressed_size);
-    assert (this->file->gcount() == compressed_size);
-    unsigned long uncompressed_size = chunk->size;
+    size_t n = entry->ByteSize();
+    entry->SerializeToArray(reserve_entry(n, instr), n);
+#endif
+}
 
-    // uncompress it
-    printf ("chunk size=%lu compressed=%lu\n", uncompressed_size, compressed_size);
+unsigned long pandalog_decompress(PlCodec codec, const unsigned char *zbuf,
+                                  unsigned long zsize, unsigned char **buf,
+                                  uint32_t *buf_size){
+    bool grow = false;
 
-    int ret;
     while (true) {
-        ret = uncompress(chunk->buf, &uncompressed_size, chunk->zbuf, compressed_size);
-
-        printf ("ret = %d\n", ret);
-
-        if (ret == Z_BUF_ERROR) {
+        if (grow) {
             // need a bigger buffer
             // make sure we won't int overflow
-            assert (chunk->size < UINT32_MAX/2);
-            chunk->size *= 2;
-            printf ("grew chunk buffer to %d\n", chunk->size);
-            free(chunk->buf);
-            chunk->buf = (unsigned char *)malloc(chunk->size);
-            chunk->buf_p = chunk->buf;
-            uncompressed_size = chunk->size;
-        } else if (ret == Z_OK) {
+            assert (*buf_size < UINT32_MAX/2);
+            *buf_size *= 2;
+            printf ("grew chunk buffer to %d\n", *buf_size);
+            free(*buf);
+            *buf = (unsigned char *)malloc(*buf_size);
+            assert (*buf != NULL);
+        }
+
+        switch (codec) {
+        case PL_CODEC_ZLIB: {
+            unsigned long uncompressed_size = *buf_size;
+            int ret = uncompress(*buf, &uncompressed_size, zbuf, zsize);
+            if (ret == Z_OK) return uncompressed_size;
+            assert(ret == Z_BUF_ERROR && "Decompression failed");
             break;
-        } else {
-            assert(false && "Decompression failed");
+        }
+#ifdef CONFIG_ZSTD
+        case PL_CODEC_ZSTD: {
+            unsigned long long content_size = ZSTD_getFrameContentSize(zbuf, zsize);
+            assert(content_size != ZSTD_CONTENTSIZE_ERROR && "Decompression failed");
+            if (content_size != ZSTD_CONTENTSIZE_UNKNOWN && content_size > *buf_size) break;
+            size_t ret = ZSTD_decompress(*buf, *buf_size, zbuf, zsize);
+            if (!ZSTD_isError(ret)) return ret;
+            assert(ZSTD_getErrorCode(ret) == ZSTD_error_dstSize_tooSmall && "Decompression failed");
+            break;
+        }
+#endif
+#ifdef CONFIG_LZ4
+        case PL_CODEC_LZ4: {
+            // lz4 can't tell a short output buffer from corrupt input
+            int ret = LZ4_decompress_safe((const char *) zbuf, (char *) *buf,
+                                          zsize, *buf_size);
+            if (ret >= 0) return ret;
+            break;
+        }
+#endif
+        default:
+            fprintf(stderr, "pandalog codec %d is not supported by this build\n", codec);
+            exit(1);
+        }
+        grow = true;
+    }
+}
+
+void PandaLog::decompress_chunk(PlCodec codec, unsigned long compressed_size){
+    PandalogCcChunk *chunk = &(this->chunk);
+    pandalog_decompress(codec, chunk->zbuf, compressed_size, &chunk->buf, &chunk->size);
+    chunk->buf_p = chunk->buf;
+}
+
+// Reads a base 128 varint, returns NULL if it runs past end
+static const unsigned char *pl_read_varint(const unsigned char *p,
+                                           const unsigned char *end,
+                                           uint64_t *val){
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        unsigned char b = *p++;
+        v |= ((uint64_t) (b & 0x7f)) << shift;
+        if (!(b & 0x80)) {
+            *val = v;
+            return p;
         }
     }
+    return NULL;
+}
+
+bool pandalog_scan_entry(const unsigned char *p, size_t n, PlEntryInfo *info){
+    const unsigned char *end = p + n;
+    memset(info, 0, sizeof(*info));
+
+    while (p < end) {
+        uint64_t key, val = 0;
+        p = pl_read_varint(p, end, &key);
+        if (!p) return false;
+        uint32_t field = key >> 3;
+        switch (key & 7) {
+        case 0:     // varint
+            p = pl_read_varint(p, end, &val);
+            if (!p) return false;
+            break;
+        case 1:     // fixed64
+            if (end - p < 8) return false;
+            memcpy(&val, p, 8);
+            p += 8;
+            break;
+        case 2: {   // length delimited
+            uint64_t len;
+            p = pl_read_varint(p, end, &len);
+            if (!p || (uint64_t) (end - p) < len) return false;
+            p += len;
+            break;
+        }
+        case 5: {   // fixed32
+            uint32_t v32;
+            if (end - p < 4) return false;
+            memcpy(&v32, p, 4);
+            val = v32;
+            p += 4;
+            break;
+        }
+        default:    // groups are not used by pandalog
+            return false;
+        }
+
+        if (field == 1) info->pc = val;
+        else if (field == 2) info->instr = val;
+        else if (field == PL_ASID_FIELD) {
+            info->asid = val;
+            info->has_asid = true;
+        }
+        uint32_t bit = field < 127 ? field : 127;
+        info->fields[bit / 64] |= 1ULL << (bit % 64);
+    }
+    return true;
+}
+
+void pandalog_index_chunk(const unsigned char *buf, size_t size, PlChunkIndex *idx){
+    const unsigned char *p = buf, *end = buf + size;
+    memset(idx, 0, sizeof(*idx));
+    idx->min_pc = idx->min_instr = UINT64_MAX;
+
+    while (p + sizeof(uint32_t) <= end) {
+        uint32_t n = *((uint32_t *) p);
+        p += sizeof(uint32_t);
+        PlEntryInfo info;
+        if (p + n > end || !pandalog_scan_entry(p, n, &info)) break;
+        p += n;
+
+        idx->num_entries++;
+        idx->fields[0] |= info.fields[0];
+        idx->fields[1] |= info.fields[1];
+        if (info.pc < idx->min_pc) idx->min_pc = info.pc;
+        if (info.pc > idx->max_pc) idx->max_pc = info.pc;
+        if (info.instr < idx->min_instr) idx->min_instr = info.instr;
+        if (info.instr > idx->max_instr) idx->max_instr = info.instr;
+        if (info.has_asid && idx->num_asids != PL_INDEX_ANY_ASID) {
+            uint32_t i;
+            for (i = 0; i < idx->num_asids; i++) {
+                if (idx->asids[i] == info.asid) break;
+            }
+            if (i == idx->num_asids) {
+                if (idx->num_asids == PL_INDEX_MAX_ASIDS) {
+                    idx->num_asids = PL_INDEX_ANY_ASID;
+                } else {
+                    idx->asids[idx->num_asids++] = info.asid;
+                }
+            }
+        }
+    }
+}
+
+void PandaLog::unmarshall_chunk(uint32_t chunk_num){  
+    printf ("unmarshalling chunk %d\n", chunk_num);
+    PandalogCcChunk *chunk = &(this->chunk);
+    // read compressed chunk data off disk
+    this->file->seekg(this->dir.pos[chunk_num]);
+
+    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num];
+    if (compressed_size > chunk->zsize) {
+        chunk->zsize = compressed_size;
+        chunk->zbuf = (unsigned char *) realloc(chunk->zbuf, chunk->zsize);
+        assert (chunk->zbuf != NULL);
+    }
+    this->file->read((char* ) chunk->zbuf, compressed_size);
+    assert (this->file->gcount() == compressed_size);
+
+    // uncompress it
+    printf ("chunk size=%u compressed=%lu\n", chunk->size, compressed_size);
+    decompress_chunk(this->codec, compressed_size);
 
     // clear previous chunk's entries 
     chunk->entries.clear();
@@ -498,6 +850,50 @@ void pandalog_cc_close(){
     globalLog.close();
 }
 
+bool pandalog_cc_set_opts(const char *opts){
+    PlCodec codec = PL_DEFAULT_CODEC;
+    int level = -1;
+    int threads = PL_COMPRESS_THREADS;
+
+    std::stringstream ss(opts);
+    std::string opt;
+    while (std::getline(ss, opt, ',')) {
+        size_t eq = opt.find('=');
+        if (eq == std::string::npos) {
+            printf("pandalog option %s: expected key=value\n", opt.c_str());
+            return false;
+        }
+        std::string key = opt.substr(0, eq);
+        std::string val = opt.substr(eq + 1);
+        if (key == "codec") {
+            if (val == "zlib") codec = PL_CODEC_ZLIB;
+            else if (val == "zstd") codec = PL_CODEC_ZSTD;
+            else if (val == "lz4") codec = PL_CODEC_LZ4;
+            else {
+                printf("unknown pandalog codec %s (expected zlib, zstd or lz4)\n", val.c_str());
+                return false;
+            }
+        } else if (key == "level") {
+            level = atoi(val.c_str());
+        } else if (key == "threads") {
+            threads = atoi(val.c_str());
+            if (threads < 0) threads = 0;
+        } else {
+            printf("unknown pandalog option %s\n", key.c_str());
+            return false;
+        }
+    }
+    if (level < 0) {
+        // the default level of each codec
+        switch (codec) {
+        case PL_CODEC_ZLIB: level = PL_Z_LEVEL; break;
+        case PL_CODEC_ZSTD: level = 3; break;
+        case PL_CODEC_LZ4:  level = 9; break;
+        }
+    }
+    return globalLog.set_compression(codec, level, threads);
+}
+
 
 // Unpack entry from buffer into C++ protobuf object
 // and write it to the log
@@ -509,6 +905,14 @@ void pandalog_write_packed(size_t entry_size, unsigned char* buf){
     globalLog.write_entry(std::move(ple));
 }
 
+void pandalog_cc_prog_point(uint64_t *pc, uint64_t *instr){
+    pandalog_prog_point(pc, instr);
+}
+
+unsigned char *pandalog_cc_reserve(size_t entry_size, uint64_t instr){
+    return globalLog.reserve_entry(entry_size, instr);
+}
+
 // Pack an entry into binary protobuf data
 // return packed data
 unsigned char* pandalog_read_packed(void){
@@ -0,0 +1,291 @@
+/**
+ *
+ * Indexed, query driven pandalog reader. See panda/plog-index.hpp.
+ *
+ */
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <google/protobuf/descriptor.h>
+#include "panda/plog-index.hpp"
+
+using namespace std;
+
+// sidecar index file header
+#define PL_SIDECAR_MAGIC 0x58494c50     // "PLIX"
+#define PL_SIDECAR_VERSION 1
+
+bool PlQuery::add_field(const std::string &name){
+    const google::protobuf::FieldDescriptor *fd =
+        panda::LogEntry::descriptor()->FindFieldByName(name);
+    if (fd == NULL) return false;
+    this->fields.push_back(fd->number());
+    return true;
+}
+
+static inline bool pl_has_field(const uint64_t *mask, uint32_t field){
+    uint32_t bit = field < 127 ? field : 127;
+    return mask[bit / 64] & (1ULL << (bit % 64));
+}
+
+bool PlQuery::chunk_may_match(const PlChunkIndex &idx) const {
+    if (idx.num_entries == 0) return false;
+    if (idx.max_pc < this->min_pc || idx.min_pc > this->max_pc) return false;
+    if (idx.max_instr < this->min_instr || idx.min_instr > this->max_instr) return false;
+    if (!this->fields.empty()) {
+        bool any = false;
+        for (uint32_t f : this->fields) {
+            if (pl_has_field(idx.fields, f)) {
+                any = true;
+                break;
+            }
+        }
+        if (!any) return false;
+    }
+    if (this->has_asid && idx.num_asids != PL_INDEX_ANY_ASID) {
+        bool any = false;
+        for (uint32_t i = 0; i < idx.num_asids; i++) {
+            if (idx.asids[i] == this->asid) {
+                any = true;
+                break;
+            }
+        }
+        if (!any) return false;
+    }
+    return true;
+}
+
+bool PlQuery::entry_matches(const PlEntryInfo &info) const {
+    if (info.pc < this->min_pc || info.pc > this->max_pc) return false;
+    if (info.instr < this->min_instr || info.instr > this->max_instr) return false;
+    if (this->has_asid && (!info.has_asid || info.asid != this->asid)) return false;
+    if (this->fields.empty()) return true;
+    for (uint32_t f : this->fields) {
+        if (pl_has_field(info.fields, f)) return true;
+    }
+    return false;
+}
+
+bool PandaLogIndexedReader::open(const char *path){
+    ifstream f(path, ios::in|ios::binary);
+    if (f.fail()) return false;
+    this->filename = path;
+
+    // NB: version 2 headers are shorter, the rest of the header area is zero
+    memset(&this->header, 0, sizeof(this->header));
+    f.read((char *) &this->header, sizeof(this->header));
+    if (f.gcount() != sizeof(this->header)) return false;
+    if (this->header.version < 3) {
+        this->header.codec = PL_CODEC_ZLIB;
+        this->header.index_pos = 0;
+    }
+
+    f.seekg(this->header.dir_pos);
+    uint32_t num_chunks;
+    f.read((char *) &num_chunks, sizeof(num_chunks));
+    if (f.gcount() != sizeof(num_chunks)) return false;
+    this->pos.clear();
+    for (uint32_t i = 0; i < num_chunks; i++) {
+        uint64_t dir_entry[3];  // instr, pos, num_entries
+        f.read((char *) dir_entry, sizeof(dir_entry));
+        if (f.gcount() != sizeof(dir_entry)) return false;
+        this->pos.push_back(dir_entry[1]);
+    }
+    // the last chunk ends where the directory starts
+    this->pos.push_back(this->header.dir_pos);
+
+    this->index.clear();
+    this->index_embedded = false;
+    if (this->header.index_pos != 0) {
+        f.seekg(this->header.index_pos);
+        uint32_t n;
+        f.read((char *) &n, sizeof(n));
+        if (f.gcount() == sizeof(n) && n == num_chunks) {
+            this->index.resize(n);
+            f.read((char *) this->index.data(), n * sizeof(PlChunkIndex));
+            if ((size_t) f.gcount() == n * sizeof(PlChunkIndex)) {
+                this->index_embedded = true;
+            } else {
+                this->index.clear();
+            }
+        }
+    }
+    return true;
+}
+
+struct PandaLogIndexedReader::ChunkResult {
+    unsigned char *buf = NULL;
+    uint32_t buf_size = 0;
+    unsigned long size = 0;
+    // offset and size of the matching entries in buf
+    std::vector<std::pair<uint32_t, uint32_t>> matches;
+
+    ~ChunkResult() { free(buf); }
+};
+
+void PandaLogIndexedReader::load_chunk(ifstream &f, uint32_t chunk,
+                                       const PlQuery *q, ChunkResult *res){
+    unsigned long zsize = this->pos[chunk + 1] - this->pos[chunk];
+    std::vector<unsigned char> zbuf(zsize);
+    f.seekg(this->pos[chunk]);
+    f.read((char *) zbuf.data(), zsize);
+    assert((unsigned long) f.gcount() == zsize);
+
+    res->buf_size = this->header.chunk_size ? this->header.chunk_size : PL_CHUNKSIZE;
+    res->buf = (unsigned char *) malloc(res->buf_size);
+    res->size = pandalog_decompress((PlCodec) this->header.codec, zbuf.data(),
+                                    zsize, &res->buf, &res->buf_size);
+    if (q == NULL) return;
+
+    const unsigned char *p = res->buf, *end = res->buf + res->size;
+    while (p + sizeof(uint32_t) <= end) {
+        uint32_t n = *((uint32_t *) p);
+        p += sizeof(uint32_t);
+        PlEntryInfo info;
+        if (p + n > end || !pandalog_scan_entry(p, n, &info)) break;
+        if (q->entry_matches(info)) {
+            res->matches.push_back(std::make_pair(p - res->buf, n));
+        }
+        p += n;
+    }
+}
+
+/*
+ * Runs work on each chunk in a pool of threads and consume on the results,
+ * in chunk order, on the calling thread. At most two results per thread are
+ * kept around. Stops early if consume returns false.
+ */
+template<typename Result, typename Work, typename Consume>
+static void pl_run_ordered(const std::string &filename,
+                           const std::vector<uint32_t> &chunks,
+                           unsigned num_threads, Work work, Consume consume){
+    if (num_threads == 0) num_threads = 1;
+    size_t window = 2 * num_threads;
+    std::mutex m;
+    std::condition_variable cv;
+    size_t next = 0, consumed = 0;
+    bool stop = false;
+    std::vector<std::unique_ptr<Result>> slots(chunks.size());
+
+    auto worker = [&]() {
+        ifstream f(filename.c_str(), ios::in|ios::binary);
+        std::unique_lock<std::mutex> lk(m);
+        while (true) {
+            cv.wait(lk, [&]{
+                return stop || next >= chunks.size() || next < consumed + window;
+            });
+            if (stop || next >= chunks.size()) break;
+            size_t i = next++;
+            lk.unlock();
+            Result *r = new Result();
+            work(f, chunks[i], r);
+            lk.lock();
+            slots[i].reset(r);
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < num_threads; t++) {
+        threads.push_back(std::thread(worker));
+    }
+    for (size_t i = 0; i < chunks.size(); i++) {
+        std::unique_ptr<Result> r;
+        {
+            std::unique_lock<std::mutex> lk(m);
+            cv.wait(lk, [&]{ return slots[i] != nullptr; });
+            r = std::move(slots[i]);
+        }
+        bool more = consume(chunks[i], *r);
+        r.reset();
+        std::lock_guard<std::mutex> lk(m);
+        consumed = i + 1;
+        if (!more) stop = true;
+        cv.notify_all();
+        if (stop) break;
+    }
+    {
+        std::lock_guard<std::mutex> lk(m);
+        stop = true;
+        cv.notify_all();
+    }
+    for (auto &t : threads) t.join();
+}
+
+void PandaLogIndexedReader::build_index(unsigned num_threads){
+    std::vector<uint32_t> chunks;
+    for (uint32_t i = 0; i < num_chunks(); i++) chunks.push_back(i);
+    this->index.assign(num_chunks(), PlChunkIndex());
+
+    pl_run_ordered<ChunkResult>(this->filename, chunks, num_threads,
+        [this](ifstream &f, uint32_t chunk, ChunkResult *res) {
+            load_chunk(f, chunk, NULL, res);
+            pandalog_index_chunk(res->buf, res->size, &this->index[chunk]);
+        },
+        [](uint32_t, ChunkResult &) { return true; });
+}
+
+bool PandaLogIndexedReader::load_index(const char *path){
+    ifstream f(path, ios::in|ios::binary);
+    if (f.fail()) return false;
+    uint32_t hdr[3];    // magic, version, num_chunks
+    uint64_t dir_pos;
+    f.read((char *) hdr, sizeof(hdr));
+    f.read((char *) &dir_pos, sizeof(dir_pos));
+    // make sure the index was built for this log
+    if (f.fail() || hdr[0] != PL_SIDECAR_MAGIC || hdr[1] != PL_SIDECAR_VERSION
+            || hdr[2] != num_chunks() || dir_pos != this->header.dir_pos) {
+        return false;
+    }
+    std::vector<PlChunkIndex> idx(hdr[2]);
+    f.read((char *) idx.data(), hdr[2] * sizeof(PlChunkIndex));
+    if ((size_t) f.gcount() != hdr[2] * sizeof(PlChunkIndex)) return false;
+    this->index.swap(idx);
+    return true;
+}
+
+bool PandaLogIndexedReader::save_index(const char *path) const {
+    ofstream f(path, ios::out|ios::binary);
+    if (f.fail()) return false;
+    uint32_t hdr[3] = { PL_SIDECAR_MAGIC, PL_SIDECAR_VERSION, num_chunks() };
+    f.write((const char *) hdr, sizeof(hdr));
+    f.write((const char *) &this->header.dir_pos, sizeof(this->header.dir_pos));
+    f.write((const char *) this->index.data(), this->index.size() * sizeof(PlChunkIndex));
+    return !f.fail();
+}
+
+uint64_t PandaLogIndexedReader::scan(const PlQuery &q,
+        const std::function<bool(const panda::LogEntry &)> &fn,
+        unsigned num_threads, uint32_t *chunks_read){
+    std::vector<uint32_t> chunks;
+    for (uint32_t i = 0; i < num_chunks(); i++) {
+        if (!has_index() || q.chunk_may_match(this->index[i])) {
+            chunks.push_back(i);
+        }
+    }
+    if (chunks_read) *chunks_read = chunks.size();
+
+    uint64_t num_matches = 0;
+    panda::LogEntry ple;
+    pl_run_ordered<ChunkResult>(this->filename, chunks, num_threads,
+        [this, &q](ifstream &f, uint32_t chunk, ChunkResult *res) {
+            load_chunk(f, chunk, &q, res);
+        },
+        [&](uint32_t, ChunkResult &res) {
+            bool more = true;
+            for (auto &m : res.matches) {
+                ple.Clear();
+                ple.ParseFromArray(res.buf + m.first, m.second);
+                num_matches++;
+                if (!fn(ple)) {
+                    more = false;
+                    break;
+                }
+            }
+            return more;
+        });
+    return num_matches;
+}
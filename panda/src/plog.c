@@ -58,6 +58,7 @@
 #include "panda/rr/rr_log.h"
 #endif
 
+#include <assert.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -68,6 +69,8 @@
 
 // Externed functions that are wrappers around the C++ pandalog functions
 extern void pandalog_write_packed(size_t entry_size, unsigned char* buf);
+extern void pandalog_cc_prog_point(uint64_t *pc, uint64_t *instr);
+extern unsigned char* pandalog_cc_reserve(size_t entry_size, uint64_t instr);
 extern unsigned char* pandalog_read_packed(void);
 extern void pandalog_cc_init_read(const char* path);
 extern void pandalog_cc_init_write(const char* path);
@@ -78,15 +81,76 @@ extern void pandalog_cc_close(void);
 void pandalog_open_read(const char *path, uint32_t pl_mode);
 
 
+/*
+  Entry builder arena.
+
+  Messages nested in an entry, repeated fields and strings are bump
+  allocated from a list of blocks owned by the thread. Writing an entry
+  rewinds the list, so the blocks are reused for the next entry and a
+  plugin emitting an entry per event does no heap allocation once the
+  arena has grown to the size of its largest entry.
+*/
+
+#define PL_ARENA_BLOCK_SIZE 65536
+#define PL_ARENA_ALIGN 16
+
+typedef struct PlArenaBlock {
+    struct PlArenaBlock *next;
+    size_t size;
+    size_t used;
+    unsigned char data[] __attribute__((aligned(PL_ARENA_ALIGN)));
+} PlArenaBlock;
+
+static __thread PlArenaBlock *pl_arena_head, *pl_arena_cur;
+
+void *pandalog_alloc(size_t size) {
+    size = (size + PL_ARENA_ALIGN - 1) & ~((size_t) PL_ARENA_ALIGN - 1);
+    PlArenaBlock *b = pl_arena_cur, *last = NULL;
+    while (b && b->used + size > b->size) {
+        last = b;
+        b = b->next;
+    }
+    if (b == NULL) {
+        size_t bsize = size > PL_ARENA_BLOCK_SIZE ? size : PL_ARENA_BLOCK_SIZE;
+        b = malloc(sizeof(PlArenaBlock) + bsize);
+        assert(b != NULL);
+        b->next = NULL;
+        b->size = bsize;
+        b->used = 0;
+        if (last) {
+            last->next = b;
+        } else {
+            pl_arena_head = b;
+        }
+    }
+    pl_arena_cur = b;
+    void *p = b->data + b->used;
+    b->used += size;
+    memset(p, 0, size);
+    return p;
+}
+
+char *pandalog_strdup(const char *s) {
+    size_t n = strlen(s) + 1;
+    return memcpy(pandalog_alloc(n), s, n);
+}
+
+void pandalog_arena_reset(void) {
+    for (PlArenaBlock *b = pl_arena_head; b != NULL; b = b->next) {
+        b->used = 0;
+    }
+    pl_arena_cur = pl_arena_head;
+}
+
 void pandalog_write_entry(Panda__LogEntry *entry) {
-	// Pack this entry and pass it on to a C++ interface
-		
+	// Pack this entry straight into the current chunk of the C++ pandalog
+	pandalog_cc_prog_point(&entry->pc, &entry->instr);
 	size_t packed_size = panda__log_entry__get_packed_size(entry);
-	unsigned char* buf = malloc(packed_size);
-	panda__log_entry__pack(entry, buf);
-
-	pandalog_write_packed(packed_size, buf);
-  free(buf);
+	unsigned char* buf = pandalog_cc_reserve(packed_size, entry->instr);
+	if (buf) {
+		panda__log_entry__pack(entry, buf);
+	}
+	pandalog_arena_reset();
 }
 
 void pandalog_open_read(const char *path, uint32_t pl_mode) {
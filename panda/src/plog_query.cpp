@@ -0,0 +1,122 @@
+/*
+ * Prints the entries of a pandalog that match a query, using the chunk index
+ * to skip chunks that can't match. See panda/plog-index.hpp.
+ *
+ * USAGE: plog_query [options] <plog>
+ *   -t type[,type...]  entries with one of these LogEntry fields
+ *                      (e.g. tainted_branch,tainted_instr)
+ *   -a asid            entries with this asid
+ *   -p lo-hi           entries with lo <= pc <= hi
+ *   -i lo-hi           entries with lo <= instr <= hi
+ *   -j threads         number of decompression threads (default 4)
+ *   -w                 save the index to <plog>.idx if the log has none
+ *   -c                 only count the matching entries
+ *
+ */
+
+#include <fstream>
+#include <string>
+#include <inttypes.h>
+#include <unistd.h>
+#include "panda/plog-index.hpp"
+
+/* plog-cc.cpp dependencies. See plog_reader.cpp. */
+
+int panda_in_main_loop = 0;
+struct CPUTailQ cpus;
+
+target_ulong panda_current_pc(CPUState *env) {
+    assert(false);
+}
+
+/* *** */
+
+static void usage(const char *prog) {
+    printf("USAGE: %s [-t type,...] [-a asid] [-p lo-hi] [-i lo-hi] "
+           "[-j threads] [-w] [-c] <plog>\n", prog);
+    exit(1);
+}
+
+static bool parse_range(const char *arg, uint64_t *lo, uint64_t *hi) {
+    char *end;
+    *lo = strtoull(arg, &end, 0);
+    if (*end != '-') return false;
+    *hi = strtoull(end + 1, &end, 0);
+    return *end == '\0' && *lo <= *hi;
+}
+
+int main (int argc, char **argv) {
+
+    memset(&cpus, 0, sizeof(cpus));
+
+    PlQuery q;
+    unsigned num_threads = 4;
+    bool save_index = false, count_only = false;
+    int c;
+    while ((c = getopt(argc, argv, "t:a:p:i:j:wc")) != -1) {
+        switch (c) {
+        case 't': {
+            std::string types(optarg);
+            size_t start = 0;
+            while (start <= types.size()) {
+                size_t end = types.find(',', start);
+                if (end == std::string::npos) end = types.size();
+                std::string name = types.substr(start, end - start);
+                if (!name.empty() && !q.add_field(name)) {
+                    fprintf(stderr, "unknown entry type %s\n", name.c_str());
+                    exit(1);
+                }
+                start = end + 1;
+            }
+            break;
+        }
+        case 'a':
+            q.has_asid = true;
+            q.asid = strtoull(optarg, NULL, 0);
+            break;
+        case 'p':
+            if (!parse_range(optarg, &q.min_pc, &q.max_pc)) usage(argv[0]);
+            break;
+        case 'i':
+            if (!parse_range(optarg, &q.min_instr, &q.max_instr)) usage(argv[0]);
+            break;
+        case 'j':
+            num_threads = atoi(optarg);
+            break;
+        case 'w':
+            save_index = true;
+            break;
+        case 'c':
+            count_only = true;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1) usage(argv[0]);
+
+    const char *plog = argv[optind];
+    std::string sidecar = std::string(plog) + ".idx";
+    PandaLogIndexedReader r;
+    if (!r.open(plog)) {
+        fprintf(stderr, "couldn't read pandalog %s\n", plog);
+        exit(1);
+    }
+    if (!r.has_embedded_index() && !r.load_index(sidecar.c_str())) {
+        fprintf(stderr, "%s has no index, building it\n", plog);
+        r.build_index(num_threads);
+        if (save_index && !r.save_index(sidecar.c_str())) {
+            fprintf(stderr, "couldn't write %s\n", sidecar.c_str());
+        }
+    }
+
+    uint32_t chunks_read;
+    uint64_t n = r.scan(q, [count_only](const panda::LogEntry &ple) {
+            if (!count_only) printf("%s\n", ple.ShortDebugString().c_str());
+            return true;
+        }, num_threads, &chunks_read);
+
+    fprintf(stderr, "%" PRIu64 " matching entries, read %u of %u chunks\n",
+            n, chunks_read, r.num_chunks());
+    if (count_only) printf("%" PRIu64 "\n", n);
+}
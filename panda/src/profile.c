@@ -0,0 +1,238 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <glib.h>
+
+#include "panda/plugin.h"
+#include "panda/profile.h"
+#include "qemu/timer.h"
+#include "qemu/atomic.h"
+#include "qemu/rcu.h"
+
+#ifdef CONFIG_SOFTMMU
+#include "qapi/qmp/qdict.h"
+#include "qmp-commands.h"
+#include "hmp.h"
+#include "qapi/error.h"
+#include "monitor/monitor.h"
+#endif
+
+extern int nb_panda_plugins;
+extern panda_plugin panda_plugins[MAX_PANDA_PLUGINS];
+
+bool panda_profiling = false;
+panda_prof_counter panda_prof_sections[PANDA_PROF_LAST];
+
+static const char *panda_cb_type_names[PANDA_CB_LAST] = {
+    [PANDA_CB_BEFORE_BLOCK_TRANSLATE] = "before_block_translate",
+    [PANDA_CB_AFTER_BLOCK_TRANSLATE] = "after_block_translate",
+    [PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] = "before_block_exec_invalidate_opt",
+    [PANDA_CB_BEFORE_BLOCK_EXEC] = "before_block_exec",
+    [PANDA_CB_AFTER_BLOCK_EXEC] = "after_block_exec",
+    [PANDA_CB_INSN_TRANSLATE] = "insn_translate",
+    [PANDA_CB_INSN_EXEC] = "insn_exec",
+    [PANDA_CB_AFTER_INSN_TRANSLATE] = "after_insn_translate",
+    [PANDA_CB_AFTER_INSN_EXEC] = "after_insn_exec",
+    [PANDA_CB_VIRT_MEM_BEFORE_READ] = "virt_mem_before_read",
+    [PANDA_CB_VIRT_MEM_BEFORE_WRITE] = "virt_mem_before_write",
+    [PANDA_CB_PHYS_MEM_BEFORE_READ] = "phys_mem_before_read",
+    [PANDA_CB_PHYS_MEM_BEFORE_WRITE] = "phys_mem_before_write",
+    [PANDA_CB_VIRT_MEM_AFTER_READ] = "virt_mem_after_read",
+    [PANDA_CB_VIRT_MEM_AFTER_WRITE] = "virt_mem_after_write",
+    [PANDA_CB_PHYS_MEM_AFTER_READ] = "phys_mem_after_read",
+    [PANDA_CB_PHYS_MEM_AFTER_WRITE] = "phys_mem_after_write",
+    [PANDA_CB_HD_READ] = "hd_read",
+    [PANDA_CB_HD_WRITE] = "hd_write",
+    [PANDA_CB_GUEST_HYPERCALL] = "guest_hypercall",
+    [PANDA_CB_MONITOR] = "monitor",
+    [PANDA_CB_CPU_RESTORE_STATE] = "cpu_restore_state",
+    [PANDA_CB_BEFORE_REPLAY_LOADVM] = "before_replay_loadvm",
+    [PANDA_CB_ASID_CHANGED] = "asid_changed",
+    [PANDA_CB_REPLAY_HD_TRANSFER] = "replay_hd_transfer",
+    [PANDA_CB_REPLAY_NET_TRANSFER] = "replay_net_transfer",
+    [PANDA_CB_REPLAY_BEFORE_DMA] = "replay_before_dma",
+    [PANDA_CB_REPLAY_AFTER_DMA] = "replay_after_dma",
+    [PANDA_CB_REPLAY_HANDLE_PACKET] = "replay_handle_packet",
+    [PANDA_CB_AFTER_MACHINE_INIT] = "after_machine_init",
+    [PANDA_CB_TOP_LOOP] = "top_loop",
+};
+
+static const char *panda_prof_section_names[PANDA_PROF_LAST] = {
+    [PANDA_PROF_LLVM_TRANSLATE] = "llvm_translate",
+    [PANDA_PROF_TAINT] = "taint_ops",
+    [PANDA_PROF_RR_LOG] = "rr_log_io",
+};
+
+typedef void (*panda_prof_emit_fn)(void *opaque, const char *owner,
+                                   const char *what, uint64_t count,
+                                   uint64_t cycles);
+
+/*
+ * Walks the callback lists and sections, emitting one record per
+ * (plugin, callback type) pair that has been invoked. If plugin is not
+ * NULL, only the callbacks of that plugin are reported.
+ */
+static void panda_profile_collect(void *plugin, panda_prof_emit_fn emit,
+                                  void *opaque) {
+    for (int i = 0; i < nb_panda_plugins; i++) {
+        if (plugin && panda_plugins[i].plugin != plugin) continue;
+        for (int type = 0; type < PANDA_CB_LAST; type++) {
+            uint64_t count = 0, cycles = 0;
+            // Walk the raw list: disabled callbacks may have run earlier.
+            rcu_read_lock();
+            for (panda_cb_list *plist = atomic_rcu_read(&panda_cbs[type]);
+                 plist != NULL; plist = atomic_rcu_read(&plist->next)) {
+                if (plist->owner == panda_plugins[i].plugin) {
+                    count += plist->prof_count;
+                    cycles += plist->prof_cycles;
+                }
+            }
+            rcu_read_unlock();
+            if (count > 0) {
+                emit(opaque, panda_plugins[i].name, panda_cb_type_names[type],
+                     count, cycles);
+            }
+        }
+    }
+    if (plugin) return;
+    for (int s = 0; s < PANDA_PROF_LAST; s++) {
+        if (panda_prof_sections[s].count > 0) {
+            emit(opaque, PANDA_CORE_NAME, panda_prof_section_names[s],
+                 panda_prof_sections[s].count, panda_prof_sections[s].cycles);
+        }
+    }
+}
+
+void panda_enable_profiling(void) {
+    panda_profiling = true;
+}
+
+void panda_disable_profiling(void) {
+    panda_profiling = false;
+    for (int s = 0; s < PANDA_PROF_LAST; s++) {
+        panda_prof_sections[s].depth = 0;
+    }
+}
+
+void panda_profile_reset(void) {
+    rcu_read_lock();
+    for (int type = 0; type < PANDA_CB_LAST; type++) {
+        for (panda_cb_list *plist = atomic_rcu_read(&panda_cbs[type]);
+             plist != NULL; plist = atomic_rcu_read(&plist->next)) {
+            plist->prof_count = 0;
+            plist->prof_cycles = 0;
+        }
+    }
+    rcu_read_unlock();
+    for (int s = 0; s < PANDA_PROF_LAST; s++) {
+        panda_prof_sections[s].count = 0;
+        panda_prof_sections[s].cycles = 0;
+    }
+}
+
+void panda_profile_init(void) {
+    panda_arg_list *args = panda_get_args("general");
+    if (panda_parse_bool_opt(args, "profile", "profile callback and core costs")) {
+        fprintf(stderr, PANDA_MSG_FMT "callback profiling enabled\n", PANDA_CORE_NAME);
+        panda_enable_profiling();
+    }
+    panda_free_args(args);
+}
+
+void panda_prof_enter(panda_prof_section section) {
+    panda_prof_counter *c = &panda_prof_sections[section];
+    if (c->depth++ == 0) {
+        c->start = cpu_get_host_ticks();
+    }
+}
+
+void panda_prof_exit(panda_prof_section section) {
+    panda_prof_counter *c = &panda_prof_sections[section];
+    // Profiling may have been switched on in the middle of a section.
+    if (c->depth == 0) return;
+    if (--c->depth == 0) {
+        c->cycles += cpu_get_host_ticks() - c->start;
+        c->count++;
+    }
+}
+
+static void panda_profile_emit_file(void *opaque, const char *owner,
+                                    const char *what, uint64_t count,
+                                    uint64_t cycles) {
+    fprintf((FILE *)opaque, "%-20s%-36s%16" PRIu64 "%20" PRIu64 "%12" PRIu64 "\n",
+            owner, what, count, cycles, cycles / count);
+}
+
+void panda_profile_dump(FILE *out, void *plugin) {
+    fprintf(out, "%-20s%-36s%16s%20s%12s\n",
+            "PLUGIN", "CALLBACK", "COUNT", "CYCLES", "CYC/CALL");
+    panda_profile_collect(plugin, panda_profile_emit_file, out);
+}
+
+#ifdef CONFIG_SOFTMMU
+
+// QMP
+
+static void panda_profile_emit_qmp(void *opaque, const char *owner,
+                                   const char *what, uint64_t count,
+                                   uint64_t cycles) {
+    PandaProfileEntryList **head = opaque;
+    PandaProfileEntryList *list_item = g_new0(typeof(*list_item), 1);
+    PandaProfileEntry *entry = g_new0(typeof(*entry), 1);
+
+    entry->plugin = g_strdup(owner);
+    entry->callback = g_strdup(what);
+    entry->count = count;
+    entry->cycles = cycles;
+
+    list_item->value = entry;
+    list_item->next = *head;
+    *head = list_item;
+}
+
+PandaProfileEntryList *qmp_panda_profile(bool has_reset, bool reset, Error **errp) {
+    PandaProfileEntryList *head = NULL;
+    panda_profile_collect(NULL, panda_profile_emit_qmp, &head);
+    if (has_reset && reset) {
+        panda_profile_reset();
+    }
+    return head;
+}
+
+void qmp_panda_profile_enable(bool enable, Error **errp) {
+    if (enable) {
+        panda_enable_profiling();
+    } else {
+        panda_disable_profiling();
+    }
+}
+
+// HMP
+void hmp_panda_profile(Monitor *mon, const QDict *qdict) {
+    Error *err = NULL;
+    const char *action = qdict_get_try_str(qdict, "action");
+
+    if (action == NULL) {
+        PandaProfileEntryList *entry = qmp_panda_profile(false, false, &err);
+        PandaProfileEntryList *head = entry;
+        monitor_printf(mon, "profiling %s\n", PANDA_FLAG_STATUS(panda_profiling));
+        monitor_printf(mon, "%-20s%-36s%16s%20s\n",
+                       "plugin", "callback", "count", "cycles");
+        while (entry != NULL) {
+            monitor_printf(mon, "%-20s%-36s%16" PRId64 "%20" PRId64 "\n",
+                           entry->value->plugin, entry->value->callback,
+                           entry->value->count, entry->value->cycles);
+            entry = entry->next;
+        }
+        qapi_free_PandaProfileEntryList(head);
+    } else if (strcmp(action, "on") == 0) {
+        qmp_panda_profile_enable(true, &err);
+    } else if (strcmp(action, "off") == 0) {
+        qmp_panda_profile_enable(false, &err);
+    } else if (strcmp(action, "reset") == 0) {
+        panda_profile_reset();
+    } else {
+        monitor_printf(mon, "unknown action %s (expected on, off or reset)\n", action);
+    }
+}
+
+#endif // CONFIG_SOFTMMU
@@ -52,6 +52,7 @@
 #include "io/channel-file.h"
 #include "sysemu/sysemu.h"
 #include "panda/callback_support.h"
+#include "panda/profile.h"
 /******************************************************************************************/
 /* GLOBALS */
 /******************************************************************************************/
@@ -260,7 +261,9 @@ static inline void rr_assert_fail(const char* exp, const char* file, int line,
 /******************************************************************************************/
 
 static inline size_t rr_fwrite(void *ptr, size_t size, size_t nmemb) {
+    PANDA_PROF_BEGIN(PANDA_PROF_RR_LOG);
     size_t result = fwrite(ptr, size, nmemb, rr_nondet_log->fp);
+    PANDA_PROF_END(PANDA_PROF_RR_LOG);
     rr_assert(result == nmemb);
     return result;
 }
@@ -613,7 +616,9 @@ static inline void free_entry_params(RR_log_entry* entry)
 }
 
 static inline size_t rr_fread(void *ptr, size_t size, size_t nmemb) {
+    PANDA_PROF_BEGIN(PANDA_PROF_RR_LOG);
     size_t result = fread(ptr, size, nmemb, rr_nondet_log->fp);
+    PANDA_PROF_END(PANDA_PROF_RR_LOG);
     rr_nondet_log->bytes_read += nmemb * size;
     rr_assert(result == nmemb);
     return result;
@@ -4138,6 +4138,10 @@ DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
 
+DEF("pandalog-opts", HAS_ARG, QEMU_OPTION_pandalog_opts,
+    "-pandalog-opts [codec=zlib|zstd|lz4][,level=n][,threads=n]\n"
+    "                set pandalog chunk compression\n", QEMU_ARCH_ALL)
+
 DEF("panda-plugin", HAS_ARG, QEMU_OPTION_panda_plugin,
     "-panda-plugin <file>\n"
     "                load PANDA plugin from <file>\n", QEMU_ARCH_ALL)
@@ -1215,6 +1215,7 @@ static void disas_uncond_b_imm(DisasContext *s, uint32_t insn)
     if (insn & (1U << 31)) {
         /* C5.6.26 BL Branch with link */
         tcg_gen_movi_i64(cpu_reg(s, 30), s->pc);
+        s->tb->panda_call_type = PANDA_TB_CALL;
     }
 
     /* C5.6.20 B Branch / C5.6.26 BL Branch with link */
@@ -1768,6 +1769,9 @@ static void disas_uncond_b_reg(DisasContext *s, uint32_t insn)
         /* BLR also needs to load return address */
         if (opc == 1) {
             tcg_gen_movi_i64(cpu_reg(s, 30), s->pc);
+            s->tb->panda_call_type = PANDA_TB_CALL;
+        } else if (opc == 2) {
+            s->tb->panda_call_type = PANDA_TB_RET;
         }
         break;
     case 4: /* ERET */
@@ -8142,6 +8142,7 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
             val += 4;
             /* protected by ARCH(5); above, near the start of uncond block */
             gen_bx_im(s, val);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             return;
         } else if ((insn & 0x0e000f00) == 0x0c000100) {
             if (arm_dc_feature(s, ARM_FEATURE_IWMMXT)) {
@@ -8279,6 +8280,9 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
                 ARCH(4T);
                 tmp = load_reg(s, rm);
                 gen_bx(s, tmp);
+                if (rm == 14) {
+                    s->tb->panda_call_type = PANDA_TB_RET;
+                }
             } else if (op1 == 3) {
                 /* clz */
                 ARCH(5);
@@ -8311,6 +8315,7 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
             tcg_gen_movi_i32(tmp2, s->pc);
             store_reg(s, 14, tmp2);
             gen_bx(s, tmp);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             break;
         case 0x4:
         {
@@ -9302,6 +9307,9 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
             if (insn & (1 << 20)) {
                 /* Complete the load.  */
                 store_reg_from_load(s, rd, tmp);
+                if (rd == 15 && rn == 13) {
+                    s->tb->panda_call_type = PANDA_TB_RET;
+                }
             }
             break;
         case 0x08:
@@ -9430,6 +9438,8 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
                     gen_helper_cpsr_write_eret(cpu_env, tmp);
                     tcg_temp_free_i32(tmp);
                     s->is_jmp = DISAS_JUMP;
+                } else if (is_load && (insn & (1 << 15)) && rn == 13) {
+                    s->tb->panda_call_type = PANDA_TB_RET;
                 }
             }
             break;
@@ -9444,6 +9454,7 @@ static void disas_arm_insn(DisasContext *s, unsigned int insn)
                     tmp = tcg_temp_new_i32();
                     tcg_gen_movi_i32(tmp, val);
                     store_reg(s, 14, tmp);
+                    s->tb->panda_call_type = PANDA_TB_CALL;
                 }
                 offset = sextract32(insn << 2, 0, 26);
                 val += offset + 4;
@@ -9594,6 +9605,7 @@ static int disas_thumb2_insn(CPUARMState *env, DisasContext *s, uint16_t insn_hw
             tcg_gen_movi_i32(tmp2, s->pc | 1);
             store_reg(s, 14, tmp2);
             gen_bx(s, tmp);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             return 0;
         }
         if (insn & (1 << 11)) {
@@ -9606,6 +9618,7 @@ static int disas_thumb2_insn(CPUARMState *env, DisasContext *s, uint16_t insn_hw
             tcg_gen_movi_i32(tmp2, s->pc | 1);
             store_reg(s, 14, tmp2);
             gen_bx(s, tmp);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             return 0;
         }
         if ((s->pc & ~TARGET_PAGE_MASK) == 0) {
@@ -9849,6 +9862,9 @@ static int disas_thumb2_insn(CPUARMState *env, DisasContext *s, uint16_t insn_hw
                         gen_aa32_ld32u(s, tmp, addr, get_mem_index(s));
                         if (i == 15) {
                             gen_bx(s, tmp);
+                            if (rn == 13) {
+                                s->tb->panda_call_type = PANDA_TB_RET;
+                            }
                         } else if (i == rn) {
                             loaded_var = tmp;
                             loaded_base = 1;
@@ -10349,6 +10365,7 @@ static int disas_thumb2_insn(CPUARMState *env, DisasContext *s, uint16_t insn_hw
                 if (insn & (1 << 14)) {
                     /* Branch and link.  */
                     tcg_gen_movi_i32(cpu_R[14], s->pc | 1);
+                    s->tb->panda_call_type = PANDA_TB_CALL;
                 }
 
                 offset += s->pc;
@@ -10856,6 +10873,9 @@ static int disas_thumb2_insn(CPUARMState *env, DisasContext *s, uint16_t insn_hw
             }
             if (rs == 15) {
                 gen_bx(s, tmp);
+                if (rn == 13) {
+                    s->tb->panda_call_type = PANDA_TB_RET;
+                }
             } else {
                 store_reg(s, rs, tmp);
             }
@@ -11045,6 +11065,9 @@ static void disas_thumb_insn(CPUARMState *env, DisasContext *s)
                     tmp2 = tcg_temp_new_i32();
                     tcg_gen_movi_i32(tmp2, val);
                     store_reg(s, 14, tmp2);
+                    s->tb->panda_call_type = PANDA_TB_CALL;
+                } else if (rm == 14) {
+                    s->tb->panda_call_type = PANDA_TB_RET;
                 }
                 /* already thumb, no need to check */
                 gen_bx(s, tmp);
@@ -11408,6 +11431,7 @@ static void disas_thumb_insn(CPUARMState *env, DisasContext *s)
             if (insn & (1 << 8)) {
                 if (insn & (1 << 11)) {
                     /* pop pc */
+                    s->tb->panda_call_type = PANDA_TB_RET;
                     tmp = tcg_temp_new_i32();
                     gen_aa32_ld32u(s, tmp, addr, get_mem_index(s));
                     /* don't set the pc until the rest of the instruction
@@ -4974,6 +4974,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
             gen_op_jmp_v(cpu_T0);
             gen_bnd_jmp(s);
             gen_eob(s);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             break;
         case 3: /* lcall Ev */
             gen_op_ld_v(s, ot, cpu_T1, cpu_A0);
@@ -4992,6 +4993,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
                                       tcg_const_i32(s->pc - s->cs_base));
             }
             gen_eob(s);
+            s->tb->panda_call_type = PANDA_TB_CALL;
             break;
         case 4: /* jmp Ev */
             if (dflag == MO_16) {
@@ -6395,6 +6397,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
         gen_op_jmp_v(cpu_T0);
         gen_bnd_jmp(s);
         gen_eob(s);
+        s->tb->panda_call_type = PANDA_TB_RET;
         break;
     case 0xc3: /* ret */
         ot = gen_pop_T0(s);
@@ -6403,6 +6406,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
         gen_op_jmp_v(cpu_T0);
         gen_bnd_jmp(s);
         gen_eob(s);
+        s->tb->panda_call_type = PANDA_TB_RET;
         break;
     case 0xca: /* lret im */
         val = cpu_ldsw_code(env, s->pc);
@@ -6428,6 +6432,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
             gen_stack_update(s, val + (2 << dflag));
         }
         gen_eob(s);
+        s->tb->panda_call_type = PANDA_TB_RET;
         break;
     case 0xcb: /* lret */
         val = 0;
@@ -6470,6 +6475,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
             gen_push_v(s, cpu_T0);
             gen_bnd_jmp(s);
             gen_jmp(s, tval);
+            s->tb->panda_call_type = PANDA_TB_CALL;
         }
         break;
     case 0x9a: /* lcall im */
@@ -6484,6 +6490,7 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
 
             tcg_gen_movi_tl(cpu_T0, selector);
             tcg_gen_movi_tl(cpu_T1, offset);
+            s->tb->panda_call_type = PANDA_TB_CALL;
         }
         goto do_lcall;
     case 0xe9: /* jmp im */
@@ -77,6 +77,7 @@
 
 #include "panda/rr/rr_log.h"
 #include "panda/callback_support.h"
+#include "panda/profile.h"
 
 /* #define DEBUG_TB_INVALIDATE */
 /* #define DEBUG_TB_FLUSH */
@@ -1167,6 +1168,42 @@ void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
     tcg_ctx.tb_ctx.tb_phys_invalidate_count++;
 }
 
+static void
+do_tb_collect_filtered(struct qht *ht, void *p, uint32_t hash, void *userp)
+{
+    TranslationBlock *tb = p;
+    void **args = userp;
+    bool (*filter)(TranslationBlock *tb, void *opaque) = args[0];
+
+    if (filter(tb, args[1])) {
+        g_ptr_array_add(args[2], tb);
+    }
+}
+
+/* invalidate every TB for which filter returns true, keeping the rest of
+ * the code cache. Returns the number of invalidated TBs.
+ *
+ * Called with tb_lock held.
+ */
+int tb_invalidate_filtered(bool (*filter)(TranslationBlock *tb, void *opaque),
+                           void *opaque)
+{
+    GPtrArray *tbs = g_ptr_array_new();
+    void *args[3] = { filter, opaque, tbs };
+    int i, n;
+
+    assert_tb_locked();
+
+    /* qht_iter holds the bucket locks, so collect before removing */
+    qht_iter(&tcg_ctx.tb_ctx.htable, do_tb_collect_filtered, args);
+    for (i = 0; i < tbs->len; i++) {
+        tb_phys_invalidate(g_ptr_array_index(tbs, i), -1);
+    }
+    n = tbs->len;
+    g_ptr_array_free(tbs, true);
+    return n;
+}
+
 #ifdef CONFIG_SOFTMMU
 static void build_page_bitmap(PageDesc *p)
 {
@@ -1334,7 +1371,9 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     tcg_func_start(&tcg_ctx);
 
     tcg_ctx.cpu = ENV_GET_CPU(env);
+    panda_tb_translate_begin(cpu, tb);
     gen_intermediate_code(env, tb);
+    panda_tb_translate_end(cpu, tb);
     tcg_ctx.cpu = NULL;
 
     trace_translate_block(tb, tb->pc, tb->tc_ptr);
@@ -1365,8 +1404,11 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     gen_code_size = tcg_gen_code(&tcg_ctx, tb);
 
 #if defined(CONFIG_LLVM)
-    if (generate_llvm)
+    if (generate_llvm) {
+        PANDA_PROF_BEGIN(PANDA_PROF_LLVM_TRANSLATE);
         tcg_llvm_gen_code(tcg_llvm_ctx, &tcg_ctx, tb);
+        PANDA_PROF_END(PANDA_PROF_LLVM_TRANSLATE);
+    }
 #endif
 
     if (unlikely(gen_code_size < 0)) {
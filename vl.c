@@ -149,8 +149,10 @@ extern void panda_unload_plugins(void);
 extern char *panda_plugin_path(const char *name);
 void panda_set_os_name(char *os_name);
 extern void panda_callbacks_after_machine_init(void);
+extern void panda_profile_init(void);
 
 extern void pandalog_cc_init_write(const char * fname); 
+extern bool pandalog_cc_set_opts(const char *opts);
 int pandalog = 0;
 int panda_in_main_loop = 0;
 extern bool panda_abort_requested;
@@ -4176,6 +4178,11 @@ int main(int argc, char **argv, char **envp)
                 pandalog_cc_init_write(optarg);
                 printf ("pandalogging to [%s]\n", optarg);
                 break;
+            case QEMU_OPTION_pandalog_opts:
+                if (!pandalog_cc_set_opts(optarg)) {
+                    exit(1);
+                }
+                break;
             case QEMU_OPTION_record_from:
                 record_name = optarg;
                 break;
@@ -4264,6 +4271,8 @@ int main(int argc, char **argv, char **envp)
     if (panda_abort_requested)
         exit(0);
 
+    panda_profile_init();
+
     replay_configure(icount_opts);
 
     qemu_tcg_configure(accel_opts, &error_fatal);